@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MPSCQueue.h"
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+namespace {
+struct Message {
+    int Value{};
+};
+} // namespace
+
+static void BM_MPSCQueueEnqueueDequeue(benchmark::State& state)
+{
+    std::size_t const count = std::size_t(state.range(0));
+
+    std::vector<Message> messages(count);
+    MPSCQueue<Message>   queue;
+
+    for (auto _ : state) {
+        for (Message& message : messages)
+            queue.Enqueue(&message);
+
+        Message* result = nullptr;
+        while (queue.Dequeue(result))
+            benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations() * count));
+}
+BENCHMARK(BM_MPSCQueueEnqueueDequeue)->Arg(64)->Arg(4096);
+
+static void BM_MPSCQueueProducers(benchmark::State& state)
+{
+    static MPSCQueue<Message> queue;
+    static Message            message;
+
+    for (auto _ : state) {
+        queue.Enqueue(&message);
+
+        // the single consumer drains what every producer thread added
+        if (state.thread_index() == 0) {
+            Message* result = nullptr;
+            while (queue.Dequeue(result))
+                benchmark::DoNotOptimize(result);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPSCQueueProducers)->ThreadRange(1, 8);
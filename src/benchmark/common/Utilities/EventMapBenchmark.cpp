@@ -0,0 +1,51 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "benchmark/benchmark.h"
+
+// a boss script: a handful of repeating events polled every update
+static void BM_EventMapUpdate(benchmark::State& state)
+{
+    uint32 const eventCount = uint32(state.range(0));
+
+    EventMap events;
+    for (uint32 eventId = 1; eventId <= eventCount; ++eventId)
+        events.ScheduleEvent(eventId, eventId * 100);
+
+    for (auto _ : state) {
+        events.Update(50);
+        while (uint32 eventId = events.ExecuteEvent())
+            events.ScheduleEvent(eventId, eventId * 100);
+    }
+}
+BENCHMARK(BM_EventMapUpdate)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_EventMapReschedule(benchmark::State& state)
+{
+    EventMap events;
+    for (uint32 eventId = 1; eventId <= 16; ++eventId)
+        events.ScheduleEvent(eventId, eventId * 100);
+
+    uint32 eventId = 0;
+    for (auto _ : state) {
+        eventId = eventId % 16 + 1;
+        events.RescheduleEvent(eventId, eventId * 100);
+    }
+}
+BENCHMARK(BM_EventMapReschedule);
@@ -0,0 +1,35 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Duration.h"
+#include "TaskScheduler.h"
+#include "benchmark/benchmark.h"
+
+static void BM_TaskSchedulerUpdate(benchmark::State& state)
+{
+    std::size_t const taskCount = std::size_t(state.range(0));
+
+    TaskScheduler scheduler;
+    for (std::size_t i = 1; i <= taskCount; ++i)
+        scheduler.Schedule(Milliseconds(i * 100),
+                           [](TaskContext context) { context.Repeat(); });
+
+    for (auto _ : state)
+        scheduler.Update(50);
+}
+BENCHMARK(BM_TaskSchedulerUpdate)->Arg(4)->Arg(16)->Arg(64);
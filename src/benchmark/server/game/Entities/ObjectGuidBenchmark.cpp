@@ -0,0 +1,54 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectGuid.h"
+#include "benchmark/benchmark.h"
+
+#include <unordered_set>
+#include <vector>
+
+static void BM_ObjectGuidSetFind(benchmark::State& state)
+{
+    std::size_t const count = std::size_t(state.range(0));
+
+    std::vector<ObjectGuid>        guids;
+    std::unordered_set<ObjectGuid> set;
+    guids.reserve(count);
+    for (std::size_t i = 1; i <= count; ++i) {
+        guids.emplace_back(HighGuid::Unit, 1000 + uint32(i % 7), uint32(i));
+        set.insert(guids.back());
+    }
+
+    for (auto _ : state)
+        for (ObjectGuid const& guid : guids)
+            benchmark::DoNotOptimize(set.find(guid));
+
+    state.SetItemsProcessed(int64_t(state.iterations() * count));
+}
+BENCHMARK(BM_ObjectGuidSetFind)->Arg(256)->Arg(65536);
+
+static void BM_ObjectGuidPacked(benchmark::State& state)
+{
+    ObjectGuid const guid(HighGuid::Player, ObjectGuid::LowType(123456));
+
+    for (auto _ : state) {
+        PackedGuid packed(guid);
+        benchmark::DoNotOptimize(packed.size());
+    }
+}
+BENCHMARK(BM_ObjectGuidPacked);
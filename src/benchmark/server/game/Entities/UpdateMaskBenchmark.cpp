@@ -0,0 +1,40 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ByteBuffer.h"
+#include "UpdateFields.h"
+#include "UpdateMask.h"
+#include "benchmark/benchmark.h"
+
+// a values update of a player touching every Nth field
+static void BM_UpdateMaskBuild(benchmark::State& state)
+{
+    uint32 const stride = uint32(state.range(0));
+
+    for (auto _ : state) {
+        UpdateMask mask;
+        mask.SetCount(PLAYER_END);
+        for (uint32 index = 0; index < PLAYER_END; index += stride)
+            mask.SetBit(index);
+
+        ByteBuffer data(mask.GetBlockCount() * 4 + 1);
+        mask.AppendToPacket(&data);
+        benchmark::DoNotOptimize(data.contents());
+    }
+}
+BENCHMARK(BM_UpdateMaskBuild)->Arg(1)->Arg(16)->Arg(256);
@@ -0,0 +1,63 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ByteBuffer.h"
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+static void BM_ByteBufferWrite(benchmark::State& state)
+{
+    std::size_t const count = std::size_t(state.range(0));
+    std::string const name  = "Benchmarkname";
+
+    for (auto _ : state) {
+        ByteBuffer buffer(count * 24);
+        for (std::size_t i = 0; i < count; ++i)
+            buffer << uint32(i) << uint64(i) << float(i) << name;
+
+        benchmark::DoNotOptimize(buffer.contents());
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations() * count));
+}
+BENCHMARK(BM_ByteBufferWrite)->Arg(16)->Arg(1024);
+
+static void BM_ByteBufferRead(benchmark::State& state)
+{
+    std::size_t const count = std::size_t(state.range(0));
+
+    ByteBuffer buffer(count * 24);
+    for (std::size_t i = 0; i < count; ++i)
+        buffer << uint32(i) << uint64(i) << float(i) << "Benchmarkname";
+
+    for (auto _ : state) {
+        buffer.rpos(0);
+        for (std::size_t i = 0; i < count; ++i) {
+            uint32      u32;
+            uint64      u64;
+            float       f;
+            std::string str;
+            buffer >> u32 >> u64 >> f >> str;
+            benchmark::DoNotOptimize(u64);
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations() * count));
+}
+BENCHMARK(BM_ByteBufferRead)->Arg(16)->Arg(1024);
@@ -279,6 +279,86 @@ public:
         }
     }
 
+    // Calls intersectCallback(object) for every object whose node overlaps
+    // the box [lo, hi], stops as soon as the callback returns true
+    template <typename AreaCallback>
+    void intersectArea(const G3D::Vector3& lo,
+                       const G3D::Vector3& hi,
+                       AreaCallback&       intersectCallback) const
+    {
+        for (int i = 0; i < 3; ++i)
+            if (bounds.low()[i] > hi[i] || bounds.high()[i] < lo[i])
+                return;
+
+        StackNode stack[MAX_STACK_SIZE];
+        int       stackPos = 0;
+        int       node     = 0;
+
+        while (true) {
+            while (true) {
+                uint32 tn = tree[node];
+                uint32 axis =
+                    (tn & (3 << 30)) >> 30; // cppcheck-suppress integerOverflow
+                bool BVH2 = tn & (1 << 29); // cppcheck-suppress integerOverflow
+                int  offset =
+                    tn & ~(7 << 29); // cppcheck-suppress integerOverflow
+                if (!BVH2) {
+                    if (axis < 3) {
+                        // "normal" interior node
+                        float tl    = intBitsToFloat(tree[node + 1]);
+                        float tr    = intBitsToFloat(tree[node + 2]);
+                        bool  left  = lo[axis] <= tl;
+                        bool  right = hi[axis] >= tr;
+                        if (!left && !right) {
+                            break;
+                        }
+
+                        if (left && right) {
+                            stack[stackPos].node = offset + 3;
+                            stackPos++;
+                        }
+
+                        node = left ? offset : offset + 3;
+                        continue;
+                    }
+                    else {
+                        // leaf - test some objects
+                        int n = tree[node + 1];
+                        while (n > 0) {
+                            if (intersectCallback(objects[offset])) {
+                                return;
+                            }
+                            --n;
+                            ++offset;
+                        }
+                        break;
+                    }
+                }
+                else // BVH2 node (empty space cut off left and right)
+                {
+                    if (axis > 2) {
+                        return; // should not happen
+                    }
+                    float tl = intBitsToFloat(tree[node + 1]);
+                    float tr = intBitsToFloat(tree[node + 2]);
+                    node     = offset;
+                    if (tl > hi[axis] || tr < lo[axis]) {
+                        break;
+                    }
+                    continue;
+                }
+            } // traversal loop
+
+            // stack is empty?
+            if (stackPos == 0) {
+                return;
+            }
+            // move back up the stack
+            stackPos--;
+            node = stack[stackPos].node;
+        }
+    }
+
     template <typename IsectCallback>
     void intersectPoint(const G3D::Vector3& p,
                         IsectCallback&      intersectCallback) const
@@ -112,6 +112,8 @@ public:
         m_tree.build(m_objects, BoundsFunc::GetBounds2);
     }
 
+    [[nodiscard]] bool isBalanced() const { return unbalanced_times == 0; }
+
     template <typename RayCallback>
     void intersectRay(const G3D::Ray& ray,
                       RayCallback&    intersectCallback,
@@ -177,6 +177,13 @@ public:
                                       float              z,
                                       uint8              reqLiquidType,
                                       AreaAndLiquidData& data) const = 0;
+    // true if a loaded WMO overlaps the rectangle, positions outside of all
+    // WMOs have no vmap area or liquid info at any height
+    [[nodiscard]] virtual bool HasWMOInArea(uint32 mapId,
+                                            float  minX,
+                                            float  minY,
+                                            float  maxX,
+                                            float  maxY) const = 0;
 };
 } // namespace VMAP
 
@@ -21,17 +21,31 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <mutex>
 
 namespace MMAP {
 static char const* const MAP_FILE_NAME_FORMAT  = "%s/mmaps/%03i.mmap";
 static char const* const TILE_FILE_NAME_FORMAT = "%s/mmaps/%03i%02i%02i.mmtile";
 
+namespace {
+// last query handed out on this thread, map threads keep asking for the same
+// instance so most lookups never touch navMeshQueriesLock
+struct CachedNavMeshQuery {
+    MMapData const* Data       = nullptr;
+    uint32          InstanceId = 0;
+    uint32          Generation = 0;
+    dtNavMeshQuery* Query      = nullptr;
+};
+
+thread_local CachedNavMeshQuery LastNavMeshQuery;
+} // namespace
+
 // ######################## MMapMgr ########################
 MMapMgr::~MMapMgr()
 {
     for (MMapDataSet::iterator i = loadedMMaps.begin(); i != loadedMMaps.end();
          ++i) {
-        delete i->second;
+        delete i->second.load();
     }
 
     // by now we should not have maps loaded
@@ -44,6 +58,7 @@ void MMapMgr::InitializeThreadUnsafe(const std::vector<uint32>& mapIds)
     // VMapMgr2 lifetime
     for (const uint32& mapId : mapIds) {
         loadedMMaps.emplace(mapId, nullptr);
+        tileGenerations.try_emplace(mapId, 0);
     }
 
     thread_safe_environment = false;
@@ -53,7 +68,8 @@ MMapDataSet::const_iterator MMapMgr::GetMMapData(uint32 mapId) const
 {
     // return the iterator if found or end() if not found/NULL
     MMapDataSet::const_iterator itr = loadedMMaps.find(mapId);
-    if (itr != loadedMMaps.cend() && !itr->second) {
+    if (itr != loadedMMaps.cend() &&
+        !itr->second.load(std::memory_order_acquire)) {
         itr = loadedMMaps.cend();
     }
 
@@ -71,8 +87,7 @@ bool MMapMgr::loadMapData(uint32 mapId)
     }
     else {
         if (thread_safe_environment) {
-            itr = loadedMMaps.insert(MMapDataSet::value_type(mapId, nullptr))
-                      .first;
+            itr = loadedMMaps.emplace(mapId, nullptr).first;
         }
         else {
             ABORT("Invalid mapId {} passed to MMapMgr after startup in thread "
@@ -120,9 +135,9 @@ bool MMapMgr::loadMapData(uint32 mapId)
 
     LOG_DEBUG("maps", "MMAP:loadMapData: Loaded {:03}.mmap", mapId);
 
-    // store inside our map list
-    MMapData* mmap_data = new MMapData(mesh);
-    itr->second         = mmap_data;
+    // store inside our map list, the navmesh must be initialized before other
+    // threads can see it
+    itr->second.store(new MMapData(mesh), std::memory_order_release);
     return true;
 }
 
@@ -219,6 +234,7 @@ bool MMapMgr::loadMap(uint32 mapId, int32 x, int32 y)
         mmap->loadedTileRefs.insert(
             std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
         ++loadedTiles;
+        BumpTileGeneration(mapId);
         dtMeshHeader* header = (dtMeshHeader*)data;
         LOG_DEBUG("maps",
                   "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into "
@@ -292,6 +308,7 @@ bool MMapMgr::unloadMap(uint32 mapId, int32 x, int32 y)
 
     mmap->loadedTileRefs.erase(packedGridPos);
     --loadedTiles;
+    BumpTileGeneration(mapId);
     LOG_DEBUG("maps",
               "MMAP:unloadMap: Unloaded mmtile {:03}[{:02},{:02}] from {:03}",
               mapId,
@@ -340,8 +357,10 @@ bool MMapMgr::unloadMap(uint32 mapId)
         }
     }
 
+    itr->second.store(nullptr, std::memory_order_release);
+    queryGeneration.fetch_add(1, std::memory_order_release);
+    BumpTileGeneration(mapId);
     delete mmap;
-    itr->second = nullptr;
     LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded {:03}.mmap", mapId);
 
     return true;
@@ -360,8 +379,11 @@ bool MMapMgr::unloadMapInstance(uint32 mapId, uint32 instanceId)
         return false;
     }
 
-    MMapData* mmap = itr->second;
-    if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end()) {
+    MMapData*                          mmap = itr->second;
+    std::lock_guard<std::shared_mutex> guard(mmap->navMeshQueriesLock);
+
+    NavMeshQuerySet::iterator query = mmap->navMeshQueries.find(instanceId);
+    if (query == mmap->navMeshQueries.end()) {
         LOG_DEBUG("maps",
                   "MMAP:unloadMapInstance: Asked to unload not loaded "
                   "dtNavMeshQuery mapId {:03} instanceId {}",
@@ -370,10 +392,9 @@ bool MMapMgr::unloadMapInstance(uint32 mapId, uint32 instanceId)
         return false;
     }
 
-    dtNavMeshQuery* query = mmap->navMeshQueries[instanceId];
-
-    dtFreeNavMeshQuery(query);
-    mmap->navMeshQueries.erase(instanceId);
+    queryGeneration.fetch_add(1, std::memory_order_release);
+    dtFreeNavMeshQuery(query->second);
+    mmap->navMeshQueries.erase(query);
     LOG_DEBUG("maps",
               "MMAP:unloadMapInstance: Unloaded mapId {:03} instanceId {}",
               mapId,
@@ -382,6 +403,22 @@ bool MMapMgr::unloadMapInstance(uint32 mapId, uint32 instanceId)
     return true;
 }
 
+std::optional<uint32> MMapMgr::GetTileGeneration(uint32 mapId) const
+{
+    MMapGenerationSet::const_iterator itr = tileGenerations.find(mapId);
+    if (itr == tileGenerations.end())
+        return std::nullopt;
+
+    return itr->second.load(std::memory_order_acquire);
+}
+
+void MMapMgr::BumpTileGeneration(uint32 mapId)
+{
+    MMapGenerationSet::iterator itr = tileGenerations.find(mapId);
+    if (itr != tileGenerations.end())
+        itr->second.fetch_add(1, std::memory_order_release);
+}
+
 dtNavMesh const* MMapMgr::GetNavMesh(uint32 mapId)
 {
     MMapDataSet::const_iterator itr = GetMMapData(mapId);
@@ -389,7 +426,7 @@ dtNavMesh const* MMapMgr::GetNavMesh(uint32 mapId)
         return nullptr;
     }
 
-    return itr->second->navMesh;
+    return itr->second.load(std::memory_order_acquire)->navMesh;
 }
 
 dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
@@ -399,35 +436,53 @@ dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
         return nullptr;
     }
 
-    MMapData* mmap = itr->second;
-    if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end()) {
-        // check again after acquiring mutex
-        if (mmap->navMeshQueries.find(instanceId) ==
-            mmap->navMeshQueries.end()) {
-            // allocate mesh query
-            dtNavMeshQuery* query = dtAllocNavMeshQuery();
-            ASSERT(query);
-
-            if (dtStatusFailed(query->init(mmap->navMesh, 1024))) {
-                dtFreeNavMeshQuery(query);
-                LOG_ERROR("maps",
-                          "MMAP:GetNavMeshQuery: Failed to initialize "
-                          "dtNavMeshQuery for mapId {:03} instanceId {}",
-                          mapId,
-                          instanceId);
-                return nullptr;
-            }
-
-            LOG_DEBUG("maps",
-                      "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId "
-                      "{:03} instanceId {}",
-                      mapId,
-                      instanceId);
-            mmap->navMeshQueries.insert(
-                std::pair<uint32, dtNavMeshQuery*>(instanceId, query));
+    MMapData*    mmap       = itr->second.load(std::memory_order_acquire);
+    uint32 const generation = queryGeneration.load(std::memory_order_acquire);
+
+    CachedNavMeshQuery& cached = LastNavMeshQuery;
+    if (cached.Data == mmap && cached.InstanceId == instanceId &&
+        cached.Generation == generation)
+        return cached.Query;
+
+    {
+        std::shared_lock<std::shared_mutex> guard(mmap->navMeshQueriesLock);
+        NavMeshQuerySet::const_iterator     query =
+            mmap->navMeshQueries.find(instanceId);
+        if (query != mmap->navMeshQueries.end()) {
+            cached = {mmap, instanceId, generation, query->second};
+            return query->second;
         }
     }
 
-    return mmap->navMeshQueries[instanceId];
+    std::lock_guard<std::shared_mutex> guard(mmap->navMeshQueriesLock);
+
+    // check again after acquiring mutex
+    NavMeshQuerySet::const_iterator existing =
+        mmap->navMeshQueries.find(instanceId);
+    if (existing != mmap->navMeshQueries.end())
+        return existing->second;
+
+    // allocate mesh query
+    dtNavMeshQuery* query = dtAllocNavMeshQuery();
+    ASSERT(query);
+
+    if (dtStatusFailed(query->init(mmap->navMesh, 1024))) {
+        dtFreeNavMeshQuery(query);
+        LOG_ERROR("maps",
+                  "MMAP:GetNavMeshQuery: Failed to initialize "
+                  "dtNavMeshQuery for mapId {:03} instanceId {}",
+                  mapId,
+                  instanceId);
+        return nullptr;
+    }
+
+    LOG_DEBUG("maps",
+              "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId "
+              "{:03} instanceId {}",
+              mapId,
+              instanceId);
+    mmap->navMeshQueries.emplace(instanceId, query);
+    cached = {mmap, instanceId, generation, query};
+    return query;
 }
 } // namespace MMAP
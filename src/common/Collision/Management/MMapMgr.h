@@ -23,6 +23,8 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include <atomic>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_map>
 #include <vector>
@@ -56,13 +58,18 @@ struct MMapData {
     }
 
     // we have to use single dtNavMeshQuery for every instance, since those are
-    // not thread safe
-    NavMeshQuerySet navMeshQueries; // instanceId to query
-    dtNavMesh*      navMesh;
-    MMapTileSet     loadedTileRefs; // maps [map grid coords] to [dtTile]
+    // not thread safe. Instances of one map are updated by different threads,
+    // so creating and removing queries takes navMeshQueriesLock exclusively
+    NavMeshQuerySet   navMeshQueries; // instanceId to query
+    std::shared_mutex navMeshQueriesLock;
+    dtNavMesh*        navMesh;
+    MMapTileSet       loadedTileRefs; // maps [map grid coords] to [dtTile]
 };
 
-typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
+// the map ids are fixed by InitializeThreadUnsafe, only the data pointers are
+// published and cleared while map threads are reading them
+typedef std::unordered_map<uint32, std::atomic<MMapData*>> MMapDataSet;
+typedef std::unordered_map<uint32, std::atomic<uint32>>    MMapGenerationSet;
 
 // singleton class
 // holds all all access to mmap loading unloading and meshes
@@ -81,6 +88,11 @@ public:
     dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
     dtNavMesh const*      GetNavMesh(uint32 mapId);
 
+    // changes whenever a tile of the map is loaded or unloaded, poly refs
+    // cached under another generation may point to stale polygons. Empty if
+    // the map was not known at InitializeThreadUnsafe.
+    [[nodiscard]] std::optional<uint32> GetTileGeneration(uint32 mapId) const;
+
     [[nodiscard]] uint32 getLoadedTilesCount() const { return loadedTiles; }
     [[nodiscard]] uint32 getLoadedMapsCount() const
     {
@@ -92,9 +104,15 @@ private:
     uint32                                    packTileID(int32 x, int32 y);
     [[nodiscard]] MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
 
-    MMapDataSet loadedMMaps;
-    uint32      loadedTiles{0};
+    void                                      BumpTileGeneration(uint32 mapId);
+
+    MMapDataSet       loadedMMaps;
+    MMapGenerationSet tileGenerations;
+    uint32            loadedTiles{0};
     bool        thread_safe_environment{true};
+
+    // bumped whenever a query or map is freed, drops the per thread caches
+    std::atomic<uint32> queryGeneration{0};
 };
 } // namespace MMAP
 
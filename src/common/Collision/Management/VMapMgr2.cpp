@@ -23,12 +23,53 @@
 #include "ModelInstance.h"
 #include "WorldModel.h"
 #include <G3D/Vector3.h>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string>
 
 using G3D::Vector3;
 
+namespace {
+/*
+ * Static geometry only changes when tiles are loaded or unloaded, so the
+ * same caster and target standing still get the same answer tick after
+ * tick. Results are kept per thread in a small direct mapped table keyed by
+ * the exact endpoints, no locking and no approximation.
+ */
+struct LineOfSightCacheEntry {
+    float  Coords[6];
+    uint32 MapId;
+    uint32 Generation;
+    uint8  IgnoreFlags;
+    bool   Valid;
+    bool   Result;
+};
+
+constexpr uint32 LOS_CACHE_SIZE        = 512;
+constexpr uint32 LOS_CACHE_FLUSH_EVERY = 1024;
+
+struct LineOfSightCache {
+    LineOfSightCacheEntry Entries[LOS_CACHE_SIZE] = {};
+    uint32                Hits                    = 0;
+    uint32                Misses                  = 0;
+};
+
+thread_local LineOfSightCache _losCache;
+
+uint32 HashLineOfSight(uint32 mapId, float const (&coords)[6], uint8 flags)
+{
+    uint32 hash = 2166136261u ^ mapId ^ (uint32(flags) << 24);
+    for (float coord : coords) {
+        uint32 bits;
+        std::memcpy(&bits, &coord, sizeof(bits));
+        hash = (hash ^ bits) * 16777619u;
+    }
+
+    return (hash ^ (hash >> 16)) & (LOS_CACHE_SIZE - 1);
+}
+} // namespace
+
 namespace VMAP {
 VMapMgr2::VMapMgr2()
 {
@@ -142,7 +183,9 @@ bool VMapMgr2::_loadMap(uint32             mapId,
         instanceTree->second = newTree;
     }
 
-    return instanceTree->second->LoadMapTile(tileX, tileY, this);
+    bool result = instanceTree->second->LoadMapTile(tileX, tileY, this);
+    _tileGeneration.fetch_add(1, std::memory_order_release);
+    return result;
 }
 
 void VMapMgr2::unloadMap(unsigned int mapId)
@@ -154,6 +197,7 @@ void VMapMgr2::unloadMap(unsigned int mapId)
             delete instanceTree->second;
             instanceTree->second = nullptr;
         }
+        _tileGeneration.fetch_add(1, std::memory_order_release);
     }
 }
 
@@ -166,6 +210,7 @@ void VMapMgr2::unloadMap(unsigned int mapId, int x, int y)
             delete instanceTree->second;
             instanceTree->second = nullptr;
         }
+        _tileGeneration.fetch_add(1, std::memory_order_release);
     }
 }
 
@@ -185,17 +230,50 @@ bool VMapMgr2::isInLineOfSight(unsigned int     mapId,
     }
 #endif
 
+    // read before the lookup, a tile change during the ray cast then
+    // invalidates the stored result
+    uint32 generation = _tileGeneration.load(std::memory_order_acquire);
+    float const coords[6] = {x1, y1, z1, x2, y2, z2};
+    uint8 const flags     = uint8(ignoreFlags);
+
+    LineOfSightCache&      cache = _losCache;
+    LineOfSightCacheEntry& entry =
+        cache.Entries[HashLineOfSight(mapId, coords, flags)];
+
+    if ((cache.Hits + cache.Misses) >= LOS_CACHE_FLUSH_EVERY) {
+        _losCacheHits.fetch_add(cache.Hits, std::memory_order_relaxed);
+        _losCacheMisses.fetch_add(cache.Misses, std::memory_order_relaxed);
+        cache.Hits   = 0;
+        cache.Misses = 0;
+    }
+
+    if (entry.Valid && entry.Generation == generation &&
+        entry.MapId == mapId && entry.IgnoreFlags == flags &&
+        !std::memcmp(entry.Coords, coords, sizeof(coords))) {
+        ++cache.Hits;
+        return entry.Result;
+    }
+
+    ++cache.Misses;
+
+    bool result = true;
     InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
     if (instanceTree != iInstanceMapTrees.end()) {
         Vector3 pos1 = convertPositionToInternalRep(x1, y1, z1);
         Vector3 pos2 = convertPositionToInternalRep(x2, y2, z2);
         if (pos1 != pos2) {
-            return instanceTree->second->isInLineOfSight(
+            result = instanceTree->second->isInLineOfSight(
                 pos1, pos2, ignoreFlags);
         }
     }
 
-    return true;
+    std::memcpy(entry.Coords, coords, sizeof(coords));
+    entry.MapId       = mapId;
+    entry.Generation  = generation;
+    entry.IgnoreFlags = flags;
+    entry.Valid       = true;
+    entry.Result      = result;
+    return result;
 }
 
 /**
@@ -334,6 +412,20 @@ bool VMapMgr2::GetLiquidLevel(uint32  mapId,
     return false;
 }
 
+bool VMapMgr2::HasWMOInArea(
+    uint32 mapId, float minX, float minY, float maxX, float maxY) const
+{
+    InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+    if (instanceTree == iInstanceMapTrees.end())
+        return false;
+
+    // the internal representation mirrors both axes
+    Vector3 low  = convertPositionToInternalRep(maxX, maxY, 0.0f);
+    Vector3 high = convertPositionToInternalRep(minX, minY, 0.0f);
+    return instanceTree->second->HasWMOInArea(G3D::Vector2(low.x, low.y),
+                                              G3D::Vector2(high.x, high.y));
+}
+
 void VMapMgr2::GetAreaAndLiquidData(uint32             mapId,
                                     float              x,
                                     float              y,
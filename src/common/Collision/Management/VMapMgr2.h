@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "IVMapMgr.h"
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -82,6 +83,12 @@ protected:
     // Mutex for iLoadedModelFiles
     std::mutex LoadedModelFilesLock;
 
+    // Bumped whenever a tile is loaded or unloaded, line of sight results
+    // cached before that are no longer used
+    std::atomic<uint32> _tileGeneration{0};
+    std::atomic<uint64> _losCacheHits{0};
+    std::atomic<uint64> _losCacheMisses{0};
+
     bool _loadMap(uint32             mapId,
                   const std::string& basePath,
                   uint32             tileX,
@@ -121,6 +128,13 @@ public:
                          float            y2,
                          float            z2,
                          ModelIgnoreFlags ignoreFlags) override;
+    /// Totals of the per thread line of sight cache, flushed periodically
+    void GetLineOfSightCacheStats(uint64& hits, uint64& misses) const
+    {
+        hits   = _losCacheHits.load(std::memory_order_relaxed);
+        misses = _losCacheMisses.load(std::memory_order_relaxed);
+    }
+
     /**
     fill the hit pos and return true, if an object was hit
     */
@@ -169,6 +183,11 @@ public:
                               float              z,
                               uint8              reqLiquidType,
                               AreaAndLiquidData& data) const override;
+    [[nodiscard]] bool HasWMOInArea(uint32 mapId,
+                                    float  minX,
+                                    float  minY,
+                                    float  maxX,
+                                    float  maxY) const override;
 
     WorldModel* acquireModelInstance(const std::string& basepath,
                                      const std::string& filename,
@@ -139,6 +139,27 @@ bool StaticMapTree::GetLocationInfo(const Vector3& pos,
     return intersectionCallBack.result;
 }
 
+bool StaticMapTree::HasWMOInArea(const G3D::Vector2& low,
+                                 const G3D::Vector2& high) const
+{
+    Vector3 lo(low.x, low.y, -G3D::finf());
+    Vector3 hi(high.x, high.y, G3D::finf());
+
+    bool found    = false;
+    auto callback = [&](uint32 entry) {
+        ModelInstance const& model = iTreeValues[entry];
+        if (!model.isLoaded() || (model.flags & MOD_M2))
+            return false;
+
+        G3D::AABox const& bound = model.GetBounds();
+        found = bound.low().x <= high.x && bound.high().x >= low.x &&
+                bound.low().y <= high.y && bound.high().y >= low.y;
+        return found;
+    };
+    iTree.intersectArea(lo, hi, callback);
+    return found;
+}
+
 StaticMapTree::StaticMapTree(uint32 mapID, const std::string& basePath)
     : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath)
 {
@@ -21,6 +21,7 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
+#include <G3D/Vector2.h>
 #include <unordered_map>
 
 namespace VMAP {
@@ -101,6 +102,10 @@ public:
                                     int32&        rootId,
                                     int32&        groupId) const;
     bool GetLocationInfo(const G3D::Vector3& pos, LocationInfo& info) const;
+    // true if a loaded WMO spawn (the only models carrying area and liquid
+    // info) overlaps the given xy rectangle at any height
+    [[nodiscard]] bool HasWMOInArea(const G3D::Vector2& low,
+                                    const G3D::Vector2& high) const;
 
     bool               InitMap(const std::string& fname, VMapMgr2* vm);
     void               UnloadMap(VMapMgr2* vm);
@@ -21,10 +21,14 @@
 #include "MapDefines.h"
 #include "MapTree.h"
 #include "VMapDefinitions.h"
+#include <algorithm>
+#include <atomic>
 #include <boost/filesystem.hpp>
 #include <iomanip>
+#include <mutex>
 #include <set>
 #include <sstream>
+#include <thread>
 
 using G3D::AABox;
 using G3D::inf;
@@ -237,16 +241,44 @@ bool TileAssembler::convertWorld2()
     exportGameobjectModels();
     // export objects
     std::cout << "\nConverting Model Files" << std::endl;
-    for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin();
-         mfile != spawnedModelFiles.end();
-         ++mfile) {
-        std::cout << "Converting " << *mfile << std::endl;
-        if (!convertRawFile(*mfile)) {
-            std::cout << "error converting " << *mfile << std::endl;
-            success = false;
-            break;
+
+    // every model is read, gets its mesh trees built and is written on its
+    // own, so they are spread over all cores
+    std::vector<std::string const*> modelFiles;
+    modelFiles.reserve(spawnedModelFiles.size());
+    for (std::string const& modelFile : spawnedModelFiles)
+        modelFiles.push_back(&modelFile);
+
+    std::atomic<std::size_t> nextModel{0};
+    std::atomic<bool>        failed{false};
+    std::mutex               outputLock;
+    auto                     convertModels = [&]() {
+        std::size_t index;
+        while (!failed && (index = nextModel++) < modelFiles.size()) {
+            std::string const& modelFile = *modelFiles[index];
+            {
+                std::lock_guard<std::mutex> lock(outputLock);
+                std::cout << "Converting " << modelFile << std::endl;
+            }
+
+            if (!convertRawFile(modelFile)) {
+                std::lock_guard<std::mutex> lock(outputLock);
+                std::cout << "error converting " << modelFile << std::endl;
+                failed = true;
+            }
         }
-    }
+    };
+
+    std::vector<std::thread> workers;
+    uint32 workerCount = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32 i = 0; i < workerCount; ++i)
+        workers.emplace_back(convertModels);
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    if (failed)
+        success = false;
 
     // cleanup:
     for (MapData::iterator map_iter = mapData.begin();
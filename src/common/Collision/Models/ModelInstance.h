@@ -68,6 +68,7 @@ public:
                         LocationInfo&       info,
                         float&              liqHeight) const;
     WorldModel* getWorldModel() { return iModel; }
+    [[nodiscard]] bool isLoaded() const { return iModel != nullptr; }
 
 protected:
     G3D::Matrix3 iInvRot;
@@ -53,24 +53,28 @@ bool IntersectTriangle(const MeshTriangle&                  tri,
         return false;
     }
 
-    const float   f = 1.0f / a;
+    // Barycentric coordinates are compared against the determinant instead
+    // of being divided by it, most triangles of a leaf are rejected here and
+    // only a hit pays for the division.
+    const float   sign = a < 0.0f ? -1.0f : 1.0f;
+    const float   det  = a * sign;
     const Vector3 s(ray.origin() - points[tri.idx0]);
-    const float   u = f * s.dot(p);
+    const float   u = sign * s.dot(p);
 
-    if ((u < 0.0f) || (u > 1.0f)) {
+    if ((u < 0.0f) || (u > det)) {
         // We hit the plane of the m_geometry, but outside the m_geometry
         return false;
     }
 
     const Vector3 q(s.cross(e1));
-    const float   v = f * ray.direction().dot(q);
+    const float   v = sign * ray.direction().dot(q);
 
-    if ((v < 0.0f) || ((u + v) > 1.0f)) {
+    if ((v < 0.0f) || ((u + v) > det)) {
         // We hit the plane of the triangle, but outside the triangle
         return false;
     }
 
-    const float t = f * e2.dot(q);
+    const float t = e2.dot(q) / a;
 
     if ((t > 0.0f) && (t < distance)) {
         // This is a new hit, closer than the previous one
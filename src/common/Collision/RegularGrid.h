@@ -5,6 +5,7 @@
 #include <G3D/PositionTrait.h>
 #include <G3D/Ray.h>
 #include <G3D/Table.h>
+#include <vector>
 
 #include "Errors.h"
 
@@ -49,6 +50,9 @@ public:
 
     MemberTable memberTable;
     Node*       nodes[CELL_NUMBER][CELL_NUMBER];
+    // cells changed since the last balance(), so that it does not have to
+    // walk the whole grid and only rebuilds the trees that need it
+    std::vector<Node*> dirtyNodes;
 
     RegularGrid2D() { memset(nodes, 0, sizeof(nodes)); }
 
@@ -85,6 +89,7 @@ public:
 
         for (uint8 i = 0; i < 9; ++i) {
             if (na._nodes[i]) {
+                markDirty(na._nodes[i]);
                 na._nodes[i]->insert(value);
             }
             else {
@@ -100,6 +105,7 @@ public:
         NodeArray<Node>& na = memberTable[&value];
         for (uint8 i = 0; i < 9; ++i) {
             if (na._nodes[i]) {
+                markDirty(na._nodes[i]);
                 na._nodes[i]->remove(value);
             }
             else {
@@ -113,11 +119,20 @@ public:
 
     void balance()
     {
-        for (int x = 0; x < CELL_NUMBER; ++x)
-            for (int y = 0; y < CELL_NUMBER; ++y)
-                if (Node* n = nodes[x][y]) {
-                    n->balance();
-                }
+        for (Node* n : dirtyNodes) {
+            n->balance();
+        }
+
+        dirtyNodes.clear();
+    }
+
+    void markDirty(Node* n)
+    {
+        // a node that already has pending changes is in the list, unless a
+        // query balanced it in the meantime - then it is there twice at worst
+        if (n->isBalanced()) {
+            dirtyNodes.push_back(n);
+        }
     }
 
     bool contains(const T& value) const
@@ -35,6 +35,19 @@ std::unordered_map<std::string /*name*/, std::string /*value*/> _configOptions;
 std::unordered_map<std::string /*name*/, std::string /*value*/> _envVarCache;
 std::mutex                                                      _configLock;
 
+// Options declared through RegisterOption, they may be registered from static
+// initializers in other translation units so the storage is created lazily
+struct RegisteredOptions {
+    std::mutex                                    Lock;
+    std::vector<std::unique_ptr<ConfigValueBase>> Options;
+};
+
+RegisteredOptions& GetRegisteredOptions()
+{
+    static RegisteredOptions registered;
+    return registered;
+}
+
 // Check system configs like *server.conf*
 bool IsAppConfig(std::string_view fileName)
 {
@@ -363,7 +376,7 @@ Optional<std::string> GetEnvFromCache(std::string const& configName,
 
 std::vector<std::string> ConfigMgr::OverrideWithEnvVariablesIfAny()
 {
-    std::lock_guard<std::mutex> lock(_configLock);
+    std::unique_lock<std::mutex> lock(_configLock);
 
     std::vector<std::string> overriddenKeys;
 
@@ -380,9 +393,49 @@ std::vector<std::string> ConfigMgr::OverrideWithEnvVariablesIfAny()
         overriddenKeys.push_back(itr.first);
     }
 
+    lock.unlock();
+    RefreshRegisteredOptions(false);
+
     return overriddenKeys;
 }
 
+ConfigValueBase&
+ConfigMgr::RegisterOption(std::unique_ptr<ConfigValueBase> option)
+{
+    RegisteredOptions&          registered = GetRegisteredOptions();
+    std::lock_guard<std::mutex> lock(registered.Lock);
+
+    for (auto const& existing : registered.Options) {
+        if (existing->GetName() == option->GetName()) {
+            return *existing;
+        }
+    }
+
+    // Options registered before the first load keep their default until
+    // LoadAppConfigs/LoadModulesConfigs refresh them
+    bool isLoaded;
+    {
+        std::lock_guard<std::mutex> configLock(_configLock);
+        isLoaded = !_configOptions.empty();
+    }
+
+    if (isLoaded) {
+        option->Refresh(*this, true);
+    }
+
+    return *registered.Options.emplace_back(std::move(option));
+}
+
+void ConfigMgr::RefreshRegisteredOptions(bool showLogs /*= true*/)
+{
+    RegisteredOptions&          registered = GetRegisteredOptions();
+    std::lock_guard<std::mutex> lock(registered.Lock);
+
+    for (auto const& option : registered.Options) {
+        option->Refresh(*this, showLogs);
+    }
+}
+
 template <class T>
 T ConfigMgr::GetValueDefault(std::string const& name,
                              T const&           def,
@@ -576,6 +629,12 @@ bool ConfigMgr::LoadAppConfigs(bool isReload /*= false*/)
         return false;
     }
 
+    // Module options are only known after LoadModulesConfigs, which logs
+    // anything missing, so don't report them here
+    if (!isReload) {
+        RefreshRegisteredOptions(false);
+    }
+
     return true;
 }
 
@@ -583,6 +642,10 @@ bool ConfigMgr::LoadModulesConfigs(bool isReload /*= false*/,
                                    bool isNeedPrintInfo /*= true*/)
 {
     if (_additonalFiles.empty()) {
+        if (!isReload) {
+            RefreshRegisteredOptions();
+        }
+
         // Send successful load if no found files
         return true;
     }
@@ -648,6 +711,11 @@ bool ConfigMgr::LoadModulesConfigs(bool isReload /*= false*/,
         LOG_INFO("server.loading", " ");
     }
 
+    // On reload this is done once the environment overrides are applied
+    if (!isReload) {
+        RefreshRegisteredOptions();
+    }
+
     return true;
 }
 
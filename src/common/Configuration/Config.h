@@ -20,10 +20,59 @@
 #define CONFIG_H
 
 #include "Define.h"
+#include <atomic>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
+class ConfigMgr;
+
+/// Base of the options registered with ConfigMgr::RegisterOption
+class ConfigValueBase {
+public:
+    virtual ~ConfigValueBase() = default;
+
+    std::string const& GetName() const { return _name; }
+
+protected:
+    explicit ConfigValueBase(std::string name) : _name(std::move(name)) {}
+
+private:
+    friend class ConfigMgr;
+
+    virtual void Refresh(ConfigMgr const& mgr, bool showLogs) = 0;
+
+    std::string _name;
+};
+
+/// Handle to a typed option that is parsed once per config load/reload, reads
+/// are a single relaxed atomic load instead of a map lookup and a conversion
+template <class T>
+class ConfigValue final : public ConfigValueBase {
+    static_assert(std::is_arithmetic_v<T>,
+                  "ConfigValue only supports bool and numeric options");
+
+public:
+    ConfigValue(std::string name, T def)
+        : ConfigValueBase(std::move(name)), _default(def), _value(def)
+    {
+    }
+
+    T Get() const { return _value.load(std::memory_order_relaxed); }
+    operator T() const { return Get(); }
+
+    T GetDefault() const { return _default; }
+
+private:
+    void Refresh(ConfigMgr const& mgr, bool showLogs) override;
+
+    T const        _default;
+    std::atomic<T> _value;
+};
+
 class ConfigMgr {
     ConfigMgr()                            = default;
     ConfigMgr(ConfigMgr const&)            = delete;
@@ -55,6 +104,16 @@ public:
                 T const&           def,
                 bool               showLogs = true) const;
 
+    /// Declares a typed option and returns a handle to its parsed value. The
+    /// handle lives as long as the ConfigMgr and is updated on every load,
+    /// reload and environment override, so it can be kept in a static.
+    /// Registering the same name again returns the existing handle
+    template <class T>
+    ConfigValue<T> const& RegisterOption(std::string const& name, T const& def);
+
+    /// Reparses all registered options from the currently loaded config
+    void RefreshRegisteredOptions(bool showLogs = true);
+
     /*
      * Deprecated geters. This geters will be deleted
      */
@@ -93,6 +152,8 @@ private:
                       T const&           def,
                       bool               showLogs = true) const;
 
+    ConfigValueBase& RegisterOption(std::unique_ptr<ConfigValueBase> option);
+
     bool dryRun = false;
 
     std::vector<std::string /*config variant*/> _moduleConfigFiles;
@@ -106,6 +167,29 @@ public:
     }
 };
 
+template <class T>
+void ConfigValue<T>::Refresh(ConfigMgr const& mgr, bool showLogs)
+{
+    _value.store(mgr.GetOption<T>(GetName(), _default, showLogs),
+                 std::memory_order_relaxed);
+}
+
+template <class T>
+ConfigValue<T> const& ConfigMgr::RegisterOption(std::string const& name,
+                                                T const&           def)
+{
+    ConfigValueBase& option =
+        RegisterOption(std::make_unique<ConfigValue<T>>(name, def));
+
+    auto* typed = dynamic_cast<ConfigValue<T>*>(&option);
+    if (!typed) {
+        throw ConfigException("Config option '" + name +
+                              "' is already registered with another type");
+    }
+
+    return *typed;
+}
+
 #define sConfigMgr ConfigMgr::instance()
 
 #endif
@@ -18,42 +18,41 @@
 
 #include "ARC4.h"
 #include "Errors.h"
+#include <numeric>
+#include <utility>
 
-Acore::Crypto::ARC4::ARC4() : _ctx(EVP_CIPHER_CTX_new())
+Acore::Crypto::ARC4::ARC4() : _state(), _i(0), _j(0)
 {
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-    _cipher = EVP_CIPHER_fetch(nullptr, "RC4", nullptr);
-#else
-    EVP_CIPHER const* _cipher = EVP_rc4();
-#endif
-
-    EVP_CIPHER_CTX_init(_ctx);
-    int result = EVP_EncryptInit_ex(_ctx, _cipher, nullptr, nullptr, nullptr);
-    ASSERT(result == 1);
+    std::iota(_state.begin(), _state.end(), uint8(0));
 }
 
-Acore::Crypto::ARC4::~ARC4()
+void Acore::Crypto::ARC4::Init(uint8 const* seed, size_t len)
 {
-    EVP_CIPHER_CTX_free(_ctx);
+    ASSERT(len > 0);
 
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-    EVP_CIPHER_free(_cipher);
-#endif
-}
+    std::iota(_state.begin(), _state.end(), uint8(0));
 
-void Acore::Crypto::ARC4::Init(uint8 const* seed, size_t len)
-{
-    int result1 = EVP_CIPHER_CTX_set_key_length(_ctx, len);
-    ASSERT(result1 == 1);
-    int result2 = EVP_EncryptInit_ex(_ctx, nullptr, nullptr, seed, nullptr);
-    ASSERT(result2 == 1);
+    uint8 j = 0;
+    for (size_t i = 0; i < _state.size(); ++i) {
+        j = uint8(j + _state[i] + seed[i % len]);
+        std::swap(_state[i], _state[j]);
+    }
+
+    _i = 0;
+    _j = 0;
 }
 
 void Acore::Crypto::ARC4::UpdateData(uint8* data, size_t len)
 {
-    int outlen  = 0;
-    int result1 = EVP_EncryptUpdate(_ctx, data, &outlen, data, len);
-    ASSERT(result1 == 1);
-    int result2 = EVP_EncryptFinal_ex(_ctx, data, &outlen);
-    ASSERT(result2 == 1);
+    uint8 i = _i;
+    uint8 j = _j;
+    for (size_t k = 0; k < len; ++k) {
+        i = uint8(i + 1);
+        j = uint8(j + _state[i]);
+        std::swap(_state[i], _state[j]);
+        data[k] ^= _state[uint8(_state[i] + _state[j])];
+    }
+
+    _i = i;
+    _j = j;
 }
@@ -21,13 +21,13 @@
 
 #include "Define.h"
 #include <array>
-#include <openssl/evp.h>
 
 namespace Acore::Crypto {
+/// RC4 keystream, implemented directly: the game protocol feeds it 4-6 byte
+/// packet headers, for which an OpenSSL EVP call costs more than the cipher
 class AC_COMMON_API ARC4 {
 public:
     ARC4();
-    ~ARC4();
 
     void Init(uint8 const* seed, size_t len);
 
@@ -46,10 +46,9 @@ public:
     }
 
 private:
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-    EVP_CIPHER* _cipher;
-#endif
-    EVP_CIPHER_CTX* _ctx;
+    std::array<uint8, 256> _state;
+    uint8                  _i;
+    uint8                  _j;
 };
 } // namespace Acore::Crypto
 
@@ -60,6 +60,9 @@ public:
         return SHA1::GetDigestOf(A, clientM, K);
     }
 
+    // derives the session key K from the shared secret S, for either side
+    static SessionKey SHA1Interleave(EphemeralKey const& S);
+
     SRP6(std::string const& username,
          Salt const&        salt,
          Verifier const&    verifier);
@@ -69,10 +72,9 @@ public:
 private:
     bool _used = false; // a single instance can only be used to verify once
 
-    static Verifier   CalculateVerifier(std::string const& username,
-                                        std::string const& password,
-                                        Salt const&        salt);
-    static SessionKey SHA1Interleave(EphemeralKey const& S);
+    static Verifier CalculateVerifier(std::string const& username,
+                                      std::string const& password,
+                                      Salt const&        salt);
 
     /* global algorithm parameters */
     static BigNumber const
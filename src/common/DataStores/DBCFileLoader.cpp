@@ -18,7 +18,7 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
-#include <stdio.h>
+#include "MappedFile.h"
 #include <string.h>
 
 DBCFileLoader::DBCFileLoader()
@@ -29,63 +29,47 @@ DBCFileLoader::DBCFileLoader()
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
-    uint32 header;
-    if (data) {
-        delete[] data;
-        data = nullptr;
-    }
-
-    FILE* f = fopen(filename, "rb");
-    if (!f) {
-        return false;
-    }
-
-    if (fread(&header, 4, 1, f) != 1) // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(header);
-
-    if (header != 0x43424457) //'WDBC'
-    {
-        fclose(f);
-        return false;
-    }
+    _file.reset();
+    data        = nullptr;
+    stringTable = nullptr;
 
-    if (fread(&recordCount, 4, 1, f) != 1) // Number of records
-    {
-        fclose(f);
+    // Copy on write, the records used in place are corrected by the core
+    auto file = std::make_shared<Acore::MappedFile>();
+    if (!file->Open(filename, true)) {
         return false;
     }
 
-    EndianConvert(recordCount);
+    uint8*            base       = file->GetWritableData();
+    constexpr uint32  headerSize = 5 * sizeof(uint32);
+    std::size_t const fileSize   = file->GetSize();
 
-    if (fread(&fieldCount, 4, 1, f) != 1) // Number of fields
-    {
-        fclose(f);
+    if (fileSize < headerSize) {
         return false;
     }
 
-    EndianConvert(fieldCount);
+    auto readHeader = [base](uint32 index) {
+        uint32 value;
+        memcpy(&value, base + index * sizeof(uint32), sizeof(uint32));
+        EndianConvert(value);
+        return value;
+    };
 
-    if (fread(&recordSize, 4, 1, f) != 1) // Size of a record
+    if (readHeader(0) != 0x43424457) //'WDBC'
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(recordSize);
+    recordCount = readHeader(1); // Number of records
+    fieldCount  = readHeader(2); // Number of fields
+    recordSize  = readHeader(3); // Size of a record
+    stringSize  = readHeader(4); // String size
 
-    if (fread(&stringSize, 4, 1, f) != 1) // String size
-    {
-        fclose(f);
+    if (fileSize - headerSize <
+        uint64(recordSize) * recordCount + uint64(stringSize)) {
         return false;
     }
 
-    EndianConvert(stringSize);
-
+    delete[] fieldsOffset;
     fieldsOffset    = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -101,25 +85,14 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
-    data        = new unsigned char[recordSize * recordCount + stringSize];
+    _file       = std::move(file);
+    data        = base + headerSize;
     stringTable = data + recordSize * recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1) {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
-DBCFileLoader::~DBCFileLoader()
-{
-    delete[] data;
-
-    delete[] fieldsOffset;
-}
+DBCFileLoader::~DBCFileLoader() { delete[] fieldsOffset; }
 
 DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
 {
@@ -127,6 +100,25 @@ DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
     return Record(*this, data + id * recordSize);
 }
 
+bool DBCFileLoader::CanUseRecordsInPlace(char const* format) const
+{
+#if ACORE_ENDIAN == ACORE_BIGENDIAN
+    (void)format;
+    return false;
+#else
+    // Strings are offsets in the file but pointers in memory, skipped fields
+    // are not part of the structure
+    for (char const* field = format; *field; ++field) {
+        if (*field != FT_INT && *field != FT_IND && *field != FT_FLOAT &&
+            *field != FT_BYTE) {
+            return false;
+        }
+    }
+
+    return GetFormatRecordSize(format) == recordSize;
+#endif
+}
+
 uint32 DBCFileLoader::GetFormatRecordSize(char const* format, int32* index_pos)
 {
     uint32 recordsize = 0;
@@ -219,16 +211,25 @@ char* DBCFileLoader::AutoProduceData(char const* format,
         indexTable = new ptr[recordCount];
     }
 
-    char* dataTable = new char[recordCount * recordsize];
+    bool const inPlace = CanUseRecordsInPlace(format);
+    char*      dataTable =
+        inPlace ? nullptr : new char[recordCount * recordsize];
 
     uint32 offset = 0;
 
     for (uint32 y = 0; y < recordCount; ++y) {
+        char* record = inPlace ? reinterpret_cast<char*>(data + y * recordSize)
+                               : &dataTable[offset];
+
         if (i >= 0) {
-            indexTable[getRecord(y).getUInt(i)] = &dataTable[offset];
+            indexTable[getRecord(y).getUInt(i)] = record;
         }
         else {
-            indexTable[y] = &dataTable[offset];
+            indexTable[y] = record;
+        }
+
+        if (inPlace) {
+            continue;
         }
 
         for (uint32 x = 0; x < fieldCount; ++x) {
@@ -271,14 +272,16 @@ char* DBCFileLoader::AutoProduceData(char const* format,
     return dataTable;
 }
 
-char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
+bool DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
     if (strlen(format) != fieldCount) {
-        return nullptr;
+        return false;
     }
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    // Records used in place have no string fields
+    if (!dataTable) {
+        return true;
+    }
 
     uint32 offset = 0;
 
@@ -299,8 +302,7 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
                 // fill only not filled entries
                 char** slot = (char**)(&dataTable[offset]);
                 if (!*slot || !**slot) {
-                    const char* st = getRecord(y).getString(x);
-                    *slot = stringPool + (st - (char const*)stringTable);
+                    *slot = const_cast<char*>(getRecord(y).getString(x));
                 }
                 offset += sizeof(char*);
                 break;
@@ -321,5 +323,5 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return true;
 }
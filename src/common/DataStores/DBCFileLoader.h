@@ -22,6 +22,11 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
+
+namespace Acore {
+class MappedFile;
+}
 
 enum DbcFieldFormat {
     FT_NA      = 'x', // not used or unknown, 4 byte size
@@ -99,12 +104,26 @@ public:
                                                             : 0;
     }
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
+    /// The mapping records and strings handed out by AutoProduceData() and
+    /// AutoProduceStrings() point into, it must outlive them
+    [[nodiscard]] std::shared_ptr<Acore::MappedFile> const& GetFile() const
+    {
+        return _file;
+    }
+    /// Returns the copied records, or nullptr if they are used in place
+    /// because the format matches the file layout. indexTable is nullptr on
+    /// error.
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
-    char* AutoProduceStrings(char const* fmt, char* dataTable);
+    /// Points the string fields of dataTable into the string table of the
+    /// file, returns false if the format doesn't match the file
+    bool AutoProduceStrings(char const* fmt, char* dataTable);
     static uint32 GetFormatRecordSize(const char* format,
                                       int32*      index_pos = nullptr);
 
 private:
+    [[nodiscard]] bool CanUseRecordsInPlace(char const* format) const;
+
+    std::shared_ptr<Acore::MappedFile> _file;
     uint32         recordSize;
     uint32         recordCount;
     uint32         fieldCount;
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _ACORE_PROFILER_H_
+#define _ACORE_PROFILER_H_
+
+/*
+ * Timeline zones for the Tracy profiler, compiled in with the WITH_TRACY build
+ * option. Tracy is built on demand: until a profiler connects, a zone costs a
+ * few nanoseconds, so the instrumented build can run in production. Without
+ * the option all macros expand to nothing.
+ *
+ * AC_PROFILE_ZONE takes a string literal, AC_PROFILE_ZONE_TEXT attaches a
+ * runtime text (e.g. the map id) to the innermost zone of the scope.
+ */
+#ifdef TRACY_ENABLE
+#include <tracy/Tracy.hpp>
+
+#define AC_PROFILE_ZONE(name) ZoneScopedN(name)
+#define AC_PROFILE_ZONE_TEXT(text, size) ZoneText(text, size)
+#define AC_PROFILE_FRAME() FrameMark
+#define AC_PROFILE_THREAD_NAME(name) tracy::SetThreadName(name)
+#else
+#define AC_PROFILE_ZONE(name) ((void)0)
+#define AC_PROFILE_ZONE_TEXT(text, size) ((void)0)
+#define AC_PROFILE_FRAME() ((void)0)
+#define AC_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,261 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ThreadWatchdog.h"
+#include "Log.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+#include <windows.h>
+#include <dbghelp.h>
+#include <tchar.h>
+#pragma comment(linker, "/DEFAULTLIB:dbghelp.lib")
+#else
+#include <csignal>
+#include <cstdlib>
+#include <execinfo.h>
+#include <pthread.h>
+#endif
+
+namespace {
+int constexpr MAX_STACK_FRAMES = 64;
+
+std::chrono::milliseconds constexpr CAPTURE_TIMEOUT(100);
+
+int64 GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+struct ThreadWatchdog::WatchedThread {
+    std::string Name;
+
+    // steady clock time the current unit of work started at, 0 while idle
+    std::atomic<int64> WorkStart{0};
+    uint32             WorkDepth{0};
+    // start of the unit of work that was last reported
+    int64 ReportedStart{0};
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    pthread_t                           Handle;
+    std::array<void*, MAX_STACK_FRAMES> Frames;
+    std::atomic<int>                    FrameCount{-1};
+#endif
+};
+
+// unregisters the thread when it exits
+struct ThreadRegistration {
+    std::shared_ptr<ThreadWatchdog::WatchedThread> Thread;
+
+    ~ThreadRegistration()
+    {
+        if (Thread)
+            sThreadWatchdog->UnregisterThread(Thread.get());
+    }
+};
+
+namespace {
+thread_local ThreadRegistration _registration;
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+std::atomic<ThreadWatchdog::WatchedThread*> _captureTarget{nullptr};
+
+// runs on the watched thread, backtrace() was called once at registration so
+// it does not need to load anything here
+void CaptureStackHandler(int /*signal*/)
+{
+    ThreadWatchdog::WatchedThread* target = _captureTarget.load();
+    if (!target)
+        return;
+
+    int count = backtrace(target->Frames.data(), MAX_STACK_FRAMES);
+    target->FrameCount.store(count, std::memory_order_release);
+}
+#endif
+} // namespace
+
+ThreadWatchdog* ThreadWatchdog::instance()
+{
+    static ThreadWatchdog instance;
+    return &instance;
+}
+
+void ThreadWatchdog::Initialize(Milliseconds stallThreshold)
+{
+    _stallThreshold = stallThreshold;
+    if (!IsEnabled())
+        return;
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    struct sigaction action = {};
+    action.sa_handler       = &CaptureStackHandler;
+    action.sa_flags         = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGUSR2, &action, nullptr);
+#endif
+}
+
+void ThreadWatchdog::RegisterThread(std::string name)
+{
+    if (!IsEnabled() || _registration.Thread)
+        return;
+
+    auto thread  = std::make_shared<WatchedThread>();
+    thread->Name = std::move(name);
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    thread->Handle = pthread_self();
+    backtrace(thread->Frames.data(), MAX_STACK_FRAMES);
+#endif
+
+    _registration.Thread = thread;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _threads.push_back(std::move(thread));
+}
+
+void ThreadWatchdog::UnregisterThread(WatchedThread* thread)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    std::erase_if(_threads, [thread](auto const& watched) {
+        return watched.get() == thread;
+    });
+}
+
+void ThreadWatchdog::Check()
+{
+    if (!IsEnabled())
+        return;
+
+    int64 const now = GetSteadyTimeMs();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (std::shared_ptr<WatchedThread> const& thread : _threads) {
+        int64 const workStart = thread->WorkStart;
+        if (!workStart || workStart == thread->ReportedStart ||
+            Milliseconds(now - workStart) < _stallThreshold)
+            continue;
+
+        // every stall is reported once, however long it lasts
+        thread->ReportedStart = workStart;
+        ReportStall(*thread, Milliseconds(now - workStart));
+    }
+}
+
+void ThreadWatchdog::ReportStall(WatchedThread const& stalled,
+                                 Milliseconds         stallTime)
+{
+    LOG_WARN("server.watchdog",
+             "Thread {} is stuck in the same unit of work for {} ms",
+             stalled.Name,
+             stallTime.count());
+
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    // the stacks of other threads can not be walked from here, a minidump
+    // holds all of them and the process keeps running
+    TCHAR modulePath[MAX_PATH];
+    GetModuleFileName(0, modulePath, MAX_PATH);
+    TCHAR* separator = _tcsrchr(modulePath, '\\');
+    if (!separator)
+        return;
+
+    separator[0] = '\0';
+
+    TCHAR dumpFolder[MAX_PATH];
+    sprintf_s(dumpFolder, "%s\\Crashes", modulePath);
+    CreateDirectory(dumpFolder, nullptr);
+
+    TCHAR dumpFile[MAX_PATH];
+    sprintf_s(dumpFile,
+              "%s\\stall_%lld.dmp",
+              dumpFolder,
+              static_cast<long long>(time(nullptr)));
+
+    HANDLE file = CreateFile(
+        dumpFile, GENERIC_WRITE, 0, 0, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    MiniDumpWriteDump(GetCurrentProcess(),
+                      GetCurrentProcessId(),
+                      file,
+                      MiniDumpNormal,
+                      nullptr,
+                      nullptr,
+                      nullptr);
+    CloseHandle(file);
+
+    LOG_WARN(
+        "server.watchdog", "Stacks of all threads written to {}", dumpFile);
+#else
+    // idle threads only wait for work, their stacks tell nothing
+    for (std::shared_ptr<WatchedThread> const& thread : _threads) {
+        if (!thread->WorkStart)
+            continue;
+
+        thread->FrameCount = -1;
+        _captureTarget     = thread.get();
+        pthread_kill(thread->Handle, SIGUSR2);
+
+        auto const deadline =
+            std::chrono::steady_clock::now() + CAPTURE_TIMEOUT;
+        while (thread->FrameCount.load(std::memory_order_acquire) < 0 &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        _captureTarget = nullptr;
+
+        int const count = thread->FrameCount.load(std::memory_order_acquire);
+        if (count <= 0) {
+            LOG_WARN("server.watchdog",
+                     "Thread {}: stack could not be captured",
+                     thread->Name);
+            continue;
+        }
+
+        LOG_WARN("server.watchdog", "Thread {}:", thread->Name);
+
+        char** symbols = backtrace_symbols(thread->Frames.data(), count);
+        for (int i = 0; i < count; ++i)
+            LOG_WARN(
+                "server.watchdog", "  #{} {}", i, symbols ? symbols[i] : "?");
+
+        free(symbols);
+    }
+#endif
+}
+
+ThreadWatchdog::WorkScope::WorkScope()
+{
+    ThreadWatchdog::WatchedThread* thread = _registration.Thread.get();
+    if (thread && !thread->WorkDepth++)
+        thread->WorkStart = GetSteadyTimeMs();
+}
+
+ThreadWatchdog::WorkScope::~WorkScope()
+{
+    ThreadWatchdog::WatchedThread* thread = _registration.Thread.get();
+    if (thread && !--thread->WorkDepth)
+        thread->WorkStart = 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _ACORE_THREADWATCHDOG_H_
+#define _ACORE_THREADWATCHDOG_H_
+
+#include "Define.h"
+#include "Duration.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * Watches the threads doing the work of the server. A watched thread wraps
+ * every unit of work (a world tick, a map update, a database operation...) in
+ * a WorkScope, waiting for work is not a stall. Check() reports a thread that
+ * stays in the same unit of work for longer than the stall threshold once,
+ * together with the stacks of all watched threads, and keeps the process
+ * running: on unix the stacks are captured through a signal, on Windows a
+ * minidump is written to the Crashes folder.
+ */
+class AC_COMMON_API ThreadWatchdog {
+public:
+    class AC_COMMON_API WorkScope {
+    public:
+        WorkScope();
+        ~WorkScope();
+
+        WorkScope(WorkScope const&)            = delete;
+        WorkScope& operator=(WorkScope const&) = delete;
+    };
+
+    static ThreadWatchdog* instance();
+
+    // signal handler setup, must run before the first thread registers
+    void Initialize(Milliseconds stallThreshold);
+    bool         IsEnabled() const { return _stallThreshold > 0s; }
+    Milliseconds GetStallThreshold() const { return _stallThreshold; }
+
+    // watches the calling thread until it exits
+    void RegisterThread(std::string name);
+
+    void Check();
+
+    // defined in ThreadWatchdog.cpp
+    struct WatchedThread;
+
+private:
+    friend struct ThreadRegistration;
+
+    ThreadWatchdog() = default;
+
+    void UnregisterThread(WatchedThread* thread);
+    void ReportStall(WatchedThread const& stalled, Milliseconds stallTime);
+
+    std::mutex                                  _lock;
+    std::vector<std::shared_ptr<WatchedThread>> _threads;
+    Milliseconds                                _stallThreshold{0};
+};
+
+#define sThreadWatchdog ThreadWatchdog::instance()
+
+#endif
@@ -23,13 +23,47 @@
 #include "Log.h"
 #include "StringConvert.h"
 #include <fstream>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+struct IpRange {
+    uint32 From;
+    uint32 To;
+    uint16 Location;
+};
+
+// Index of the first range ending after ip, or ends.size(). The loop
+// always runs log2(size) times and the compiler turns the selection into a
+// conditional move, so lookups do not depend on branch prediction.
+std::size_t FindRangeEnd(std::vector<uint32> const& ends, uint32 ip)
+{
+    if (ends.empty()) {
+        return 0;
+    }
+
+    uint32 const* base = ends.data();
+    std::size_t   size = ends.size();
+    while (size > 1) {
+        std::size_t const half = size / 2;
+        base                   = base[half - 1] <= ip ? base + half : base;
+        size -= half;
+    }
+
+    return (base - ends.data()) + (*base <= ip ? 1 : 0);
+}
+} // namespace
+
 IpLocationStore::IpLocationStore() {}
 
 IpLocationStore::~IpLocationStore() {}
 
 void IpLocationStore::Load()
 {
-    _ipLocationStore.clear();
+    _rangeEnds.clear();
+    _rangeStarts.clear();
+    _rangeLocations.clear();
+    _locations.clear();
     LOG_INFO("server.loading", "Loading IP Location Database...");
 
     std::string databaseFilePath =
@@ -60,6 +94,9 @@ void IpLocationStore::Load()
     std::string countryCode;
     std::string countryName;
 
+    std::vector<IpRange>                    ranges;
+    std::unordered_map<std::string, uint16> locationIndex;
+
     while (databaseFile.good()) {
         // Read lines
         if (!std::getline(databaseFile, ipFrom, ','))
@@ -102,28 +139,46 @@ void IpLocationStore::Load()
         if (!IpFrom || !IpTo)
             continue;
 
-        _ipLocationStore.emplace_back(
-            *IpFrom, *IpTo, std::move(countryCode), std::move(countryName));
+        // Intern the country, the file repeats it for every range
+        auto [itr, inserted] = locationIndex.try_emplace(
+            countryCode + ',' + countryName, uint16(_locations.size()));
+        if (inserted) {
+            ASSERT(_locations.size() < std::numeric_limits<uint16>::max(),
+                   "Too many distinct countries in ip database file");
+            _locations.emplace_back(std::move(countryCode),
+                                    std::move(countryName));
+        }
+
+        ranges.push_back({*IpFrom, *IpTo, itr->second});
     }
 
-    std::sort(_ipLocationStore.begin(),
-              _ipLocationStore.end(),
-              [](IpLocationRecord const& a, IpLocationRecord const& b) {
-                  return a.IpFrom < b.IpFrom;
+    std::sort(ranges.begin(),
+              ranges.end(),
+              [](IpRange const& a, IpRange const& b) {
+                  return a.From < b.From;
               });
-    ASSERT(std::is_sorted(
-               _ipLocationStore.begin(),
-               _ipLocationStore.end(),
-               [](IpLocationRecord const& a, IpLocationRecord const& b) {
-                   return a.IpFrom < b.IpTo;
-               }),
+    ASSERT(std::is_sorted(ranges.begin(),
+                          ranges.end(),
+                          [](IpRange const& a, IpRange const& b) {
+                              return a.From < b.To;
+                          }),
            "Overlapping IP ranges detected in database file");
 
     databaseFile.close();
 
+    _rangeEnds.reserve(ranges.size());
+    _rangeStarts.reserve(ranges.size());
+    _rangeLocations.reserve(ranges.size());
+    for (IpRange const& range : ranges) {
+        _rangeEnds.push_back(range.To);
+        _rangeStarts.push_back(range.From);
+        _rangeLocations.push_back(range.Location);
+    }
+
     LOG_INFO("server.loading",
-             ">> Loaded {} ip location entries.",
-             static_cast<uint32>(_ipLocationStore.size()));
+             ">> Loaded {} ip location entries ({} countries).",
+             static_cast<uint32>(_rangeEnds.size()),
+             static_cast<uint32>(_locations.size()));
     LOG_INFO("server.loading", " ");
 }
 
@@ -132,20 +187,16 @@ IpLocationStore::GetLocationRecord(std::string const& ipAddress) const
 {
     uint32 ip =
         Acore::Net::address_to_uint(Acore::Net::make_address_v4(ipAddress));
-    auto itr = std::upper_bound(
-        _ipLocationStore.begin(),
-        _ipLocationStore.end(),
-        ip,
-        [](uint32 ip, IpLocationRecord const& loc) { return ip < loc.IpTo; });
-    if (itr == _ipLocationStore.end()) {
+    std::size_t const index = FindRangeEnd(_rangeEnds, ip);
+    if (index == _rangeEnds.size()) {
         return nullptr;
     }
 
-    if (ip < itr->IpFrom) {
+    if (ip < _rangeStarts[index]) {
         return nullptr;
     }
 
-    return &(*itr);
+    return &_locations[_rangeLocations[index]];
 }
 
 IpLocationStore* IpLocationStore::instance()
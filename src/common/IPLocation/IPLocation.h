@@ -20,19 +20,15 @@
 #include <string>
 #include <vector>
 
+// Shared by every ip range of the same country
 struct IpLocationRecord {
-    IpLocationRecord() : IpFrom(0), IpTo(0) {}
-    IpLocationRecord(uint32      ipFrom,
-                     uint32      ipTo,
-                     std::string countryCode,
-                     std::string countryName)
-        : IpFrom(ipFrom), IpTo(ipTo), CountryCode(std::move(countryCode)),
+    IpLocationRecord() = default;
+    IpLocationRecord(std::string countryCode, std::string countryName)
+        : CountryCode(std::move(countryCode)),
           CountryName(std::move(countryName))
     {
     }
 
-    uint32      IpFrom;
-    uint32      IpTo;
     std::string CountryCode;
     std::string CountryName;
 };
@@ -48,7 +44,13 @@ public:
     GetLocationRecord(std::string const& ipAddress) const;
 
 private:
-    std::vector<IpLocationRecord> _ipLocationStore;
+    // Ranges sorted by ip, stored column-wise so the search only touches
+    // _rangeEnds
+    std::vector<uint32> _rangeEnds;
+    std::vector<uint32> _rangeStarts;
+    std::vector<uint16> _rangeLocations;
+
+    std::vector<IpLocationRecord> _locations;
 };
 
 #define sIPLocation IpLocationStore::instance()
@@ -45,6 +45,7 @@ public:
     void               write(LogMessage* message);
     static char const* getLogLevelString(LogLevel level);
     virtual void       setRealmId(uint32 /*realmId*/) {}
+    virtual void       flush() {}
 
 private:
     virtual void _write(LogMessage const* /*message*/) = 0;
@@ -112,10 +112,18 @@ void AppenderFile::_write(LogMessage const* message)
     }
 
     fprintf(logfile, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-    fflush(logfile);
+    // queued messages are flushed by Log once the whole burst is written
+    if (!sLog->HasQueuedMessages())
+        fflush(logfile);
     _fileSize += uint64(message->Size());
 }
 
+void AppenderFile::flush()
+{
+    if (logfile)
+        fflush(logfile);
+}
+
 FILE* AppenderFile::OpenFile(std::string const& filename,
                              std::string const& mode,
                              bool               backup)
@@ -35,6 +35,7 @@ public:
     FILE*
     OpenFile(std::string const& name, std::string const& mode, bool backup);
     AppenderType getType() const override { return type; }
+    void         flush() override;
 
 private:
     void                CloseFile();
@@ -269,15 +269,27 @@ void Log::write(std::unique_ptr<LogMessage>&& msg) const
     if (_ioContext) {
         std::shared_ptr<LogOperation> logOperation =
             std::make_shared<LogOperation>(logger, std::move(msg));
+        _queuedMessages.fetch_add(1, std::memory_order_relaxed);
         Acore::Asio::post(
-            *_ioContext, Acore::Asio::bind_executor(*_strand, [logOperation]() {
+            *_ioContext,
+            Acore::Asio::bind_executor(*_strand, [this, logOperation]() {
                 logOperation->call();
+                // last message of the burst, flush everything it wrote
+                if (_queuedMessages.fetch_sub(1, std::memory_order_relaxed) ==
+                    1)
+                    flushAppenders();
             }));
     }
     else
         logger->write(msg.get());
 }
 
+void Log::flushAppenders() const
+{
+    for (auto const& [id, appender] : appenders)
+        appender->flush();
+}
+
 Logger const* Log::GetLoggerByType(std::string const& type) const
 {
     auto it = loggers.find(type);
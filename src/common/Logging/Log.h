@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -108,6 +109,13 @@ public:
         RegisterAppender(AppenderImpl::type, &CreateAppender<AppenderImpl>);
     }
 
+    /// True while asynchronous messages wait in the queue or are being
+    /// written, appenders then leave flushing to the end of the burst.
+    [[nodiscard]] bool HasQueuedMessages() const
+    {
+        return _queuedMessages.load(std::memory_order_relaxed) != 0;
+    }
+
     [[nodiscard]] std::string const& GetLogsDir() const { return m_logsDir; }
     [[nodiscard]] std::string const& GetLogsTimestamp() const
     {
@@ -117,6 +125,7 @@ public:
 private:
     static std::string GetTimestampStr();
     void               write(std::unique_ptr<LogMessage>&& msg) const;
+    void               flushAppenders() const;
 
     [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
     Appender*                   GetAppenderByName(std::string_view name);
@@ -142,6 +151,8 @@ private:
 
     Acore::Asio::IoContext* _ioContext;
     Acore::Asio::Strand*    _strand;
+
+    mutable std::atomic<uint32> _queuedMessages{0};
 };
 
 #define sLog Log::instance()
@@ -21,6 +21,7 @@
 #include "DeadlineTimer.h"
 #include "Log.h"
 #include "Strand.h"
+#include "StringFormat.h"
 #include "Tokenize.h"
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -84,6 +85,9 @@ void Metric::LoadFromConfigs()
         _updateInterval = 1;
     }
 
+    _maxQueuedData =
+        sConfigMgr->GetOption<uint32>("Metric.MaxQueuedData", 100000);
+
     _overallStatusTimerInterval =
         sConfigMgr->GetOption<int32>("Metric.OverallStatusInterval", 1);
     if (_overallStatusTimerInterval < 1) {
@@ -162,6 +166,9 @@ void Metric::LogEvent(std::string const& category,
 {
     using namespace std::chrono;
 
+    if (!ReserveQueueSlot())
+        return;
+
     MetricData* data = new MetricData;
     data->Category   = category;
     data->Timestamp  = system_clock::now();
@@ -172,49 +179,77 @@ void Metric::LogEvent(std::string const& category,
     _queuedData.Enqueue(data);
 }
 
-void Metric::SendBatch()
+bool Metric::ReserveQueueSlot()
+{
+    // a slow metric backend must not make the queue grow without bound
+    if (!_maxQueuedData ||
+        _queuedDataCount.fetch_add(1, std::memory_order_relaxed) <
+            _maxQueuedData)
+        return true;
+
+    _queuedDataCount.fetch_sub(1, std::memory_order_relaxed);
+    _droppedDataCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void Metric::AppendLine(MetricData const& data)
 {
     using namespace std::chrono;
 
-    std::stringstream batchedData;
-    MetricData*       data;
-    bool              firstLoop = true;
+    auto out = std::back_inserter(_batchBuffer);
+    if (!_batchBuffer.empty())
+        _batchBuffer += '\n';
+
+    _batchBuffer += data.Category;
+    if (!_realmName.empty())
+        fmt::format_to(out, ",realm={}", _realmName);
+
+    for (MetricTag const& tag : data.Tags)
+        fmt::format_to(
+            out, ",{}={}", tag.first, FormatInfluxDBTagValue(tag.second));
+
+    switch (data.Type) {
+    case METRIC_DATA_VALUE:
+        fmt::format_to(out, " value={}", data.Value);
+        break;
+    case METRIC_DATA_EVENT:
+        fmt::format_to(out, " title=\"{}\",text=\"{}\"", data.Title, data.Text);
+        break;
+    }
 
-    while (_queuedData.Dequeue(data)) {
-        if (!firstLoop)
-            batchedData << "\n";
-
-        batchedData << data->Category;
-        if (!_realmName.empty())
-            batchedData << ",realm=" << _realmName;
-
-        for (MetricTag const& tag : data->Tags)
-            batchedData << "," << tag.first << "="
-                        << FormatInfluxDBTagValue(tag.second);
-
-        batchedData << " ";
-
-        switch (data->Type) {
-        case METRIC_DATA_VALUE:
-            batchedData << "value=" << data->Value;
-            break;
-        case METRIC_DATA_EVENT:
-            batchedData << "title=\"" << data->Title << "\",text=\""
-                        << data->Text << "\"";
-            break;
-        }
+    fmt::format_to(
+        out,
+        " {}",
+        duration_cast<nanoseconds>(data.Timestamp.time_since_epoch()).count());
+}
 
-        batchedData << " "
-                    << std::to_string(duration_cast<nanoseconds>(
-                                          data->Timestamp.time_since_epoch())
-                                          .count());
+void Metric::SendBatch()
+{
+    // the buffer keeps its capacity, steady batches do not reallocate
+    _batchBuffer.clear();
 
-        firstLoop = false;
+    MetricData* data;
+    uint32      dequeued = 0;
+    while (_queuedData.Dequeue(data)) {
+        AppendLine(*data);
         delete data;
+        ++dequeued;
+    }
+
+    _queuedDataCount.fetch_sub(dequeued, std::memory_order_relaxed);
+
+    if (uint32 dropped =
+            _droppedDataCount.exchange(0, std::memory_order_relaxed)) {
+        MetricData droppedData;
+        droppedData.Category  = "metric_dropped_data";
+        droppedData.Timestamp = std::chrono::system_clock::now();
+        droppedData.Type      = METRIC_DATA_VALUE;
+        droppedData.Value     = FormatInfluxDBValue(dropped);
+        AppendLine(droppedData);
     }
 
     // Check if there's any data to send
-    if (batchedData.tellp() == std::streampos(0)) {
+    if (_batchBuffer.empty()) {
         ScheduleSend();
         return;
     }
@@ -229,9 +264,9 @@ void Metric::SendBatch()
     GetDataStream() << "Content-Type: application/octet-stream\r\n";
     GetDataStream() << "Content-Transfer-Encoding: binary\r\n";
 
-    GetDataStream() << "Content-Length: " << std::to_string(batchedData.tellp())
+    GetDataStream() << "Content-Length: " << std::to_string(_batchBuffer.size())
                     << "\r\n\r\n";
-    GetDataStream() << batchedData.rdbuf();
+    GetDataStream().write(_batchBuffer.data(), _batchBuffer.size());
 
     std::string http_version;
     GetDataStream() >> http_version;
@@ -275,6 +310,7 @@ void Metric::ScheduleSend()
         // Clear the queue
         while (_queuedData.Dequeue(data)) {
             delete data;
+            _queuedDataCount.fetch_sub(1, std::memory_order_relaxed);
         }
     }
 }
@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "Duration.h"
 #include "MPSCQueue.h"
+#include <atomic>
 #include <functional>
 #include <iosfwd>
 #include <memory>
@@ -58,6 +59,10 @@ private:
     std::iostream&                 GetDataStream() { return *_dataStream; }
     std::unique_ptr<std::iostream> _dataStream;
     MPSCQueue<MetricData>          _queuedData;
+    std::atomic<uint32>            _queuedDataCount{0};
+    std::atomic<uint32>            _droppedDataCount{0};
+    uint32                         _maxQueuedData = 0;
+    std::string                    _batchBuffer;
     std::unique_ptr<Acore::Asio::DeadlineTimer> _batchTimer;
     std::unique_ptr<Acore::Asio::DeadlineTimer> _overallStatusTimer;
     int32                                       _updateInterval             = 0;
@@ -72,6 +77,8 @@ private:
     std::unordered_map<std::string, int64> _thresholds;
 
     bool Connect();
+    bool ReserveQueueSlot();
+    void AppendLine(MetricData const& data);
     void SendBatch();
     void ScheduleSend();
     void ScheduleOverallStatusLog();
@@ -110,6 +117,9 @@ public:
     {
         using namespace std::chrono;
 
+        if (!ReserveQueueSlot())
+            return;
+
         MetricData* data = new MetricData;
         data->Category   = category;
         data->Timestamp  = system_clock::now();
@@ -173,6 +183,7 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
 #define METRIC_DETAILED_EVENT(category, title, description) ((void)0)
 #define METRIC_DETAILED_TIMER(category, ...) ((void)0)
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) ((void)0)
+#define METRIC_DETAILED_VALUE(category, value, ...) ((void)0)
 #else
 #if AC_PLATFORM != AC_PLATFORM_WINDOWS
 #define METRIC_EVENT(category, title, description)                             \
@@ -223,12 +234,21 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
         });
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...)                      \
     METRIC_TIMER(category, __VA_ARGS__)
+#define METRIC_DETAILED_VALUE(category, value, ...)                            \
+    do {                                                                       \
+        if (sMetric->IsEnabled()) {                                            \
+            int64 const metricValue = int64(value);                            \
+            if (sMetric->ShouldLog(category, metricValue))                     \
+                sMetric->LogValue(category, metricValue, {__VA_ARGS__});       \
+        }                                                                      \
+    } while (0)
 #define METRIC_DETAILED_EVENT(category, title, description)                    \
     METRIC_EVENT(category, title, description)
 #else
 #define METRIC_DETAILED_EVENT(category, title, description) ((void)0)
 #define METRIC_DETAILED_TIMER(category, ...) ((void)0)
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) ((void)0)
+#define METRIC_DETAILED_VALUE(category, value, ...) ((void)0)
 #endif
 
 #endif
@@ -58,6 +58,18 @@ public:
         _queue.insert(_queue.begin(), begin, end);
     }
 
+    //! Moves up to max items from the front of the queue to the back of
+    //! out under a single lock.
+    template <class Container>
+    void drain(Container& out, std::size_t max)
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        auto end = _queue.size() > max ? _queue.begin() + max : _queue.end();
+        out.insert(out.end(), _queue.begin(), end);
+        _queue.erase(_queue.begin(), end);
+    }
+
     //! Gets the next result in the queue, if any.
     bool next(T& result)
     {
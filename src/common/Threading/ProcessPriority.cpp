@@ -18,10 +18,14 @@
 
 #include "ProcessPriority.h"
 #include "Log.h"
+#include "StringConvert.h"
+#include "Tokenize.h"
 
 #ifdef _WIN32 // Windows
 #include <Windows.h>
 #elif defined(__linux__)
+#include <filesystem>
+#include <pthread.h>
 #include <sched.h>
 #include <sys/resource.h>
 #define PROCESS_HIGH_PRIORITY -15 // [-20, 19], default is 0
@@ -119,3 +123,90 @@ void SetProcessPriority(std::string const& logChannel,
     (void)highPriority;
 #endif
 }
+
+std::vector<uint32> ParseProcessorList(std::string_view list)
+{
+    std::vector<uint32> processors;
+    for (std::string_view part : Acore::Tokenize(list, ',', false)) {
+        std::size_t const dash  = part.find('-');
+        Optional<uint32>  first = Acore::StringTo<uint32>(part.substr(0, dash));
+        Optional<uint32>  last  = first;
+        if (dash != std::string_view::npos)
+            last = Acore::StringTo<uint32>(part.substr(dash + 1));
+
+        if (!first || !last || *last < *first) {
+            LOG_ERROR("server.loading",
+                      "Invalid processor range '{}' in list '{}', skipped",
+                      part,
+                      list);
+            continue;
+        }
+
+        for (uint32 processor = *first; processor <= *last; ++processor)
+            processors.push_back(processor);
+    }
+
+    return processors;
+}
+
+uint32 GetProcessorNumaNode([[maybe_unused]] uint32 processor)
+{
+#ifdef _WIN32
+    UCHAR node = 0;
+    if (processor < 64 && GetNumaProcessorNode(UCHAR(processor), &node))
+        return node;
+#elif defined(__linux__)
+    // the cpu directory contains a nodeN link to the node it belongs to
+    std::error_code ec;
+    for (auto const& entry : std::filesystem::directory_iterator(
+             "/sys/devices/system/cpu/cpu" + std::to_string(processor), ec)) {
+        std::string const name = entry.path().filename().string();
+        if (name.starts_with("node"))
+            if (Optional<uint32> node = Acore::StringTo<uint32>(name.substr(4)))
+                return *node;
+    }
+#endif
+    return 0;
+}
+
+bool SetThreadAffinity(std::string const& logChannel,
+                       std::string const& threadName,
+                       uint32             processor)
+{
+#ifdef _WIN32
+    if (processor >= 64 ||
+        !SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << processor)) {
+        LOG_ERROR(logChannel,
+                  "Can't pin {} to processor {}",
+                  threadName,
+                  processor);
+        return false;
+    }
+#elif defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(processor, &mask);
+    if (int error =
+            pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask)) {
+        LOG_ERROR(logChannel,
+                  "Can't pin {} to processor {}, error: {}",
+                  threadName,
+                  processor,
+                  strerror(error));
+        return false;
+    }
+#else
+    LOG_ERROR(logChannel,
+              "Thread affinity is not supported on this platform, {} is not "
+              "pinned",
+              threadName);
+    return false;
+#endif
+
+    LOG_INFO(logChannel,
+             "{} pinned to processor {} (NUMA node {})",
+             threadName,
+             processor,
+             GetProcessorNumaNode(processor));
+    return true;
+}
@@ -21,6 +21,8 @@
 
 #include "Define.h"
 #include <string>
+#include <string_view>
+#include <vector>
 
 #define CONFIG_PROCESSOR_AFFINITY "UseProcessors"
 #define CONFIG_HIGH_PRIORITY "ProcessPriority"
@@ -29,4 +31,17 @@ void AC_COMMON_API SetProcessPriority(std::string const& logChannel,
                                       uint32             affinity,
                                       bool               highPriority);
 
+/// Parses a processor list like "0-3,8,10-11", invalid parts are skipped
+std::vector<uint32> AC_COMMON_API ParseProcessorList(std::string_view list);
+
+/// NUMA node the processor belongs to, 0 when it can't be determined
+uint32 AC_COMMON_API GetProcessorNumaNode(uint32 processor);
+
+/// Pins the calling thread to one processor. The kernel allocates the memory
+/// a thread touches first on the NUMA node it runs on, so data created by a
+/// pinned thread stays local to it.
+bool AC_COMMON_API SetThreadAffinity(std::string const& logChannel,
+                                     std::string const& threadName,
+                                     uint32             processor);
+
 #endif
@@ -44,18 +44,24 @@ public:
         if (_callbacks.empty())
             return;
 
-        std::vector<T> updateCallbacks{std::move(_callbacks)};
+        // Callbacks may add new callbacks while being invoked, so the pending
+        // ones are moved aside first. Both buffers keep their capacity, which
+        // saves two allocations per call.
+        std::swap(_callbacks, _processing);
 
-        updateCallbacks.erase(
+        _processing.erase(
             std::remove_if(
-                updateCallbacks.begin(),
-                updateCallbacks.end(),
+                _processing.begin(),
+                _processing.end(),
                 [](T& callback) { return callback.InvokeIfReady(); }),
-            updateCallbacks.end());
+            _processing.end());
 
-        _callbacks.insert(_callbacks.end(),
-                          std::make_move_iterator(updateCallbacks.begin()),
-                          std::make_move_iterator(updateCallbacks.end()));
+        _processing.insert(_processing.end(),
+                           std::make_move_iterator(_callbacks.begin()),
+                           std::make_move_iterator(_callbacks.end()));
+        _callbacks.clear();
+
+        std::swap(_callbacks, _processing);
     }
 
 private:
@@ -63,6 +69,7 @@ private:
     AsyncCallbackProcessor& operator=(AsyncCallbackProcessor const&) = delete;
 
     std::vector<T> _callbacks;
+    std::vector<T> _processing;
 };
 
 #endif // AsyncCallbackProcessor_h__
@@ -18,12 +18,28 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+struct EventLater {
+    template <typename E>
+    bool operator()(E const& left, E const& right) const
+    {
+        if (left.Time != right.Time)
+            return left.Time > right.Time;
+
+        return left.Sequence > right.Sequence;
+    }
+};
+} // namespace
 
 void EventMap::Reset()
 {
     _eventMap.clear();
-    _time  = 0;
-    _phase = 0;
+    _time         = 0;
+    _phase        = 0;
+    _nextSequence = 0;
 }
 
 void EventMap::SetPhase(uint8 phase)
@@ -63,7 +79,7 @@ void EventMap::ScheduleEvent(uint32 eventId,
         eventId |= (1 << (phase + 23));
     }
 
-    _eventMap.emplace(_time + time, eventId);
+    PushEvent(_time + time, eventId);
 }
 
 void EventMap::ScheduleEvent(uint32       eventId,
@@ -111,10 +127,7 @@ void EventMap::RescheduleEvent(uint32       eventId,
     ScheduleEvent(eventId, randtime(minTime, maxTime).count(), group, phase);
 }
 
-void EventMap::RepeatEvent(uint32 time)
-{
-    _eventMap.emplace(_time + time, _lastEvent);
-}
+void EventMap::RepeatEvent(uint32 time) { PushEvent(_time + time, _lastEvent); }
 
 void EventMap::Repeat(Milliseconds time) { RepeatEvent(time.count()); }
 
@@ -126,19 +139,19 @@ void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
 uint32 EventMap::ExecuteEvent()
 {
     while (!Empty()) {
-        auto const& itr = _eventMap.begin();
+        Event const& event = _eventMap.front();
 
-        if (itr->first > _time) {
+        if (event.Time > _time) {
             return 0;
         }
-        else if (_phase && (itr->second & 0xFF000000) &&
-                 !((itr->second >> 24) & _phase)) {
-            _eventMap.erase(itr);
+        else if (_phase && (event.Data & 0xFF000000) &&
+                 !((event.Data >> 24) & _phase)) {
+            PopEvent();
         }
         else {
-            uint32 eventId = (itr->second & 0x0000FFFF);
-            _lastEvent     = itr->second;
-            _eventMap.erase(itr);
+            uint32 eventId = (event.Data & 0x0000FFFF);
+            _lastEvent     = event.Data;
+            PopEvent();
             return eventId;
         }
     }
@@ -159,36 +172,23 @@ void EventMap::DelayEvents(uint32 delay, uint32 group)
         return;
     }
 
-    EventStore delayed;
-
-    for (EventStore::iterator itr = _eventMap.begin();
-         itr != _eventMap.end();) {
-        if (!group || (itr->second & (1 << (group + 15)))) {
-            delayed.insert(
-                EventStore::value_type(itr->first + delay, itr->second));
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
-
-    _eventMap.insert(delayed.begin(), delayed.end());
+    ReinsertEvents(
+        [group](Event const& event) {
+            return !group || (event.Data & (1 << (group + 15)));
+        },
+        [delay](Event const& event) { return event.Time + delay; });
 }
 
 void EventMap::DelayEventsToMax(uint32 delay, uint32 group)
 {
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();) {
-        if (itr->first < _time + delay &&
-            (group == 0 || ((1 << (group + 15)) & itr->second))) {
-            ScheduleEvent(itr->second, delay);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+    uint32 const maxTime = _time + delay;
+
+    ReinsertEvents(
+        [maxTime, group](Event const& event) {
+            return event.Time < maxTime &&
+                   (group == 0 || ((1 << (group + 15)) & event.Data));
+        },
+        [maxTime](Event const& /*event*/) { return maxTime; });
 }
 
 void EventMap::CancelEvent(uint32 eventId)
@@ -197,14 +197,16 @@ void EventMap::CancelEvent(uint32 eventId)
         return;
     }
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();) {
-        if (eventId == (itr->second & 0x0000FFFF)) {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
+    auto end = std::remove_if(
+        _eventMap.begin(), _eventMap.end(), [eventId](Event const& event) {
+            return eventId == (event.Data & 0x0000FFFF);
+        });
 
-        ++itr;
-    }
+    if (end == _eventMap.end())
+        return;
+
+    _eventMap.erase(end, _eventMap.end());
+    std::make_heap(_eventMap.begin(), _eventMap.end(), EventLater());
 }
 
 void EventMap::CancelEventGroup(uint32 group)
@@ -214,28 +216,22 @@ void EventMap::CancelEventGroup(uint32 group)
     }
 
     uint32 groupMask = (1 << (group + 15));
-    for (EventStore::iterator itr = _eventMap.begin();
-         itr != _eventMap.end();) {
-        if (itr->second & groupMask) {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
+    auto   end       = std::remove_if(
+        _eventMap.begin(), _eventMap.end(), [groupMask](Event const& event) {
+            return event.Data & groupMask;
+        });
 
-        ++itr;
-    }
+    if (end == _eventMap.end())
+        return;
+
+    _eventMap.erase(end, _eventMap.end());
+    std::make_heap(_eventMap.begin(), _eventMap.end(), EventLater());
 }
 
 uint32 EventMap::GetNextEventTime(uint32 eventId) const
 {
-    if (Empty()) {
-        return 0;
-    }
-
-    for (auto const& itr : _eventMap) {
-        if (eventId == (itr.second & 0x0000FFFF)) {
-            return itr.first;
-        }
+    if (Event const* event = FindNextEvent(eventId)) {
+        return event->Time;
     }
 
     return 0;
@@ -243,7 +239,7 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
 
 uint32 EventMap::GetNextEventTime() const
 {
-    return Empty() ? 0 : _eventMap.begin()->first;
+    return Empty() ? 0 : _eventMap.front().Time;
 }
 
 bool EventMap::IsInPhase(uint8 phase)
@@ -253,10 +249,79 @@ bool EventMap::IsInPhase(uint8 phase)
 
 Milliseconds EventMap::GetTimeUntilEvent(uint32 eventId) const
 {
-    for (std::pair<uint32 const, uint32> const& itr : _eventMap)
-        if (eventId == (itr.second & 0x0000FFFF))
-            return std::chrono::duration_cast<Milliseconds>(
-                Milliseconds(itr.first) - Milliseconds(_time));
+    if (Event const* event = FindNextEvent(eventId))
+        return std::chrono::duration_cast<Milliseconds>(
+            Milliseconds(event->Time) - Milliseconds(_time));
 
     return Milliseconds::max();
 }
+
+EventMap::Event const* EventMap::FindNextEvent(uint32 eventId) const
+{
+    Event const* next = nullptr;
+    for (Event const& event : _eventMap)
+        if (eventId == (event.Data & 0x0000FFFF) &&
+            (!next || EventLater()(*next, event)))
+            next = &event;
+
+    return next;
+}
+
+void EventMap::PushEvent(uint32 time, uint32 data)
+{
+    if (_nextSequence == std::numeric_limits<uint32>::max())
+        RenumberEvents();
+
+    _eventMap.push_back({time, data, _nextSequence++});
+    std::push_heap(_eventMap.begin(), _eventMap.end(), EventLater());
+}
+
+void EventMap::PopEvent()
+{
+    std::pop_heap(_eventMap.begin(), _eventMap.end(), EventLater());
+    _eventMap.pop_back();
+}
+
+template <typename Predicate, typename TimeGetter>
+void EventMap::ReinsertEvents(Predicate&& predicate, TimeGetter&& getNewTime)
+{
+    if (std::numeric_limits<uint32>::max() - _nextSequence < _eventMap.size())
+        RenumberEvents();
+
+    auto moved = std::partition(
+        _eventMap.begin(), _eventMap.end(), [&predicate](Event const& event) {
+            return !predicate(event);
+        });
+
+    if (moved == _eventMap.end())
+        return;
+
+    // keep the original execution order of the moved events
+    std::sort(moved,
+              _eventMap.end(),
+              [](Event const& left, Event const& right) {
+                  return EventLater()(right, left);
+              });
+
+    for (auto itr = moved; itr != _eventMap.end(); ++itr) {
+        itr->Time     = getNewTime(*itr);
+        itr->Sequence = _nextSequence++;
+    }
+
+    std::make_heap(_eventMap.begin(), _eventMap.end(), EventLater());
+}
+
+void EventMap::RenumberEvents()
+{
+    std::sort(_eventMap.begin(),
+              _eventMap.end(),
+              [](Event const& left, Event const& right) {
+                  return EventLater()(right, left);
+              });
+
+    _nextSequence = 0;
+    for (Event& event : _eventMap)
+        event.Sequence = _nextSequence++;
+
+    // a sorted range is a valid min-heap, nothing else to do
+}
@@ -21,13 +21,15 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <boost/container/small_vector.hpp>
 
 class EventMap {
     /**
      * Internal storage type.
-     * Key: Time as TimePoint when the event should occur.
-     * Value: The event data as uint32.
+     * Time: Time as uint32 when the event should occur.
+     * Data: The event data as uint32.
+     * Sequence: Insertion counter, keeps events scheduled for the same
+     * time in the order they were scheduled.
      *
      * Structure of event data:
      * - Bit  0 - 15: Event Id.
@@ -35,7 +37,18 @@ class EventMap {
      * - Bit 24 - 31: Phase
      * - Pattern: 0xPPGGEEEE
      */
-    typedef std::multimap<uint32, uint32> EventStore;
+    struct Event {
+        uint32 Time;
+        uint32 Data;
+        uint32 Sequence;
+    };
+
+    /**
+     * Events are kept as a binary min-heap ordered by (Time, Sequence).
+     * Most creatures never have more than a handful of events scheduled,
+     * those are stored inline without any heap allocation.
+     */
+    typedef boost::container::small_vector<Event, 4> EventStore;
 
 public:
     EventMap() {}
@@ -339,14 +352,41 @@ private:
      */
     uint32 _lastEvent{0};
 
+    /**
+     * @name _nextSequence
+     * @brief Sequence number given to the next scheduled event.
+     */
+    uint32 _nextSequence{0};
+
     /**
      * @name _eventMap
-     * @brief Internal event storage map. Contains the scheduled events.
+     * @brief Internal event storage heap. Contains the scheduled events.
      *
      * See typedef at the beginning of the class for more
      * details.
      */
     EventStore _eventMap;
+
+    void PushEvent(uint32 time, uint32 data);
+    void PopEvent();
+
+    /**
+     * @name ReinsertEvents
+     * @brief Moves the events matching the predicate to a new time, keeping
+     * their relative order and placing them behind events already scheduled
+     * for the same time.
+     */
+    template <typename Predicate, typename TimeGetter>
+    void ReinsertEvents(Predicate&& predicate, TimeGetter&& getNewTime);
+
+    void RenumberEvents();
+
+    /**
+     * @name FindNextEvent
+     * @brief Returns the earliest scheduled event with the given id or
+     * nullptr.
+     */
+    [[nodiscard]] Event const* FindNextEvent(uint32 eventId) const;
 };
 
 #endif
@@ -190,6 +190,8 @@ public:
 
     void CancelEventGroup(uint8 group);
 
+    [[nodiscard]] bool Empty() const { return m_events.empty(); }
+
 protected:
     uint64    m_time{0};
     EventList m_events;
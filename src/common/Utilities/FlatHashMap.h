@@ -0,0 +1,153 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_FLAT_HASH_MAP_H
+#define ACORE_FLAT_HASH_MAP_H
+
+#include "Define.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Acore {
+/// Open addressing hash map with linear probing for integral keys. Keys and
+/// values are stored next to each other in one array, a key equal to Key()
+/// marks an empty slot and can't be inserted. Erase shifts the following
+/// entries back, so lookups never have to skip tombstones.
+template <typename Key, typename Value>
+class FlatHashMap {
+    static_assert(std::is_integral_v<Key>, "FlatHashMap needs integral keys");
+
+    struct Slot {
+        Key   First;
+        Value Second;
+    };
+
+public:
+    FlatHashMap() = default;
+
+    static uint64 Hash(Key key)
+    {
+        // splitmix64 finalizer, spreads sequential guids over all slots
+        uint64 hash = static_cast<uint64>(key);
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    /// Returns the stored value or Value() when the key isn't present
+    [[nodiscard]] Value Find(Key key) const
+    {
+        if (_slots.empty())
+            return Value();
+
+        for (std::size_t index = Hash(key) & _mask;;
+             index             = (index + 1) & _mask) {
+            Slot const& slot = _slots[index];
+            if (slot.First == key)
+                return slot.Second;
+
+            if (slot.First == Key())
+                return Value();
+        }
+    }
+
+    /// Inserts or replaces the value for key
+    void Insert(Key key, Value value)
+    {
+        if ((_size + 1) * 2 > _slots.size())
+            Rehash(_slots.empty() ? 16 : _slots.size() * 2);
+
+        std::size_t index = Hash(key) & _mask;
+        while (_slots[index].First != Key() && _slots[index].First != key)
+            index = (index + 1) & _mask;
+
+        if (_slots[index].First == Key())
+            ++_size;
+
+        _slots[index].First  = key;
+        _slots[index].Second = std::move(value);
+    }
+
+    bool Erase(Key key)
+    {
+        if (_slots.empty())
+            return false;
+
+        std::size_t index = Hash(key) & _mask;
+        while (_slots[index].First != key) {
+            if (_slots[index].First == Key())
+                return false;
+
+            index = (index + 1) & _mask;
+        }
+
+        // move back every following entry which would not be found anymore
+        // through the freed slot
+        std::size_t next = index;
+        for (;;) {
+            next = (next + 1) & _mask;
+            if (_slots[next].First == Key())
+                break;
+
+            std::size_t const home = Hash(_slots[next].First) & _mask;
+            if (((next - home) & _mask) >= ((next - index) & _mask)) {
+                _slots[index] = std::move(_slots[next]);
+                index         = next;
+            }
+        }
+
+        _slots[index] = Slot{Key(), Value()};
+        --_size;
+        return true;
+    }
+
+    void Clear()
+    {
+        _slots.clear();
+        _mask = 0;
+        _size = 0;
+    }
+
+    [[nodiscard]] std::size_t Size() const { return _size; }
+    [[nodiscard]] bool        Empty() const { return _size == 0; }
+
+private:
+    void Rehash(std::size_t capacity)
+    {
+        std::vector<Slot> slots(capacity, Slot{Key(), Value()});
+        std::swap(slots, _slots);
+        _mask = capacity - 1;
+        _size = 0;
+
+        for (Slot& slot : slots)
+            if (slot.First != Key())
+                Insert(slot.First, std::move(slot.Second));
+    }
+
+    std::vector<Slot> _slots;
+    std::size_t       _mask = 0;
+    std::size_t       _size = 0;
+};
+} // namespace Acore
+
+#endif
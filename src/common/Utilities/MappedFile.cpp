@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace Acore {
+struct MappedFile::Region {
+    boost::interprocess::mapped_region Mapping;
+};
+
+MappedFile::MappedFile() : _data(nullptr), _size(0), _writable(false) {}
+
+MappedFile::~MappedFile() = default;
+
+bool MappedFile::Open(std::string const& fileName, bool copyOnWrite)
+{
+    Close();
+
+    namespace bip = boost::interprocess;
+    try {
+        // the region keeps the pages mapped after the file mapping (and its
+        // handle) is destroyed
+        bip::file_mapping file(fileName.c_str(), bip::read_only);
+        _region = std::make_unique<Region>(Region{bip::mapped_region(
+            file, copyOnWrite ? bip::copy_on_write : bip::read_only)});
+    }
+    catch (bip::interprocess_exception const&) {
+        return false;
+    }
+
+    _data     = static_cast<uint8*>(_region->Mapping.get_address());
+    _size     = _region->Mapping.get_size();
+    _writable = copyOnWrite;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    _region.reset();
+    _data     = nullptr;
+    _size     = 0;
+    _writable = false;
+}
+} // namespace Acore
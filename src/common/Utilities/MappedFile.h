@@ -0,0 +1,65 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_MAPPED_FILE_H
+#define ACORE_MAPPED_FILE_H
+
+#include "Define.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Acore {
+/// Read only memory mapping of a whole file. The pages are shared through the
+/// page cache with every other mapping of the same file, also across
+/// processes, and the file handle is closed as soon as the mapping exists.
+class AC_COMMON_API MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    /// Maps the file, returns false if it doesn't exist, is empty or can't
+    /// be mapped. Pages of a copy on write mapping are only copied once they
+    /// are written to, the file itself is never modified.
+    bool Open(std::string const& fileName, bool copyOnWrite = false);
+    void Close();
+
+    [[nodiscard]] bool         IsOpen() const { return _data != nullptr; }
+    [[nodiscard]] uint8 const* GetData() const { return _data; }
+    [[nodiscard]] std::size_t  GetSize() const { return _size; }
+
+    /// Returns the mapping of a copy on write file, nullptr otherwise
+    [[nodiscard]] uint8* GetWritableData() const
+    {
+        return _writable ? _data : nullptr;
+    }
+
+private:
+    struct Region;
+
+    std::unique_ptr<Region> _region;
+    uint8*                  _data;
+    std::size_t             _size;
+    bool                    _writable;
+};
+} // namespace Acore
+
+#endif
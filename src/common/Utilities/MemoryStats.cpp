@@ -0,0 +1,92 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MemoryStats.h"
+#include <cstddef>
+#include <cstdint>
+
+#if AC_PLATFORM == AC_PLATFORM_UNIX
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+#ifdef ACORE_WITH_JEMALLOC
+// Declared here instead of including jemalloc.h, whose include directory is
+// private to the jemalloc target
+extern "C" int mallctl(char const* name,
+                       void*       oldp,
+                       size_t*     oldlenp,
+                       void*       newp,
+                       size_t      newlen);
+#endif
+
+namespace Acore::Memory {
+#ifdef ACORE_WITH_JEMALLOC
+namespace {
+bool ReadStat(char const* name, uint64& value)
+{
+    std::size_t stat = 0;
+    std::size_t size = sizeof(stat);
+    if (mallctl(name, &stat, &size, nullptr, 0) != 0)
+        return false;
+
+    value = stat;
+    return true;
+}
+} // namespace
+#endif
+
+AllocatorStats GetAllocatorStats()
+{
+    AllocatorStats stats;
+#ifdef ACORE_WITH_JEMALLOC
+    // statistics are cached by jemalloc, bumping the epoch refreshes them
+    uint64_t    epoch = 1;
+    std::size_t size  = sizeof(epoch);
+    if (mallctl("epoch", &epoch, &size, &epoch, size) != 0)
+        return stats;
+
+    stats.Available = ReadStat("stats.allocated", stats.Allocated) &&
+                      ReadStat("stats.active", stats.Active) &&
+                      ReadStat("stats.resident", stats.Resident) &&
+                      ReadStat("stats.mapped", stats.Mapped);
+#endif
+    return stats;
+}
+
+uint64 GetProcessResidentBytes()
+{
+#if AC_PLATFORM == AC_PLATFORM_UNIX
+    std::FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file)
+        return 0;
+
+    unsigned long long totalPages    = 0;
+    unsigned long long residentPages = 0;
+    int                read =
+        std::fscanf(file, "%llu %llu", &totalPages, &residentPages);
+    std::fclose(file);
+    if (read != 2)
+        return 0;
+
+    return uint64(residentPages) * uint64(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+} // namespace Acore::Memory
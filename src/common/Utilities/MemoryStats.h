@@ -0,0 +1,41 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_MEMORY_STATS_H
+#define ACORE_MEMORY_STATS_H
+
+#include "Define.h"
+
+namespace Acore::Memory {
+/// Heap usage as reported by the allocator. Only jemalloc builds with
+/// statistics enabled fill it in, Available is false otherwise.
+struct AllocatorStats {
+    bool   Available = false;
+    uint64 Allocated = 0; ///< bytes handed out to the application
+    uint64 Active    = 0; ///< bytes in pages holding live allocations
+    uint64 Resident  = 0; ///< bytes of allocator pages backed by memory
+    uint64 Mapped    = 0; ///< bytes of address space the allocator mapped
+};
+
+AC_COMMON_API AllocatorStats GetAllocatorStats();
+
+/// Resident set size of the whole process, 0 if the platform doesn't tell.
+AC_COMMON_API uint64 GetProcessResidentBytes();
+} // namespace Acore::Memory
+
+#endif
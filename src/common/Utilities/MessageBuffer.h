@@ -21,6 +21,8 @@
 
 #include "Define.h"
 #include <cstring>
+#include <memory>
+#include <utility>
 #include <vector>
 
 class MessageBuffer {
@@ -35,13 +37,32 @@ public:
         _storage.resize(initialSize);
     }
 
+    // Takes over already written data, e.g. the storage of a packet
+    explicit MessageBuffer(std::vector<uint8>&& storage)
+        : _wpos(storage.size()), _rpos(0), _storage(std::move(storage))
+    {
+    }
+
+    // Refers to read only data kept alive by owner, e.g. a packet queued on
+    // several sockets. Only the active data accessors may be used.
+    MessageBuffer(std::shared_ptr<void const> owner,
+                  uint8 const*                data,
+                  std::size_t                 size)
+        : _wpos(size), _rpos(0), _storage(), _sharedOwner(std::move(owner)),
+          _sharedData(data)
+    {
+    }
+
     MessageBuffer(MessageBuffer const& right)
-        : _wpos(right._wpos), _rpos(right._rpos), _storage(right._storage)
+        : _wpos(right._wpos), _rpos(right._rpos), _storage(right._storage),
+          _sharedOwner(right._sharedOwner), _sharedData(right._sharedData)
     {
     }
 
     MessageBuffer(MessageBuffer&& right) noexcept
-        : _wpos(right._wpos), _rpos(right._rpos), _storage(right.Move())
+        : _wpos(right._wpos), _rpos(right._rpos), _storage(right.Move()),
+          _sharedOwner(std::move(right._sharedOwner)),
+          _sharedData(std::exchange(right._sharedData, nullptr))
     {
     }
 
@@ -57,6 +78,12 @@ public:
     uint8* GetReadPointer() { return GetBasePointer() + _rpos; }
     uint8* GetWritePointer() { return GetBasePointer() + _wpos; }
 
+    // Start of the active data, also valid for shared buffers
+    [[nodiscard]] uint8 const* GetActiveData() const
+    {
+        return (_sharedData ? _sharedData : _storage.data()) + _rpos;
+    }
+
     void ReadCompleted(size_type bytes) { _rpos += bytes; }
     void WriteCompleted(size_type bytes) { _wpos += bytes; }
 
@@ -109,9 +136,11 @@ public:
     MessageBuffer& operator=(MessageBuffer const& right)
     {
         if (this != &right) {
-            _wpos    = right._wpos;
-            _rpos    = right._rpos;
-            _storage = right._storage;
+            _wpos        = right._wpos;
+            _rpos        = right._rpos;
+            _storage     = right._storage;
+            _sharedOwner = right._sharedOwner;
+            _sharedData  = right._sharedData;
         }
 
         return *this;
@@ -120,9 +149,11 @@ public:
     MessageBuffer& operator=(MessageBuffer&& right) noexcept
     {
         if (this != &right) {
-            _wpos    = right._wpos;
-            _rpos    = right._rpos;
-            _storage = right.Move();
+            _wpos        = right._wpos;
+            _rpos        = right._rpos;
+            _storage     = right.Move();
+            _sharedOwner = std::move(right._sharedOwner);
+            _sharedData  = std::exchange(right._sharedData, nullptr);
         }
 
         return *this;
@@ -132,6 +163,9 @@ private:
     size_type          _wpos{0};
     size_type          _rpos{0};
     std::vector<uint8> _storage;
+
+    std::shared_ptr<void const> _sharedOwner;
+    uint8 const*                _sharedData{nullptr};
 };
 
 #endif /* __MESSAGEBUFFER_H_ */
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MessageBufferPool.h"
+#include <array>
+#include <mutex>
+
+namespace {
+// client packets are smaller than 10240 bytes, see ClientPktHeader
+constexpr std::array<std::size_t, 4> SizeClasses = {64, 256, 1024, 10240};
+
+// cached bytes per size class
+constexpr std::size_t MaxCachedBytes = 1024 * 1024;
+
+struct SizeClass {
+    std::mutex                      Lock;
+    std::vector<std::vector<uint8>> Free;
+};
+
+std::array<SizeClass, SizeClasses.size()>& GetSizeClasses()
+{
+    static std::array<SizeClass, SizeClasses.size()> classes;
+    return classes;
+}
+} // namespace
+
+namespace Acore {
+std::vector<uint8> MessageBufferPool::Acquire(std::size_t size)
+{
+    std::vector<uint8> storage;
+    for (std::size_t i = 0; i < SizeClasses.size(); ++i) {
+        if (size > SizeClasses[i])
+            continue;
+
+        SizeClass& sizeClass = GetSizeClasses()[i];
+        {
+            std::lock_guard<std::mutex> guard(sizeClass.Lock);
+            if (!sizeClass.Free.empty()) {
+                storage = std::move(sizeClass.Free.back());
+                sizeClass.Free.pop_back();
+            }
+        }
+
+        if (!storage.capacity())
+            storage.reserve(SizeClasses[i]);
+
+        break;
+    }
+
+    storage.resize(size);
+    return storage;
+}
+
+void MessageBufferPool::Release(std::vector<uint8>&& storage)
+{
+    // the largest class the storage can still serve
+    std::size_t const capacity = storage.capacity();
+    for (std::size_t i = SizeClasses.size(); i > 0; --i) {
+        if (capacity < SizeClasses[i - 1])
+            continue;
+
+        if (capacity > SizeClasses[i - 1] * 2)
+            return;
+
+        SizeClass& sizeClass = GetSizeClasses()[i - 1];
+        storage.clear();
+
+        std::lock_guard<std::mutex> guard(sizeClass.Lock);
+        if (sizeClass.Free.size() * SizeClasses[i - 1] < MaxCachedBytes)
+            sizeClass.Free.push_back(std::move(storage));
+
+        return;
+    }
+}
+} // namespace Acore
@@ -0,0 +1,41 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_MESSAGE_BUFFER_POOL_H
+#define ACORE_MESSAGE_BUFFER_POOL_H
+
+#include "Define.h"
+#include <cstddef>
+#include <vector>
+
+namespace Acore {
+/// Recycles the storage of received packets. Storage is taken by the network
+/// threads and usually given back by the thread that handled the packet, so
+/// the free lists are shared, one per size class, each behind its own lock.
+class AC_COMMON_API MessageBufferPool {
+public:
+    /// Storage of exactly size bytes, with the capacity of its size class
+    static std::vector<uint8> Acquire(std::size_t size);
+
+    /// Keeps storage for reuse, storage that fits no size class or would
+    /// exceed the cached bytes of its class is freed
+    static void Release(std::vector<uint8>&& storage);
+};
+} // namespace Acore
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_POOL_ALLOCATOR_H
+#define ACORE_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace Acore {
+/// Thread local free list of fixed size memory blocks. Released blocks are
+/// kept for reuse by the next allocation of the releasing thread, up to
+/// MaxPooled blocks per thread.
+template <std::size_t Size, std::size_t MaxPooled = 1024>
+class BlockPool {
+    union Block {
+        Block* Next;
+        alignas(std::max_align_t) unsigned char Storage[Size];
+    };
+
+    // trivially destructible on purpose: blocks may be released during
+    // static destruction, after the thread local storage would be destroyed
+    struct FreeList {
+        Block*      Head;
+        std::size_t Count;
+    };
+
+    static FreeList& Local()
+    {
+        thread_local FreeList list = {nullptr, 0};
+        return list;
+    }
+
+public:
+    static void* Allocate()
+    {
+        FreeList& list = Local();
+        if (Block* block = list.Head) {
+            list.Head = block->Next;
+            --list.Count;
+            return block;
+        }
+
+        return ::operator new(sizeof(Block));
+    }
+
+    static void Release(void* pointer)
+    {
+        FreeList& list = Local();
+        if (list.Count >= MaxPooled) {
+            ::operator delete(pointer);
+            return;
+        }
+
+        Block* block = static_cast<Block*>(pointer);
+        block->Next  = list.Head;
+        list.Head    = block;
+        ++list.Count;
+    }
+};
+
+/// Standard allocator drawing single objects from a BlockPool, meant for
+/// std::allocate_shared of short lived objects created at a high rate.
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(PoolAllocator<U> const&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        if (count != 1 || alignof(T) > alignof(std::max_align_t))
+            return std::allocator<T>().allocate(count);
+
+        return static_cast<T*>(BlockPool<sizeof(T)>::Allocate());
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept
+    {
+        if (count != 1 || alignof(T) > alignof(std::max_align_t)) {
+            std::allocator<T>().deallocate(pointer, count);
+            return;
+        }
+
+        BlockPool<sizeof(T)>::Release(pointer);
+    }
+
+    template <typename U>
+    bool operator==(PoolAllocator<U> const&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(PoolAllocator<U> const&) const noexcept
+    {
+        return false;
+    }
+};
+} // namespace Acore
+
+#endif
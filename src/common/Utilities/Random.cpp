@@ -19,16 +19,23 @@
 #include "Random.h"
 #include "Errors.h"
 #include "SFMTRand.h"
+#include <atomic>
 #include <memory>
 #include <random>
 
 static thread_local std::unique_ptr<SFMTRand> sfmtRand;
 static RandomEngine                           engine;
+static std::atomic<uint32>                    fixedSeed;
 
 static SFMTRand* GetRng()
 {
     if (!sfmtRand) {
-        sfmtRand = std::make_unique<SFMTRand>();
+        if (uint32 seed = fixedSeed) {
+            sfmtRand = std::make_unique<SFMTRand>(seed);
+        }
+        else {
+            sfmtRand = std::make_unique<SFMTRand>();
+        }
     }
 
     return sfmtRand.get();
@@ -91,4 +98,10 @@ uint32 urandweighted(size_t count, double const* chances)
     return dd(engine);
 }
 
+void SetRandomSeed(uint32 seed)
+{
+    fixedSeed = seed;
+    sfmtRand.reset();
+}
+
 RandomEngine& RandomEngine::Instance() { return engine; }
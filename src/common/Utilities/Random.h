@@ -53,6 +53,11 @@ AC_COMMON_API double rand_chance();
  * having a different chance of happening */
 AC_COMMON_API uint32 urandweighted(size_t count, double const* chances);
 
+/* Seed the generator of every thread with a fixed value to make runs
+ * reproducible, 0 restores random seeding. Applies to the calling thread and
+ * to threads that did not draw a number yet. */
+AC_COMMON_API void SetRandomSeed(uint32 seed);
+
 /* Return true if a random roll fits in the specified chance (range 0-100). */
 inline bool roll_chance_f(float chance) { return chance > rand_chance(); }
 
@@ -29,6 +29,7 @@
 class SFMTRand {
 public:
     SFMTRand();
+    explicit SFMTRand(uint32 seed); // same sequence for the same seed
     uint32 RandomUInt32(); // Output random bits
     void*  operator new(size_t size, std::nothrow_t const&);
     void   operator delete(void* ptr, std::nothrow_t const&);
@@ -0,0 +1,179 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_SMALL_FUNCTION_H
+#define ACORE_SMALL_FUNCTION_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Acore {
+/// Type erased callable like std::function, but callables up to Capacity
+/// bytes are stored inline. Larger callables fall back to the heap.
+template <typename Signature, std::size_t Capacity = 48>
+class SmallFunction;
+
+template <typename R, typename... Args, std::size_t Capacity>
+class SmallFunction<R(Args...), Capacity> {
+    struct Operations {
+        R (*Invoke)(void* storage, Args&&... args);
+        void (*Copy)(void const* source, void* destination);
+        void (*Move)(void* source, void* destination);
+        void (*Destroy)(void* storage);
+    };
+
+    template <typename F>
+    static constexpr bool IsInline = sizeof(F) <= Capacity &&
+                                     alignof(F) <= alignof(std::max_align_t) &&
+                                     std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    struct InlineOperations {
+        static R Invoke(void* storage, Args&&... args)
+        {
+            return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+        }
+
+        static void Copy(void const* source, void* destination)
+        {
+            new (destination) F(*static_cast<F const*>(source));
+        }
+
+        static void Move(void* source, void* destination)
+        {
+            new (destination) F(std::move(*static_cast<F*>(source)));
+            static_cast<F*>(source)->~F();
+        }
+
+        static void Destroy(void* storage) { static_cast<F*>(storage)->~F(); }
+
+        static constexpr Operations Table = {Invoke, Copy, Move, Destroy};
+    };
+
+    template <typename F>
+    struct HeapOperations {
+        static F*& Target(void* storage) { return *static_cast<F**>(storage); }
+
+        static R Invoke(void* storage, Args&&... args)
+        {
+            return (*Target(storage))(std::forward<Args>(args)...);
+        }
+
+        static void Copy(void const* source, void* destination)
+        {
+            new (destination) F*(new F(**static_cast<F* const*>(source)));
+        }
+
+        static void Move(void* source, void* destination)
+        {
+            new (destination) F*(Target(source));
+        }
+
+        static void Destroy(void* storage) { delete Target(storage); }
+
+        static constexpr Operations Table = {Invoke, Copy, Move, Destroy};
+    };
+
+public:
+    SmallFunction() noexcept = default;
+
+    SmallFunction(std::nullptr_t) noexcept {}
+
+    template <typename F,
+              typename Callable = std::decay_t<F>,
+              typename = std::enable_if_t<
+                  !std::is_same_v<Callable, SmallFunction> &&
+                  std::is_invocable_r_v<R, Callable&, Args...>>>
+    SmallFunction(F&& callable)
+    {
+        if constexpr (IsInline<Callable>) {
+            new (&_storage) Callable(std::forward<F>(callable));
+            _operations = &InlineOperations<Callable>::Table;
+        }
+        else {
+            new (&_storage) Callable*(new Callable(std::forward<F>(callable)));
+            _operations = &HeapOperations<Callable>::Table;
+        }
+    }
+
+    SmallFunction(SmallFunction const& right) : _operations(right._operations)
+    {
+        if (_operations)
+            _operations->Copy(&right._storage, &_storage);
+    }
+
+    SmallFunction(SmallFunction&& right) noexcept
+        : _operations(right._operations)
+    {
+        if (_operations) {
+            _operations->Move(&right._storage, &_storage);
+            right._operations = nullptr;
+        }
+    }
+
+    ~SmallFunction() { Reset(); }
+
+    SmallFunction& operator=(SmallFunction const& right)
+    {
+        if (this != &right) {
+            SmallFunction copy(right);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    SmallFunction& operator=(SmallFunction&& right) noexcept
+    {
+        if (this != &right) {
+            Reset();
+            if (right._operations) {
+                right._operations->Move(&right._storage, &_storage);
+                _operations       = right._operations;
+                right._operations = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    R operator()(Args... args) const
+    {
+        return _operations->Invoke(&_storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return _operations != nullptr; }
+
+private:
+    void Reset() noexcept
+    {
+        if (_operations) {
+            _operations->Destroy(&_storage);
+            _operations = nullptr;
+        }
+    }
+
+    mutable std::aligned_storage_t<Capacity, alignof(std::max_align_t)>
+                      _storage;
+    Operations const* _operations = nullptr;
+};
+} // namespace Acore
+
+#endif
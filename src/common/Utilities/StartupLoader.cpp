@@ -0,0 +1,177 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Acore {
+void StartupLoader::Add(std::string                     name,
+                        std::vector<std::string> const& dependencies,
+                        LoaderFunction                  loader)
+{
+    _loaders.push_back({std::move(name), dependencies, std::move(loader)});
+}
+
+std::string StartupLoader::Validate() const
+{
+    std::unordered_map<std::string, std::size_t> indexByName;
+    for (std::size_t i = 0; i < _loaders.size(); ++i)
+        if (!indexByName.emplace(_loaders[i].Name, i).second)
+            return "startup loader '" + _loaders[i].Name +
+                   "' is added more than once";
+
+    for (Loader const& loader : _loaders)
+        for (std::string const& dependency : loader.Dependencies)
+            if (!indexByName.count(dependency))
+                return "startup loader '" + loader.Name +
+                       "' depends on unknown loader '" + dependency + "'";
+
+    // depth first search, 1 = on the current path, 2 = done
+    std::vector<uint8>                               state(_loaders.size(), 0);
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+    for (std::size_t root = 0; root < _loaders.size(); ++root) {
+        if (state[root])
+            continue;
+
+        stack.emplace_back(root, 0);
+        state[root] = 1;
+        while (!stack.empty()) {
+            auto& [index, next] = stack.back();
+            if (next == _loaders[index].Dependencies.size()) {
+                state[index] = 2;
+                stack.pop_back();
+                continue;
+            }
+
+            std::size_t const dependency =
+                indexByName[_loaders[index].Dependencies[next++]];
+            if (state[dependency] == 1)
+                return "startup loader '" + _loaders[index].Name +
+                       "' has a dependency cycle through '" +
+                       _loaders[dependency].Name + "'";
+
+            if (!state[dependency]) {
+                state[dependency] = 1;
+                stack.emplace_back(dependency, 0);
+            }
+        }
+    }
+
+    return {};
+}
+
+void StartupLoader::Run(uint32 threads)
+{
+    std::string const error = Validate();
+    if (!error.empty())
+        ABORT("{}", error);
+
+    if (_loaders.empty())
+        return;
+
+    uint32 const startTime = getMSTime();
+
+    std::unordered_map<std::string, std::size_t> indexByName;
+    for (std::size_t i = 0; i < _loaders.size(); ++i)
+        indexByName.emplace(_loaders[i].Name, i);
+
+    std::vector<std::size_t>              pending(_loaders.size());
+    std::vector<std::vector<std::size_t>> dependents(_loaders.size());
+    std::deque<std::size_t>               ready;
+    for (std::size_t i = 0; i < _loaders.size(); ++i) {
+        pending[i] = _loaders[i].Dependencies.size();
+        for (std::string const& dependency : _loaders[i].Dependencies)
+            dependents[indexByName[dependency]].push_back(i);
+
+        if (!pending[i])
+            ready.push_back(i);
+    }
+
+    std::vector<uint32>     durations(_loaders.size(), 0);
+    std::size_t             finished = 0;
+    std::mutex              lock;
+    std::condition_variable wakeUp;
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> guard(lock);
+        for (;;) {
+            wakeUp.wait(guard, [&]() {
+                return !ready.empty() || finished == _loaders.size();
+            });
+            if (ready.empty())
+                return;
+
+            std::size_t const index = ready.front();
+            ready.pop_front();
+
+            guard.unlock();
+            uint32 const loaderStart = getMSTime();
+            _loaders[index].Function();
+            uint32 const duration = GetMSTimeDiffToNow(loaderStart);
+            guard.lock();
+
+            durations[index] = duration;
+            ++finished;
+
+            // keep the added order among loaders which became ready together
+            for (std::size_t dependent : dependents[index])
+                if (!--pending[dependent])
+                    ready.insert(std::upper_bound(ready.begin(),
+                                                  ready.end(),
+                                                  dependent),
+                                 dependent);
+
+            wakeUp.notify_all();
+        }
+    };
+
+    threads = std::clamp<uint32>(threads, 1, uint32(_loaders.size()));
+
+    std::vector<std::thread> workers;
+    for (uint32 i = 1; i < threads; ++i)
+        workers.emplace_back(worker);
+
+    worker();
+    for (std::thread& thread : workers)
+        thread.join();
+
+    for (std::size_t i = 0; i < _loaders.size(); ++i)
+        LOG_DEBUG("server.loading",
+                  "Startup loader {} took {} ms",
+                  _loaders[i].Name,
+                  durations[i]);
+
+    auto const slowest = std::max_element(durations.begin(), durations.end());
+    LOG_INFO("server.loading",
+             ">> Ran {} startup loaders on {} threads in {} ms (slowest: {} in "
+             "{} ms)",
+             _loaders.size(),
+             threads,
+             GetMSTimeDiffToNow(startTime),
+             _loaders[slowest - durations.begin()].Name,
+             *slowest);
+}
+} // namespace Acore
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_STARTUP_LOADER_H
+#define ACORE_STARTUP_LOADER_H
+
+#include "Define.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Acore {
+/// Runs named startup loaders, each one once all the loaders it declared as
+/// dependencies have finished. Independent loaders run in parallel, a free
+/// thread always picks the first added loader which is ready, so loaders added
+/// in a valid order run exactly in that order with a single thread.
+class AC_COMMON_API StartupLoader {
+public:
+    typedef std::function<void()> LoaderFunction;
+
+    /// Dependencies must name loaders added to the same StartupLoader,
+    /// they may be added before or after the dependent loader
+    void Add(std::string                     name,
+             std::vector<std::string> const& dependencies,
+             LoaderFunction                  loader);
+
+    /// Returns a description of the first unknown dependency, duplicate name
+    /// or dependency cycle, empty when the loaders can run
+    [[nodiscard]] std::string Validate() const;
+
+    /// Runs all loaders on up to threads threads and logs how long each of
+    /// them took. Aborts with the Validate() message when they can't run.
+    void Run(uint32 threads);
+
+private:
+    struct Loader {
+        std::string              Name;
+        std::vector<std::string> Dependencies;
+        LoaderFunction           Function;
+    };
+
+    std::vector<Loader> _loaders;
+};
+} // namespace Acore
+
+#endif
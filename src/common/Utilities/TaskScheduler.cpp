@@ -124,19 +124,33 @@ bool TaskScheduler::IsGroupScheduled(group_t const group)
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.insert(task);
+    task->_sequence = _nextSequence++;
+    container.push_back(std::move(task));
+    std::push_heap(container.begin(),
+                   container.end(),
+                   [this](TaskContainer const& left,
+                          TaskContainer const& right) {
+                       return IsLater(left, right);
+                   });
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    std::pop_heap(container.begin(),
+                  container.end(),
+                  [this](TaskContainer const& left,
+                         TaskContainer const& right) {
+                      return IsLater(left, right);
+                  });
+
+    TaskContainer result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.front();
 }
 
 void TaskScheduler::TaskQueue::Clear() { container.clear(); }
@@ -144,29 +158,43 @@ void TaskScheduler::TaskQueue::Clear() { container.clear(); }
 void TaskScheduler::TaskQueue::RemoveIf(
     std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr)) {
-            itr = container.erase(itr);
-        }
-        else {
-            ++itr;
-        }
+    auto const end = std::remove_if(container.begin(), container.end(), filter);
+    if (end == container.end())
+        return;
+
+    container.erase(end, container.end());
+    std::make_heap(container.begin(),
+                   container.end(),
+                   [this](TaskContainer const& left,
+                          TaskContainer const& right) {
+                       return IsLater(left, right);
+                   });
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(
     std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr)) {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else {
-            ++itr;
+    // Visit the tasks in execution order, modified tasks are queued again
+    // behind the tasks which already have the same end.
+    std::sort(container.begin(), container.end(), Compare());
+
+    bool modified = false;
+    for (TaskContainer const& task : container)
+        if (filter(task)) {
+            task->_sequence = _nextSequence++;
+            modified        = true;
         }
 
-    container.insert(cache.begin(), cache.end());
+    // a sorted vector is a valid heap already
+    if (!modified)
+        return;
+
+    std::make_heap(container.begin(),
+                   container.end(),
+                   [this](TaskContainer const& left,
+                          TaskContainer const& right) {
+                       return IsLater(left, right);
+                   });
 }
 
 bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
@@ -182,16 +210,6 @@ bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
 
 bool TaskScheduler::TaskQueue::IsEmpty() const { return container.empty(); }
 
-TaskContext& TaskContext::Dispatch(
-    std::function<TaskScheduler&(TaskScheduler&)> const& apply)
-{
-    if (auto const owner = _owner.lock()) {
-        apply(*owner);
-    }
-
-    return *this;
-}
-
 bool TaskContext::IsExpired() const { return _owner.expired(); }
 
 bool TaskContext::IsInGroup(TaskScheduler::group_t const group) const
@@ -19,6 +19,8 @@
 #ifndef _TASK_SCHEDULER_H_
 #define _TASK_SCHEDULER_H_
 
+#include "PoolAllocator.h"
+#include "SmallFunction.h"
 #include "Util.h"
 #include <algorithm>
 #include <chrono>
@@ -26,7 +28,6 @@
 #include <memory>
 #include <optional>
 #include <queue>
-#include <set>
 #include <utility>
 #include <vector>
 
@@ -60,8 +61,8 @@ class TaskScheduler {
     typedef uint32 group_t;
     // Task repeated type
     typedef uint32 repeated_t;
-    // Task handle type
-    typedef std::function<void(TaskContext)> task_handler_t;
+    // Task handle type, small callables are stored inside the task itself
+    typedef Acore::SmallFunction<void(TaskContext)> task_handler_t;
     // Predicate type
     typedef std::function<bool()> predicate_t;
     // Success handle type
@@ -75,6 +76,7 @@ class TaskScheduler {
         duration_t             _duration;
         std::optional<group_t> _group;
         repeated_t             _repeated;
+        uint64                 _sequence;
         task_handler_t         _task;
 
     public:
@@ -85,7 +87,7 @@ class TaskScheduler {
              repeated_t const              repeated,
              task_handler_t const&         task)
             : _end(end), _duration(duration), _group(group),
-              _repeated(repeated), _task(task)
+              _repeated(repeated), _sequence(0), _task(task)
         {
         }
 
@@ -94,7 +96,7 @@ class TaskScheduler {
              duration_t const&     duration,
              task_handler_t const& task)
             : _end(end), _duration(duration), _group(std::nullopt),
-              _repeated(0), _task(task)
+              _repeated(0), _sequence(0), _task(task)
         {
         }
 
@@ -130,17 +132,33 @@ class TaskScheduler {
 
     typedef std::shared_ptr<Task> TaskContainer;
 
-    /// Container which provides Task order, insert and reschedule operations.
+    /// Tasks and their control blocks are taken from a thread local pool
+    typedef Acore::PoolAllocator<Task> TaskAllocator;
+
+    /// Orders tasks by its end, tasks with the same end keep the order they
+    /// were queued in.
     struct Compare {
         bool operator()(TaskContainer const& left,
                         TaskContainer const& right) const
         {
-            return (*left.get()) < (*right.get());
+            if (left->_end != right->_end)
+                return left->_end < right->_end;
+
+            return left->_sequence < right->_sequence;
         };
     };
 
+    /// Container which provides Task order, insert and reschedule operations.
+    /// Tasks are kept as a binary min-heap in a contiguous vector.
     class TaskQueue {
-        std::multiset<TaskContainer, Compare> container;
+        std::vector<TaskContainer> container;
+        uint64                     _nextSequence = 0;
+
+        bool IsLater(TaskContainer const& left,
+                     TaskContainer const& right) const
+        {
+            return Compare()(right, left);
+        }
 
     public:
         // Pushes the task in the container
@@ -430,7 +448,8 @@ private:
                               std::chrono::duration<_Rep, _Period> const& time,
                               task_handler_t const&                       task)
     {
-        return InsertTask(TaskContainer(new Task(end + time, time, task)));
+        return InsertTask(std::allocate_shared<Task>(
+            TaskAllocator(), end + time, time, task));
     }
 
     /// Schedule an event with a fixed rate.
@@ -443,8 +462,8 @@ private:
                               task_handler_t const&                       task)
     {
         static repeated_t const DEFAULT_REPEATED = 0;
-        return InsertTask(TaskContainer(
-            new Task(end + time, time, group, DEFAULT_REPEATED, task)));
+        return InsertTask(std::allocate_shared<Task>(
+            TaskAllocator(), end + time, time, group, DEFAULT_REPEATED, task));
     }
 
     // Returns a random duration between min and max
@@ -483,19 +502,31 @@ class TaskContext {
     std::shared_ptr<bool> _consumed;
 
     /// Dispatches an action safe on the TaskScheduler
-    TaskContext&
-    Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply);
+    template <typename Apply>
+    TaskContext& Dispatch(Apply&& apply)
+    {
+        if (auto const owner = _owner.lock()) {
+            apply(*owner);
+        }
 
-public:
-    // Empty constructor
-    TaskContext() : _task(), _owner(), _consumed(std::make_shared<bool>(true))
+        return *this;
+    }
+
+    static std::shared_ptr<bool> MakeConsumedState(bool consumed)
     {
+        return std::allocate_shared<bool>(Acore::PoolAllocator<bool>(),
+                                          consumed);
     }
 
+public:
+    // Empty constructor
+    TaskContext() : _task(), _owner(), _consumed(MakeConsumedState(true)) {}
+
     // Construct from task and owner
     explicit TaskContext(TaskScheduler::TaskContainer&& task,
                          std::weak_ptr<TaskScheduler>&& owner)
-        : _task(task), _owner(owner), _consumed(std::make_shared<bool>(false))
+        : _task(std::move(task)), _owner(std::move(owner)),
+          _consumed(MakeConsumedState(false))
     {
     }
 
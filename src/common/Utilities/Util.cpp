@@ -26,6 +26,7 @@
 #include <boost/core/demangle.hpp>
 #include <cctype>
 #include <cstdarg>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <utf8.h>
@@ -524,6 +525,71 @@ bool Utf8ToUpperOnlyLatin(std::string& utf8String)
     return WStrToUtf8(wstr, utf8String);
 }
 
+bool IsAsciiString(std::string_view str)
+{
+    char const* itr = str.data();
+    char const* end = itr + str.size();
+
+    // test eight bytes per step for any set high bit, the compiler turns this
+    // into plain (or vectorized) word loads
+    constexpr uint64 highBits = 0x8080808080808080ULL;
+    for (; end - itr >= 8; itr += 8) {
+        uint64 word;
+        std::memcpy(&word, itr, sizeof(word));
+        if (word & highBits)
+            return false;
+    }
+
+    for (; itr != end; ++itr)
+        if (uint8(*itr) & 0x80)
+            return false;
+
+    return true;
+}
+
+bool Utf8ToLower(std::string_view utf8str, std::string& lowered)
+{
+    if (IsAsciiString(utf8str)) {
+        lowered.resize(utf8str.size());
+        std::transform(utf8str.begin(),
+                       utf8str.end(),
+                       lowered.begin(),
+                       [](char c) {
+                           return (c >= 'A' && c <= 'Z') ? char(c + 0x20) : c;
+                       });
+        return true;
+    }
+
+    // mixed input: copy ASCII runs directly and only decode the multi-byte
+    // sequences to run them through the same table as wcharToLower
+    lowered.clear();
+    lowered.reserve(utf8str.size());
+    try {
+        auto itr = utf8str.begin();
+        auto end = utf8str.end();
+        while (itr != end) {
+            if (!(uint8(*itr) & 0x80)) {
+                char c = *itr++;
+                lowered.push_back(
+                    (c >= 'A' && c <= 'Z') ? char(c + 0x20) : c);
+                continue;
+            }
+
+            uint32 codepoint = utf8::next(itr, end);
+            if (codepoint <= 0xFFFF)
+                codepoint = uint32(wcharToLower(wchar_t(codepoint)));
+
+            utf8::append(codepoint, std::back_inserter(lowered));
+        }
+    }
+    catch (std::exception const&) {
+        lowered.clear();
+        return false;
+    }
+
+    return true;
+}
+
 std::string Acore::Impl::ByteArrayToHexStr(uint8 const* bytes,
                                            size_t       arrayLen,
                                            bool         reverse /* = false */)
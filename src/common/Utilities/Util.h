@@ -391,6 +391,14 @@ AC_COMMON_API void utf8printf(FILE* out, const char* str, ...);
 AC_COMMON_API void vutf8printf(FILE* out, const char* str, va_list* ap);
 AC_COMMON_API bool Utf8ToUpperOnlyLatin(std::string& utf8String);
 
+//! Lowercases utf8str into lowered without going through std::wstring, pure
+//! ASCII input (the common case for names) is handled a word at a time and
+//! only non-ASCII code points are decoded. Returns false on invalid UTF-8
+AC_COMMON_API bool Utf8ToLower(std::string_view utf8str, std::string& lowered);
+
+//! Returns true if str only contains 7-bit ASCII characters
+AC_COMMON_API bool IsAsciiString(std::string_view str);
+
 bool IsIPAddress(char const* ipaddress);
 
 uint32 CreatePIDFile(const std::string& filename);
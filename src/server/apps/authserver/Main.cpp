@@ -160,7 +160,7 @@ int main(int argc, char** argv)
     std::shared_ptr<void> sRealmListHandle(nullptr,
                                            [](void*) { sRealmList->Close(); });
 
-    if (sRealmList->GetRealms().empty()) {
+    if (sRealmList->GetRealms()->empty()) {
         LOG_ERROR("server.authserver", "No valid realms specified.");
         return 1;
     }
@@ -182,7 +182,17 @@ int main(int argc, char** argv)
     std::string bindIp =
         sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
-    if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port)) {
+    // SRP6 math runs on the network threads, more of them spread login
+    // storms across cores
+    int32 networkThreads = sConfigMgr->GetOption<int32>("Network.Threads", 1);
+    if (networkThreads <= 0) {
+        LOG_ERROR("server.authserver",
+                  "Network.Threads must be greater than 0");
+        return 1;
+    }
+
+    if (!sAuthSocketMgr.StartNetwork(
+            *ioContext, bindIp, port, networkThreads)) {
         LOG_ERROR("server.authserver", "Failed to initialize network");
         return 1;
     }
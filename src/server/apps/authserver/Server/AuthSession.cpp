@@ -884,7 +884,8 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
     ByteBuffer pkt;
 
     size_t RealmListSize = 0;
-    for (auto const& [realmHandle, realm] : sRealmList->GetRealms()) {
+    std::shared_ptr<RealmList::RealmMap const> realms = sRealmList->GetRealms();
+    for (auto const& [realmHandle, realm] : *realms) {
         // don't work with realms which not compatible with the client
         bool okBuild =
             ((_expversion & POST_BC_EXP_FLAG) && realm.Build == _build) ||
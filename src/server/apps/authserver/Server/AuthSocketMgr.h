@@ -40,14 +40,14 @@ public:
         if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
             return false;
 
-        _acceptor->AsyncAcceptWithCallback<&AuthSocketMgr::OnSocketAccept>();
+        AsyncAcceptWithCallback<&AuthSocketMgr::OnSocketAccept>();
         return true;
     }
 
 protected:
     NetworkThread<AuthSession>* CreateThreads() const override
     {
-        return new NetworkThread<AuthSession>[1];
+        return new NetworkThread<AuthSession>[GetNetworkThreadCount()];
     }
 
     static void OnSocketAccept(tcp::socket&& sock, uint32 threadIndex)
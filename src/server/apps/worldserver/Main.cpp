@@ -33,9 +33,11 @@
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
+#include "GameTime.h"
 #include "GitRevision.h"
 #include "IoContext.h"
 #include "MapMgr.h"
+#include "MemoryStats.h"
 #include "Metric.h"
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
@@ -43,13 +45,18 @@
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
 #include "ProcessPriority.h"
+#include "Profiler.h"
 #include "RASession.h"
+#include "Random.h"
 #include "RealmList.h"
 #include "Resolver.h"
 #include "ScriptLoader.h"
 #include "ScriptMgr.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
+#include "ThreadWatchdog.h"
+#include "VMapFactory.h"
+#include "VMapMgr2.h"
 #include "World.h"
 #include "WorldSocket.h"
 #include "WorldSocketMgr.h"
@@ -88,10 +95,13 @@ namespace fs = std::filesystem;
 
 class FreezeDetector {
 public:
-    FreezeDetector(Acore::Asio::IoContext& ioContext, uint32 maxCoreStuckTime)
+    FreezeDetector(Acore::Asio::IoContext& ioContext,
+                   uint32                  maxCoreStuckTime,
+                   uint32                  checkInterval)
         : _timer(ioContext), _worldLoopCounter(0),
           _lastChangeMsTime(getMSTime()),
-          _maxCoreStuckTimeInMs(maxCoreStuckTime)
+          _maxCoreStuckTimeInMs(maxCoreStuckTime),
+          _checkIntervalInMs(checkInterval)
     {
     }
 
@@ -112,6 +122,7 @@ private:
     uint32                     _worldLoopCounter;
     uint32                     _lastChangeMsTime;
     uint32                     _maxCoreStuckTimeInMs;
+    uint32                     _checkIntervalInMs;
 };
 
 void SignalHandler(boost::system::error_code const& error, int signalNumber);
@@ -266,6 +277,10 @@ int main(int argc, char** argv)
 #endif
     signals.async_wait(SignalHandler);
 
+    // Must be set up before the database, map and network threads start
+    sThreadWatchdog->Initialize(Milliseconds(
+        sConfigMgr->GetOption<uint32>("ThreadWatchdog.StallThreshold", 0)));
+
     // Start the Boost based thread pool
     int numThreads = sConfigMgr->GetOption<int32>("ThreadPool", 1);
     std::shared_ptr<std::vector<std::thread>> threadPool(
@@ -283,7 +298,10 @@ int main(int argc, char** argv)
     }
 
     for (int i = 0; i < numThreads; ++i) {
-        threadPool->push_back(std::thread([ioContext]() { ioContext->run(); }));
+        threadPool->push_back(std::thread([ioContext]() {
+            AC_PROFILE_THREAD_NAME("IO pool");
+            ioContext->run();
+        }));
     }
 
     // Set process priority according to configuration settings
@@ -327,6 +345,20 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_character",
                      uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        METRIC_VALUE("memory_process_resident",
+                     Acore::Memory::GetProcessResidentBytes());
+
+        Acore::Memory::AllocatorStats heap = Acore::Memory::GetAllocatorStats();
+        if (heap.Available) {
+            METRIC_VALUE("memory_heap_allocated", heap.Allocated);
+            METRIC_VALUE("memory_heap_resident", heap.Resident);
+        }
+
+        uint64 losHits, losMisses;
+        VMAP::VMapFactory::createOrGetVMapMgr()->GetLineOfSightCacheStats(
+            losHits, losMisses);
+        METRIC_VALUE("vmap_los_cache_hits", losHits);
+        METRIC_VALUE("vmap_los_cache_misses", losMisses);
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -338,6 +370,13 @@ int main(int argc, char** argv)
 
     Acore::Module::SetEnableModulesList(AC_MODULES_LIST);
 
+    ///- Reproducible runs when a packet capture is replayed
+    if (uint32 seed = sConfigMgr->GetOption<uint32>("Replay.RandomSeed", 0))
+        SetRandomSeed(seed);
+
+    if (uint32 startTime = sConfigMgr->GetOption<uint32>("Replay.StartTime", 0))
+        GameTime::SetStartTime(Seconds(startTime));
+
     ///- Initialize the World
     sSecretMgr->Initialize();
     sWorld->SetInitialWorldSettings();
@@ -414,17 +453,24 @@ int main(int argc, char** argv)
         RealmFlags(realm.Flags & ~uint32(REALM_FLAG_VERSION_MISMATCH));
 
     // Start the freeze check callback cycle in 5 seconds (cycle itself is 1
-    // sec)
+    // sec, shorter when the thread watchdog needs to notice short stalls)
     std::shared_ptr<FreezeDetector> freezeDetector;
-    if (int32 coreStuckTime =
-            sConfigMgr->GetOption<int32>("MaxCoreStuckTime", 60)) {
-        freezeDetector =
-            std::make_shared<FreezeDetector>(*ioContext, coreStuckTime * 1000);
+    int32                           coreStuckTime =
+        sConfigMgr->GetOption<int32>("MaxCoreStuckTime", 60);
+    if (coreStuckTime || sThreadWatchdog->IsEnabled()) {
+        uint32 checkInterval = 1000;
+        if (sThreadWatchdog->IsEnabled())
+            checkInterval = std::clamp<uint32>(
+                sThreadWatchdog->GetStallThreshold().count() / 4, 10, 1000);
+
+        freezeDetector = std::make_shared<FreezeDetector>(
+            *ioContext, coreStuckTime * 1000, checkInterval);
         FreezeDetector::Start(freezeDetector);
-        LOG_INFO(
-            "server.worldserver",
-            "Starting up anti-freeze thread ({} seconds max stuck time)...",
-            coreStuckTime);
+        if (coreStuckTime)
+            LOG_INFO(
+                "server.worldserver",
+                "Starting up anti-freeze thread ({} seconds max stuck time)...",
+                coreStuckTime);
     }
 
     LOG_INFO("server.worldserver",
@@ -658,6 +704,9 @@ void WorldUpdateLoop()
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    AC_PROFILE_THREAD_NAME("World");
+    sThreadWatchdog->RegisterThread("World");
+
     ///- While we have not World::m_stopEvent, update the world
     while (!World::IsStopped()) {
         ++World::m_worldLoopCounter;
@@ -677,8 +726,13 @@ void WorldUpdateLoop()
             continue;
         }
 
-        sWorld->Update(diff);
+        {
+            ThreadWatchdog::WorkScope watchdogScope;
+            sWorld->Update(diff);
+        }
+
         realPrevTime = realCurrTime;
+        AC_PROFILE_FRAME();
 
 #ifdef _WIN32
         if (m_ServiceStatus == 0)
@@ -714,7 +768,7 @@ void FreezeDetector::Handler(std::weak_ptr<FreezeDetector>    freezeDetectorRef,
                 freezeDetector->_worldLoopCounter = worldLoopCounter;
             }
             // possible freeze
-            else {
+            else if (freezeDetector->_maxCoreStuckTimeInMs) {
                 uint32 msTimeDiff =
                     getMSTimeDiff(freezeDetector->_lastChangeMsTime, curtime);
                 if (msTimeDiff > freezeDetector->_maxCoreStuckTimeInMs) {
@@ -726,8 +780,11 @@ void FreezeDetector::Handler(std::weak_ptr<FreezeDetector>    freezeDetectorRef,
                 }
             }
 
+            sThreadWatchdog->Check();
+
             freezeDetector->_timer.expires_from_now(
-                boost::posix_time::seconds(1));
+                boost::posix_time::milliseconds(
+                    freezeDetector->_checkIntervalInMs));
             freezeDetector->_timer.async_wait(
                 std::bind(&FreezeDetector::Handler,
                           freezeDetectorRef,
@@ -819,8 +876,7 @@ void AuctionListingRunnable()
     LOG_INFO("server", "Starting up Auction House Listing thread...");
 
     while (!World::IsStopped()) {
-        Milliseconds diff = AsyncAuctionListingMgr::GetDiff();
-        AsyncAuctionListingMgr::ResetDiff();
+        Milliseconds diff = AsyncAuctionListingMgr::TakeDiff();
 
         if (!AsyncAuctionListingMgr::GetTempList().empty() ||
             !AsyncAuctionListingMgr::GetList().empty()) {
@@ -844,16 +900,19 @@ void AuctionListingRunnable()
                 }
             }
 
+            // Answer every listing that is due in this pass; taking only one
+            // per sleep left queued searches waiting behind each other.
             for (auto itr = AsyncAuctionListingMgr::GetList().begin();
-                 itr != AsyncAuctionListingMgr::GetList().end();
-                 ++itr) {
-                if ((*itr)._pickupTimer != Milliseconds::zero())
+                 itr != AsyncAuctionListingMgr::GetList().end();) {
+                if ((*itr)._pickupTimer != Milliseconds::zero()) {
+                    ++itr;
                     continue;
+                }
 
                 if ((*itr).Execute())
-                    AsyncAuctionListingMgr::GetList().erase(itr);
-
-                break;
+                    itr = AsyncAuctionListingMgr::GetList().erase(itr);
+                else
+                    ++itr;
             }
         }
         std::this_thread::sleep_for(1ms);
@@ -18,10 +18,12 @@
 
 #include "DatabaseLoader.h"
 #include "Config.h"
+#include "DatabaseWorker.h"
 #include "DBUpdater.h"
 #include "DatabaseEnv.h"
 #include "Duration.h"
 #include "Log.h"
+#include "ProcessPriority.h"
 #include <errmsg.h>
 #include <mysqld_error.h>
 #include <thread>
@@ -34,6 +36,8 @@ DatabaseLoader::DatabaseLoader(std::string const& logger,
       _updateFlags(sConfigMgr->GetOption<uint32>("Updates.EnableDatabases",
                                                  defaultUpdateMask))
 {
+    DatabaseWorker::SetProcessors(ParseProcessorList(
+        sConfigMgr->GetOption<std::string>("Database.Threads.Affinity", "")));
 }
 
 template <class T>
@@ -66,7 +70,34 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool,
         uint8 const synchThreads =
             sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
-        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        uint8 const batchSize =
+            sConfigMgr->GetOption<uint8>(name + "Database.BatchSize", 1);
+        if (batchSize < 1) {
+            LOG_ERROR(_logger,
+                      "{} database: invalid batch size specified. "
+                      "Please pick a value of 1 or more.",
+                      name);
+            return false;
+        }
+
+        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads, batchSize);
+
+        std::string const replicaString = sConfigMgr->GetOption<std::string>(
+            name + "Database.ReplicaInfo", "");
+        if (!replicaString.empty()) {
+            uint8 const replicaThreads = sConfigMgr->GetOption<uint8>(
+                name + "Database.ReplicaThreads", 1);
+            if (replicaThreads < 1 || replicaThreads > 32) {
+                LOG_ERROR(
+                    _logger,
+                    "{} database: invalid number of replica threads "
+                    "specified. Please pick a value between 1 and 32.",
+                    name);
+                return false;
+            }
+
+            pool.SetReplicaConnectionInfo(replicaString, replicaThreads);
+        }
 
         if (uint32 error = pool.Open()) {
             // Try reconnect
@@ -17,8 +17,24 @@
  */
 
 #include "DatabaseWorker.h"
+#include "Log.h"
+#include "Metric.h"
+#include "MySQLConnection.h"
 #include "PCQueue.h"
+#include "ProcessPriority.h"
+#include "Profiler.h"
 #include "SQLOperation.h"
+#include "ThreadWatchdog.h"
+
+namespace {
+std::vector<uint32> _processors;
+std::atomic<uint32> _nextProcessor{0};
+} // namespace
+
+void DatabaseWorker::SetProcessors(std::vector<uint32> processors)
+{
+    _processors = std::move(processors);
+}
 
 DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue,
                                MySQLConnection*                      connection)
@@ -26,6 +42,7 @@ DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue,
     _connection       = connection;
     _queue            = newQueue;
     _cancelationToken = false;
+    _batchSize        = 1;
     _workerThread     = std::thread(&DatabaseWorker::WorkerThread, this);
 }
 
@@ -43,6 +60,14 @@ void DatabaseWorker::WorkerThread()
     if (!_queue)
         return;
 
+    AC_PROFILE_THREAD_NAME("Database worker");
+    sThreadWatchdog->RegisterThread("Database worker");
+
+    if (!_processors.empty())
+        SetThreadAffinity("sql.driver",
+                          "Database worker",
+                          _processors[_nextProcessor++ % _processors.size()]);
+
     for (;;) {
         SQLOperation* operation = nullptr;
 
@@ -51,9 +76,97 @@ void DatabaseWorker::WorkerThread()
         if (_cancelationToken || !operation)
             return;
 
+        LogQueueWait(operation);
+
+        uint8 const batchSize = _batchSize;
+        if (batchSize <= 1 || !operation->IsBatchable()) {
+            Execute(operation);
+            continue;
+        }
+
+        // Drain the statements queued behind this one, stopping at the first
+        // one which can't be batched so the queue order is kept
+        std::vector<SQLOperation*> batch;
+        batch.reserve(batchSize);
+        batch.push_back(operation);
+
+        SQLOperation* next = nullptr;
+        while (batch.size() < batchSize && _queue->Pop(next)) {
+            LogQueueWait(next);
+            if (!next->IsBatchable())
+                break;
+
+            batch.push_back(next);
+            next = nullptr;
+        }
+
+        ExecuteBatch(batch);
+
+        if (next)
+            Execute(next);
+    }
+}
+
+void DatabaseWorker::Execute(SQLOperation* operation)
+{
+    AC_PROFILE_ZONE("DatabaseWorker::Execute");
+    ThreadWatchdog::WorkScope watchdogScope;
+
+    operation->SetConnection(_connection);
+    operation->call();
+
+    delete operation;
+}
+
+void DatabaseWorker::ExecuteBatch(std::vector<SQLOperation*>& batch)
+{
+    AC_PROFILE_ZONE("DatabaseWorker::ExecuteBatch");
+    ThreadWatchdog::WorkScope watchdogScope;
+
+    if (batch.size() == 1) {
+        Execute(batch.front());
+        return;
+    }
+
+    // All statements share one commit instead of an implicit commit each
+    bool success = true;
+    _connection->BeginTransaction();
+
+    for (SQLOperation* operation : batch) {
         operation->SetConnection(_connection);
-        operation->call();
+        if (!operation->Execute()) {
+            success = false;
+            break;
+        }
+    }
 
-        delete operation;
+    if (success) {
+        _connection->CommitTransaction();
+
+        for (SQLOperation* operation : batch)
+            delete operation;
+
+        return;
     }
+
+    // Nothing of the batch was kept, fall back to executing every statement
+    // on its own so a single failing statement doesn't drop the others
+    _connection->RollbackTransaction();
+
+    LOG_WARN("sql.sql",
+             "Batch of {} statements failed, executing them one by one.",
+             batch.size());
+
+    for (SQLOperation* operation : batch)
+        Execute(operation);
+}
+
+void DatabaseWorker::LogQueueWait([[maybe_unused]] SQLOperation* operation)
+{
+    METRIC_DETAILED_VALUE(
+        "db_queue_wait",
+        int64(std::chrono::duration_cast<Milliseconds>(
+                  std::chrono::steady_clock::now() - operation->m_queuedTime)
+                  .count()),
+        METRIC_TAG("db", _connection->GetDatabaseName()));
 }
@@ -22,6 +22,7 @@
 #include "Define.h"
 #include <atomic>
 #include <thread>
+#include <vector>
 
 template <typename T>
 class ProducerConsumerQueue;
@@ -35,14 +36,27 @@ public:
                    MySQLConnection*                      connection);
     ~DatabaseWorker();
 
+    //! Maximum amount of queued batchable statements executed inside one
+    //! transaction, 1 disables batching
+    void SetBatchSize(uint8 batchSize) { _batchSize = batchSize; }
+
+    //! Processors the workers started afterwards are pinned to, one after
+    //! another; empty leaves them to the scheduler
+    static void SetProcessors(std::vector<uint32> processors);
+
 private:
     ProducerConsumerQueue<SQLOperation*>* _queue;
     MySQLConnection*                      _connection;
 
     void        WorkerThread();
+    void        Execute(SQLOperation* operation);
+    void        ExecuteBatch(std::vector<SQLOperation*>& batch);
+    //! Logs how long the operation was queued, see db_queue_wait
+    void        LogQueueWait(SQLOperation* operation);
     std::thread _workerThread;
 
-    std::atomic<bool> _cancelationToken;
+    std::atomic<bool>  _cancelationToken;
+    std::atomic<uint8> _batchSize;
 
     DatabaseWorker(DatabaseWorker const& right)            = delete;
     DatabaseWorker& operator=(DatabaseWorker const& right) = delete;
@@ -29,9 +29,11 @@
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
+#include "QuerySnapshot.h"
 #include "SQLOperation.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -51,10 +53,19 @@ class PingOperation : public SQLOperation {
     }
 };
 
+namespace {
+
+// Query holders are only split into parts of at least this many queries
+constexpr size_t MIN_QUERIES_PER_HOLDER_TASK = 4;
+
+} // namespace
+
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
-    : _queue(new ProducerConsumerQueue<SQLOperation*>()), _async_threads(0),
-      _synch_threads(0)
+    : _queue(new ProducerConsumerQueue<SQLOperation*>()),
+      _replicaQueue(new ProducerConsumerQueue<SQLOperation*>()),
+      _async_threads(0), _synch_threads(0), _replica_threads(0),
+      _async_batch_size(1)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -90,17 +101,28 @@ template <class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
     _queue->Cancel();
+    _replicaQueue->Cancel();
 }
 
 template <class T>
 void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString,
                                               uint8 const      asyncThreads,
-                                              uint8 const      synchThreads)
+                                              uint8 const      synchThreads,
+                                              uint8 const      asyncBatchSize)
 {
     _connectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
 
-    _async_threads = asyncThreads;
-    _synch_threads = synchThreads;
+    _async_threads    = asyncThreads;
+    _synch_threads    = synchThreads;
+    _async_batch_size = asyncBatchSize;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetReplicaConnectionInfo(
+    std::string_view infoString, uint8 const replicaThreads)
+{
+    _replicaConnectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
+    _replica_threads       = replicaThreads;
 }
 
 template <class T>
@@ -110,10 +132,11 @@ uint32 DatabaseWorkerPool<T>::Open()
 
     LOG_INFO("sql.driver",
              "Opening DatabasePool '{}'. Asynchronous connections: {}, "
-             "synchronous connections: {}.",
+             "synchronous connections: {}, batch size: {}.",
              GetDatabaseName(),
              _async_threads,
-             _synch_threads);
+             _synch_threads,
+             _async_batch_size);
 
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
@@ -122,13 +145,26 @@ uint32 DatabaseWorkerPool<T>::Open()
 
     error = OpenConnections(IDX_SYNCH, _synch_threads);
 
+    if (!error && _replicaConnectionInfo) {
+        LOG_INFO("sql.driver",
+                 "Opening read replica of DatabasePool '{}' on {}:{}. "
+                 "Replica connections: {}.",
+                 GetDatabaseName(),
+                 _replicaConnectionInfo->host,
+                 _replicaConnectionInfo->port_or_socket,
+                 _replica_threads);
+
+        error = OpenConnections(IDX_REPLICA, _replica_threads);
+    }
+
     if (!error) {
-        LOG_INFO(
-            "sql.driver",
-            "DatabasePool '{}' opened successfully. {} total connections "
-            "running.",
-            GetDatabaseName(),
-            (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size()));
+        LOG_INFO("sql.driver",
+                 "DatabasePool '{}' opened successfully. {} total connections "
+                 "running.",
+                 GetDatabaseName(),
+                 (_connections[IDX_SYNCH].size() +
+                  _connections[IDX_ASYNC].size() +
+                  _connections[IDX_REPLICA].size()));
     }
 
     LOG_INFO("sql.driver", " ");
@@ -143,6 +179,7 @@ void DatabaseWorkerPool<T>::Close()
         "sql.driver", "Closing down DatabasePool '{}'.", GetDatabaseName());
 
     //! Closes the actualy MySQL connection.
+    _connections[IDX_REPLICA].clear();
     _connections[IDX_ASYNC].clear();
 
     LOG_INFO("sql.driver",
@@ -206,10 +243,17 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
 template <class T>
 QueryResult DatabaseWorkerPool<T>::Query(std::string_view sql)
 {
-    auto connection = GetFreeConnection();
+    ResultSet* result = _querySnapshot ? _querySnapshot->Find(sql) : nullptr;
 
-    ResultSet* result = connection->Query(sql);
-    connection->Unlock();
+    if (!result) {
+        auto connection = GetFreeConnection();
+
+        result = connection->Query(sql);
+        connection->Unlock();
+
+        if (result && _querySnapshot)
+            result = _querySnapshot->Record(sql, result);
+    }
 
     if (!result || !result->GetRowCount() || !result->NextRow()) {
         delete result;
@@ -259,15 +303,44 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
     return QueryCallback(std::move(result));
 }
 
+template <class T>
+QueryCallback DatabaseWorkerPool<T>::AsyncReplicaQuery(std::string_view sql)
+{
+    BasicStatementTask* task   = new BasicStatementTask(sql, true);
+    QueryResultFuture   result = task->GetFuture();
+    EnqueueReplica(task);
+    return QueryCallback(std::move(result));
+}
+
+template <class T>
+QueryCallback
+DatabaseWorkerPool<T>::AsyncReplicaQuery(PreparedStatement<T>* stmt)
+{
+    PreparedStatementTask*    task   = new PreparedStatementTask(stmt, true);
+    PreparedQueryResultFuture result = task->GetFuture();
+    EnqueueReplica(task);
+    return QueryCallback(std::move(result));
+}
+
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(
     std::shared_ptr<SQLQueryHolder<T>> holder)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
-    // Store future result before enqueueing - task might get already processed
-    // and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    // Spread the queries over the async connections, the holder then takes
+    // about as long as its slowest part instead of the sum of all queries
+    size_t const size  = holder->GetSize();
+    size_t const parts = std::clamp<size_t>(size / MIN_QUERIES_PER_HOLDER_TASK,
+                                            1,
+                                            std::max<uint8>(_async_threads, 1));
+
+    auto join = std::make_shared<SQLQueryHolderJoin>(parts);
+    // Store future result before enqueueing - tasks might get already
+    // processed and deleted before returning from this method
+    QueryResultHolderFuture result = join->Result.get_future();
+    for (size_t i = 0; i < parts; ++i)
+        Enqueue(new SQLQueryHolderTask(
+            holder, join, size * i / parts, size * (i + 1) / parts));
+
     return {std::move(holder), std::move(result)};
 }
 
@@ -299,6 +372,7 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
+    InvalidateQuerySnapshot();
     Enqueue(new TransactionTask(transaction));
 }
 
@@ -325,6 +399,8 @@ DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
+    InvalidateQuerySnapshot();
+
     TransactionWithResultTask* task =
         new TransactionWithResultTask(transaction);
     TransactionFuture result = task->GetFuture();
@@ -336,6 +412,8 @@ template <class T>
 void DatabaseWorkerPool<T>::DirectCommitTransaction(
     SQLTransaction<T>& transaction)
 {
+    InvalidateQuerySnapshot();
+
     T*  connection = GetFreeConnection();
     int errorCode  = connection->ExecuteTransaction(transaction);
 
@@ -382,6 +460,27 @@ void DatabaseWorkerPool<T>::EscapeString(std::string& str)
     delete[] buf;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::StartQuerySnapshot(std::string path, uint64 key)
+{
+    _querySnapshot = std::make_unique<QuerySnapshot>(std::move(path));
+    _querySnapshot->Start(key);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::StopQuerySnapshot()
+{
+    if (_querySnapshot)
+        _querySnapshot->Stop();
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::InvalidateQuerySnapshot()
+{
+    if (_querySnapshot)
+        _querySnapshot->Invalidate();
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::KeepAlive()
 {
@@ -401,6 +500,9 @@ void DatabaseWorkerPool<T>::KeepAlive()
 
     for (uint8 i = 0; i < count; ++i)
         Enqueue(new PingOperation);
+
+    for (size_t i = 0; i < _connections[IDX_REPLICA].size(); ++i)
+        EnqueueReplica(new PingOperation);
 }
 
 /**
@@ -471,6 +573,9 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type,
                 return std::make_unique<T>(_queue.get(), *_connectionInfo);
             case IDX_SYNCH:
                 return std::make_unique<T>(*_connectionInfo);
+            case IDX_REPLICA:
+                return std::make_unique<T>(_replicaQueue.get(),
+                                           *_replicaConnectionInfo);
             default:
                 ABORT();
             }
@@ -491,6 +596,9 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type,
             return 1;
         }
         else {
+            if (type != IDX_SYNCH)
+                connection->SetAsyncBatchSize(_async_batch_size);
+
             _connections[type].push_back(std::move(connection));
         }
     }
@@ -513,13 +621,26 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char*         to,
 template <class T>
 void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
 {
+    op->m_queuedTime = std::chrono::steady_clock::now();
     _queue->Push(op);
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::EnqueueReplica(SQLOperation* op)
+{
+    if (_connections[IDX_REPLICA].empty()) {
+        Enqueue(op);
+        return;
+    }
+
+    op->m_queuedTime = std::chrono::steady_clock::now();
+    _replicaQueue->Push(op);
+}
+
 template <class T>
 size_t DatabaseWorkerPool<T>::QueueSize() const
 {
-    return _queue->Size();
+    return _queue->Size() + _replicaQueue->Size();
 }
 
 template <class T>
@@ -560,6 +681,8 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
     if (sql.empty())
         return;
 
+    InvalidateQuerySnapshot();
+
     BasicStatementTask* task = new BasicStatementTask(sql);
     Enqueue(task);
 }
@@ -567,6 +690,8 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
 template <class T>
 void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
 {
+    InvalidateQuerySnapshot();
+
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
     Enqueue(task);
 }
@@ -577,6 +702,8 @@ void DatabaseWorkerPool<T>::DirectExecute(std::string_view sql)
     if (sql.empty())
         return;
 
+    InvalidateQuerySnapshot();
+
     T* connection = GetFreeConnection();
     connection->Execute(sql);
     connection->Unlock();
@@ -585,6 +712,8 @@ void DatabaseWorkerPool<T>::DirectExecute(std::string_view sql)
 template <class T>
 void DatabaseWorkerPool<T>::DirectExecute(PreparedStatement<T>* stmt)
 {
+    InvalidateQuerySnapshot();
+
     T* connection = GetFreeConnection();
     connection->Execute(stmt);
     connection->Unlock();
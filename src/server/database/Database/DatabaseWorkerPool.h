@@ -57,13 +57,14 @@
 template <typename T>
 class ProducerConsumerQueue;
 
+class QuerySnapshot;
 class SQLOperation;
 struct MySQLConnectionInfo;
 
 template <class T>
 class DatabaseWorkerPool {
 private:
-    enum InternalIndex { IDX_ASYNC, IDX_SYNCH, IDX_SIZE };
+    enum InternalIndex { IDX_ASYNC, IDX_SYNCH, IDX_REPLICA, IDX_SIZE };
 
 public:
     /* Activity state */
@@ -72,7 +73,14 @@ public:
 
     void SetConnectionInfo(std::string_view infoString,
                            uint8 const      asyncThreads,
-                           uint8 const      synchThreads);
+                           uint8 const      synchThreads,
+                           uint8 const      asyncBatchSize = 1);
+
+    //! Sets an optional read replica of this database. Only
+    //! AsyncReplicaQuery() reads are sent to it, everything else stays on
+    //! the primary set by SetConnectionInfo().
+    void SetReplicaConnectionInfo(std::string_view infoString,
+                                  uint8 const      replicaThreads);
 
     uint32 Open();
     void   Close();
@@ -181,6 +189,17 @@ public:
     //! methods. Statement must be prepared with CONNECTION_ASYNC flag.
     QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
 
+    //! Same as AsyncQuery() but executed on the read replica if one is
+    //! configured. The replica may lag behind the primary, only use this for
+    //! reads that do not depend on writes made shortly before.
+    QueryCallback AsyncReplicaQuery(std::string_view sql);
+
+    //! Same as AsyncQuery() but executed on the read replica if one is
+    //! configured. The replica may lag behind the primary, only use this for
+    //! reads that do not depend on writes made shortly before. Statement must
+    //! be prepared with CONNECTION_ASYNC flag.
+    QueryCallback AsyncReplicaQuery(PreparedStatement<T>* stmt);
+
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared)
     //! that will set the value of the QueryResultHolderFuture return object as
     //! soon as the query is executed. The return value is then processed in
@@ -242,6 +261,15 @@ public:
     //! disconnecting us.
     void KeepAlive();
 
+    //! Serves synchronous ad-hoc queries from the snapshot file at path, and
+    //! records the ones it is missing, until StopQuerySnapshot() is called.
+    //! The file is only used if it was written for the same key.
+    void StartQuerySnapshot(std::string path, uint64 key);
+
+    //! Writes the recorded results and stops serving the snapshot. Any later
+    //! write through this pool deletes the snapshot file.
+    void StopQuerySnapshot();
+
     void WarnAboutSyncQueries([[maybe_unused]] bool warn)
     {
 #ifdef ACORE_DEBUG
@@ -259,6 +287,9 @@ private:
 
     void Enqueue(SQLOperation* op);
 
+    //! Enqueues a read on the replica, or on the primary if there is none.
+    void EnqueueReplica(SQLOperation* op);
+
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent
     //! deadlocks.
@@ -266,12 +297,19 @@ private:
 
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
+    void InvalidateQuerySnapshot();
+
     //! Queue shared by async worker threads.
     std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    //! Queue shared by replica worker threads.
+    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _replicaQueue;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo>                  _connectionInfo;
+    std::unique_ptr<MySQLConnectionInfo> _replicaConnectionInfo;
+    std::unique_ptr<QuerySnapshot>                        _querySnapshot;
     std::vector<uint8> _preparedStatementSize;
-    uint8              _async_threads, _synch_threads;
+    uint8              _async_threads, _synch_threads, _replica_threads;
+    uint8              _async_batch_size;
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
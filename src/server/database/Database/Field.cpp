@@ -98,25 +98,12 @@ inline bool IsCorrectFieldType(DatabaseFieldTypes type)
     return false;
 }
 
-inline Optional<std::string_view> GetCleanAliasName(std::string_view alias)
-{
-    if (alias.empty())
-        return {};
-
-    auto pos = alias.find_first_of('(');
-    if (pos == std::string_view::npos)
-        return {};
-
-    alias.remove_suffix(alias.length() - pos);
-
-    return {alias};
-}
-
 template <typename T>
-inline bool IsCorrectAlias(DatabaseFieldTypes type, std::string_view alias)
+inline bool IsCorrectAlias(DatabaseFieldTypes     type,
+                           DatabaseFieldAggregate aggregate)
 {
     if constexpr (std::is_same_v<T, double>) {
-        if ((StringEqualI(alias, "sum") || StringEqualI(alias, "avg")) &&
+        if (aggregate == DatabaseFieldAggregate::SumAvg &&
             type == DatabaseFieldTypes::Decimal)
             return true;
 
@@ -124,13 +111,14 @@ inline bool IsCorrectAlias(DatabaseFieldTypes type, std::string_view alias)
     }
 
     if constexpr (std::is_same_v<T, uint64>) {
-        if (StringEqualI(alias, "count") && type == DatabaseFieldTypes::Int64)
+        if (aggregate == DatabaseFieldAggregate::Count &&
+            type == DatabaseFieldTypes::Int64)
             return true;
 
         return false;
     }
 
-    if ((StringEqualI(alias, "min") || StringEqualI(alias, "max")) &&
+    if (aggregate == DatabaseFieldAggregate::MinMax &&
         IsCorrectFieldType<T>(type)) {
         return true;
     }
@@ -139,6 +127,26 @@ inline bool IsCorrectAlias(DatabaseFieldTypes type, std::string_view alias)
 }
 } // namespace
 
+DatabaseFieldAggregate GetDatabaseFieldAggregate(std::string_view alias)
+{
+    auto pos = alias.find_first_of('(');
+    if (pos == std::string_view::npos)
+        return DatabaseFieldAggregate::None;
+
+    alias.remove_suffix(alias.length() - pos);
+
+    if (StringEqualI(alias, "min") || StringEqualI(alias, "max"))
+        return DatabaseFieldAggregate::MinMax;
+
+    if (StringEqualI(alias, "sum") || StringEqualI(alias, "avg"))
+        return DatabaseFieldAggregate::SumAvg;
+
+    if (StringEqualI(alias, "count"))
+        return DatabaseFieldAggregate::Count;
+
+    return DatabaseFieldAggregate::None;
+}
+
 void Field::GetBinarySizeChecked(uint8* buf, size_t length) const
 {
     ASSERT(data.value && (data.length == length),
@@ -229,15 +237,14 @@ T Field::GetData() const
             result = Acore::StringTo<float>(data.value);
     }
 
-    // Check -1 for *_dbc db tables
+    // Check -1 for *_dbc db tables, only a failed conversion needs this
     if constexpr (std::is_same_v<T, uint32>) {
         std::string_view tableName{meta->TableName};
 
-        if (!tableName.empty() && tableName.size() > 4) {
+        if (!result && tableName.size() > 4 && tableName.ends_with("_dbc")) {
             auto signedResult = Acore::StringTo<int32>(data.value);
 
-            if (signedResult && !result &&
-                tableName.substr(tableName.length() - 4) == "_dbc") {
+            if (signedResult) {
                 LOG_DEBUG(
                     "sql.sql",
                     "> Found incorrect value '{}' for type '{}' in _dbc table.",
@@ -253,25 +260,27 @@ T Field::GetData() const
         }
     }
 
-    if (auto alias = GetCleanAliasName(meta->Alias)) {
-        if ((StringEqualI(*alias, "min") || StringEqualI(*alias, "max")) &&
-            !IsCorrectAlias<T>(meta->Type, *alias)) {
+    switch (meta->Aggregate) {
+    case DatabaseFieldAggregate::MinMax:
+        if (!IsCorrectAlias<T>(meta->Type, meta->Aggregate))
             LogWrongType(__FUNCTION__, typeid(T).name());
-        }
-
-        if ((StringEqualI(*alias, "sum") || StringEqualI(*alias, "avg")) &&
-            !IsCorrectAlias<T>(meta->Type, *alias)) {
+        break;
+    case DatabaseFieldAggregate::SumAvg:
+        if (!IsCorrectAlias<T>(meta->Type, meta->Aggregate)) {
             LogWrongType(__FUNCTION__, typeid(T).name());
             LOG_WARN("sql.sql", "> Please use GetData<double>()");
             return GetData<double>();
         }
-
-        if (StringEqualI(*alias, "count") &&
-            !IsCorrectAlias<T>(meta->Type, *alias)) {
+        break;
+    case DatabaseFieldAggregate::Count:
+        if (!IsCorrectAlias<T>(meta->Type, meta->Aggregate)) {
             LogWrongType(__FUNCTION__, typeid(T).name());
             LOG_WARN("sql.sql", "> Please use GetData<uint64>()");
             return GetData<uint64>();
         }
+        break;
+    default:
+        break;
     }
 
     if (!result) {
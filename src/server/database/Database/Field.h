@@ -51,16 +51,24 @@ enum class DatabaseFieldTypes : uint8 {
     Binary
 };
 
+//- Aggregate function a column is named after, e.g. "COUNT(*)"
+enum class DatabaseFieldAggregate : uint8 { None, MinMax, SumAvg, Count };
+
 struct QueryResultFieldMetadata {
-    std::string        TableName{};
-    std::string        TableAlias{};
-    std::string        Name{};
-    std::string        Alias{};
-    std::string        TypeName{};
-    uint32             Index = 0;
-    DatabaseFieldTypes Type  = DatabaseFieldTypes::Null;
+    std::string            TableName{};
+    std::string            TableAlias{};
+    std::string            Name{};
+    std::string            Alias{};
+    std::string            TypeName{};
+    uint32                 Index     = 0;
+    DatabaseFieldTypes     Type      = DatabaseFieldTypes::Null;
+    DatabaseFieldAggregate Aggregate = DatabaseFieldAggregate::None;
 };
 
+//- Parses the alias once per column instead of on every Field::Get
+AC_DATABASE_API DatabaseFieldAggregate
+GetDatabaseFieldAggregate(std::string_view alias);
+
 /**
     @class Field
 
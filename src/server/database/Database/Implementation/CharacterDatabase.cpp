@@ -1440,17 +1440,13 @@ void CharacterDatabaseConnection::DoPrepareStatements()
                      "DELETE FROM character_achievement_progress WHERE guid = "
                      "? AND criteria = ?",
                      CONNECTION_ASYNC);
-    PrepareStatement(CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS,
-                     "INSERT INTO character_achievement_progress (guid, "
+    PrepareStatement(CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS,
+                     "REPLACE INTO character_achievement_progress (guid, "
                      "criteria, counter, date) VALUES (?, ?, ?, ?)",
                      CONNECTION_ASYNC);
-    PrepareStatement(
-        CHAR_DEL_CHAR_REPUTATION_BY_FACTION,
-        "DELETE FROM character_reputation WHERE guid = ? AND faction = ?",
-        CONNECTION_ASYNC);
-    PrepareStatement(CHAR_INS_CHAR_REPUTATION_BY_FACTION,
-                     "INSERT INTO character_reputation (guid, faction, "
-                     "standing, flags) VALUES (?, ?, ? , ?)",
+    PrepareStatement(CHAR_REP_CHAR_REPUTATION_BY_FACTION,
+                     "REPLACE INTO character_reputation (guid, faction, "
+                     "standing, flags) VALUES (?, ?, ?, ?)",
                      CONNECTION_ASYNC);
     PrepareStatement(
         CHAR_UPD_CHAR_ARENA_POINTS,
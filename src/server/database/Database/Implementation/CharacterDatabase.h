@@ -364,9 +364,8 @@ enum CharacterDatabaseStatements : uint32 {
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS,
     CHAR_INS_CHAR_ACHIEVEMENT,
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA,
-    CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS,
-    CHAR_DEL_CHAR_REPUTATION_BY_FACTION,
-    CHAR_INS_CHAR_REPUTATION_BY_FACTION,
+    CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS,
+    CHAR_REP_CHAR_REPUTATION_BY_FACTION,
     CHAR_UPD_CHAR_ARENA_POINTS,
     CHAR_DEL_ITEM_REFUND_INSTANCE,
     CHAR_INS_ITEM_REFUND_INSTANCE,
@@ -19,6 +19,7 @@
 #include "MySQLConnection.h"
 #include "DatabaseWorker.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLHacks.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
@@ -237,6 +238,10 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
+    METRIC_DETAILED_TIMER("db_statement_time",
+                          METRIC_TAG("db", m_connectionInfo.database),
+                          METRIC_TAG("statement", std::to_string(index)));
+
     uint32 _s = getMSTime();
 
 #if !defined(MARIADB_VERSION_ID) && (MYSQL_VERSION_ID >= 80300)
@@ -309,6 +314,10 @@ bool MySQLConnection::_Query(PreparedStatementBase*   stmt,
     MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
+    METRIC_DETAILED_TIMER("db_statement_time",
+                          METRIC_TAG("db", m_connectionInfo.database),
+                          METRIC_TAG("statement", std::to_string(index)));
+
     uint32 _s = getMSTime();
 
 #if !defined(MARIADB_VERSION_ID) && (MYSQL_VERSION_ID >= 80300)
@@ -436,6 +445,12 @@ bool MySQLConnection::_Query(std::string_view sql,
     return true;
 }
 
+void MySQLConnection::SetAsyncBatchSize(uint8 batchSize)
+{
+    if (m_worker)
+        m_worker->SetBatchSize(batchSize);
+}
+
 void MySQLConnection::BeginTransaction() { Execute("START TRANSACTION"); }
 
 void MySQLConnection::RollbackTransaction() { Execute("ROLLBACK"); }
@@ -92,8 +92,16 @@ public:
     size_t EscapeString(char* to, const char* from, size_t length);
     void   Ping();
 
+    //! Asynchronous connections only, see DatabaseWorker::SetBatchSize
+    void SetAsyncBatchSize(uint8 batchSize);
+
     uint32 GetLastError();
 
+    [[nodiscard]] std::string const& GetDatabaseName() const
+    {
+        return m_connectionInfo.database;
+    }
+
 protected:
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
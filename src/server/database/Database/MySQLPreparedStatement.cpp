@@ -64,6 +64,8 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt*       stmt,
     /// Initialize variable parameters
     m_paramCount = mysql_stmt_param_count(stmt);
     m_paramsSet.assign(m_paramCount, false);
+    m_paramValues.assign(m_paramCount, 0);
+    m_paramLengths.assign(m_paramCount, 0);
     m_bind = new MySQLBind[m_paramCount];
     memset(m_bind, 0, sizeof(MySQLBind) * m_paramCount);
 
@@ -107,10 +109,10 @@ void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 
 void MySQLPreparedStatement::ClearParameters()
 {
+    // Nothing to free, the binds only point to m_paramValues,
+    // m_paramLengths or into the bound statement
     for (uint32 i = 0; i < m_paramCount; ++i) {
-        delete m_bind[i].length;
         m_bind[i].length = nullptr;
-        delete[] (char*)m_bind[i].buffer;
         m_bind[i].buffer = nullptr;
         m_paramsSet[i]   = false;
     }
@@ -148,13 +150,15 @@ void MySQLPreparedStatement::AssertValidIndex(uint8 index)
 template <typename T>
 void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
 {
+    static_assert(sizeof(T) <= sizeof(uint64));
+
     AssertValidIndex(index);
     m_paramsSet[index] = true;
     MYSQL_BIND* param  = &m_bind[index];
     uint32      len    = uint32(sizeof(T));
     param->buffer_type = MySQLType<T>::value;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer        = new char[len];
+
+    param->buffer        = &m_paramValues[index];
     param->buffer_length = 0;
     param->is_null_value = 0;
     param->length        = nullptr; // Only != NULL for strings
@@ -175,12 +179,11 @@ void MySQLPreparedStatement::SetParameter(const uint8 index,
     m_paramsSet[index] = true;
     MYSQL_BIND* param  = &m_bind[index];
     param->buffer_type = MYSQL_TYPE_NULL;
-    delete[] static_cast<char*>(param->buffer);
+
     param->buffer        = nullptr;
     param->buffer_length = 0;
     param->is_null_value = 1;
-    delete param->length;
-    param->length = nullptr;
+    param->length        = nullptr;
 }
 
 void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
@@ -190,14 +193,12 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
     MYSQL_BIND* param  = &m_bind[index];
     uint32      len    = uint32(value.size());
     param->buffer_type = MYSQL_TYPE_VAR_STRING;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer        = new char[len];
-    param->buffer_length = len;
-    param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
-
-    memcpy(param->buffer, value.c_str(), len);
+    // The statement outlives its execution, no need to copy the value
+    param->buffer         = const_cast<char*>(value.data());
+    param->buffer_length  = len;
+    param->is_null_value  = 0;
+    m_paramLengths[index] = len;
+    param->length         = &m_paramLengths[index];
 }
 
 void MySQLPreparedStatement::SetParameter(uint8                     index,
@@ -208,14 +209,12 @@ void MySQLPreparedStatement::SetParameter(uint8                     index,
     MYSQL_BIND* param  = &m_bind[index];
     uint32      len    = uint32(value.size());
     param->buffer_type = MYSQL_TYPE_BLOB;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer        = new char[len];
-    param->buffer_length = len;
-    param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
-
-    memcpy(param->buffer, value.data(), len);
+    // The statement outlives its execution, no need to copy the value
+    param->buffer         = const_cast<uint8*>(value.data());
+    param->buffer_length  = len;
+    param->is_null_value  = 0;
+    m_paramLengths[index] = len;
+    param->length         = &m_paramLengths[index];
 }
 
 std::string MySQLPreparedStatement::getQueryString() const
@@ -66,6 +66,12 @@ private:
     MySQLBind*        m_bind;
     std::string       m_queryString{};
 
+    //- Storage the binds of numeric parameters and the lengths of string
+    //- parameters point to, kept between executions. String and binary
+    //- binds point into the bound PreparedStatementBase itself.
+    std::vector<uint64>        m_paramValues;
+    std::vector<unsigned long> m_paramLengths;
+
     MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
     MySQLPreparedStatement&
     operator=(MySQLPreparedStatement const& right) = delete;
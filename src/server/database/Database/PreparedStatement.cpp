@@ -31,6 +31,33 @@ PreparedStatementBase::PreparedStatementBase(uint32 index, uint8 capacity)
 
 PreparedStatementBase::~PreparedStatementBase() {}
 
+std::size_t PreparedStatementBase::GetParametersHash() const
+{
+    std::size_t hash    = std::hash<uint32>()(m_index);
+    auto        combine = [&hash](std::size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+
+    for (PreparedStatementData const& parameter : statement_data) {
+        std::size_t const value = std::visit(
+            [](auto const& data) -> std::size_t {
+                using T = std::decay_t<decltype(data)>;
+                if constexpr (std::is_same_v<T, std::vector<uint8>>)
+                    return std::hash<std::string_view>()(std::string_view(
+                        reinterpret_cast<char const*>(data.data()),
+                        data.size()));
+                else
+                    return std::hash<T>()(data);
+            },
+            parameter.data);
+
+        combine(parameter.data.index());
+        combine(value);
+    }
+
+    return hash;
+}
+
 //- Bind to buffer
 template <typename T>
 Acore::Types::is_non_string_view_v<T>
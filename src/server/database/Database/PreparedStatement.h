@@ -131,6 +131,10 @@ public:
         return statement_data;
     }
 
+    //- Hash of the statement index and its bound parameters, equal for two
+    //- statements which would write the same data
+    [[nodiscard]] std::size_t GetParametersHash() const;
+
 protected:
     template <typename T>
     Acore::Types::is_non_string_view_v<T> SetValidData(const uint8 index,
@@ -182,6 +186,8 @@ public:
     bool                      Execute() override;
     PreparedQueryResultFuture GetFuture() { return m_result->get_future(); }
 
+    [[nodiscard]] bool IsBatchable() const override { return !m_has_result; }
+
 protected:
     PreparedStatementBase*      m_stmt;
     bool                        m_has_result;
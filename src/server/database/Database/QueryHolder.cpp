@@ -81,16 +81,37 @@ void SQLQueryHolderBase::SetSize(size_t size)
     m_queries.resize(size);
 }
 
+SQLQueryHolderTask::SQLQueryHolderTask(
+    std::shared_ptr<SQLQueryHolderBase> holder)
+    : m_holder(std::move(holder)),
+      m_join(std::make_shared<SQLQueryHolderJoin>(1)), m_begin(0),
+      m_end(m_holder->GetSize())
+{
+}
+
+SQLQueryHolderTask::SQLQueryHolderTask(
+    std::shared_ptr<SQLQueryHolderBase> holder,
+    std::shared_ptr<SQLQueryHolderJoin> join,
+    size_t                              begin,
+    size_t                              end)
+    : m_holder(std::move(holder)), m_join(std::move(join)), m_begin(begin),
+      m_end(end)
+{
+}
+
 SQLQueryHolderTask::~SQLQueryHolderTask() = default;
 
 bool SQLQueryHolderTask::Execute()
 {
-    /// execute all queries in the holder and pass the results
-    for (size_t i = 0; i < m_holder->m_queries.size(); ++i)
+    /// execute our part of the queries in the holder and pass the results,
+    /// other tasks only write the results of their own indexes
+    for (size_t i = m_begin; i < m_end; ++i)
         if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
 
-    m_result.set_value();
+    if (--m_join->Pending == 0)
+        m_join->Result.set_value();
+
     return true;
 }
 
@@ -20,6 +20,7 @@
 #define _QUERYHOLDER_H
 
 #include "SQLOperation.h"
+#include <atomic>
 #include <vector>
 
 class AC_DATABASE_API SQLQueryHolderBase {
@@ -29,6 +30,7 @@ public:
     SQLQueryHolderBase() = default;
     virtual ~SQLQueryHolderBase();
     void                SetSize(size_t size);
+    [[nodiscard]] size_t GetSize() const { return m_queries.size(); }
     PreparedQueryResult GetPreparedResult(size_t index) const;
     void SetPreparedResult(size_t index, PreparedResultSet* result);
 
@@ -49,21 +51,34 @@ public:
     }
 };
 
+//- Shared by the tasks executing parts of one holder, the last task to
+//- finish completes the holder
+struct SQLQueryHolderJoin {
+    explicit SQLQueryHolderJoin(size_t tasks) : Pending(tasks) {}
+
+    std::atomic<size_t>      Pending;
+    QueryResultHolderPromise Result;
+};
+
 class AC_DATABASE_API SQLQueryHolderTask : public SQLOperation {
 public:
-    explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
-        : m_holder(std::move(holder))
-    {
-    }
+    explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder);
+    //- Executes only the queries [begin, end) of the holder
+    SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder,
+                       std::shared_ptr<SQLQueryHolderJoin> join,
+                       size_t                              begin,
+                       size_t                              end);
 
     ~SQLQueryHolderTask();
 
     bool                    Execute() override;
-    QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
+    QueryResultHolderFuture GetFuture() { return m_join->Result.get_future(); }
 
 private:
     std::shared_ptr<SQLQueryHolderBase> m_holder;
-    QueryResultHolderPromise            m_result;
+    std::shared_ptr<SQLQueryHolderJoin> m_join;
+    size_t                              m_begin;
+    size_t                              m_end;
 };
 
 class AC_DATABASE_API SQLQueryHolderCallback {
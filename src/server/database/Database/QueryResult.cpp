@@ -22,8 +22,13 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include <cstring>
+#include <limits>
 
 namespace {
+/// Length written in place of a value for NULL fields
+constexpr uint32 SerializedNullLength = std::numeric_limits<uint32>::max();
+
 static uint32 SizeForType(MYSQL_FIELD* field)
 {
     switch (field->type) {
@@ -191,7 +196,58 @@ void InitializeDatabaseFieldMetadata(QueryResultFieldMetadata* meta,
     meta->TypeName   = FieldTypeToString(field->type);
     meta->Index      = fieldIndex;
     meta->Type       = MysqlTypeToFieldType(field->type);
+    meta->Aggregate  = GetDatabaseFieldAggregate(meta->Alias);
+}
+
+template <typename T>
+void WriteSerialized(std::string& out, T value)
+{
+    out.append(reinterpret_cast<char const*>(&value), sizeof(T));
 }
+
+void WriteSerialized(std::string& out, std::string const& str)
+{
+    WriteSerialized<uint32>(out, str.size());
+    out.append(str);
+}
+
+/// Bounds checked reader over a buffer written by ResultSet::Serialize()
+class SerializedReader {
+public:
+    explicit SerializedReader(std::string_view data)
+        : _pos(data.data()), _end(data.data() + data.size())
+    {
+    }
+
+    template <typename T>
+    bool Read(T& value)
+    {
+        if (std::size_t(_end - _pos) < sizeof(T))
+            return false;
+
+        std::memcpy(&value, _pos, sizeof(T));
+        _pos += sizeof(T);
+        return true;
+    }
+
+    bool Read(std::string& str)
+    {
+        uint32 length = 0;
+        if (!Read(length) || std::size_t(_end - _pos) < length)
+            return false;
+
+        str.assign(_pos, length);
+        _pos += length;
+        return true;
+    }
+
+    [[nodiscard]] std::size_t GetRemaining() const { return _end - _pos; }
+    [[nodiscard]] char const* GetPosition() const { return _pos; }
+
+private:
+    char const* _pos;
+    char const* _end;
+};
 } // namespace
 
 ResultSet::ResultSet(MySQLResult* result,
@@ -199,7 +255,7 @@ ResultSet::ResultSet(MySQLResult* result,
                      uint64       rowCount,
                      uint32       fieldCount)
     : _rowCount(rowCount), _fieldCount(fieldCount), _result(result),
-      _fields(fields)
+      _fields(fields), _serializedRow(nullptr), _serializedEnd(nullptr)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -210,12 +266,63 @@ ResultSet::ResultSet(MySQLResult* result,
     }
 }
 
+ResultSet::ResultSet(std::shared_ptr<void const> storage,
+                     std::string_view            data)
+    : _rowCount(0), _currentRow(nullptr), _fieldCount(0), _result(nullptr),
+      _fields(nullptr), _serializedRow(nullptr), _serializedEnd(nullptr)
+{
+    SerializedReader reader(data);
+
+    uint32 fieldCount = 0;
+    bool   valid      = reader.Read(fieldCount) &&
+                 fieldCount <= reader.GetRemaining();
+
+    std::vector<QueryResultFieldMetadata> fieldMetadata;
+    if (valid)
+        fieldMetadata.resize(fieldCount);
+
+    for (uint32 i = 0; valid && i < fieldCount; ++i) {
+        QueryResultFieldMetadata& meta = fieldMetadata[i];
+        uint8                     type = 0;
+
+        valid = reader.Read(meta.TableName) && reader.Read(meta.TableAlias) &&
+                reader.Read(meta.Name) && reader.Read(meta.Alias) &&
+                reader.Read(meta.TypeName) && reader.Read(type);
+
+        meta.Index     = i;
+        meta.Type      = DatabaseFieldTypes(type);
+        meta.Aggregate = GetDatabaseFieldAggregate(meta.Alias);
+    }
+
+    uint64 rowCount = 0;
+    if (!valid || !reader.Read(rowCount)) {
+        LOG_ERROR("sql.sql",
+                  "ResultSet: malformed serialized result, treating it as "
+                  "empty.");
+        return;
+    }
+
+    _fieldMetadata = std::move(fieldMetadata);
+    _rowCount      = rowCount;
+    _fieldCount    = fieldCount;
+    _currentRow    = new Field[_fieldCount];
+    _storage       = std::move(storage);
+    _serializedRow = reader.GetPosition();
+    _serializedEnd = data.data() + data.size();
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet() { CleanUp(); }
 
 bool ResultSet::NextRow()
 {
     MYSQL_ROW row;
 
+    if (_serializedRow)
+        return NextSerializedRow();
+
     if (!_result)
         return false;
 
@@ -242,10 +349,87 @@ bool ResultSet::NextRow()
     return true;
 }
 
+bool ResultSet::NextSerializedRow()
+{
+    if (_serializedRow == _serializedEnd) {
+        CleanUp();
+        return false;
+    }
+
+    bool truncated = false;
+    for (uint32 i = 0; i < _fieldCount; i++) {
+        uint32 length = 0;
+        if (std::size_t(_serializedEnd - _serializedRow) < sizeof(length)) {
+            truncated = true;
+            break;
+        }
+
+        std::memcpy(&length, _serializedRow, sizeof(length));
+        _serializedRow += sizeof(length);
+
+        if (length == SerializedNullLength) {
+            _currentRow[i].SetStructuredValue(nullptr, 0);
+            continue;
+        }
+
+        // Values are followed by a terminator, Field parses them as C strings
+        if (std::size_t(_serializedEnd - _serializedRow) <= length) {
+            truncated = true;
+            break;
+        }
+
+        _currentRow[i].SetStructuredValue(_serializedRow, length);
+        _serializedRow += length + 1;
+    }
+
+    if (!truncated)
+        return true;
+
+    LOG_ERROR("sql.sql", "ResultSet: serialized row is truncated.");
+    CleanUp();
+    return false;
+}
+
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
+}
+
+void ResultSet::Serialize(std::string& out)
+{
+    WriteSerialized<uint32>(out, _fieldCount);
+    for (QueryResultFieldMetadata const& meta : _fieldMetadata) {
+        WriteSerialized(out, meta.TableName);
+        WriteSerialized(out, meta.TableAlias);
+        WriteSerialized(out, meta.Name);
+        WriteSerialized(out, meta.Alias);
+        WriteSerialized(out, meta.TypeName);
+        WriteSerialized<uint8>(out, uint8(meta.Type));
+    }
+
+    // Patched below, NextRow() may stop early on a fetch error
+    std::size_t const rowCountPos = out.size();
+    uint64            rowCount    = 0;
+    WriteSerialized<uint64>(out, rowCount);
+
+    while (NextRow()) {
+        for (uint32 i = 0; i < _fieldCount; i++) {
+            Field const& field = _currentRow[i];
+            if (field.IsNull()) {
+                WriteSerialized(out, SerializedNullLength);
+                continue;
+            }
+
+            WriteSerialized<uint32>(out, field.data.length);
+            out.append(field.data.value, field.data.length);
+            out.push_back('\0');
+        }
+
+        ++rowCount;
+    }
+
+    std::memcpy(out.data() + rowCountPos, &rowCount, sizeof(rowCount));
 }
 
 void ResultSet::CleanUp()
@@ -259,6 +443,9 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    _serializedRow = nullptr;
+    _storage.reset();
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -22,6 +22,8 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -56,6 +58,9 @@ public:
               MySQLField*  fields,
               uint64       rowCount,
               uint32       fieldCount);
+    /// Replays a result written by Serialize(). The memory behind data must
+    /// stay valid for as long as storage is alive.
+    ResultSet(std::shared_ptr<void const> storage, std::string_view data);
     ~ResultSet();
 
     bool                      NextRow();
@@ -63,6 +68,10 @@ public:
     [[nodiscard]] uint32      GetFieldCount() const { return _fieldCount; }
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
 
+    /// Appends the field metadata and every row not yet fetched to out.
+    /// Consumes the result, call it before the first NextRow().
+    void Serialize(std::string& out);
+
     [[nodiscard]] Field* Fetch() const { return _currentRow; }
     Field const&         operator[](std::size_t index) const;
 
@@ -96,9 +105,15 @@ private:
     void CleanUp();
     void AssertRows(std::size_t sizeRows);
 
+    bool NextSerializedRow();
+
     MySQLResult* _result;
     MySQLField*  _fields;
 
+    std::shared_ptr<void const> _storage;
+    char const*                 _serializedRow;
+    char const*                 _serializedEnd;
+
     ResultSet(ResultSet const& right)            = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
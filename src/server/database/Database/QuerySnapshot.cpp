@@ -0,0 +1,231 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QuerySnapshot.h"
+#include "Log.h"
+#include "MappedFile.h"
+#include "QueryResult.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+namespace {
+constexpr char   SnapshotMagic[4] = {'A', 'C', 'Q', 'S'};
+constexpr uint32 SnapshotVersion  = 1;
+
+struct SnapshotHeader {
+    char   Magic[4];
+    uint32 Version;
+    uint64 Key;
+    uint64 Count;
+};
+
+template <typename T>
+bool ReadSnapshot(uint8 const*& pos, uint8 const* end, T& value)
+{
+    if (std::size_t(end - pos) < sizeof(T))
+        return false;
+
+    std::memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+template <typename T>
+void WriteSnapshot(std::ofstream& out, T const& value)
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+} // namespace
+
+QuerySnapshot::QuerySnapshot(std::string path)
+    : _path(std::move(path)), _key(0), _dirty(false), _active(false),
+      _invalidated(false)
+{
+}
+
+QuerySnapshot::~QuerySnapshot() = default;
+
+void QuerySnapshot::Start(uint64 key)
+{
+    _key   = key;
+    _dirty = false;
+    _entries.clear();
+
+    if (Load())
+        LOG_INFO("sql.driver",
+                 "Using query snapshot {} with {} results.",
+                 _path,
+                 _entries.size());
+    else
+        LOG_INFO("sql.driver",
+                 "Query snapshot {} is missing or outdated, recording a new "
+                 "one.",
+                 _path);
+
+    _active = true;
+}
+
+void QuerySnapshot::Stop()
+{
+    if (!_active)
+        return;
+
+    _active = false;
+
+    bool const saved = _dirty && Save();
+
+    // The mapping has to be released before the new file replaces it
+    _entries.clear();
+
+    if (!saved)
+        return;
+
+    std::error_code error;
+    std::filesystem::rename(_path + ".tmp", _path, error);
+    if (error)
+        LOG_ERROR("sql.driver",
+                  "Could not replace query snapshot {}: {}",
+                  _path,
+                  error.message());
+    else
+        LOG_INFO("sql.driver", "Wrote query snapshot {}.", _path);
+}
+
+void QuerySnapshot::Invalidate()
+{
+    if (_active || _invalidated.exchange(true))
+        return;
+
+    std::error_code error;
+    if (std::filesystem::remove(_path, error))
+        LOG_INFO("sql.driver",
+                 "Removed query snapshot {} after a write to the database.",
+                 _path);
+}
+
+ResultSet* QuerySnapshot::Find(std::string_view sql) const
+{
+    if (!_active)
+        return nullptr;
+
+    std::shared_lock lock(_entriesLock);
+
+    auto itr = _entries.find(std::string(sql));
+    if (itr == _entries.end())
+        return nullptr;
+
+    return new ResultSet(itr->second.Storage, itr->second.Data);
+}
+
+ResultSet* QuerySnapshot::Record(std::string_view sql, ResultSet* result)
+{
+    if (!_active)
+        return result;
+
+    auto data = std::make_shared<std::string>();
+    result->Serialize(*data);
+    delete result;
+
+    std::unique_lock lock(_entriesLock);
+
+    auto [itr, inserted] = _entries.try_emplace(std::string(sql));
+    if (inserted) {
+        itr->second.Data    = *data;
+        itr->second.Storage = std::move(data);
+        _dirty              = true;
+    }
+
+    return new ResultSet(itr->second.Storage, itr->second.Data);
+}
+
+bool QuerySnapshot::Load()
+{
+    auto file = std::make_shared<Acore::MappedFile>();
+    if (!file->Open(_path))
+        return false;
+
+    uint8 const* pos = file->GetData();
+    uint8 const* end = pos + file->GetSize();
+
+    SnapshotHeader header;
+    if (!ReadSnapshot(pos, end, header) ||
+        std::memcmp(header.Magic, SnapshotMagic, sizeof(header.Magic)) ||
+        header.Version != SnapshotVersion || header.Key != _key)
+        return false;
+
+    for (uint64 i = 0; i < header.Count; ++i) {
+        uint32 sqlLength  = 0;
+        uint64 dataLength = 0;
+
+        if (!ReadSnapshot(pos, end, sqlLength) ||
+            std::size_t(end - pos) < sqlLength) {
+            _entries.clear();
+            return false;
+        }
+
+        std::string sql(reinterpret_cast<char const*>(pos), sqlLength);
+        pos += sqlLength;
+
+        if (!ReadSnapshot(pos, end, dataLength) ||
+            std::size_t(end - pos) < dataLength) {
+            _entries.clear();
+            return false;
+        }
+
+        Entry& entry  = _entries[std::move(sql)];
+        entry.Storage = file;
+        entry.Data    = {reinterpret_cast<char const*>(pos), dataLength};
+        pos += dataLength;
+    }
+
+    return true;
+}
+
+bool QuerySnapshot::Save() const
+{
+    std::ofstream out(_path + ".tmp", std::ios::binary | std::ios::trunc);
+    if (!out) {
+        LOG_ERROR(
+            "sql.driver", "Could not create query snapshot {}.tmp", _path);
+        return false;
+    }
+
+    SnapshotHeader header;
+    std::memcpy(header.Magic, SnapshotMagic, sizeof(header.Magic));
+    header.Version = SnapshotVersion;
+    header.Key     = _key;
+    header.Count   = _entries.size();
+    WriteSnapshot(out, header);
+
+    for (auto const& [sql, entry] : _entries) {
+        WriteSnapshot<uint32>(out, sql.size());
+        out.write(sql.data(), sql.size());
+        WriteSnapshot<uint64>(out, entry.Data.size());
+        out.write(entry.Data.data(), entry.Data.size());
+    }
+
+    out.close();
+    if (!out) {
+        LOG_ERROR("sql.driver", "Could not write query snapshot {}.tmp", _path);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef QUERYSNAPSHOT_H
+#define QUERYSNAPSHOT_H
+
+#include "Define.h"
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class ResultSet;
+
+/// Binary snapshot of ad-hoc query results, read back through a memory
+/// mapping instead of asking the server again. A snapshot is only used when
+/// it was written for the same key, callers derive the key from everything
+/// that can change the results (applied updates, core revision).
+class AC_DATABASE_API QuerySnapshot {
+public:
+    explicit QuerySnapshot(std::string path);
+    ~QuerySnapshot();
+
+    QuerySnapshot(QuerySnapshot const&)            = delete;
+    QuerySnapshot& operator=(QuerySnapshot const&) = delete;
+
+    /// Maps the snapshot file if it was written for key and starts serving
+    /// and recording results
+    void Start(uint64 key);
+    /// Rewrites the snapshot file if new results were recorded and releases
+    /// the mapping. Results still held by callers stay valid.
+    void Stop();
+    /// Deletes the snapshot file once the snapshot is stopped, the recorded
+    /// results no longer match the database
+    void Invalidate();
+
+    [[nodiscard]] bool IsActive() const { return _active; }
+
+    /// Returns a replay of the result recorded for sql, nullptr if there is
+    /// none or the snapshot isn't active
+    [[nodiscard]] ResultSet* Find(std::string_view sql) const;
+    /// Records result for sql and returns a replay of it, result is consumed.
+    /// Returns result unchanged if the snapshot isn't active.
+    ResultSet* Record(std::string_view sql, ResultSet* result);
+
+private:
+    struct Entry {
+        std::shared_ptr<void const> Storage;
+        std::string_view            Data;
+    };
+
+    bool Load();
+    bool Save() const;
+
+    std::string                            _path;
+    uint64                                 _key;
+    std::unordered_map<std::string, Entry> _entries;
+    mutable std::shared_mutex              _entriesLock;
+    bool                                   _dirty;
+    std::atomic<bool>                      _active;
+    std::atomic<bool>                      _invalidated;
+};
+
+#endif
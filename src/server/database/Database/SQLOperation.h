@@ -21,6 +21,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include <variant>
 
 //- Type specifier of our element data
@@ -48,8 +49,15 @@ public:
     virtual bool Execute() = 0;
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+    //- Operations without a result which may share a transaction with
+    //- other batchable operations, see DatabaseWorker
+    [[nodiscard]] virtual bool IsBatchable() const { return false; }
+
     MySQLConnection* m_conn{nullptr};
 
+    //- Set when the operation is queued, see DatabaseWorker::Execute
+    TimePoint m_queuedTime;
+
 private:
     SQLOperation(SQLOperation const& right)            = delete;
     SQLOperation& operator=(SQLOperation const& right) = delete;
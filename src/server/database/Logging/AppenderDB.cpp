@@ -20,13 +20,24 @@
 #include "DatabaseEnv.h"
 #include "LogMessage.h"
 #include "PreparedStatement.h"
+#include "Timer.h"
+
+namespace {
+// rows buffered before the batch is committed
+constexpr std::size_t BATCH_SIZE = 64;
+// age in ms after which a partial batch is committed
+constexpr uint32 BATCH_INTERVAL = 1000;
+// pending login db tasks above which batches are dropped instead of queued
+constexpr std::size_t MAX_QUEUED_TASKS = 256;
+} // namespace
 
 AppenderDB::AppenderDB(uint8              id,
                        std::string const& name,
                        LogLevel           level,
                        AppenderFlags /*flags*/,
                        std::vector<std::string_view> const& /*args*/)
-    : Appender(id, name, level), realmId(0), enabled(false)
+    : Appender(id, name, level), realmId(0), enabled(false), _pendingSince(0),
+      _dropped(0)
 {
 }
 
@@ -45,7 +56,57 @@ void AppenderDB::_write(LogMessage const* message)
     stmt->SetData(2, message->type);
     stmt->SetData(3, uint8(message->level));
     stmt->SetData(4, message->text);
-    LoginDatabase.Execute(stmt);
+
+    std::lock_guard<std::mutex> lock(_pendingLock);
+    if (!_pending) {
+        _pending      = LoginDatabase.BeginTransaction();
+        _pendingSince = getMSTime();
+    }
+
+    _pending->Append(stmt);
+
+    if (_pending->GetSize() >= BATCH_SIZE ||
+        getMSTimeDiff(_pendingSince, getMSTime()) >= BATCH_INTERVAL)
+        commitPending();
+}
+
+void AppenderDB::flush()
+{
+    std::lock_guard<std::mutex> lock(_pendingLock);
+    commitPending();
+}
+
+// _pendingLock must be held
+void AppenderDB::commitPending()
+{
+    if (!_pending)
+        return;
+
+    // the login db is falling behind, do not let logging compete with it
+    if (LoginDatabase.QueueSize() > MAX_QUEUED_TASKS) {
+        _dropped += uint32(_pending->GetSize());
+        _pending = nullptr;
+        return;
+    }
+
+    if (_dropped) {
+        LoginDatabasePreparedStatement* stmt =
+            LoginDatabase.GetPreparedStatement(LOGIN_INS_LOG);
+        stmt->SetData(0, uint64(time(nullptr)));
+        stmt->SetData(1, realmId);
+        stmt->SetData(2, "server.logging");
+        stmt->SetData(3, uint8(LOG_LEVEL_WARN));
+        stmt->SetData(4,
+                      Acore::StringFormatFmt(
+                          "AppenderDB dropped {} messages, login database "
+                          "queue was full",
+                          _dropped));
+        _pending->Append(stmt);
+        _dropped = 0;
+    }
+
+    LoginDatabase.CommitTransaction(_pending);
+    _pending = nullptr;
 }
 
 void AppenderDB::setRealmId(uint32 _realmId)
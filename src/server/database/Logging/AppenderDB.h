@@ -20,6 +20,8 @@
 #define APPENDERDB_H
 
 #include "Appender.h"
+#include "DatabaseEnvFwd.h"
+#include <mutex>
 
 class AppenderDB : public Appender {
 public:
@@ -34,11 +36,20 @@ public:
 
     void         setRealmId(uint32 realmId) override;
     AppenderType getType() const override { return type; }
+    void         flush() override;
 
 private:
     uint32 realmId;
     bool   enabled;
     void   _write(LogMessage const* message) override;
+    void   commitPending();
+
+    // rows are committed as one transaction per batch instead of one
+    // async statement per message
+    std::mutex               _pendingLock;
+    LoginDatabaseTransaction _pending;
+    uint32                   _pendingSince;
+    uint32                   _dropped;
 };
 
 #endif
@@ -25,9 +25,12 @@
 #include "Log.h"
 #include "StartProcess.h"
 #include "UpdateFetcher.h"
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 std::string DBUpdaterUtil::GetCorrectedMySQLExecutable()
 {
@@ -425,37 +428,59 @@ bool DBUpdater<T>::Populate(DatabaseWorkerPool<T>& pool)
     }
 
     std::filesystem::directory_iterator const DirItr;
-    uint32                                    FilesCount = 0;
+    std::vector<Path>                         files;
 
     for (std::filesystem::directory_iterator itr(DirPath); itr != DirItr;
          ++itr) {
         if (itr->path().extension() == ".sql")
-            FilesCount++;
+            files.push_back(itr->path());
     }
 
-    if (!FilesCount) {
+    if (files.empty()) {
         LOG_ERROR("sql.updates",
                   ">> In directory \"{}\" not exist '*.sql' files",
                   DirPath.generic_string());
         return false;
     }
 
-    for (std::filesystem::directory_iterator itr(DirPath); itr != DirItr;
-         ++itr) {
-        if (itr->path().extension() != ".sql")
-            continue;
+    // Every base file holds its own tables, so they can be imported by
+    // several mysql processes at once
+    size_t const threadCount = std::clamp<size_t>(
+        sConfigMgr->GetOption<uint32>("Updates.PopulateThreads", 1),
+        1,
+        files.size());
 
-        LOG_INFO("sql.updates",
-                 ">> Applying \'{}\'...",
-                 itr->path().filename().generic_string());
+    std::atomic<size_t> nextFile{0};
+    std::atomic<bool>   failed{false};
 
-        try {
-            ApplyFile(pool, itr->path());
-        }
-        catch (UpdateException&) {
-            return false;
+    auto importFiles = [&]() {
+        for (size_t i = nextFile++; i < files.size() && !failed;
+             i = nextFile++) {
+            LOG_INFO("sql.updates",
+                     ">> Applying \'{}\'...",
+                     files[i].filename().generic_string());
+
+            try {
+                ApplyFile(pool, files[i]);
+            }
+            catch (UpdateException&) {
+                failed = true;
+            }
         }
-    }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+        threads.emplace_back(importFiles);
+
+    importFiles();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    if (failed)
+        return false;
 
     LOG_INFO("sql.updates", ">> Done!");
     LOG_INFO("sql.updates", " ");
@@ -508,7 +533,10 @@ void DBUpdater<T>::ApplyFile(DatabaseWorkerPool<T>& pool,
     tempDir = Acore::String::AddSuffixIfNotExists(
         tempDir, std::filesystem::path::preferred_separator);
 
-    std::string confFileName = "mysql_ac.conf";
+    // One file per call, files may be applied by several threads at once
+    static std::atomic<uint32> confFileCounter{0};
+    std::string const          confFileName =
+        "mysql_ac_" + std::to_string(++confFileCounter) + ".conf";
 
     std::ofstream outfile(tempDir + confFileName);
 
@@ -583,6 +611,9 @@ void DBUpdater<T>::ApplyFile(DatabaseWorkerPool<T>& pool,
                             "",
                             true);
 
+    std::error_code error;
+    std::filesystem::remove(tempDir + confFileName, error);
+
     if (ret != EXIT_SUCCESS) {
         LOG_FATAL("sql.updates",
                   "Applying of file \'{}\' to database \'{}\' failed!"
@@ -33,6 +33,7 @@
 #include "ObjectMgr.h"
 #include "ScriptedCreature.h"
 #include "ScriptedGossip.h"
+#include "ScriptProfiler.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
 #include "Vehicle.h"
@@ -97,6 +98,9 @@ void SmartScript::ProcessEventsFor(SMART_EVENT      e,
                                    SpellInfo const* spell,
                                    GameObject*      gob)
 {
+    if (e >= SMART_EVENT_AC_END || !mEventTypes.test(e))
+        return;
+
     for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end();
          ++i) {
         SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
@@ -104,8 +108,9 @@ void SmartScript::ProcessEventsFor(SMART_EVENT      e,
             continue;
 
         if (eventType == e) {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent(
-                (*i).entryOrGuid, (*i).event_id, (*i).source_type);
+            ConditionList const& conds =
+                sConditionMgr->GetConditionsForSmartEvent(
+                    (*i).entryOrGuid, (*i).event_id, (*i).source_type);
             ConditionSourceInfo info = ConditionSourceInfo(
                 unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
@@ -3522,7 +3527,7 @@ void SmartScript::ProcessTimedAction(SmartScriptHolder& e,
                                      GameObject*        gob)
 {
     // xinef: extended by selfs victim
-    ConditionList const conds = sConditionMgr->GetConditionsForSmartEvent(
+    ConditionList const& conds = sConditionMgr->GetConditionsForSmartEvent(
         e.entryOrGuid, e.event_id, e.source_type);
     ConditionSourceInfo info = ConditionSourceInfo(
         unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
@@ -5429,7 +5434,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e,
                 return;
         }
         else if (e.event.distance.entry != 0) {
-            std::list<Creature*> list;
+            std::vector<Creature*> list;
             me->GetCreatureListWithEntryInGrid(
                 list, e.event.distance.entry, (float)e.event.distance.dist);
 
@@ -5459,7 +5464,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e,
                 return;
         }
         else if (e.event.distance.entry != 0) {
-            std::list<GameObject*> list;
+            std::vector<GameObject*> list;
             me->GetGameObjectListWithEntryInGrid(
                 list, e.event.distance.entry, (float)e.event.distance.dist);
 
@@ -5788,13 +5793,21 @@ bool SmartScript::CheckTimer(SmartScriptHolder const& e) const
     return e.active;
 }
 
+void SmartScript::AddEvent(SmartScriptHolder const& e)
+{
+    mEvents.push_back(e);
+
+    if (e.GetEventType() < SMART_EVENT_AC_END)
+        mEventTypes.set(e.GetEventType());
+}
+
 void SmartScript::InstallEvents()
 {
     if (!mInstallEvents.empty()) {
         for (SmartAIEventList::iterator i = mInstallEvents.begin();
              i != mInstallEvents.end();
              ++i)
-            mEvents.push_back(*i); // must be before UpdateTimers
+            AddEvent(*i); // must be before UpdateTimers
 
         mInstallEvents.clear();
     }
@@ -5807,6 +5820,10 @@ void SmartScript::OnUpdate(uint32 const diff)
         !GetBaseObject())
         return;
 
+    ScriptProfilerScope profile;
+    if (profile.IsSampled())
+        profile.SetScript(SCRIPT_PROFILE_SMART_SCRIPT, GetProfileName());
+
     InstallEvents(); // before UpdateTimers
 
     if (mEventSortingRequired) {
@@ -5929,13 +5946,13 @@ void SmartScript::FillScript(SmartAIEventList   e,
             if (obj && obj->GetMap()->IsDungeon()) {
                 if ((1 << (obj->GetMap()->GetSpawnMode() + 1)) &
                     (*i).event.event_flags) {
-                    mEvents.push_back((*i));
+                    AddEvent(*i);
                 }
             }
             continue;
         }
-        mEvents.push_back((*i)); // NOTE: 'world(0)' events still get processed
-                                 // in ANY instance mode
+        AddEvent(*i); // NOTE: 'world(0)' events still get processed in ANY
+                      // instance mode
     }
 }
 
@@ -6202,6 +6219,18 @@ Unit* SmartScript::GetLastInvoker(Unit* invoker) const
     return nullptr;
 }
 
+std::string SmartScript::GetProfileName() const
+{
+    if (me)
+        return "creature " + std::to_string(me->GetEntry());
+    if (go)
+        return "gameobject " + std::to_string(go->GetEntry());
+    if (trigger)
+        return "areatrigger " + std::to_string(trigger->entry);
+
+    return "source type " + std::to_string(mScriptType);
+}
+
 bool SmartScript::IsUnit(WorldObject* obj)
 {
     return obj && (obj->GetTypeId() == TYPEID_UNIT ||
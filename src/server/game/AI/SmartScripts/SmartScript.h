@@ -26,6 +26,7 @@
 #include "SmartScriptMgr.h"
 #include "Spell.h"
 #include "Unit.h"
+#include <bitset>
 
 class SmartScript {
 public:
@@ -311,9 +312,17 @@ private:
     bool IsInPhase(uint32 p) const;
 
     void SortEvents(SmartAIEventList& events);
+
+    // "creature <entry>" etc., the script profiler sums up the time by it
+    std::string GetProfileName() const;
     void RaisePriority(SmartScriptHolder& e);
     void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
+    void AddEvent(SmartScriptHolder const& e);
+
+    // Event types present in mEvents, most events fired have no handler
+    std::bitset<SMART_EVENT_AC_END> mEventTypes;
+
     SmartAIEventList   mEvents;
     SmartAIEventList   mInstallEvents;
     SmartAIEventList   mTimedActionList;
@@ -686,6 +686,7 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _completedCriteria.clear();
     DeleteFromDB(_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -782,38 +783,83 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
     }
 
     if (!_criteriaProgress.empty()) {
+        ObjectGuid::LowType const lowGuid = GetPlayer()->GetGUID().GetCounter();
+
+        std::vector<CriteriaProgressMap::const_iterator> replaced;
+        std::vector<uint32>                              deleted;
+
         for (CriteriaProgressMap::iterator iter = _criteriaProgress.begin();
              iter != _criteriaProgress.end();
              ++iter) {
             if (!iter->second.changed)
                 continue;
 
-            CharacterDatabasePreparedStatement* stmt =
-                CharacterDatabase.GetPreparedStatement(
-                    CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA);
-            stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
-            stmt->SetData(1, iter->first);
-            trans->Append(stmt);
-
             // pussywizard: insert only for (counter != 0) is very important!
             // this is how criteria of completed achievements gets deleted from
             // db (by setting counter to 0); if conflicted during merge -
             // contact me
-            if (iter->second.counter) {
-                stmt = CharacterDatabase.GetPreparedStatement(
-                    CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS);
-                stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
-                stmt->SetData(1, iter->first);
-                stmt->SetData(2, iter->second.counter);
-                stmt->SetData(3, uint32(iter->second.date));
-                trans->Append(stmt);
-            }
+            if (iter->second.counter)
+                replaced.push_back(iter);
+            else
+                deleted.push_back(iter->first);
 
             iter->second.changed = false;
 
             sScriptMgr->OnCriteriaSave(
                 trans, GetPlayer(), iter->first, iter->second);
         }
+
+        // all changed criteria of this save share one REPLACE and one DELETE,
+        // a single row keeps using the prepared statements
+        if (replaced.size() == 1) {
+            CharacterDatabasePreparedStatement* stmt =
+                CharacterDatabase.GetPreparedStatement(
+                    CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS);
+            stmt->SetData(0, lowGuid);
+            stmt->SetData(1, replaced.front()->first);
+            stmt->SetData(2, replaced.front()->second.counter);
+            stmt->SetData(3, uint32(replaced.front()->second.date));
+            trans->Append(stmt);
+        }
+        else if (!replaced.empty()) {
+            std::string sql = "REPLACE INTO character_achievement_progress "
+                              "(guid, criteria, counter, date) VALUES ";
+            for (auto const& iter : replaced) {
+                if (iter != replaced.front())
+                    sql += ", ";
+
+                sql += Acore::StringFormatFmt("({}, {}, {}, {})",
+                                              lowGuid,
+                                              iter->first,
+                                              iter->second.counter,
+                                              uint32(iter->second.date));
+            }
+
+            trans->Append(sql);
+        }
+
+        if (deleted.size() == 1) {
+            CharacterDatabasePreparedStatement* stmt =
+                CharacterDatabase.GetPreparedStatement(
+                    CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA);
+            stmt->SetData(0, lowGuid);
+            stmt->SetData(1, deleted.front());
+            trans->Append(stmt);
+        }
+        else if (!deleted.empty()) {
+            std::string criteriaIds;
+            for (uint32 criteriaId : deleted) {
+                if (!criteriaIds.empty())
+                    criteriaIds += ", ";
+
+                criteriaIds += std::to_string(criteriaId);
+            }
+
+            trans->Append("DELETE FROM character_achievement_progress WHERE "
+                          "guid = {} AND criteria IN ({})",
+                          lowGuid,
+                          criteriaIds);
+        }
     }
 }
 
@@ -2556,6 +2602,10 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* entry,
             !entry->timeLimit)
             return;
 
+        // the counter may go down, the criteria has to be checked again
+        if (ptype == PROGRESS_SET || ptype == PROGRESS_RESET)
+            _completedCriteria.erase(entry->ID);
+
         progress->counter = newValue;
     }
 
@@ -2596,6 +2646,7 @@ void AchievementMgr::RemoveCriteriaProgress(
     _player->SendDirectMessage(&data);
 
     _criteriaProgress.erase(criteriaProgress);
+    _completedCriteria.erase(entry->ID);
 }
 
 void AchievementMgr::UpdateTimedAchievements(uint32 timeDiff)
@@ -2816,7 +2867,9 @@ void AchievementMgr::SendAllAchievementData() const
                      _completedAchievements.size() * 8 + 4 +
                          _criteriaProgress.size() * 38 + 4);
     BuildAllDataPacket(&data);
-    GetPlayer()->GetSession()->SendPacket(&data);
+    // the largest login packet, handed to the socket instead of copied
+    GetPlayer()->GetSession()->SendPacket(
+        std::make_shared<WorldPacket const>(std::move(data)));
 }
 
 void AchievementMgr::SendRespondInspectAchievements(Player* player) const
@@ -2883,6 +2936,9 @@ bool AchievementMgr::HasAchieved(uint32 achievementId) const
 bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria,
                                        AchievementEntry const* achievement)
 {
+    if (_completedCriteria.count(criteria->ID))
+        return false;
+
     if (DisableMgr::IsDisabledFor(
             DISABLE_TYPE_ACHIEVEMENT_CRITERIA, criteria->ID, nullptr))
         return false;
@@ -2918,8 +2974,14 @@ bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria,
     }
 
     // don't update already completed criteria
-    if (IsCompletedCriteria(criteria, achievement))
+    if (IsCompletedCriteria(criteria, achievement)) {
+        // realm firsts stop counting as completed once someone else got it
+        if (!(achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH |
+                                    ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+            _completedCriteria.insert(criteria->ID);
+
         return false;
+    }
 
     return true;
 }
@@ -3706,7 +3768,7 @@ void AchievementGlobalMgr::LoadRewardLocales()
         }
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!sObjectMgr->ShouldLoadLocale(locale))
             continue;
 
         AchievementRewardLocale& data = _achievementRewardLocales[ID];
@@ -27,9 +27,11 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <unordered_set>
 
-typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
-typedef std::list<AchievementEntry const*>         AchievementEntryList;
+typedef std::vector<AchievementCriteriaEntry const*>
+                                           AchievementCriteriaEntryList;
+typedef std::list<AchievementEntry const*> AchievementEntryList;
 
 typedef std::unordered_map<uint32, AchievementCriteriaEntryList>
     AchievementCriteriaListByAchievement;
@@ -342,6 +344,9 @@ private:
     Player*                          _player;
     CriteriaProgressMap              _criteriaProgress;
     CompletedAchievementMap          _completedAchievements;
+    //! Criteria IsCompletedCriteria() already returned true for, they are
+    //! skipped by CanUpdateCriteria() without checking them again
+    std::unordered_set<uint32>       _completedCriteria;
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements; // Criteria id/time left in MS
 };
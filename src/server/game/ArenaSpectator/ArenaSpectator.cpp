@@ -409,10 +409,19 @@ AC_GAME_API void ArenaSpectator::SendPacketTo(const Map*    map,
         return;
 
     Battleground* bg = ((BattlegroundMap*)map)->GetBG();
-    if (!bg || bg->GetStatus() != STATUS_IN_PROGRESS)
+    if (!bg || bg->GetStatus() != STATUS_IN_PROGRESS || !bg->HaveSpectators())
         return;
 
-    WorldPacket data;
-    CreatePacket(data, message);
-    bg->SpectatorsSendPacket(data);
+    // the addon prefix is added once for all commands batched in a packet
+    std::string_view command(message);
+    std::string_view prefix(SPECTATOR_ADDON_PREFIX);
+    if (command.substr(0, prefix.size()) != prefix) {
+        WorldPacket data;
+        CreatePacket(data, message);
+        bg->SpectatorsSendPacket(data);
+        return;
+    }
+
+    command.remove_prefix(prefix.size());
+    bg->SpectatorsQueueCommand(command);
 }
@@ -33,14 +33,23 @@
 
 constexpr auto AH_MINIMUM_DEPOSIT = 100;
 
-// Proof of concept, we should shift the info we're obtaining in here into
-// AuctionEntry probably
-static bool SortAuction(AuctionEntry*           left,
-                        AuctionEntry*           right,
-                        AuctionSortOrderVector& sortOrder,
-                        Player*                 player,
-                        bool                    checkMinBidBuyout)
+// A search result together with the names it is sorted by. The names are
+// resolved once per search instead of on every comparison, which would
+// localize the item name and look up the owner O(n log n) times.
+struct AuctionSortEntry {
+    AuctionEntry* auction;
+    std::string   itemName;
+    std::string   ownerName;
+};
+
+static bool SortAuction(AuctionSortEntry const&       leftEntry,
+                        AuctionSortEntry const&       rightEntry,
+                        AuctionSortOrderVector const& sortOrder,
+                        bool                          checkMinBidBuyout)
 {
+    AuctionEntry const* left  = leftEntry.auction;
+    AuctionEntry const* right = rightEntry.auction;
+
     for (auto& thisOrder : sortOrder) {
         switch (thisOrder.sortOrder) {
         case AUCTION_SORT_BID: {
@@ -76,38 +85,12 @@ static bool SortAuction(AuctionEntry*           left,
                                     : left->buyout < right->buyout;
         }
         case AUCTION_SORT_ITEM: {
-            ItemTemplate const* protoLeft =
-                sObjectMgr->GetItemTemplate(left->item_template);
-            ItemTemplate const* protoRight =
-                sObjectMgr->GetItemTemplate(right->item_template);
-            if (!protoLeft || !protoRight) {
-                continue;
-            }
-
-            std::string leftName  = protoLeft->Name1;
-            std::string rightName = protoRight->Name1;
+            std::string const& leftName  = leftEntry.itemName;
+            std::string const& rightName = rightEntry.itemName;
             if (leftName.empty() || rightName.empty()) {
                 continue;
             }
 
-            LocaleConstant locale = LOCALE_enUS;
-            if (player && player->GetSession()) {
-                locale = player->GetSession()->GetSessionDbLocaleIndex();
-            }
-
-            if (locale > LOCALE_enUS) {
-                if (ItemLocale const* leftIl =
-                        sObjectMgr->GetItemLocale(protoLeft->ItemId)) {
-                    ObjectMgr::GetLocaleString(leftIl->Name, locale, leftName);
-                }
-
-                if (ItemLocale const* rightIl =
-                        sObjectMgr->GetItemLocale(protoRight->ItemId)) {
-                    ObjectMgr::GetLocaleString(
-                        rightIl->Name, locale, rightName);
-                }
-            }
-
             int result = leftName.compare(rightName);
             if (result == 0) {
                 continue;
@@ -133,13 +116,7 @@ static bool SortAuction(AuctionEntry*           left,
                        : protoLeft->RequiredLevel < protoRight->RequiredLevel;
         }
         case AUCTION_SORT_OWNER: {
-            std::string leftName;
-            sCharacterCache->GetCharacterNameByGuid(left->owner, leftName);
-
-            std::string rightName;
-            sCharacterCache->GetCharacterNameByGuid(right->owner, rightName);
-
-            int result = leftName.compare(rightName);
+            int result = leftEntry.ownerName.compare(rightEntry.ownerName);
             if (result == 0) {
                 continue;
             }
@@ -1049,40 +1026,72 @@ bool AuctionHouseObject::BuildListAuctionItems(
         return true;
     }
 
+    std::vector<AuctionSortEntry> sortedList;
+    sortedList.reserve(auctionShortlist.size());
+    for (AuctionEntry* auction : auctionShortlist)
+        sortedList.push_back({auction, std::string(), std::string()});
+
     // Check if sort enabled, and first sort column is valid, if not don't sort
     if (!sortOrder.empty()) {
         AuctionSortInfo const& sortInfo = *sortOrder.begin();
         if (sortInfo.sortOrder >= AUCTION_SORT_MINLEVEL &&
             sortInfo.sortOrder < AUCTION_SORT_MAX &&
             sortInfo.sortOrder != AUCTION_SORT_UNK4) {
+            bool sortByItem  = false;
+            bool sortByOwner = false;
+            for (AuctionSortInfo const& thisOrder : sortOrder) {
+                sortByItem |= thisOrder.sortOrder == AUCTION_SORT_ITEM;
+                sortByOwner |= thisOrder.sortOrder == AUCTION_SORT_OWNER;
+            }
+
+            LocaleConstant locale = LOCALE_enUS;
+            if (player && player->GetSession()) {
+                locale = player->GetSession()->GetSessionDbLocaleIndex();
+            }
+
+            for (AuctionSortEntry& entry : sortedList) {
+                if (sortByItem) {
+                    if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(
+                            entry.auction->item_template)) {
+                        entry.itemName = proto->Name1;
+                        if (!entry.itemName.empty() && locale > LOCALE_enUS) {
+                            if (ItemLocale const* il =
+                                    sObjectMgr->GetItemLocale(proto->ItemId)) {
+                                ObjectMgr::GetLocaleString(
+                                    il->Name, locale, entry.itemName);
+                            }
+                        }
+                    }
+                }
+
+                if (sortByOwner) {
+                    sCharacterCache->GetCharacterNameByGuid(
+                        entry.auction->owner, entry.ownerName);
+                }
+            }
+
+            bool checkMinBidBuyout = sortInfo.sortOrder == AUCTION_SORT_BID;
+            auto comparator        = [&](AuctionSortEntry const& left,
+                                  AuctionSortEntry const& right) {
+                return SortAuction(left, right, sortOrder, checkMinBidBuyout);
+            };
+
             // Partial sort to improve performance a bit, but the last pages
             // will burn
-            if (listfrom + 50 <= auctionShortlist.size()) {
-                std::partial_sort(
-                    auctionShortlist.begin(),
-                    auctionShortlist.begin() + listfrom + 50,
-                    auctionShortlist.end(),
-                    std::bind(SortAuction,
-                              std::placeholders::_1,
-                              std::placeholders::_2,
-                              sortOrder,
-                              player,
-                              sortInfo.sortOrder == AUCTION_SORT_BID));
+            if (listfrom + 50 <= sortedList.size()) {
+                std::partial_sort(sortedList.begin(),
+                                  sortedList.begin() + listfrom + 50,
+                                  sortedList.end(),
+                                  comparator);
             }
             else {
-                std::sort(auctionShortlist.begin(),
-                          auctionShortlist.end(),
-                          std::bind(SortAuction,
-                                    std::placeholders::_1,
-                                    std::placeholders::_2,
-                                    sortOrder,
-                                    player,
-                                    sortInfo.sortOrder == AUCTION_SORT_BID));
+                std::sort(sortedList.begin(), sortedList.end(), comparator);
             }
         }
     }
 
-    for (auto& auction : auctionShortlist) {
+    for (AuctionSortEntry const& entry : sortedList) {
+        AuctionEntry* auction = entry.auction;
         // Add the item if no search term or if entered search term was found
         if (count < 50 && totalcount >= listfrom) {
             Item* item = sAuctionMgr->GetAItem(auction->item_guid);
@@ -32,6 +32,7 @@
 #include "ObjectMgr.h"
 #include "Transport.h"
 #include "WorldPacket.h"
+#include "WorldStatePackets.h"
 
 /// @todo: this import is not necessary for compilation and marked as unused by
 /// the IDE
@@ -528,12 +529,11 @@ void Battlefield::SendWarning(uint8 id, WorldObject const* target /*= nullptr*/)
 
 void Battlefield::SendUpdateWorldState(uint32 field, uint32 value)
 {
-    for (uint8 i = 0; i < PVP_TEAMS_COUNT; ++i)
-        for (GuidUnorderedSet::iterator itr = m_players[i].begin();
-             itr != m_players[i].end();
-             ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                player->SendUpdateWorldState(field, value);
+    // built once for the whole zone
+    WorldPackets::WorldState::UpdateWorldState worldstate;
+    worldstate.VariableID = field;
+    worldstate.Value      = value;
+    BroadcastPacketToZone(worldstate.Write());
 }
 
 void Battlefield::RegisterZone(uint32 zoneId)
@@ -1239,12 +1239,18 @@ bool BfCapturePoint::Update(uint32 diff)
 
 void BfCapturePoint::SendUpdateWorldState(uint32 field, uint32 value)
 {
+    WorldPackets::WorldState::UpdateWorldState worldstate;
+    worldstate.VariableID = field;
+    worldstate.Value      = value;
+
+    WorldPacket const* data = worldstate.Write();
+
     for (uint8 team = 0; team < 2; ++team)
         for (GuidUnorderedSet::iterator itr = m_activePlayers[team].begin();
              itr != m_activePlayers[team].end();
              ++itr) // send to all players present in the area
             if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                player->SendUpdateWorldState(field, value);
+                player->GetSession()->SendPacket(data);
 }
 
 void BfCapturePoint::SendObjectiveComplete(uint32 id, ObjectGuid guid)
@@ -384,24 +384,14 @@ void BattlefieldWG::UpdateCounterVehicle(bool init)
 // Update vehicle count WorldState to player
 void BattlefieldWG::UpdateVehicleCountWG()
 {
-    for (uint8 i = 0; i < PVP_TEAMS_COUNT; ++i)
-        for (GuidUnorderedSet::iterator itr = m_players[i].begin();
-             itr != m_players[i].end();
-             ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr)) {
-                player->SendUpdateWorldState(
-                    BATTLEFIELD_WG_WORLD_STATE_VEHICLE_H,
-                    GetData(BATTLEFIELD_WG_DATA_VEHICLE_H));
-                player->SendUpdateWorldState(
-                    BATTLEFIELD_WG_WORLD_STATE_MAX_VEHICLE_H,
-                    GetData(BATTLEFIELD_WG_DATA_MAX_VEHICLE_H));
-                player->SendUpdateWorldState(
-                    BATTLEFIELD_WG_WORLD_STATE_VEHICLE_A,
-                    GetData(BATTLEFIELD_WG_DATA_VEHICLE_A));
-                player->SendUpdateWorldState(
-                    BATTLEFIELD_WG_WORLD_STATE_MAX_VEHICLE_A,
-                    GetData(BATTLEFIELD_WG_DATA_MAX_VEHICLE_A));
-            }
+    SendUpdateWorldState(BATTLEFIELD_WG_WORLD_STATE_VEHICLE_H,
+                         GetData(BATTLEFIELD_WG_DATA_VEHICLE_H));
+    SendUpdateWorldState(BATTLEFIELD_WG_WORLD_STATE_MAX_VEHICLE_H,
+                         GetData(BATTLEFIELD_WG_DATA_MAX_VEHICLE_H));
+    SendUpdateWorldState(BATTLEFIELD_WG_WORLD_STATE_VEHICLE_A,
+                         GetData(BATTLEFIELD_WG_DATA_VEHICLE_A));
+    SendUpdateWorldState(BATTLEFIELD_WG_WORLD_STATE_MAX_VEHICLE_A,
+                         GetData(BATTLEFIELD_WG_DATA_MAX_VEHICLE_A));
 }
 
 void BattlefieldWG::CapturePointTaken(uint32 areaId)
@@ -452,14 +452,17 @@ void Arena::EndBattleground(TeamId winnerTeamId)
         winnerArenaTeam->SetPreviousOpponents(loserArenaTeam->GetId());
         loserArenaTeam->SetPreviousOpponents(winnerArenaTeam->GetId());
 
-        // save the stat changes
+        // save the stat changes of both teams together
+        CharacterDatabaseTransaction trans =
+            CharacterDatabase.BeginTransaction();
         if (bValidArena) {
-            winnerArenaTeam->SaveToDB();
+            winnerArenaTeam->SaveToDB(false, trans);
             winnerArenaTeam->NotifyStatsChanged();
         }
 
-        loserArenaTeam->SaveToDB();
+        loserArenaTeam->SaveToDB(false, trans);
         loserArenaTeam->NotifyStatsChanged();
+        CharacterDatabase.CommitTransaction(trans);
     }
 
     // end battleground
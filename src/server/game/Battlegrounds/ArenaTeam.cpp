@@ -1034,6 +1034,14 @@ void ArenaTeam::UpdateArenaPointsHelper(
 }
 
 void ArenaTeam::SaveToDB(bool forceMemberSave)
+{
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    SaveToDB(forceMemberSave, trans);
+    CharacterDatabase.CommitTransaction(trans);
+}
+
+void ArenaTeam::SaveToDB(bool                         forceMemberSave,
+                         CharacterDatabaseTransaction trans)
 {
     if (!sScriptMgr->CanSaveToDB(this))
         return;
@@ -1041,8 +1049,6 @@ void ArenaTeam::SaveToDB(bool forceMemberSave)
     // Save team and member stats to db
     // Called after a match has ended or when calculating arena_points
 
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_UPD_ARENA_TEAM_STATS);
     stmt->SetData(0, Stats.Rating);
@@ -1079,8 +1085,6 @@ void ArenaTeam::SaveToDB(bool forceMemberSave)
         stmt->SetData(3, itr->MaxMMR);
         trans->Append(stmt);
     }
-
-    CharacterDatabase.CommitTransaction(trans);
 }
 
 bool ArenaTeam::FinishWeek()
@@ -181,6 +181,7 @@ public:
     bool LoadMembersFromDB(QueryResult arenaTeamMembersResult);
     void LoadStatsFromDB(uint32 ArenaTeamId);
     void SaveToDB(bool forceMemberSave = false);
+    void SaveToDB(bool forceMemberSave, CharacterDatabaseTransaction trans);
 
     void BroadcastPacket(WorldPacket* packet);
     void BroadcastEvent(ArenaTeamEvents    event,
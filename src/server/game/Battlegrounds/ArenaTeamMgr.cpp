@@ -261,17 +261,22 @@ void ArenaTeamMgr::DistributeArenaPoints()
     sWorld->SendWorldText(LANG_DIST_ARENA_POINTS_ONLINE_END);
 
     sWorld->SendWorldText(LANG_DIST_ARENA_POINTS_TEAM_START);
+
+    // every team that played this week is reset in a single transaction
+    trans = CharacterDatabase.BeginTransaction();
     for (ArenaTeamContainer::iterator titr = GetArenaTeamMapBegin();
          titr != GetArenaTeamMapEnd();
          ++titr) {
         if (ArenaTeam* at = titr->second) {
             if (at->FinishWeek())
-                at->SaveToDB(true);
+                at->SaveToDB(true, trans);
 
             at->NotifyStatsChanged();
         }
     }
 
+    CharacterDatabase.CommitTransaction(trans);
+
     sWorld->SendWorldText(LANG_DIST_ARENA_POINTS_TEAM_END);
 
     sWorld->SendWorldText(LANG_DIST_ARENA_POINTS_END);
@@ -20,6 +20,7 @@
 #define _ARENATEAMMGR_H
 
 #include "ArenaTeam.h"
+#include <atomic>
 
 constexpr uint32 MAX_ARENA_TEAM_ID      = 0xFFF00000;
 constexpr uint32 MAX_TEMP_ARENA_TEAM_ID = 0xFFFFFFFE;
@@ -68,7 +69,8 @@ protected:
     uint32             NextArenaTeamId;
     uint32             NextTempArenaTeamId;
     ArenaTeamContainer ArenaTeamStore;
-    uint32             LastArenaLogId;
+    // arenas end on their map's update thread
+    std::atomic<uint32> LastArenaLogId;
 };
 
 #define sArenaTeamMgr ArenaTeamMgr::instance()
@@ -728,10 +728,11 @@ Position const* Battleground::GetTeamStartPosition(TeamId teamId) const
 
 void Battleground::SendPacketToAll(WorldPacket const* packet)
 {
+    auto const shared = std::make_shared<WorldPacket const>(*packet);
     for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin();
          itr != m_Players.end();
          ++itr)
-        itr->second->GetSession()->SendPacket(packet);
+        itr->second->GetSession()->SendPacket(shared);
 }
 
 void Battleground::SendPacketToTeam(TeamId             teamId,
@@ -739,12 +740,13 @@ void Battleground::SendPacketToTeam(TeamId             teamId,
                                     Player*            sender,
                                     bool               self)
 {
+    auto const shared = std::make_shared<WorldPacket const>(*packet);
     for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin();
          itr != m_Players.end();
          ++itr)
         if (itr->second->GetBgTeamId() == teamId &&
             (self || sender != itr->second))
-            itr->second->GetSession()->SendPacket(packet);
+            itr->second->GetSession()->SendPacket(shared);
 }
 
 void Battleground::SendChatMessage(Creature*    source,
@@ -875,10 +877,34 @@ uint32 Battleground::GetRealRepFactionForPlayer(uint32  factionId,
 
 void Battleground::UpdateWorldState(uint32 variable, uint32 value)
 {
-    WorldPackets::WorldState::UpdateWorldState worldstate;
-    worldstate.VariableID = variable;
-    worldstate.Value      = value;
-    SendPacketToAll(worldstate.Write());
+    // players joining later get the current values from
+    // FillInitialWorldStates
+    if (m_Players.empty())
+        return;
+
+    // a state changed several times during one update is only sent once
+    auto itr = std::find_if(
+        _pendingWorldStates.begin(),
+        _pendingWorldStates.end(),
+        [variable](std::pair<uint32, uint32> const& state) {
+            return state.first == variable;
+        });
+    if (itr != _pendingWorldStates.end())
+        itr->second = value;
+    else
+        _pendingWorldStates.emplace_back(variable, value);
+}
+
+void Battleground::FlushWorldStates()
+{
+    for (auto const& [variable, value] : _pendingWorldStates) {
+        WorldPackets::WorldState::UpdateWorldState worldstate;
+        worldstate.VariableID = variable;
+        worldstate.Value      = value;
+        SendPacketToAll(worldstate.Write());
+    }
+
+    _pendingWorldStates.clear();
 }
 
 void Battleground::EndBattleground(PvPTeamId winnerTeamId)
@@ -1129,6 +1155,7 @@ void Battleground::RemovePlayerAtLeave(Player* player)
     if (itr2 != PlayerScores.end()) {
         delete itr2->second;
         PlayerScores.erase(itr2);
+        _pvpLogData.reset();
     }
 
     RemovePlayerFromResurrectQueue(player);
@@ -1255,6 +1282,8 @@ void Battleground::Init()
         delete itr.second;
 
     PlayerScores.clear();
+    _pvpLogData.reset();
+    _pendingWorldStates.clear();
 
     for (auto& itr : _arenaTeamScores)
         itr.Reset();
@@ -1292,6 +1321,7 @@ void Battleground::AddPlayer(Player* player)
     sScriptMgr->OnBattlegroundBeforeAddPlayer(this, player);
 
     // score struct must be created in inherited class
+    _pvpLogData.reset();
 
     ObjectGuid guid   = player->GetGUID();
     TeamId     teamId = player->GetBgTeamId();
@@ -1498,6 +1528,33 @@ void Battleground::SpectatorsSendPacket(WorldPacket& data)
         (*itr)->GetSession()->SendPacket(&data);
 }
 
+void Battleground::SpectatorsQueueCommand(std::string_view command)
+{
+    if (m_SpectatorCommands.size() + command.size() > SPECTATOR_BUFFER_LEN)
+        SpectatorsFlushCommands();
+
+    m_SpectatorCommands.append(command);
+}
+
+void Battleground::SpectatorsFlushCommands()
+{
+    if (m_SpectatorCommands.empty())
+        return;
+
+    if (!m_Spectators.empty()) {
+        WorldPacket data;
+        ArenaSpectator::CreatePacket(data,
+                                     SPECTATOR_ADDON_PREFIX +
+                                         m_SpectatorCommands);
+        std::shared_ptr<WorldPacket const> packet =
+            std::make_shared<WorldPacket const>(std::move(data));
+        for (Player* spectator : m_Spectators)
+            spectator->GetSession()->SendPacket(packet);
+    }
+
+    m_SpectatorCommands.clear();
+}
+
 void Battleground::ReadyMarkerClicked(Player* p)
 {
     if (!isArena() || GetStatus() >= STATUS_IN_PROGRESS ||
@@ -1546,6 +1603,17 @@ void Battleground::BuildPvPLogDataPacket(WorldPacket& data)
         score.second->AppendToPacket(data);
 }
 
+std::shared_ptr<WorldPacket const> const& Battleground::GetPvPLogDataPacket()
+{
+    if (!_pvpLogData) {
+        WorldPacket data;
+        BuildPvPLogDataPacket(data);
+        _pvpLogData = std::make_shared<WorldPacket const>(std::move(data));
+    }
+
+    return _pvpLogData;
+}
+
 bool Battleground::UpdatePlayerScore(Player* player,
                                      uint32  type,
                                      uint32  value,
@@ -1559,8 +1627,10 @@ bool Battleground::UpdatePlayerScore(Player* player,
         player->RewardHonor(
             nullptr, 1, value); // RewardHonor calls UpdatePlayerScore with
                                 // doAddHonor = false
-    else
+    else {
         itr->second->UpdateScore(type, value);
+        _pvpLogData.reset();
+    }
 
     return true;
 }
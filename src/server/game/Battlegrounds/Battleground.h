@@ -24,6 +24,7 @@
 #include "DBCEnums.h"
 #include "GameObject.h"
 #include "SharedDefines.h"
+#include <string_view>
 
 class Creature;
 class GameObject;
@@ -361,7 +362,11 @@ public:
     void SetRandomTypeID(BattlegroundTypeId TypeID) { m_RandomTypeID = TypeID; }
     void SetBracket(PvPDifficultyEntry const* bracketEntry);
     void SetInstanceID(uint32 InstanceID) { m_InstanceID = InstanceID; }
-    void SetStatus(BattlegroundStatus Status) { m_Status = Status; }
+    void SetStatus(BattlegroundStatus Status)
+    {
+        m_Status = Status;
+        _pvpLogData.reset();
+    }
     void SetClientInstanceID(uint32 InstanceID)
     {
         m_ClientInstanceID = InstanceID;
@@ -377,7 +382,11 @@ public:
     void SetRated(bool state) { m_IsRated = state; }
     void SetArenaType(uint8 type) { m_ArenaType = type; }
     void SetArenaorBGType(bool _isArena) { m_IsArena = _isArena; }
-    void SetWinner(PvPTeamId winner) { m_WinnerId = winner; }
+    void SetWinner(PvPTeamId winner)
+    {
+        m_WinnerId = winner;
+        _pvpLogData.reset();
+    }
     void SetScriptId(uint32 scriptId) { ScriptId = scriptId; }
     void SetRandom(bool isRandom) { m_IsRandom = isRandom; }
 
@@ -433,6 +442,10 @@ public:
             m_ToBeTeleported.erase(itr);
     }
     void SpectatorsSendPacket(WorldPacket& data);
+    // addon commands are collected and sent to all spectators in one packet
+    // at the end of the map update
+    void SpectatorsQueueCommand(std::string_view command);
+    void SpectatorsFlushCommands();
 
     [[nodiscard]] bool isArena() const { return m_IsArena; }
     [[nodiscard]] bool isBattleground() const { return !m_IsArena; }
@@ -527,6 +540,9 @@ public:
     uint32 GetRealRepFactionForPlayer(uint32 factionId, Player* player);
 
     void UpdateWorldState(uint32 variable, uint32 value);
+    // sends the world states changed during the map update, called by
+    // BattlegroundMap::Update
+    void FlushWorldStates();
 
     void EndBattleground(PvPTeamId winnerTeamId);
 
@@ -560,6 +576,8 @@ public:
     void SetBgRaid(TeamId teamId, Group* bg_raid);
 
     void         BuildPvPLogDataPacket(WorldPacket& data);
+    // scoreboard shared by all players until a score changes
+    std::shared_ptr<WorldPacket const> const& GetPvPLogDataPacket();
     virtual bool UpdatePlayerScore(Player* player,
                                    uint32  type,
                                    uint32  value,
@@ -989,6 +1007,11 @@ private:
     Group* m_BgRaids[PVP_TEAMS_COUNT]; // 0 - alliance, 1 - horde
 
     SpectatorList     m_Spectators;
+    std::string       m_SpectatorCommands;
+
+    // last value of every world state changed since the last flush
+    std::vector<std::pair<uint32, uint32>> _pendingWorldStates;
+    std::shared_ptr<WorldPacket const>     _pvpLogData;
     ToBeTeleportedMap m_ToBeTeleported;
 
     // Players count by team
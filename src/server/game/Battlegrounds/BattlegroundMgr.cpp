@@ -103,7 +103,12 @@ void BattlegroundMgr::Update(uint32 diff)
             itrDelete        = itr++;
             Battleground* bg = itrDelete->second;
 
-            bg->Update(diff);
+            // a battleground with a map is updated by BattlegroundMap::Update
+            // on the map update threads, only the ones nobody has entered yet
+            // are left to this serialized loop, as is their deletion
+            if (!bg->FindBgMap())
+                bg->Update(diff);
+
             if (bg->ToBeDeleted()) {
                 itrDelete->second = nullptr;
                 bgList.erase(itrDelete);
@@ -126,11 +131,14 @@ void BattlegroundMgr::Update(uint32 diff)
 
     // update using scheduled tasks (used only for rated arenas, initial
     // opponent search works differently than periodic queue update)
-    if (!m_QueueUpdateScheduler.empty()) {
-        std::vector<uint64> scheduled;
+    std::vector<uint64> scheduled;
+    {
+        std::lock_guard<std::mutex> lock(_queueUpdateSchedulerLock);
         std::swap(scheduled, m_QueueUpdateScheduler);
+    }
 
-        for (uint8 i = 0; i < scheduled.size(); i++) {
+    if (!scheduled.empty()) {
+        for (std::size_t i = 0; i < scheduled.size(); i++) {
             uint32                  arenaMMRating = scheduled[i] >> 32;
             uint8                   arenaType     = scheduled[i] >> 24 & 255;
             BattlegroundQueueTypeId bgQueueTypeId =
@@ -885,12 +893,12 @@ void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating,
                                           BattlegroundTypeId      bgTypeId,
                                           BattlegroundBracketId   bracket_id)
 {
-    // This method must be atomic, @todo add mutex
     // we will use only 1 number created of bgTypeId and bracket_id
     uint64 const scheduleId = ((uint64)arenaMatchmakerRating << 32) |
                               ((uint64)arenaType << 24) |
                               ((uint64)bgQueueTypeId << 16) |
                               ((uint64)bgTypeId << 8) | (uint64)bracket_id;
+    std::lock_guard<std::mutex> lock(_queueUpdateSchedulerLock);
     if (std::find(m_QueueUpdateScheduler.begin(),
                   m_QueueUpdateScheduler.end(),
                   scheduleId) == m_QueueUpdateScheduler.end())
@@ -1086,13 +1094,15 @@ BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundTypeId bgTypeId)
 void BattlegroundMgr::AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId,
                                            Battleground*      bg)
 {
+    std::lock_guard<std::mutex> lock(_freeSlotQueueLock);
     bgDataStore[bgTypeId].BGFreeSlotQueue.push_front(bg);
 }
 
 void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId,
                                                 uint32             instanceId)
 {
-    BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
+    std::lock_guard<std::mutex> lock(_freeSlotQueueLock);
+    BGFreeSlotQueueContainer&   queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
     for (BGFreeSlotQueueContainer::iterator itr = queues.begin();
          itr != queues.end();
          ++itr)
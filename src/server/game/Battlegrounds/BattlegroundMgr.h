@@ -25,6 +25,7 @@
 #include "CreatureAIImpl.h"
 #include "DBCEnums.h"
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 typedef std::map<uint32, Battleground*> BattlegroundContainer;
@@ -201,6 +202,10 @@ private:
 
     BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES];
 
+    // battlegrounds are updated on their map's update thread, these guard the
+    // state they share with the manager
+    std::mutex          _queueUpdateSchedulerLock;
+    std::mutex          _freeSlotQueueLock;
     std::vector<uint64> m_QueueUpdateScheduler;
     bool                m_ArenaTesting;
     bool                m_Testing;
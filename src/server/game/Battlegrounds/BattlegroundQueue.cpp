@@ -665,9 +665,12 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id,
                     BG_QUEUE_NORMAL_ALLIANCE +
                     i; // pussywizard: update GroupQueueInfo internal variable
                 m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i]
-                    .push_front((*itr));
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].erase(
-                    itr);
+                    .splice(m_QueuedGroups[bracket_id]
+                                          [BG_QUEUE_NORMAL_ALLIANCE + i]
+                                              .begin(),
+                            m_QueuedGroups[bracket_id]
+                                          [BG_QUEUE_PREMADE_ALLIANCE + i],
+                            itr);
             }
         }
     }
@@ -1118,17 +1121,18 @@ void BattlegroundQueue::BattlegroundQueueUpdate(
             // Queue::RemovePlayer
             if (aTeam->teamId != TEAM_ALLIANCE) {
                 aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE]
-                    .push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(
+                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].splice(
+                    m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE]
+                        .begin(),
+                    m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE],
                     itr_teams[TEAM_ALLIANCE]);
             }
 
             if (hTeam->teamId != TEAM_HORDE) {
                 hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(
-                    hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(
+                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].splice(
+                    m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].begin(),
+                    m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE],
                     itr_teams[TEAM_HORDE]);
             }
 
@@ -23,12 +23,28 @@
 #include "Player.h"
 #include "Timer.h"
 #include "World.h"
+#include <string_view>
 #include <unordered_map>
 
 namespace {
 std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-std::unordered_map<std::string, CharacterCacheEntry*>
+// Keys point to CharacterCacheEntry::Name, so every name is only stored once.
+// An entry's key must be removed before its name is changed or it is erased.
+std::unordered_map<std::string_view, CharacterCacheEntry*>
     _characterCacheByNameStore;
+
+void AddCharacterCacheName(CharacterCacheEntry& data)
+{
+    _characterCacheByNameStore.erase(data.Name);
+    _characterCacheByNameStore.emplace(data.Name, &data);
+}
+
+void RemoveCharacterCacheName(CharacterCacheEntry const& data)
+{
+    auto itr = _characterCacheByNameStore.find(data.Name);
+    if (itr != _characterCacheByNameStore.end() && itr->second == &data)
+        _characterCacheByNameStore.erase(itr);
+}
 } // namespace
 
 CharacterCache* CharacterCache::instance()
@@ -59,6 +75,7 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
+    _characterCacheByNameStore.clear();
     _characterCacheStore.clear();
     uint32 oldMSTime = getMSTime();
 
@@ -71,6 +88,9 @@ void CharacterCache::LoadCharacterCacheStorage()
         return;
     }
 
+    _characterCacheStore.reserve(result->GetRowCount());
+    _characterCacheByNameStore.reserve(result->GetRowCount());
+
     do {
         Field* fields = result->Fetch();
         AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(
@@ -152,7 +172,11 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const&  guid,
                                             uint8              playerClass,
                                             uint8              level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
+    auto [itr, inserted]      = _characterCacheStore.try_emplace(guid);
+    CharacterCacheEntry& data = itr->second;
+    if (!inserted)
+        RemoveCharacterCacheName(data);
+
     data.Guid                 = guid;
     data.Name                 = name;
     data.AccountId            = accountId;
@@ -166,14 +190,17 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const&  guid,
     }
 
     // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    AddCharacterCacheName(data);
 }
 
-void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const&  guid,
-                                               std::string const& name)
+void CharacterCache::DeleteCharacterCacheEntry(
+    ObjectGuid const& guid, std::string const& /*name*/)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    auto itr = _characterCacheStore.find(guid);
+    if (itr != _characterCacheStore.end()) {
+        RemoveCharacterCacheName(itr->second);
+        _characterCacheStore.erase(itr);
+    }
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const&  guid,
@@ -185,8 +212,10 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const&  guid,
     if (itr == _characterCacheStore.end())
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name    = name;
+    // Correct name -> pointer storage, the key points to the old name
+    RemoveCharacterCacheName(itr->second);
+    itr->second.Name = name;
+    AddCharacterCacheName(itr->second);
 
     if (gender) {
         itr->second.Sex = *gender;
@@ -198,10 +227,6 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const&  guid,
 
     // WorldPackets::Misc::InvalidatePlayer packet(guid);
     // sWorld->SendGlobalMessage(packet.Write());
-
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
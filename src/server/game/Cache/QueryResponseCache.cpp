@@ -0,0 +1,60 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "QueryResponseCache.h"
+#include <mutex>
+
+QueryResponseCache* QueryResponseCache::instance()
+{
+    static QueryResponseCache instance;
+    return &instance;
+}
+
+bool QueryResponseCache::Get(QueryResponseCacheType type,
+                             uint32                 entry,
+                             LocaleConstant         locale,
+                             WorldPacket&           packet) const
+{
+    Storage const&                      storage = _storage[type];
+    std::shared_lock<std::shared_mutex> lock(storage.lock);
+
+    auto itr = storage.packets.find(MakeKey(entry, locale));
+    if (itr == storage.packets.end())
+        return false;
+
+    packet = itr->second;
+    return true;
+}
+
+void QueryResponseCache::Store(QueryResponseCacheType type,
+                               uint32                 entry,
+                               LocaleConstant         locale,
+                               WorldPacket const&     packet)
+{
+    Storage&                            storage = _storage[type];
+    std::unique_lock<std::shared_mutex> lock(storage.lock);
+    storage.packets.emplace(MakeKey(entry, locale), packet);
+}
+
+void QueryResponseCache::Clear(QueryResponseCacheType type)
+{
+    Storage&                            storage = _storage[type];
+    std::unique_lock<std::shared_mutex> lock(storage.lock);
+    storage.packets.clear();
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _QUERY_RESPONSE_CACHE_H_
+#define _QUERY_RESPONSE_CACHE_H_
+
+#include "Common.h"
+#include "WorldPacket.h"
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
+
+enum QueryResponseCacheType : uint8 {
+    QUERY_RESPONSE_CREATURE,
+    QUERY_RESPONSE_GAMEOBJECT,
+    QUERY_RESPONSE_ITEM,
+    QUERY_RESPONSE_NPC_TEXT,
+    QUERY_RESPONSE_PAGE_TEXT,
+
+    MAX_QUERY_RESPONSE_TYPES
+};
+
+//! Holds the responses of the static query opcodes once they have been built
+//! for an (entry, locale) pair. Creature, gameobject and item queries are
+//! processed concurrently on the map threads, so every storage has its own
+//! reader/writer lock.
+class AC_GAME_API QueryResponseCache {
+    QueryResponseCache()  = default;
+    ~QueryResponseCache() = default;
+
+    QueryResponseCache(QueryResponseCache const&) = delete;
+    QueryResponseCache(QueryResponseCache&&)      = delete;
+
+    QueryResponseCache& operator=(QueryResponseCache const&) = delete;
+    QueryResponseCache& operator=(QueryResponseCache&&)      = delete;
+
+public:
+    static QueryResponseCache* instance();
+
+    //! Copies the cached response into packet, false when none is stored yet
+    bool Get(QueryResponseCacheType type,
+             uint32                 entry,
+             LocaleConstant         locale,
+             WorldPacket&           packet) const;
+    void Store(QueryResponseCacheType type,
+               uint32                 entry,
+               LocaleConstant         locale,
+               WorldPacket const&     packet);
+
+    //! Must be called whenever the data behind the responses is reloaded
+    void Clear(QueryResponseCacheType type);
+
+private:
+    static uint64 MakeKey(uint32 entry, LocaleConstant locale)
+    {
+        return (uint64(entry) << 8) | uint64(locale);
+    }
+
+    struct Storage {
+        mutable std::shared_mutex               lock;
+        std::unordered_map<uint64, WorldPacket> packets;
+    };
+
+    std::array<Storage, MAX_QUERY_RESPONSE_TYPES> _storage;
+};
+
+#define sQueryResponseCache QueryResponseCache::instance()
+
+#endif
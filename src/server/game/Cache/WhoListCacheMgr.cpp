@@ -20,6 +20,7 @@
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
 #include "World.h"
+#include <algorithm>
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -37,23 +38,19 @@ void WhoListCacheMgr::Update()
         if (!player->FindMap() || player->GetSession()->PlayerLoading())
             continue;
 
-        std::string  playerName = player->GetName();
-        std::wstring widePlayerName;
+        std::string playerName = player->GetName();
+        std::string lowerPlayerName;
 
-        if (!Utf8toWStr(playerName, widePlayerName))
+        if (!Utf8ToLower(playerName, lowerPlayerName))
             continue;
 
-        wstrToLower(widePlayerName);
-
         std::string guildName =
             sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
+        std::string lowerGuildName;
 
-        if (!Utf8toWStr(guildName, wideGuildName))
+        if (!Utf8ToLower(guildName, lowerGuildName))
             continue;
 
-        wstrToLower(wideGuildName);
-
         _whoListStorage.emplace_back(
             player->GetGUID(),
             player->GetTeamId(),
@@ -64,9 +61,38 @@ void WhoListCacheMgr::Update()
             (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()),
             player->getGender(),
             player->IsVisible(),
-            widePlayerName,
-            wideGuildName,
+            lowerPlayerName,
+            lowerGuildName,
             playerName,
             guildName);
     }
+
+    std::stable_sort(
+        _whoListStorage.begin(),
+        _whoListStorage.end(),
+        [](WhoListPlayerInfo const& left, WhoListPlayerInfo const& right) {
+            return left.GetLevel() < right.GetLevel();
+        });
+}
+
+Acore::IteratorPair<WhoListInfoVector::const_iterator>
+WhoListCacheMgr::GetWhoList(uint32 levelMin, uint32 levelMax) const
+{
+    if (levelMin > levelMax)
+        return {_whoListStorage.end(), _whoListStorage.end()};
+
+    auto first = std::partition_point(
+        _whoListStorage.begin(),
+        _whoListStorage.end(),
+        [levelMin](WhoListPlayerInfo const& info) {
+            return info.GetLevel() < levelMin;
+        });
+    auto last = std::partition_point(
+        first,
+        _whoListStorage.end(),
+        [levelMax](WhoListPlayerInfo const& info) {
+            return info.GetLevel() <= levelMax;
+        });
+
+    return {first, last};
 }
@@ -20,6 +20,7 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "IteratorPair.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
 
@@ -34,14 +35,14 @@ public:
                       uint32              zoneid,
                       uint8               gender,
                       bool                visible,
-                      std::wstring const& widePlayerName,
-                      std::wstring const& wideGuildName,
+                      std::string const&  lowerPlayerName,
+                      std::string const&  lowerGuildName,
                       std::string const&  playerName,
                       std::string const&  guildName)
         : _guid(guid), _team(team), _security(security), _level(level),
           _class(clss), _race(race), _zoneid(zoneid), _gender(gender),
-          _visible(visible), _widePlayerName(widePlayerName),
-          _wideGuildName(wideGuildName), _playerName(playerName),
+          _visible(visible), _lowerPlayerName(lowerPlayerName),
+          _lowerGuildName(lowerGuildName), _playerName(playerName),
           _guildName(guildName)
     {
     }
@@ -55,8 +56,9 @@ public:
     uint32              GetZoneId() const { return _zoneid; }
     uint8               GetGender() const { return _gender; }
     bool                IsVisible() const { return _visible; }
-    std::wstring const& GetWidePlayerName() const { return _widePlayerName; }
-    std::wstring const& GetWideGuildName() const { return _wideGuildName; }
+    //! Lowercased UTF-8 names, used for the substring matching of /who
+    std::string const& GetLowerPlayerName() const { return _lowerPlayerName; }
+    std::string const& GetLowerGuildName() const { return _lowerGuildName; }
     std::string const&  GetPlayerName() const { return _playerName; }
     std::string const&  GetGuildName() const { return _guildName; }
 
@@ -70,8 +72,8 @@ private:
     uint32       _zoneid;
     uint8        _gender;
     bool         _visible;
-    std::wstring _widePlayerName;
-    std::wstring _wideGuildName;
+    std::string  _lowerPlayerName;
+    std::string  _lowerGuildName;
     std::string  _playerName;
     std::string  _guildName;
 };
@@ -94,6 +96,11 @@ public:
     void                     Update();
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
+    //! Entries with a level between levelMin and levelMax, the list is kept
+    //! sorted by level so this doesn't have to look at the other entries
+    Acore::IteratorPair<WhoListInfoVector::const_iterator>
+    GetWhoList(uint32 levelMin, uint32 levelMax) const;
+
 protected:
     WhoListInfoVector _whoListStorage;
 };
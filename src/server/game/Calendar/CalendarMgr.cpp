@@ -110,6 +110,7 @@ void CalendarMgr::LoadFromDB()
                                   title,
                                   description);
             _events.insert(calendarEvent);
+            IndexEvent(calendarEvent);
 
             _maxEventId = std::max(_maxEventId, eventId);
 
@@ -149,6 +150,7 @@ void CalendarMgr::LoadFromDB()
                                                         rank,
                                                         text);
             _invites[eventId].push_back(invite);
+            IndexInvite(invite);
 
             _maxInviteId = std::max(_maxInviteId, inviteId);
 
@@ -171,6 +173,7 @@ void CalendarMgr::AddEvent(CalendarEvent*        calendarEvent,
                            CalendarSendEventType sendType)
 {
     _events.insert(calendarEvent);
+    IndexEvent(calendarEvent);
     UpdateEvent(calendarEvent);
     SendCalendarEvent(
         calendarEvent->GetCreatorGUID(), *calendarEvent, sendType);
@@ -189,6 +192,7 @@ void CalendarMgr::AddInvite(CalendarEvent*               calendarEvent,
 
     if (!calendarEvent->IsGuildAnnouncement()) {
         _invites[invite->GetEventId()].push_back(invite);
+        IndexInvite(invite);
         UpdateInvite(invite, trans);
     }
 }
@@ -235,6 +239,7 @@ void CalendarMgr::RemoveEvent(CalendarEvent* calendarEvent, ObjectGuid remover)
                             calendarEvent,
                             MAIL_CHECK_MASK_COPIED);
 
+        UnindexInvite(invite);
         delete invite;
     }
 
@@ -245,9 +250,9 @@ void CalendarMgr::RemoveEvent(CalendarEvent* calendarEvent, ObjectGuid remover)
     trans->Append(stmt);
     CharacterDatabase.CommitTransaction(trans);
 
-    delete calendarEvent;
+    UnindexEvent(calendarEvent);
     _events.erase(calendarEvent);
-    return;
+    delete calendarEvent;
 }
 
 void CalendarMgr::RemoveInvite(uint64 inviteId,
@@ -289,10 +294,50 @@ void CalendarMgr::RemoveInvite(uint64 inviteId,
     //        .SendMailTo(trans, MailReceiver((*itr)->GetInvitee()),
     //        calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+    UnindexInvite(*itr);
     delete *itr;
     _invites[eventId].erase(itr);
 }
 
+void CalendarMgr::IndexEvent(CalendarEvent* calendarEvent)
+{
+    _eventsById[calendarEvent->GetEventId()] = calendarEvent;
+    if (calendarEvent->GetGuildId())
+        _guildEvents[calendarEvent->GetGuildId()].insert(calendarEvent);
+}
+
+void CalendarMgr::UnindexEvent(CalendarEvent* calendarEvent)
+{
+    _eventsById.erase(calendarEvent->GetEventId());
+
+    auto itr = _guildEvents.find(calendarEvent->GetGuildId());
+    if (itr == _guildEvents.end())
+        return;
+
+    itr->second.erase(calendarEvent);
+    if (itr->second.empty())
+        _guildEvents.erase(itr);
+}
+
+void CalendarMgr::IndexInvite(CalendarInvite* invite)
+{
+    _invitesById[invite->GetInviteId()] = invite;
+    _playerInvites[invite->GetInviteeGUID()].push_back(invite);
+}
+
+void CalendarMgr::UnindexInvite(CalendarInvite* invite)
+{
+    _invitesById.erase(invite->GetInviteId());
+
+    auto itr = _playerInvites.find(invite->GetInviteeGUID());
+    if (itr == _playerInvites.end())
+        return;
+
+    std::erase(itr->second, invite);
+    if (itr->second.empty())
+        _playerInvites.erase(itr);
+}
+
 void CalendarMgr::UpdateEvent(CalendarEvent* calendarEvent)
 {
     CharacterDatabasePreparedStatement* stmt =
@@ -366,25 +411,15 @@ void CalendarMgr::RemovePlayerGuildEventsAndSignups(ObjectGuid guid,
 
 CalendarEvent* CalendarMgr::GetEvent(uint64 eventId)
 {
-    for (CalendarEventStore::iterator itr = _events.begin();
-         itr != _events.end();
-         ++itr)
-        if ((*itr)->GetEventId() == eventId)
-            return *itr;
-
-    return nullptr;
+    auto itr = _eventsById.find(eventId);
+    return itr != _eventsById.end() ? itr->second : nullptr;
 }
 
 CalendarInvite* CalendarMgr::GetInvite(uint64 inviteId) const
 {
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin();
-         itr != _invites.end();
-         ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin();
-             itr2 != itr->second.end();
-             ++itr2)
-            if ((*itr2)->GetInviteId() == inviteId)
-                return *itr2;
+    auto itr = _invitesById.find(inviteId);
+    if (itr != _invitesById.end())
+        return itr->second;
 
     LOG_DEBUG(
         "entities.unit", "CalendarMgr::GetInvite: [{}] not found!", inviteId);
@@ -463,12 +498,14 @@ CalendarEventStore CalendarMgr::GetGuildEvents(uint32 guildId)
     if (!guildId)
         return result;
 
-    for (CalendarEventStore::const_iterator itr = _events.begin();
-         itr != _events.end();
-         ++itr)
-        if ((*itr)->IsGuildEvent() || (*itr)->IsGuildAnnouncement())
-            if ((*itr)->GetGuildId() == guildId)
-                result.insert(*itr);
+    auto itr = _guildEvents.find(guildId);
+    if (itr == _guildEvents.end())
+        return result;
+
+    for (CalendarEvent* calendarEvent : itr->second)
+        if (calendarEvent->IsGuildEvent() ||
+            calendarEvent->IsGuildAnnouncement())
+            result.insert(calendarEvent);
 
     return result;
 }
@@ -477,25 +514,20 @@ CalendarEventStore CalendarMgr::GetPlayerEvents(ObjectGuid guid)
 {
     CalendarEventStore events;
 
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin();
-         itr != _invites.end();
-         ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin();
-             itr2 != itr->second.end();
-             ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                if (CalendarEvent* event =
-                        GetEvent(itr->first)) // nullptr check added as attempt
-                                              // to fix #11512
-                    events.insert(event);
-
-    if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
-        if (player->GetGuildId())
-            for (CalendarEventStore::const_iterator itr = _events.begin();
-                 itr != _events.end();
-                 ++itr)
-                if ((*itr)->GetGuildId() == player->GetGuildId())
-                    events.insert(*itr);
+    auto invites = _playerInvites.find(guid);
+    if (invites != _playerInvites.end())
+        for (CalendarInvite const* invite : invites->second)
+            if (CalendarEvent* event =
+                    GetEvent(invite->GetEventId())) // nullptr check added as
+                                                    // attempt to fix #11512
+                events.insert(event);
+
+    if (Player* player = ObjectAccessor::FindConnectedPlayer(guid)) {
+        auto guildEvents = _guildEvents.find(player->GetGuildId());
+        if (player->GetGuildId() && guildEvents != _guildEvents.end())
+            events.insert(guildEvents->second.begin(),
+                          guildEvents->second.end());
+    }
 
     return events;
 }
@@ -507,18 +539,8 @@ CalendarInviteStore const& CalendarMgr::GetEventInvites(uint64 eventId)
 
 CalendarInviteStore CalendarMgr::GetPlayerInvites(ObjectGuid guid)
 {
-    CalendarInviteStore invites;
-
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin();
-         itr != _invites.end();
-         ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin();
-             itr2 != itr->second.end();
-             ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                invites.push_back(*itr2);
-
-    return invites;
+    auto itr = _playerInvites.find(guid);
+    return itr != _playerInvites.end() ? itr->second : CalendarInviteStore();
 }
 
 uint32 CalendarMgr::GetPlayerNumPending(ObjectGuid guid)
@@ -311,6 +311,17 @@ private:
     CalendarEventStore       _events;
     CalendarEventInviteStore _invites;
 
+    // lookups into _events and _invites, kept in sync by the index helpers
+    std::unordered_map<uint64, CalendarEvent*>          _eventsById;
+    std::unordered_map<uint32, CalendarEventStore>      _guildEvents;
+    std::unordered_map<uint64, CalendarInvite*>         _invitesById;
+    std::unordered_map<ObjectGuid, CalendarInviteStore> _playerInvites;
+
+    void IndexEvent(CalendarEvent* calendarEvent);
+    void UnindexEvent(CalendarEvent* calendarEvent);
+    void IndexInvite(CalendarInvite* invite);
+    void UnindexInvite(CalendarInvite* invite);
+
     std::deque<uint64> _freeEventIds;
     std::deque<uint64> _freeInviteIds;
     uint64             _maxEventId;
@@ -214,7 +214,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.flags  = MEMBER_FLAG_NONE;
     pinfo.plrPtr = player;
 
-    playersStore[guid] = pinfo;
+    _GetPlayerInfo(guid) = pinfo;
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession())
@@ -226,7 +226,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
 
     JoinNotify(player);
 
-    playersStore[guid].SetOwnerGM(player->GetSession()->IsGMAccount());
+    _GetPlayerInfo(guid).SetOwnerGM(player->GetSession()->IsGMAccount());
 
     // Custom channel handling
     if (!IsConstant()) {
@@ -237,7 +237,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
         if (_channelRights.moderators.find(
                 player->GetSession()->GetAccountId()) !=
             _channelRights.moderators.end()) {
-            playersStore[guid].SetModerator(true);
+            _GetPlayerInfo(guid).SetModerator(true);
             FlagsNotify(player);
         }
 
@@ -248,12 +248,12 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
              (_isOwnerGM &&
               sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL))) &&
             _ownership) {
-            _isOwnerGM = playersStore[guid].IsOwnerGM();
+            _isOwnerGM = _GetPlayerInfo(guid).IsOwnerGM();
             SetOwner(guid, false);
         }
 
         if (_channelRights.flags & CHANNEL_RIGHT_CANT_SPEAK)
-            playersStore[guid].SetMuted(true);
+            _GetPlayerInfo(guid).SetMuted(true);
     }
 }
 
@@ -277,9 +277,9 @@ void Channel::LeaveChannel(Player* player, bool send)
         data.clear();
     }
 
-    bool changeowner = playersStore[guid].IsOwner();
+    bool changeowner = _GetPlayerInfo(guid).IsOwner();
 
-    playersStore.erase(guid);
+    _ErasePlayerInfo(guid);
     if (_announce && ShouldAnnouncePlayer(player)) {
         WorldPacket data;
         MakeLeft(&data, guid);
@@ -302,12 +302,12 @@ void Channel::LeaveChannel(Player* player, bool send)
                          playersStore.begin();
                      itr != playersStore.end();
                      ++itr) {
-                    newowner = itr->second.player;
-                    if (itr->second.plrPtr->GetSession()->IsGMAccount())
+                    newowner = itr->player;
+                    if (itr->plrPtr->GetSession()->IsGMAccount())
                         _isOwnerGM = true;
                     else
                         _isOwnerGM = false;
-                    if (!itr->second.plrPtr->GetSession()->GetSecurity())
+                    if (!itr->plrPtr->GetSession()->GetSecurity())
                         break;
                 }
                 SetOwner(newowner);
@@ -333,7 +333,7 @@ void Channel::KickOrBan(Player const*      player,
         return;
     }
 
-    if (!playersStore[good].IsModerator() &&
+    if (!_GetPlayerInfo(good).IsModerator() &&
         !player->GetSession()->IsGMAccount()) {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -441,7 +441,7 @@ void Channel::KickOrBan(Player const*      player,
     }
 
     if (isOnChannel) {
-        playersStore.erase(victim);
+        _ErasePlayerInfo(victim);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -456,8 +456,8 @@ void Channel::KickOrBan(Player const*      player,
                      playersStore.begin();
                  itr != playersStore.end();
                  ++itr) {
-                newowner = itr->second.player;
-                if (!itr->second.plrPtr->GetSession()->GetSecurity())
+                newowner = itr->player;
+                if (!itr->plrPtr->GetSession()->GetSecurity())
                     break;
             }
             SetOwner(newowner);
@@ -478,7 +478,7 @@ void Channel::UnBan(Player const* player, std::string const& badname)
         return;
     }
 
-    if (!playersStore[good].IsModerator() &&
+    if (!_GetPlayerInfo(good).IsModerator() &&
         !player->GetSession()->IsGMAccount()) {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -550,7 +550,7 @@ void Channel::Password(Player const* player, std::string const& pass)
         return;
     }
 
-    if (!playersStore[guid].IsModerator() &&
+    if (!_GetPlayerInfo(guid).IsModerator() &&
         !player->GetSession()->IsGMAccount()) {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -588,7 +588,7 @@ void Channel::SetMode(Player const*      player,
         return;
     }
 
-    if (!playersStore[guid].IsModerator() &&
+    if (!_GetPlayerInfo(guid).IsModerator() &&
         !player->GetSession()->IsGMAccount()) {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -726,9 +726,9 @@ void Channel::List(Player const* player)
              i != playersStore.end();
              ++i)
             if (AccountMgr::IsPlayerAccount(
-                    i->second.plrPtr->GetSession()->GetSecurity())) {
-                data << i->first;
-                data << uint8(i->second.flags); // flags seems to be changed...
+                    i->plrPtr->GetSession()->GetSecurity())) {
+                data << i->player;
+                data << uint8(i->flags); // flags seems to be changed...
                 ++count;
             }
 
@@ -748,7 +748,7 @@ void Channel::Announce(Player const* player)
         return;
     }
 
-    if (!playersStore[guid].IsModerator() &&
+    if (!_GetPlayerInfo(guid).IsModerator() &&
         !player->GetSession()->IsGMAccount()) {
         WorldPacket data;
         MakeNotModerator(&data);
@@ -791,7 +791,7 @@ void Channel::Say(ObjectGuid guid, std::string const& what, uint32 lang)
         return;
     }
 
-    PlayerInfo& pinfo = playersStore[guid];
+    PlayerInfo& pinfo = _GetPlayerInfo(guid);
 
     if (pinfo.IsMuted()) {
         WorldPacket data;
@@ -886,17 +886,17 @@ void Channel::Invite(Player const* player, std::string const& newname)
 void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 {
     if (_ownerGUID) {
-        // [] will re-add player after it possible removed
-        PlayerContainer::iterator p_itr = playersStore.find(_ownerGUID);
+        // _GetPlayerInfo will re-add player after it possible removed
+        PlayerContainer::iterator p_itr = _FindPlayerInfo(_ownerGUID);
         if (p_itr != playersStore.end()) {
-            p_itr->second.SetOwner(false);
-            FlagsNotify(p_itr->second.plrPtr);
+            p_itr->SetOwner(false);
+            FlagsNotify(p_itr->plrPtr);
         }
     }
 
     _ownerGUID = guid;
     if (_ownerGUID) {
-        PlayerInfo& pinfo = playersStore[_ownerGUID];
+        PlayerInfo& pinfo = _GetPlayerInfo(_ownerGUID);
 
         pinfo.SetModerator(true);
         uint8 oldFlag = pinfo.flags;
@@ -921,22 +921,73 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
     }
 }
 
+Channel::PlayerContainer::iterator Channel::_FindPlayerInfo(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr =
+        std::lower_bound(playersStore.begin(),
+                         playersStore.end(),
+                         guid,
+                         [](PlayerInfo const& info, ObjectGuid other) {
+                             return info.player < other;
+                         });
+    if (itr != playersStore.end() && itr->player != guid)
+        return playersStore.end();
+
+    return itr;
+}
+
+Channel::PlayerContainer::const_iterator
+Channel::_FindPlayerInfo(ObjectGuid guid) const
+{
+    return const_cast<Channel*>(this)->_FindPlayerInfo(guid);
+}
+
+Channel::PlayerInfo& Channel::_GetPlayerInfo(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr = _FindPlayerInfo(guid);
+    if (itr != playersStore.end())
+        return *itr;
+
+    // keep the array sorted, members join rarely compared to broadcasts
+    itr = std::upper_bound(playersStore.begin(),
+                           playersStore.end(),
+                           guid,
+                           [](ObjectGuid other, PlayerInfo const& info) {
+                               return other < info.player;
+                           });
+
+    PlayerInfo& info = *playersStore.insert(itr, PlayerInfo());
+    info.player      = guid;
+    info.flags       = MEMBER_FLAG_NONE;
+    info.plrPtr      = nullptr;
+    return info;
+}
+
+void Channel::_ErasePlayerInfo(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr = _FindPlayerInfo(guid);
+    if (itr != playersStore.end())
+        playersStore.erase(itr);
+}
+
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
+    auto const shared = std::make_shared<WorldPacket const>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin();
          i != playersStore.end();
          ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+        if (!guid || !i->plrPtr->GetSocial()->HasIgnore(guid))
+            i->plrPtr->GetSession()->SendPacket(shared);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
+    auto const shared = std::make_shared<WorldPacket const>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin();
          i != playersStore.end();
          ++i)
-        if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+        if (i->player != who)
+            i->plrPtr->GetSession()->SendPacket(shared);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -1261,7 +1312,7 @@ void Channel::ToggleModeration(Player* player)
         sWorld->getIntConfig(CONFIG_GM_LEVEL_CHANNEL_MODERATION);
     const bool gm = (level && player->GetSession()->GetSecurity() >= level);
 
-    if (!playersStore[guid].IsModerator() && !gm) {
+    if (!_GetPlayerInfo(guid).IsModerator() && !gm) {
         WorldPacket data;
         MakeNotModerator(&data);
         SendToOne(&data, guid);
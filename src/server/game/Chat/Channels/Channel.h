@@ -26,6 +26,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 class Player;
 
@@ -346,7 +347,7 @@ private:
 
     [[nodiscard]] bool IsOn(ObjectGuid who) const
     {
-        return playersStore.find(who) != playersStore.end();
+        return _FindPlayerInfo(who) != playersStore.end();
     }
     [[nodiscard]] bool IsBanned(ObjectGuid guid) const;
 
@@ -357,13 +358,13 @@ private:
 
     [[nodiscard]] uint8 GetPlayerFlags(ObjectGuid guid) const
     {
-        PlayerContainer::const_iterator itr = playersStore.find(guid);
-        return itr != playersStore.end() ? itr->second.flags : 0;
+        PlayerContainer::const_iterator itr = _FindPlayerInfo(guid);
+        return itr != playersStore.end() ? itr->flags : 0;
     }
 
     void SetModerator(ObjectGuid guid, bool set)
     {
-        PlayerInfo& pinfo = playersStore[guid];
+        PlayerInfo& pinfo = _GetPlayerInfo(guid);
         if (pinfo.IsModerator() != set) {
             uint8 oldFlag = pinfo.flags;
             pinfo.SetModerator(set);
@@ -378,7 +379,7 @@ private:
 
     void SetMute(ObjectGuid guid, bool set)
     {
-        PlayerInfo& pinfo = playersStore[guid];
+        PlayerInfo& pinfo = _GetPlayerInfo(guid);
         if (pinfo.IsMuted() != set) {
             uint8 oldFlag = pinfo.flags;
             pinfo.SetMuted(set);
@@ -389,9 +390,18 @@ private:
         }
     }
 
-    typedef std::unordered_map<ObjectGuid, PlayerInfo> PlayerContainer;
-    typedef std::unordered_map<ObjectGuid, uint32>     BannedContainer;
-    typedef std::unordered_set<Player*>                PlayersWatchingContainer;
+    // Members are kept sorted by guid in one array, so broadcasts walk
+    // contiguous memory
+    typedef std::vector<PlayerInfo>                PlayerContainer;
+    typedef std::unordered_map<ObjectGuid, uint32> BannedContainer;
+    typedef std::unordered_set<Player*>            PlayersWatchingContainer;
+
+    [[nodiscard]] PlayerContainer::iterator _FindPlayerInfo(ObjectGuid guid);
+    [[nodiscard]] PlayerContainer::const_iterator
+    _FindPlayerInfo(ObjectGuid guid) const;
+    // Returns the member's info, adding an empty one when not on the channel
+    PlayerInfo& _GetPlayerInfo(ObjectGuid guid);
+    void        _ErasePlayerInfo(ObjectGuid guid);
 
     bool                     _announce;
     bool                     _moderation;
@@ -167,11 +167,26 @@ void Acore::Impl::ChatCommands::ChatCommandNode::ResolveNames(std::string name)
 
     _name = name;
 
+    _subtreeHasInvoker    = static_cast<bool>(_invoker);
+    _subtreeRequiredLevel = _permission.RequiredLevel;
+    _subtreeAllowConsole =
+        _invoker &&
+        (_permission.AllowConsole == Acore::ChatCommands::Console::Yes);
+
     for (auto& [subToken, cmd] : _subCommands) {
         std::string subName(name);
         subName.push_back(COMMAND_DELIMITER);
         subName.append(subToken);
         cmd.ResolveNames(subName);
+
+        if (cmd._subtreeHasInvoker &&
+            (!_subtreeHasInvoker ||
+             cmd._subtreeRequiredLevel < _subtreeRequiredLevel)) {
+            _subtreeHasInvoker    = true;
+            _subtreeRequiredLevel = cmd._subtreeRequiredLevel;
+        }
+
+        _subtreeAllowConsole |= cmd._subtreeAllowConsole;
     }
 }
 
@@ -578,6 +593,17 @@ Acore::Impl::ChatCommands::ChatCommandNode::GetAutoCompletionsFor(
     }
 }
 
+bool Acore::Impl::ChatCommands::ChatCommandNode::IsVisible(
+    ChatHandler const& who) const
+{
+    // same result as IsInvokerVisible() || HasVisibleSubCommands(), from the
+    // subtree summary
+    if (who.IsConsole())
+        return _subtreeAllowConsole;
+
+    return _subtreeHasInvoker && who.IsAvailable(_subtreeRequiredLevel);
+}
+
 bool Acore::Impl::ChatCommands::ChatCommandNode::IsInvokerVisible(
     ChatHandler const& who) const
 {
@@ -211,7 +211,9 @@ public:
     GetAutoCompletionsFor(ChatHandler const& handler, std::string_view cmd);
 
     ChatCommandNode()
-        : _name{}, _invoker{}, _permission{}, _help{}, _subCommands{}
+        : _name{}, _invoker{}, _permission{}, _help{}, _subCommands{},
+          _subtreeHasInvoker{false}, _subtreeRequiredLevel{0},
+          _subtreeAllowConsole{false}
     {
     }
 
@@ -232,10 +234,7 @@ private:
     void ResolveNames(std::string name);
     void SendCommandHelp(ChatHandler& handler) const;
 
-    bool IsVisible(ChatHandler const& who) const
-    {
-        return (IsInvokerVisible(who) || HasVisibleSubCommands(who));
-    }
+    bool IsVisible(ChatHandler const& who) const;
     bool IsInvokerVisible(ChatHandler const& who) const;
     bool HasVisibleSubCommands(ChatHandler const& who) const;
 
@@ -245,6 +244,12 @@ private:
     std::variant<std::monostate, AcoreStrings, std::string> _help;
     std::map<std::string_view, ChatCommandNode, StringCompareLessI_T>
         _subCommands;
+
+    // summary of all invokers of this node and its subcommands, filled by
+    // ResolveNames() so that visibility checks don't walk the subtree
+    bool   _subtreeHasInvoker;
+    uint32 _subtreeRequiredLevel;
+    bool   _subtreeAllowConsole;
 };
 } // namespace Acore::Impl::ChatCommands
 
@@ -24,6 +24,9 @@
 #include "SharedDefines.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 using namespace Acore::Hyperlinks;
 
@@ -384,9 +387,52 @@ static bool ValidateLinkInfo(HyperlinkInfo const& info)
     return false;
 }
 
+namespace {
+struct LinkCacheHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view link) const
+    {
+        return std::hash<std::string_view>()(link);
+    }
+};
+
+// Validation results of complete links. Spam repeats the same few links, so
+// their item, spell and quest lookups are done once; the cache is dropped
+// when it grows too large.
+std::size_t const LINK_CACHE_MAX_SIZE = 4096;
+std::shared_mutex _linkCacheLock;
+std::unordered_map<std::string, bool, LinkCacheHash, std::equal_to<>>
+    _linkCache;
+} // namespace
+
+static bool ValidateLinkInfoCached(std::string_view     link,
+                                   HyperlinkInfo const& info)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(_linkCacheLock);
+        auto itr = _linkCache.find(link);
+        if (itr != _linkCache.end())
+            return itr->second;
+    }
+
+    bool valid = ValidateLinkInfo(info);
+
+    std::unique_lock<std::shared_mutex> lock(_linkCacheLock);
+    if (_linkCache.size() >= LINK_CACHE_MAX_SIZE)
+        _linkCache.clear();
+
+    _linkCache.emplace(link, valid);
+    return valid;
+}
+
 // Validates all hyperlinks and control sequences contained in str
 bool Acore::Hyperlinks::CheckAllLinks(std::string_view str)
 {
+    // Most messages contain no control sequence at all, a single memchr scan
+    // decides that
+    if (str.find('|') == std::string_view::npos)
+        return true;
+
     // Step 1: Disallow all control sequences except ||, |H, |h, |c and |r
     {
         std::string_view::size_type pos = 0;
@@ -419,7 +465,12 @@ bool Acore::Hyperlinks::CheckAllLinks(std::string_view str)
             }
 
             HyperlinkInfo info = ParseSingleHyperlink(str.substr(pos));
-            if (!info || !ValidateLinkInfo(info))
+            if (!info)
+                return false;
+
+            std::string_view link =
+                str.substr(pos, str.length() - pos - info.tail.length());
+            if (!ValidateLinkInfoCached(link, info))
                 return false;
 
             // tag is fine, find the next one
@@ -26,6 +26,7 @@
 #include "SpellMgr.h"
 #include "Unit.h"
 #include "UnitEvents.h"
+#include <algorithm>
 
 //==============================================================
 //================= ThreatCalcHelper ===========================
@@ -264,6 +265,7 @@ void ThreatContainer::clearReferences()
     }
 
     iThreatList.clear();
+    iThreatIndex.clear();
 }
 
 //============================================================
@@ -280,16 +282,8 @@ ThreatContainer::getReferenceByTarget(Unit const* victim) const
 HostileReference*
 ThreatContainer::getReferenceByTarget(ObjectGuid const& guid) const
 {
-    for (ThreatContainer::StorageType::const_iterator i = iThreatList.begin();
-         i != iThreatList.end();
-         ++i) {
-        HostileReference* ref = (*i);
-        if (ref && ref->getUnitGuid() == guid) {
-            return ref;
-        }
-    }
-
-    return nullptr;
+    auto itr = iThreatIndex.find(guid);
+    return itr != iThreatIndex.end() ? itr->second : nullptr;
 }
 
 //============================================================
@@ -316,7 +310,11 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
+    // threat changes mostly leave the order intact, the sort is stable so
+    // skipping it for a sorted list changes nothing
+    if (iDirty && iThreatList.size() > 1 &&
+        !std::is_sorted(
+            iThreatList.begin(), iThreatList.end(), Acore::ThreatOrderPred()))
         iThreatList.sort(Acore::ThreatOrderPred());
 
     iDirty = false;
@@ -26,6 +26,7 @@
 #include "SharedDefines.h"
 #include "UnitEvents.h"
 #include <list>
+#include <unordered_map>
 
 //==============================================================
 
@@ -192,11 +193,13 @@ private:
     void remove(HostileReference* hostileRef)
     {
         iThreatList.remove(hostileRef);
+        iThreatIndex.erase(hostileRef->getUnitGuid());
     }
 
     void addReference(HostileReference* hostileRef)
     {
         iThreatList.push_back(hostileRef);
+        iThreatIndex[hostileRef->getUnitGuid()] = hostileRef;
     }
 
     void clearReferences();
@@ -205,7 +208,9 @@ private:
     void update();
 
     StorageType iThreatList;
-    bool        iDirty{false};
+    // Every threat change looks its reference up by target
+    std::unordered_map<ObjectGuid, HostileReference*> iThreatIndex;
+    bool                                              iDirty{false};
 };
 
 //=================================================
@@ -30,6 +30,28 @@
 #include "SpellAuras.h"
 #include "SpellMgr.h"
 
+namespace {
+ConditionList const EmptyConditionList;
+
+// A condition list rarely has more than a handful of else groups, so a flat
+// vector searched linearly beats building a std::map on every evaluation.
+template <typename T> using ElseGroupList = std::vector<std::pair<uint32, T>>;
+
+template <typename T>
+T& FindOrAddElseGroup(ElseGroupList<T>& store,
+                      uint32            elseGroup,
+                      T                 initial,
+                      bool&             added)
+{
+    for (auto& [group, value] : store)
+        if (group == elseGroup)
+            return value;
+
+    added = true;
+    return store.emplace_back(elseGroup, initial).second;
+}
+} // namespace
+
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special
 // event (ie: eventAI)
@@ -810,7 +832,7 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(
     if (conditions.empty())
         return GRID_MAP_TYPE_MASK_ALL;
     //     groupId, typeMask
-    std::map<uint32, uint32> ElseGroupStore;
+    ElseGroupList<uint32> ElseGroupStore;
     for (ConditionList::const_iterator i = conditions.begin();
          i != conditions.end();
          ++i) {
@@ -818,13 +840,14 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(
         ASSERT((*i)->isLoaded() &&
                "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet "
                "loaded condition found in list");
-        std::map<uint32, uint32>::const_iterator itr =
-            ElseGroupStore.find((*i)->ElseGroup);
+        bool added = false;
         // group not filled yet, fill with widest mask possible
-        if (itr == ElseGroupStore.end())
-            ElseGroupStore[(*i)->ElseGroup] = GRID_MAP_TYPE_MASK_ALL;
+        uint32& groupMask = FindOrAddElseGroup(ElseGroupStore,
+                                               (*i)->ElseGroup,
+                                               uint32(GRID_MAP_TYPE_MASK_ALL),
+                                               added);
         // no point of checking anymore, empty mask
-        else if (!(*itr).second)
+        if (!added && !groupMask)
             continue;
 
         if ((*i)->ReferenceId) // handle reference
@@ -834,25 +857,21 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(
             ASSERT(ref != ConditionReferenceStore.end() &&
                    "ConditionMgr::GetSearcherTypeMaskForConditionList - "
                    "incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &=
-                GetSearcherTypeMaskForConditionList((*ref).second);
+            groupMask &= GetSearcherTypeMaskForConditionList((*ref).second);
         }
         else // handle normal condition
         {
             // object will match conditions in one ElseGroupStore only when it
             // matches all of them so, let's find a smallest possible mask which
             // satisfies all conditions
-            ElseGroupStore[(*i)->ElseGroup] &=
-                (*i)->GetSearcherTypeMaskForCondition();
+            groupMask &= (*i)->GetSearcherTypeMaskForCondition();
         }
     }
     // object will match condition when one of the checks in ElseGroupStore is
     // matching so, let's include all possible masks
     uint32 mask = 0;
-    for (std::map<uint32, uint32>::const_iterator i = ElseGroupStore.begin();
-         i != ElseGroupStore.end();
-         ++i)
-        mask |= i->second;
+    for (auto const& [elseGroup, groupMask] : ElseGroupStore)
+        mask |= groupMask;
 
     return mask;
 }
@@ -861,7 +880,7 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
                                                ConditionList const& conditions)
 {
     //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
+    ElseGroupList<bool> ElseGroupStore;
     for (ConditionList::const_iterator i = conditions.begin();
          i != conditions.end();
          ++i) {
@@ -872,13 +891,12 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
             (*i)->ConditionValue1);
         if ((*i)->isLoaded()) {
             //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr =
-                ElseGroupStore.find((*i)->ElseGroup);
             //! If not found, add an entry in the store and set to true
             //! (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
+            bool  added       = false;
+            bool& groupPassed = FindOrAddElseGroup(
+                ElseGroupStore, (*i)->ElseGroup, true, added);
+            if (!added && !groupPassed)
                 continue;
 
             if ((*i)->ReferenceId) // handle reference
@@ -887,7 +905,7 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
                     ConditionReferenceStore.find((*i)->ReferenceId);
                 if (ref != ConditionReferenceStore.end()) {
                     if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
+                        groupPassed = false;
                 }
                 else {
                     LOG_DEBUG("condition",
@@ -899,14 +917,12 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
             else // handle normal condition
             {
                 if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
+                    groupPassed = false;
             }
         }
     }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin();
-         i != ElseGroupStore.end();
-         ++i)
-        if (i->second)
+    for (auto const& [elseGroup, groupPassed] : ElseGroupStore)
+        if (groupPassed)
             return true;
 
     return false;
@@ -966,11 +982,10 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT);
 }
 
-ConditionList
+ConditionList const&
 ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType,
                                               uint32              entry)
 {
-    ConditionList spellCond;
     if (sourceType > CONDITION_SOURCE_TYPE_NONE &&
         sourceType < CONDITION_SOURCE_TYPE_MAX) {
         ConditionContainer::const_iterator itr =
@@ -979,90 +994,85 @@ ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType,
             ConditionTypeContainer::const_iterator i =
                 (*itr).second.find(entry);
             if (i != (*itr).second.end()) {
-                spellCond = (*i).second;
                 LOG_DEBUG("condition",
                           "GetConditionsForNotGroupedEntry: found conditions "
                           "for type {} and entry {}",
                           uint32(sourceType),
                           entry);
+                return (*i).second;
             }
         }
     }
-    return spellCond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId,
-                                                            uint32 spellId)
+ConditionList const&
+ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId,
+                                              uint32 spellId)
 {
-    ConditionList                                   cond;
     CreatureSpellConditionContainer::const_iterator itr =
         SpellClickEventConditionStore.find(creatureId);
     if (itr != SpellClickEventConditionStore.end()) {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
         if (i != (*itr).second.end()) {
-            cond = (*i).second;
             LOG_DEBUG("condition",
                       "GetConditionsForSpellClickEvent: found conditions for "
                       "Vehicle entry {} spell {}",
                       creatureId,
                       spellId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId,
-                                                         uint32 spellId)
+ConditionList const&
+ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
 {
-    ConditionList                                   cond;
     CreatureSpellConditionContainer::const_iterator itr =
         VehicleSpellConditionStore.find(creatureId);
     if (itr != VehicleSpellConditionStore.end()) {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
         if (i != (*itr).second.end()) {
-            cond = (*i).second;
             LOG_DEBUG("condition",
                       "GetConditionsForVehicleSpell: found conditions for "
                       "Vehicle entry {} spell {}",
                       creatureId,
                       spellId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32  entryOrGuid,
-                                                       uint32 eventId,
-                                                       uint32 sourceType)
+ConditionList const& ConditionMgr::GetConditionsForSmartEvent(
+    int32 entryOrGuid, uint32 eventId, uint32 sourceType)
 {
-    ConditionList                                cond;
     SmartEventConditionContainer::const_iterator itr =
         SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
     if (itr != SmartEventConditionStore.end()) {
         ConditionTypeContainer::const_iterator i =
             (*itr).second.find(eventId + 1);
         if (i != (*itr).second.end()) {
-            cond = (*i).second;
             LOG_DEBUG("condition",
                       "GetConditionsForSmartEvent: found conditions for Smart "
                       "Event entry or guid {} event_id {}",
                       entryOrGuid,
                       eventId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId,
-                                                           uint32 itemId)
+ConditionList const&
+ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
 {
-    ConditionList                               cond;
     NpcVendorConditionContainer::const_iterator itr =
         NpcVendorConditionContainerStore.find(creatureId);
     if (itr != NpcVendorConditionContainerStore.end()) {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
         if (i != (*itr).second.end()) {
-            cond = (*i).second;
             if (itemId) {
                 LOG_DEBUG("condition",
                           "GetConditionsForNpcVendorEvent: found conditions "
@@ -1076,9 +1086,10 @@ ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId,
                           "for creature entry {}",
                           creatureId);
             }
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
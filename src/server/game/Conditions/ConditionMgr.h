@@ -345,18 +345,20 @@ public:
     [[nodiscard]] bool
     CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-    ConditionList
+    // The returned lists reference the loaded store and stay valid until the
+    // next condition reload.
+    ConditionList const&
     GetConditionsForNotGroupedEntry(ConditionSourceType sourceType,
                                     uint32              entry);
-    ConditionList GetConditionsForSpellClickEvent(uint32 creatureId,
-                                                  uint32 spellId);
-    ConditionList GetConditionsForSmartEvent(int32  entryOrGuid,
-                                             uint32 eventId,
-                                             uint32 sourceType);
-    ConditionList GetConditionsForVehicleSpell(uint32 creatureId,
-                                               uint32 spellId);
-    ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId,
-                                                 uint32 itemId);
+    ConditionList const& GetConditionsForSpellClickEvent(uint32 creatureId,
+                                                         uint32 spellId);
+    ConditionList const& GetConditionsForSmartEvent(int32  entryOrGuid,
+                                                    uint32 eventId,
+                                                    uint32 sourceType);
+    ConditionList const& GetConditionsForVehicleSpell(uint32 creatureId,
+                                                      uint32 spellId);
+    ConditionList const& GetConditionsForNpcVendorEvent(uint32 creatureId,
+                                                        uint32 itemId);
 
 private:
     bool isSourceTypeValid(Condition* cond);
@@ -27,6 +27,7 @@
 #include "SpellMgr.h"
 #include "TransportMgr.h"
 #include "World.h"
+#include <limits>
 #include <map>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
@@ -86,6 +87,33 @@ DBCStorage<EmotesTextEntry> sEmotesTextStore(EmotesTextEntryfmt);
 
 typedef std::map<uint32, SimpleFactionsList> FactionTeamMap;
 static FactionTeamMap                        sFactionTeamMap;
+
+// reaction between every pair of faction templates, two bits per pair,
+// rows and columns use the dense index from sFactionTemplateIndex
+static std::vector<uint16> sFactionTemplateIndex;
+static std::vector<uint8>  sFactionTemplateReactions;
+static uint32              sFactionTemplateCount = 0;
+
+// packed values of sFactionTemplateReactions
+static ReputationRank const sFactionTemplateReactionRanks[3] = {
+    REP_NEUTRAL, REP_HOSTILE, REP_FRIENDLY};
+
+static uint8
+ComputeFactionTemplateReaction(FactionTemplateEntry const& factionTemplate,
+                               FactionTemplateEntry const& target)
+{
+    if (factionTemplate.IsHostileTo(target))
+        return 1;
+    if (factionTemplate.IsFriendlyTo(target))
+        return 2;
+    if (target.IsFriendlyTo(factionTemplate))
+        return 2;
+    if (factionTemplate.factionFlags &
+        FACTION_TEMPLATE_FLAG_HATES_ALL_EXCEPT_FRIENDS)
+        return 1;
+    // neutral by default
+    return 0;
+}
 DBCStorage<FactionEntry>                     sFactionStore(FactionEntryfmt);
 DBCStorage<FactionTemplateEntry> sFactionTemplateStore(FactionTemplateEntryfmt);
 
@@ -539,6 +567,28 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
+    sFactionTemplateIndex.assign(sFactionTemplateStore.GetNumRows(),
+                                 std::numeric_limits<uint16>::max());
+    std::vector<FactionTemplateEntry const*> factionTemplates;
+    for (FactionTemplateEntry const* factionTemplate : sFactionTemplateStore) {
+        sFactionTemplateIndex[factionTemplate->ID] =
+            uint16(factionTemplates.size());
+        factionTemplates.push_back(factionTemplate);
+    }
+
+    sFactionTemplateCount = factionTemplates.size();
+    sFactionTemplateReactions.assign(
+        (sFactionTemplateCount * sFactionTemplateCount + 3) / 4, 0);
+    for (uint32 i = 0; i < sFactionTemplateCount; ++i) {
+        for (uint32 j = 0; j < sFactionTemplateCount; ++j) {
+            uint32 const pair = i * sFactionTemplateCount + j;
+            sFactionTemplateReactions[pair / 4] |=
+                ComputeFactionTemplateReaction(*factionTemplates[i],
+                                               *factionTemplates[j])
+                << ((pair % 4) * 2);
+        }
+    }
+
     for (GameObjectDisplayInfoEntry const* info : sGameObjectDisplayInfoStore) {
         if (info->maxX < info->minX)
             std::swap(*(float*)(&info->maxX), *(float*)(&info->minX));
@@ -828,6 +878,29 @@ void LoadDBCStores(const std::string& dataPath)
     LOG_INFO("server.loading", " ");
 }
 
+ReputationRank
+GetFactionTemplateReaction(FactionTemplateEntry const* factionTemplate,
+                           FactionTemplateEntry const* targetFactionTemplate)
+{
+    uint32 const row =
+        factionTemplate->ID < sFactionTemplateIndex.size()
+            ? sFactionTemplateIndex[factionTemplate->ID]
+            : std::numeric_limits<uint16>::max();
+    uint32 const column =
+        targetFactionTemplate->ID < sFactionTemplateIndex.size()
+            ? sFactionTemplateIndex[targetFactionTemplate->ID]
+            : std::numeric_limits<uint16>::max();
+
+    // templates that were not known when the table was built
+    if (row >= sFactionTemplateCount || column >= sFactionTemplateCount)
+        return sFactionTemplateReactionRanks[ComputeFactionTemplateReaction(
+            *factionTemplate, *targetFactionTemplate)];
+
+    uint32 const pair = row * sFactionTemplateCount + column;
+    return sFactionTemplateReactionRanks
+        [(sFactionTemplateReactions[pair / 4] >> ((pair % 4) * 2)) & 3];
+}
+
 SimpleFactionsList const* GetFactionTeamList(uint32 faction)
 {
     FactionTeamMap::const_iterator itr = sFactionTeamMap.find(faction);
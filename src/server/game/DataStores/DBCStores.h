@@ -30,6 +30,12 @@ typedef std::list<uint32> SimpleFactionsList;
 
 SimpleFactionsList const* GetFactionTeamList(uint32 faction);
 
+// reaction of a faction template towards another one, without any player
+// reputation or forced reactions, looked up from a table built at load
+ReputationRank
+GetFactionTemplateReaction(FactionTemplateEntry const* factionTemplate,
+                           FactionTemplateEntry const* targetFactionTemplate);
+
 char const*           GetPetName(uint32 petfamily, uint32 dbclang);
 uint32                GetTalentSpellCost(uint32 spellId);
 TalentSpellPos const* GetTalentSpellPos(uint32 spellId);
@@ -267,6 +267,9 @@ LfgCompatibility LFGQueue::FindNewGroups(const ObjectGuid& newGuid)
             return selfCompatibility;
     }
 
+    LfgQueueDataContainer::const_iterator newQueue =
+        QueueDataStore.find(newGuid);
+
     for (Lfg5GuidsList::iterator it = CompatibleList.begin();
          it != CompatibleList.end();) {
         Lfg5GuidsList::iterator itr = it++;
@@ -275,6 +278,11 @@ LfgCompatibility LFGQueue::FindNewGroups(const ObjectGuid& newGuid)
             CompatibleList.erase(itr);
             continue;
         }
+        // Cheap rejection before building a full proposal; CheckCompatibility
+        // would fail these with LFG_INCOMPATIBLES_NO_DUNGEONS anyway
+        if (newQueue != QueueDataStore.end() &&
+            !CanShareDungeon(*itr, newQueue->second.dungeons))
+            continue;
         LfgCompatibility compatibility = CheckCompatibility(
             *itr, newGuid, foundMask, foundCount, currentCompatibles);
         if (compatibility == LFG_COMPATIBLES_MATCH)
@@ -288,6 +296,35 @@ LfgCompatibility LFGQueue::FindNewGroups(const ObjectGuid& newGuid)
     return selfCompatibility;
 }
 
+// True unless a queued member of checkWith has no dungeon in common with
+// dungeons. Members missing from the queue are left to CheckCompatibility,
+// which reports and removes them.
+bool LFGQueue::CanShareDungeon(Lfg5Guids const&     checkWith,
+                               LfgDungeonSet const& dungeons) const
+{
+    for (uint8 i = 0; i < 5 && checkWith.guids[i]; ++i) {
+        LfgQueueDataContainer::const_iterator itQueue =
+            QueueDataStore.find(checkWith.guids[i]);
+        if (itQueue == QueueDataStore.end())
+            return true;
+
+        LfgDungeonSet const&          other = itQueue->second.dungeons;
+        LfgDungeonSet::const_iterator a     = dungeons.begin();
+        LfgDungeonSet::const_iterator b     = other.begin();
+        while (a != dungeons.end() && b != other.end() && *a != *b) {
+            if (*a < *b)
+                ++a;
+            else
+                ++b;
+        }
+
+        if (a == dungeons.end() || b == other.end())
+            return false;
+    }
+
+    return true;
+}
+
 LfgCompatibility
 LFGQueue::CheckCompatibility(Lfg5Guids const&           checkWith,
                              const ObjectGuid&          newGuid,
@@ -119,6 +119,8 @@ private:
                        uint64&                    foundMask,
                        uint32&                    foundCount,
                        const std::set<Lfg5Guids>& currentCompatibles);
+    bool CanShareDungeon(Lfg5Guids const&     checkWith,
+                         LfgDungeonSet const& dungeons) const;
 
     // Queue
     uint32 m_QueueStatusTimer; // used to check interval of sending queue status
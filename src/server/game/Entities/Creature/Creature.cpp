@@ -40,6 +40,7 @@
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
 #include "ScriptedGossip.h"
+#include "ScriptProfiler.h"
 #include "SpellAuraEffects.h"
 #include "SpellMgr.h"
 #include "TemporarySummon.h"
@@ -255,13 +256,15 @@ Creature::Creature(bool isWorldObject)
       m_regenHealth(true), m_regenPower(true), m_AI_locked(false),
       m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0),
       m_moveInLineOfSightDisabled(false),
-      m_moveInLineOfSightStrictlyDisabled(false), m_homePosition(),
+      m_moveInLineOfSightStrictlyDisabled(false),
+      m_moveInLineOfSightRangeLimited(false), m_homePosition(),
       m_transportHomePosition(), m_creatureInfo(nullptr),
       m_creatureData(nullptr), m_detectionDistance(20.0f), m_waypointID(0),
       m_path_id(0), m_formation(nullptr), _lastDamagedTime(nullptr),
       m_cannotReachTimer(0), _isMissingSwimmingFlagOutOfCombat(false),
       m_assistanceTimer(0), _playerDamageReq(0), _damagedByPlayer(false),
-      _isCombatMovementAllowed(true)
+      _isCombatMovementAllowed(true), _skippedUpdateDiff(0),
+      _skippedUpdateTicks(0)
 {
     m_regenTimer  = CREATURE_REGEN_INTERVAL;
     m_valuesCount = UNIT_END;
@@ -660,8 +663,68 @@ bool Creature::UpdateEntry(uint32              Entry,
     return true;
 }
 
+bool Creature::IsUpdateIdle() const
+{
+    if (!IsAlive() || IsInCombat() || IsInEvadeMode() ||
+        TriggerJustRespawned || IsSummon() ||
+        IsCharmedOwnedByPlayerOrPlayer() || GetVehicleKit() || GetVehicle())
+        return false;
+
+    if (!m_Events.Empty() || m_delayed_unit_relocation_timer ||
+        m_delayed_unit_ai_notify_timer || IsNonMeleeSpellCast(true))
+        return false;
+
+    if (!movespline->Finalized() ||
+        GetMotionMaster()->GetCurrentMovementGeneratorType() !=
+            IDLE_MOTION_TYPE)
+        return false;
+
+    if (GetHealth() < GetMaxHealth() ||
+        GetPower(getPowerType()) < GetMaxPower(getPowerType()))
+        return false;
+
+    for (auto const& [spellId, aura] : GetOwnedAuras()) {
+        if (!aura->IsPermanent())
+            return false;
+
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (AuraEffect const* effect = aura->GetEffect(i))
+                if (effect->IsPeriodic())
+                    return false;
+    }
+
+    return true;
+}
+
+bool Creature::CanDelayUpdate() const
+{
+    uint32 idleInterval =
+        sWorld->getIntConfig(CONFIG_CREATURE_IDLE_UPDATE_INTERVAL);
+    if (idleInterval && _skippedUpdateDiff < idleInterval && IsUpdateIdle())
+        return true;
+
+    uint32 farTicks = sWorld->getIntConfig(CONFIG_MAP_UPDATE_FAR_OBJECTS_TICKS);
+    if (farTicks > 1 && _skippedUpdateTicks + 1 < farTicks &&
+        !IsInCombat() && !IsVisibilityOverridden() &&
+        !GetMap()->IsCellNearPlayers(GetPositionX(), GetPositionY()))
+        return true;
+
+    return false;
+}
+
 void Creature::Update(uint32 diff)
 {
+    _skippedUpdateDiff += diff;
+    if (CanDelayUpdate()) {
+        ++_skippedUpdateTicks;
+        return;
+    }
+
+    // catch up on the time of the delayed updates
+    diff                = _skippedUpdateDiff;
+    _skippedUpdateDiff  = 0;
+    _skippedUpdateTicks = 0;
+
     if (IsAIEnabled && TriggerJustRespawned) {
         TriggerJustRespawned = false;
         AI()->JustRespawned();
@@ -818,6 +881,13 @@ void Creature::Update(uint32 diff)
         if (!IsInEvadeMode() && IsAIEnabled) {
             // do not allow the AI to be changed during update
             m_AI_locked = true;
+            ScriptProfilerScope profile;
+            if (profile.IsSampled()) {
+                std::string name = GetScriptName();
+                if (name.empty())
+                    name = GetAIName().empty() ? "default" : GetAIName();
+                profile.SetScript(SCRIPT_PROFILE_CREATURE_AI, std::move(name));
+            }
             i_AI->UpdateAI(diff);
             m_AI_locked = false;
         }
@@ -2146,8 +2216,9 @@ void Creature::Respawn(bool force)
         }
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(
-        CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
+    ConditionList const& conditions =
+        sConditionMgr->GetConditionsForNotGroupedEntry(
+            CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
 
     if (!sConditionMgr->IsObjectMeetToConditions(this, conditions) && !force) {
         // Creature should not respawn, reset respawn timer. Conditions will be
@@ -2725,9 +2796,13 @@ void Creature::UpdateMoveInLineOfSightState()
         GetScriptId() || GetAIName() == "SmartAI") {
         m_moveInLineOfSightStrictlyDisabled = false;
         m_moveInLineOfSightDisabled         = false;
+        m_moveInLineOfSightRangeLimited     = false;
         return;
     }
 
+    // everything below uses a core AI
+    m_moveInLineOfSightRangeLimited = true;
+
     if (IsTrigger() || IsCivilian() ||
         GetCreatureType() == CREATURE_TYPE_NON_COMBAT_PET || IsCritter() ||
         GetAIName() == "NullCreatureAI") {
@@ -2751,6 +2826,21 @@ void Creature::UpdateMoveInLineOfSightState()
         m_moveInLineOfSightDisabled = false;
 }
 
+bool Creature::IsOutOfMoveInLineOfSightRange(Unit const* who) const
+{
+    if (!m_moveInLineOfSightRangeLimited)
+        return false;
+
+    // upper bound of the ranges checked by CanStartAttack, GetAggroRange is
+    // capped at MAX_AGGRO_RADIUS before the rate is applied; the 2d distance
+    // never exceeds the 3d one used there
+    float range =
+        std::max(MAX_AGGRO_RADIUS * sWorld->getRate(RATE_CREATURE_AGGRO),
+                 ATTACK_DISTANCE) +
+        m_CombatDistance + GetObjectSize() + who->GetObjectSize();
+    return GetExactDist2dSq(who) > range * range;
+}
+
 void Creature::SaveRespawnTime()
 {
     if (IsSummon() || !m_spawnId || (m_creatureData && !m_creatureData->dbData))
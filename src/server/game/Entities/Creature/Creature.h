@@ -79,6 +79,10 @@ public:
     [[nodiscard]] ObjectGuid::LowType GetSpawnId() const { return m_spawnId; }
 
     void Update(uint32 time) override; // overwrited Unit::Update
+    //! Nothing of the creature changes with time, its update can be delayed
+    [[nodiscard]] bool IsUpdateIdle() const;
+    //! Idle or far from players, the update can be folded into a later one
+    [[nodiscard]] bool CanDelayUpdate() const;
     void GetRespawnPosition(float& x,
                             float& y,
                             float& z,
@@ -414,6 +418,10 @@ public:
     {
         return m_moveInLineOfSightStrictlyDisabled;
     }
+    // core AIs only react to units within aggro or assist range, so for
+    // creatures without a script anything farther away can be skipped before
+    // the visibility checks
+    [[nodiscard]] bool IsOutOfMoveInLineOfSightRange(Unit const* who) const;
 
     void RemoveCorpse(bool setSpawnTime = true, bool skipVisibility = false);
 
@@ -670,6 +678,7 @@ protected:
 
     bool m_moveInLineOfSightDisabled;
     bool m_moveInLineOfSightStrictlyDisabled;
+    bool m_moveInLineOfSightRangeLimited;
 
     Position m_homePosition;
     Position m_transportHomePosition;
@@ -718,6 +727,9 @@ private:
     uint32 _playerDamageReq;
     bool   _damagedByPlayer;
     bool   _isCombatMovementAllowed;
+
+    uint32 _skippedUpdateDiff;  // (msecs) time of the delayed updates
+    uint32 _skippedUpdateTicks; // number of delayed updates
 };
 
 class AssistDelayEvent : public BasicEvent {
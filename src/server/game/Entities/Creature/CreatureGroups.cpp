@@ -20,6 +20,7 @@
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "Log.h"
+#include "MoveSpline.h"
 #include "MoveSplineInit.h"
 #include "ObjectMgr.h"
 #include "WaypointMgr.h"
@@ -403,6 +404,19 @@ void CreatureGroup::LeaderMoveTo(float x, float y, float z, uint32 move_type)
     float pathAngle =
         std::atan2(m_leader->GetPositionY() - y, m_leader->GetPositionX() - x);
 
+    // members walk the leader's freshly launched path shifted by their
+    // formation offset instead of each running its own pathfinding
+    Movement::PointsArray leaderPath;
+    if (m_leader->movespline->Initialized() &&
+        !m_leader->movespline->Finalized()) {
+        auto const&         spline = m_leader->movespline->_Spline();
+        G3D::Vector3 const& end    = spline.getPoint(spline.last());
+        if (!spline.isCyclic() && spline.last() - spline.first() > 1 &&
+            G3D::fuzzyEq(end.x, x) && G3D::fuzzyEq(end.y, y))
+            for (int32 i = spline.first(); i <= spline.last(); ++i)
+                leaderPath.push_back(spline.getPoint(i));
+    }
+
     for (auto const& itr : m_members) {
         Creature*            member         = itr.first;
         FormationInfo const& pFormationInfo = itr.second;
@@ -473,7 +487,25 @@ void CreatureGroup::LeaderMoveTo(float x, float y, float z, uint32 move_type)
         if (speedRate > 0.01f) // don't move if speed rate is too low
         {
             member->SetSpeedRate(mtype, speedRate);
-            member->GetMotionMaster()->MovePoint(0, dx, dy, dz);
+            if (!leaderPath.empty()) {
+                Movement::PointsArray memberPath;
+                memberPath.reserve(leaderPath.size());
+                memberPath.emplace_back(member->GetPositionX(),
+                                        member->GetPositionY(),
+                                        member->GetPositionZ());
+                for (std::size_t i = 1; i + 1 < leaderPath.size(); ++i) {
+                    float px = leaderPath[i].x + dx - x;
+                    float py = leaderPath[i].y + dy - y;
+                    float pz = leaderPath[i].z;
+                    if (move_type < 2)
+                        member->UpdateGroundPositionZ(px, py, pz);
+                    memberPath.emplace_back(px, py, pz);
+                }
+                memberPath.emplace_back(dx, dy, dz);
+                member->GetMotionMaster()->MovePoint(0, memberPath);
+            }
+            else
+                member->GetMotionMaster()->MovePoint(0, dx, dy, dz);
             member->SetHomePosition(dx, dy, dz, pathAngle);
         }
     }
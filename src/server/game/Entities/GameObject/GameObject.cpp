@@ -32,6 +32,7 @@
 #include "OutdoorPvPMgr.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "SpellMgr.h"
 #include "Transport.h"
 #include "UpdateFieldFlags.h"
@@ -62,6 +63,8 @@ GameObject::GameObject()
     m_usetimes                        = 0;
     m_spellId                         = 0;
     m_cooldownTime                    = 0;
+    m_trapProximityRadius             = 0.0f;
+    m_trapTargetSearchPending         = true;
     m_goInfo                          = nullptr;
     m_goData                          = nullptr;
     m_packedRotation                  = 0;
@@ -170,6 +173,21 @@ void GameObject::AddToWorld()
 
         WorldObject::AddToWorld();
 
+        // traps only search for targets after a unit moved into their
+        // activation radius, the first update searches once anyway
+        if (GetGoType() == GAMEOBJECT_TYPE_TRAP) {
+            GameObjectTemplate const* goInfo = GetGOInfo();
+            if (goInfo->trap.diameter)
+                m_trapProximityRadius = float(goInfo->trap.diameter) * 0.5f;
+            else if (goInfo->trap.cooldown == 3)
+                m_trapProximityRadius = 3.f;
+
+            if (m_trapProximityRadius > 0.0f) {
+                m_trapTargetSearchPending = true;
+                GetMap()->AddTrapToProximityIndex(this);
+            }
+        }
+
         loot.sourceWorldObjectGUID = GetGUID();
 
         sScriptMgr->OnGameObjectAddWorld(this);
@@ -199,6 +217,11 @@ void GameObject::RemoveFromWorld()
             linkedTrap->Delete();
         }
 
+        if (m_trapProximityRadius > 0.0f) {
+            GetMap()->RemoveTrapFromProximityIndex(this);
+            m_trapProximityRadius = 0.0f;
+        }
+
         WorldObject::RemoveFromWorld();
 
         if (m_spawnId)
@@ -478,8 +501,16 @@ bool GameObject::Create(ObjectGuid::LowType guidlow,
 
 void GameObject::Update(uint32 diff)
 {
-    if (AI())
+    if (AI()) {
+        ScriptProfilerScope profile;
+        if (profile.IsSampled()) {
+            std::string name = sObjectMgr->GetScriptName(GetScriptId());
+            if (name.empty())
+                name = GetAIName().empty() ? "default" : GetAIName();
+            profile.SetScript(SCRIPT_PROFILE_GAMEOBJECT_AI, std::move(name));
+        }
         AI()->UpdateAI(diff);
+    }
     else if (!AIM_Initialize())
         LOG_ERROR("entities.gameobject", "Could not initialize GameObjectAI");
 
@@ -760,6 +791,10 @@ void GameObject::Update(uint32 diff)
                     radius = 3.f;
                 }
 
+                // nobody moved within the radius since the last search
+                if (m_trapProximityRadius > 0.0f && !m_trapTargetSearchPending)
+                    break;
+
                 // Type 0 and 1 - trap (type 0 will not get removed after
                 // casting a spell)
                 Unit* owner = GetOwner();
@@ -794,6 +829,8 @@ void GameObject::Update(uint32 diff)
                 if (target) {
                     SetLootState(GO_ACTIVATED, target);
                 }
+                else
+                    m_trapTargetSearchPending = false;
             }
             else if (uint32 max_charges = goInfo->GetCharges()) {
                 if (m_usetimes >= max_charges) {
@@ -365,6 +365,16 @@ public:
         m_linkedTrap = linkedTrap->GetGUID();
     }
 
+    // activation radius of a trap registered in the map proximity index, 0
+    // for every other gameobject
+    [[nodiscard]] float GetTrapProximityRadius() const
+    {
+        return m_trapProximityRadius;
+    }
+    // called by the map when a unit moved within the activation radius, the
+    // next update searches for a target
+    void OnUnitInTrapRange() { m_trapTargetSearchPending = true; }
+
     [[nodiscard]] bool hasQuest(uint32 quest_id) const override;
     [[nodiscard]] bool hasInvolvedQuest(uint32 quest_id) const override;
     bool               ActivateToQuest(Player* target) const;
@@ -611,6 +621,8 @@ protected:
     uint32 m_lootGenerationTime;
 
     ObjectGuid m_linkedTrap;
+    float      m_trapProximityRadius;
+    bool       m_trapTargetSearchPending;
 
     ObjectGuid _lootStateUnitGUID;
 
@@ -52,6 +52,7 @@
 #include "Vehicle.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <bit>
 
 /// @todo: this import is not necessary for compilation and marked as unused by
 /// the IDE
@@ -239,14 +240,13 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target)
         }
     }
 
-    ByteBuffer buf(500);
+    ByteBuffer& buf = data->StartUpdateBlock();
     buf << (uint8)updatetype;
     buf << GetPackGUID();
     buf << (uint8)m_objectTypeId;
 
     BuildMovementUpdate(&buf, flags);
     BuildValuesUpdate(updatetype, &buf, target);
-    data->AddUpdateBlock(buf);
 }
 
 void Object::SendUpdateToPlayer(Player* player)
@@ -262,14 +262,14 @@ void Object::SendUpdateToPlayer(Player* player)
 
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target)
 {
-    ByteBuffer buf(500);
+    // written in place, the values part is shared between observers with
+    // the same visibility through the values update cache of units
+    ByteBuffer& buf = data->StartUpdateBlock();
 
     buf << (uint8)UPDATETYPE_VALUES;
     buf << GetPackGUID();
 
     BuildValuesUpdate(UPDATETYPE_VALUES, &buf, target);
-
-    data->AddUpdateBlock(buf);
 }
 
 void Object::BuildOutOfRangeUpdateBlock(UpdateData* data) const
@@ -488,26 +488,37 @@ void Object::BuildValuesUpdate(uint8       updateType,
     if (!target)
         return;
 
-    ByteBuffer fieldBuffer;
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
     uint32* flags       = nullptr;
     uint32  visibleFlag = GetUpdateFieldData(target, flags);
 
+    uint32 fieldCount = 0;
     for (uint16 index = 0; index < m_valuesCount; ++index) {
         if (_fieldNotifyFlags & flags[index] ||
             ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index)
                                               : m_uint32Values[index]) &&
              (flags[index] & visibleFlag))) {
             updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
+            ++fieldCount;
         }
     }
 
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+
+    // the values follow the mask, written straight into the packet
+    ByteBuffer::Writer writer(*data, fieldCount * sizeof(uint32));
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block) {
+        for (UpdateMask::ClientUpdateMaskType bits = updateMask.GetBlock(block);
+             bits;
+             bits &= bits - 1) {
+            uint32 const index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS +
+                                 std::countr_zero(bits);
+            writer << m_uint32Values[index];
+        }
+    }
 }
 
 void Object::AddToObjectUpdateIfNeeded()
@@ -1800,7 +1811,7 @@ bool WorldObject::CanSeeOrDetect(WorldObject const* obj,
                 return false;
             }
 
-            ConditionList conditions =
+            ConditionList const& conditions =
                 sConditionMgr->GetConditionsForNotGroupedEntry(
                     CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY,
                     cObj->GetEntry());
@@ -2171,6 +2182,11 @@ void WorldObject::SendMessageToSetInRange(WorldPacket const* data,
                                           bool          includeMargin,
                                           Player const* skipped_rcvr) const
 {
+    // every receiver (including shared vision) is a player on this map
+    Map const* map = FindMap();
+    if (map && !map->HavePlayers())
+        return;
+
     dist += GetObjectSize();
     if (includeMargin)
         dist += VISIBILITY_COMPENSATION; // pussywizard: to ensure everyone
@@ -2714,39 +2730,55 @@ std::string WorldObject::GetDebugInfo() const
     return sstr.str();
 }
 
+template <class Container>
 void WorldObject::GetGameObjectListWithEntryInGrid(
-    std::list<GameObject*>& gameobjectList,
-    uint32                  entry,
-    float                   maxSearchRange) const
+    Container& gameobjectContainer,
+    uint32     entry,
+    float      maxSearchRange) const
 {
     Acore::AllGameObjectsWithEntryInRange check(this, entry, maxSearchRange);
     Acore::GameObjectListSearcher<Acore::AllGameObjectsWithEntryInRange>
-        searcher(this, gameobjectList, check);
+        searcher(this, gameobjectContainer, check);
     Cell::VisitGridObjects(this, searcher, maxSearchRange);
 }
 
-void WorldObject::GetCreatureListWithEntryInGrid(
-    std::list<Creature*>& creatureList,
-    uint32                entry,
-    float                 maxSearchRange) const
+template <class Container>
+void WorldObject::GetCreatureListWithEntryInGrid(Container& creatureContainer,
+                                                 uint32     entry,
+                                                 float maxSearchRange) const
 {
     Acore::AllCreaturesOfEntryInRange check(this, entry, maxSearchRange);
     Acore::CreatureListSearcher<Acore::AllCreaturesOfEntryInRange> searcher(
-        this, creatureList, check);
+        this, creatureContainer, check);
     Cell::VisitGridObjects(this, searcher, maxSearchRange);
 }
 
-void WorldObject::GetDeadCreatureListInGrid(
-    std::list<Creature*>& creaturedeadList,
-    float                 maxSearchRange,
-    bool                  alive /*= false*/) const
+template <class Container>
+void WorldObject::GetDeadCreatureListInGrid(Container& creatureContainer,
+                                            float      maxSearchRange,
+                                            bool alive /*= false*/) const
 {
     Acore::AllDeadCreaturesInRange check(this, maxSearchRange, alive);
     Acore::CreatureListSearcher<Acore::AllDeadCreaturesInRange> searcher(
-        this, creaturedeadList, check);
+        this, creatureContainer, check);
     Cell::VisitGridObjects(this, searcher, maxSearchRange);
 }
 
+template void WorldObject::GetGameObjectListWithEntryInGrid(
+    std::list<GameObject*>&, uint32, float) const;
+template void WorldObject::GetGameObjectListWithEntryInGrid(
+    std::vector<GameObject*>&, uint32, float) const;
+template void WorldObject::GetCreatureListWithEntryInGrid(
+    std::list<Creature*>&, uint32, float) const;
+template void WorldObject::GetCreatureListWithEntryInGrid(
+    std::vector<Creature*>&, uint32, float) const;
+template void WorldObject::GetDeadCreatureListInGrid(std::list<Creature*>&,
+                                                     float,
+                                                     bool) const;
+template void WorldObject::GetDeadCreatureListInGrid(std::vector<Creature*>&,
+                                                     float,
+                                                     bool) const;
+
 /*
 namespace Acore
 {
@@ -3271,6 +3303,8 @@ void WorldObject::DestroyForNearbyPlayers()
 
         DestroyForPlayer(player);
         player->m_clientGUIDs.erase(GetGUID());
+        if (Unit* unit = ToUnit())
+            unit->RemoveObserver(player->GetGUID());
     }
 }
 
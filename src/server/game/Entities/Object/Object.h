@@ -849,15 +849,20 @@ public:
                                                           float range) const;
 
     [[nodiscard]] Player* SelectNearestPlayer(float distance = 0) const;
-    void GetGameObjectListWithEntryInGrid(std::list<GameObject*>& lList,
-                                          uint32                  uiEntry,
-                                          float fMaxSearchRange) const;
-    void GetCreatureListWithEntryInGrid(std::list<Creature*>& lList,
-                                        uint32                uiEntry,
-                                        float fMaxSearchRange) const;
-    void GetDeadCreatureListInGrid(std::list<Creature*>& lList,
-                                   float                 maxSearchRange,
-                                   bool                  alive = false) const;
+    // instantiated for std::list and std::vector, a reused vector avoids
+    // allocating a node per found object
+    template <class Container>
+    void GetGameObjectListWithEntryInGrid(Container& gameobjectContainer,
+                                          uint32     entry,
+                                          float      maxSearchRange) const;
+    template <class Container>
+    void GetCreatureListWithEntryInGrid(Container& creatureContainer,
+                                        uint32     entry,
+                                        float      maxSearchRange) const;
+    template <class Container>
+    void GetDeadCreatureListInGrid(Container& creatureContainer,
+                                   float      maxSearchRange,
+                                   bool       alive = false) const;
 
     void         DestroyForNearbyPlayers();
     virtual void UpdateObjectVisibility(bool forced     = true,
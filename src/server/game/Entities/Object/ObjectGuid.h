@@ -21,6 +21,8 @@
 
 #include "ByteBuffer.h"
 #include "Define.h"
+#include <array>
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <list>
@@ -77,32 +79,39 @@ struct ObjectGuidTraits {
     static bool const MapSpecific = false;
 };
 
-#define GUID_TRAIT_GLOBAL(highguid)                                            \
+#define GUID_TRAIT_GLOBAL(highguid, slot)                                      \
     template <>                                                                \
     struct ObjectGuidTraits<highguid> {                                        \
-        static bool const Global      = true;                                  \
-        static bool const MapSpecific = false;                                 \
+        static bool const        Global        = true;                         \
+        static bool const        MapSpecific   = false;                        \
+        static std::size_t const GeneratorSlot = slot;                         \
     };
 
-#define GUID_TRAIT_MAP_SPECIFIC(highguid)                                      \
+#define GUID_TRAIT_MAP_SPECIFIC(highguid, slot)                                \
     template <>                                                                \
     struct ObjectGuidTraits<highguid> {                                        \
-        static bool const Global      = false;                                 \
-        static bool const MapSpecific = true;                                  \
+        static bool const        Global        = false;                        \
+        static bool const        MapSpecific   = true;                         \
+        static std::size_t const GeneratorSlot = slot;                         \
     };
 
-GUID_TRAIT_GLOBAL(HighGuid::Player)
-GUID_TRAIT_GLOBAL(HighGuid::Item)
-GUID_TRAIT_GLOBAL(HighGuid::Mo_Transport)
-GUID_TRAIT_GLOBAL(HighGuid::Group)
-GUID_TRAIT_GLOBAL(HighGuid::Instance)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::Transport)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::Unit)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::Vehicle)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::Pet)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::GameObject)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::DynamicObject)
-GUID_TRAIT_MAP_SPECIFIC(HighGuid::Corpse)
+// GeneratorSlot indexes the guid generator arrays of ObjectMgr (global) and
+// Map (map specific)
+GUID_TRAIT_GLOBAL(HighGuid::Player, 0)
+GUID_TRAIT_GLOBAL(HighGuid::Item, 1)
+GUID_TRAIT_GLOBAL(HighGuid::Mo_Transport, 2)
+GUID_TRAIT_GLOBAL(HighGuid::Group, 3)
+GUID_TRAIT_GLOBAL(HighGuid::Instance, 4)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::Transport, 0)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::Unit, 1)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::Vehicle, 2)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::Pet, 3)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::GameObject, 4)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::DynamicObject, 5)
+GUID_TRAIT_MAP_SPECIFIC(HighGuid::Corpse, 6)
+
+#define MAX_GLOBAL_GUID_GENERATORS 5
+#define MAX_MAP_GUID_GENERATORS    7
 
 class ObjectGuid;
 class PackedGuid;
@@ -389,17 +398,21 @@ class ObjectGuidGeneratorBase {
 public:
     ObjectGuidGeneratorBase(ObjectGuid::LowType start = 1) : _nextGuid(start) {}
 
-    virtual void Set(ObjectGuid::LowType val) { _nextGuid = val; }
+    virtual void Set(ObjectGuid::LowType val) { _nextGuid.store(val); }
     virtual ObjectGuid::LowType       Generate() = 0;
     [[nodiscard]] ObjectGuid::LowType GetNextAfterMaxUsed() const
     {
-        return _nextGuid;
+        return _nextGuid.load();
     }
+    // global generators only, every thread reserves guids in blocks of this
+    // size and hands them out without touching the shared counter
+    void SetLeaseSize(uint32 size) { _leaseSize = size; }
     virtual ~ObjectGuidGeneratorBase() = default;
 
 protected:
-    static void         HandleCounterOverflow(HighGuid high);
-    ObjectGuid::LowType _nextGuid;
+    static void                      HandleCounterOverflow(HighGuid high);
+    std::atomic<ObjectGuid::LowType> _nextGuid;
+    uint32                           _leaseSize{0};
 };
 
 template <HighGuid high>
@@ -412,13 +425,47 @@ public:
 
     ObjectGuid::LowType Generate() override
     {
-        if (_nextGuid >= ObjectGuid::GetMaxCounter(high) - 1)
+        if constexpr (ObjectGuidTraits<high>::Global)
+            if (_leaseSize > 1)
+                return GenerateLeased();
+
+        return Reserve(1);
+    }
+
+private:
+    ObjectGuid::LowType Reserve(uint32 count)
+    {
+        ObjectGuid::LowType guid =
+            _nextGuid.fetch_add(count, std::memory_order_relaxed);
+        if (guid >= ObjectGuid::GetMaxCounter(high) - count)
             HandleCounterOverflow(high);
 
-        return _nextGuid++;
+        return guid;
+    }
+
+    // there is a single generator per global guid type, so the block of the
+    // calling thread can live in a thread_local of this instantiation
+    ObjectGuid::LowType GenerateLeased()
+    {
+        static thread_local ObjectGuid::LowType next = 0;
+        static thread_local ObjectGuid::LowType end  = 0;
+        if (next == end) {
+            next = Reserve(_leaseSize);
+            end  = next + _leaseSize;
+        }
+
+        return next++;
     }
 };
 
+template <HighGuid high, std::size_t N>
+void CreateGuidGenerator(
+    std::array<std::unique_ptr<ObjectGuidGeneratorBase>, N>& generators)
+{
+    generators[ObjectGuidTraits<high>::GeneratorSlot] =
+        std::make_unique<ObjectGuidGenerator<high>>();
+}
+
 ByteBuffer& operator<<(ByteBuffer& buf, ObjectGuid const& guid);
 ByteBuffer& operator>>(ByteBuffer& buf, ObjectGuid& guid);
 
@@ -37,6 +37,12 @@ void UpdateData::AddUpdateBlock(const ByteBuffer& block)
     ++m_blockCount;
 }
 
+ByteBuffer& UpdateData::StartUpdateBlock()
+{
+    ++m_blockCount;
+    return m_data;
+}
+
 void UpdateData::AddUpdateBlock(const UpdateData& block)
 {
     m_data.append(block.m_data);
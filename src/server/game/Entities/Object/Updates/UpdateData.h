@@ -54,6 +54,8 @@ public:
     void               AddOutOfRangeGUID(ObjectGuid guid);
     void               AddUpdateBlock(const ByteBuffer& block);
     void               AddUpdateBlock(const UpdateData& block);
+    // Counts a new block and returns the buffer to write it into directly
+    ByteBuffer&        StartUpdateBlock();
     bool               BuildPacket(WorldPacket& packet);
     [[nodiscard]] bool HasData() const
     {
@@ -1581,3 +1581,16 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] = {
     UF_FLAG_DYNAMIC, // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,    // CORPSE_FIELD_PAD
 };
+
+uint32 UnitUpdateFieldBlockFlags[UNIT_UPDATE_FIELD_BLOCKS];
+
+namespace {
+struct UnitUpdateFieldBlockFlagsInitializer {
+    UnitUpdateFieldBlockFlagsInitializer()
+    {
+        for (uint32 index = 0; index < PLAYER_END; ++index)
+            UnitUpdateFieldBlockFlags[index / 32] |=
+                UnitUpdateFieldFlags[index];
+    }
+} unitUpdateFieldBlockFlagsInitializer;
+} // namespace
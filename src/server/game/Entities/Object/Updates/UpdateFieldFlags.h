@@ -41,4 +41,9 @@ extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+// all flags of the unit fields sharing one 32 bit block of the update mask,
+// lets values updates skip unchanged blocks without looking at every field
+#define UNIT_UPDATE_FIELD_BLOCKS ((PLAYER_END + 31) / 32)
+extern uint32 UnitUpdateFieldBlockFlags[UNIT_UPDATE_FIELD_BLOCKS];
+
 #endif // _UPDATEFIELDFLAGS_H
@@ -37,25 +37,43 @@ public:
     UpdateMask(UpdateMask const& right)
     {
         SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+        memcpy(_blocks,
+               right._blocks,
+               sizeof(ClientUpdateMaskType) * _blockCount);
     }
 
-    ~UpdateMask() { delete[] _bits; }
+    ~UpdateMask() { delete[] _blocks; }
 
-    void               SetBit(uint32 index) { _bits[index] = 1; }
-    void               UnsetBit(uint32 index) { _bits[index] = 0; }
-    [[nodiscard]] bool GetBit(uint32 index) const { return _bits[index] != 0; }
+    void SetBit(uint32 index)
+    {
+        _blocks[index / CLIENT_UPDATE_MASK_BITS] |=
+            ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS);
+    }
+    void UnsetBit(uint32 index)
+    {
+        _blocks[index / CLIENT_UPDATE_MASK_BITS] &=
+            ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS));
+    }
+    [[nodiscard]] bool GetBit(uint32 index) const
+    {
+        return (_blocks[index / CLIENT_UPDATE_MASK_BITS] >>
+                (index % CLIENT_UPDATE_MASK_BITS)) &
+               1;
+    }
+
+    /// Bits of CLIENT_UPDATE_MASK_BITS consecutive fields, so callers can
+    /// skip blocks without any set bit in one test
+    [[nodiscard]] ClientUpdateMaskType GetBlock(uint32 block) const
+    {
+        return _blocks[block];
+    }
 
     void AppendToPacket(ByteBuffer* data)
     {
-        for (uint32 i = 0; i < GetBlockCount(); ++i) {
-            ClientUpdateMaskType maskPart = 0;
-            for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                    maskPart |= 1 << j;
-
-            *data << maskPart;
-        }
+        ByteBuffer::Writer writer(
+            *data, GetBlockCount() * sizeof(ClientUpdateMaskType));
+        for (uint32 i = 0; i < GetBlockCount(); ++i)
+            writer << _blocks[i];
     }
 
     [[nodiscard]] uint32 GetBlockCount() const { return _blockCount; }
@@ -63,22 +81,19 @@ public:
 
     void SetCount(uint32 valuesCount)
     {
-        delete[] _bits;
+        delete[] _blocks;
 
         _fieldCount = valuesCount;
         _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) /
                       CLIENT_UPDATE_MASK_BITS;
 
-        _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-        memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        _blocks = new ClientUpdateMaskType[_blockCount]();
     }
 
     void Clear()
     {
-        if (_bits)
-            memset(_bits,
-                   0,
-                   sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        if (_blocks)
+            memset(_blocks, 0, sizeof(ClientUpdateMaskType) * _blockCount);
     }
 
     UpdateMask& operator=(UpdateMask const& right)
@@ -87,17 +102,17 @@ public:
             return *this;
 
         SetCount(right.GetCount());
-        memcpy(_bits,
-               right._bits,
-               sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        memcpy(_blocks,
+               right._blocks,
+               sizeof(ClientUpdateMaskType) * _blockCount);
         return *this;
     }
 
     UpdateMask& operator&=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] &= right._bits[i];
+        for (uint32 i = 0; i < _blockCount; ++i)
+            _blocks[i] &= i < right._blockCount ? right._blocks[i] : 0;
 
         return *this;
     }
@@ -105,8 +120,8 @@ public:
     UpdateMask& operator|=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] |= right._bits[i];
+        for (uint32 i = 0; i < right._blockCount; ++i)
+            _blocks[i] |= right._blocks[i];
 
         return *this;
     }
@@ -119,9 +134,9 @@ public:
     }
 
 private:
-    uint32 _fieldCount{0};
-    uint32 _blockCount{0};
-    uint8* _bits{nullptr};
+    uint32                _fieldCount{0};
+    uint32                _blockCount{0};
+    ClientUpdateMaskType* _blocks{nullptr};
 };
 
 #endif
@@ -556,6 +556,13 @@ bool Pet::LoadPetFromDB(Player* owner,
 }
 
 void Pet::SavePetToDB(PetSaveMode mode)
+{
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    SavePetToDB(mode, trans);
+    CharacterDatabase.CommitTransaction(trans);
+}
+
+void Pet::SavePetToDB(PetSaveMode mode, CharacterDatabaseTransaction trans)
 {
     // not save not player pets
     if (!GetOwnerGUID().IsPlayer())
@@ -583,7 +590,6 @@ void Pet::SavePetToDB(PetSaveMode mode)
     uint32 curhealth = GetHealth();
     uint32 curmana   = GetPower(POWER_MANA);
 
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     // save auras before possibly removing them
     _SaveAuras(trans);
 
@@ -593,12 +599,10 @@ void Pet::SavePetToDB(PetSaveMode mode)
 
     _SaveSpells(trans);
     _SaveSpellCooldowns(trans);
-    CharacterDatabase.CommitTransaction(trans);
 
     // current/stable/not_in_slot
     if (mode >= PET_SAVE_AS_CURRENT) {
         ObjectGuid::LowType ownerLowGUID = GetOwnerGUID().GetCounter();
-        trans                            = CharacterDatabase.BeginTransaction();
         // remove current data
 
         CharacterDatabasePreparedStatement* stmt =
@@ -650,19 +654,24 @@ void Pet::SavePetToDB(PetSaveMode mode)
         stmt->SetData(16, actionBar);
 
         trans->Append(stmt);
-        CharacterDatabase.CommitTransaction(trans);
     }
     // delete
     else {
         RemoveAllAuras();
-        DeleteFromDB(m_charmInfo->GetPetNumber());
+        DeleteFromDB(m_charmInfo->GetPetNumber(), trans);
     }
 }
 
 void Pet::DeleteFromDB(ObjectGuid::LowType guidlow)
 {
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    DeleteFromDB(guidlow, trans);
+    CharacterDatabase.CommitTransaction(trans);
+}
 
+void Pet::DeleteFromDB(ObjectGuid::LowType          guidlow,
+                       CharacterDatabaseTransaction trans)
+{
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_PET_BY_ID);
     stmt->SetData(0, guidlow);
@@ -684,8 +693,6 @@ void Pet::DeleteFromDB(ObjectGuid::LowType guidlow)
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PET_SPELL_COOLDOWNS);
     stmt->SetData(0, guidlow);
     trans->Append(stmt);
-
-    CharacterDatabase.CommitTransaction(trans);
 }
 
 void Pet::setDeathState(
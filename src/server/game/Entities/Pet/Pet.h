@@ -80,9 +80,13 @@ public:
                               uint32  healthPct = 0);
     bool        isBeingLoaded() const override { return m_loading; }
     void        SavePetToDB(PetSaveMode mode);
+    void        SavePetToDB(PetSaveMode                  mode,
+                            CharacterDatabaseTransaction trans);
     void        FillPetInfo(PetStable::PetInfo* petInfo) const;
     void        Remove(PetSaveMode mode, bool returnreagent = false);
     static void DeleteFromDB(ObjectGuid::LowType guidlow);
+    static void DeleteFromDB(ObjectGuid::LowType          guidlow,
+                             CharacterDatabaseTransaction trans);
 
     void setDeathState(DeathState s, bool despawn = false)
         override; // overwrite virtual Creature::setDeathState and
@@ -199,6 +199,7 @@ Player::Player(WorldSession* session) : Unit(true), m_mover(this)
     // group is initialized in the reference constructor
     SetGroupInvite(nullptr);
     m_groupUpdateMask    = 0;
+    m_groupUpdateThrottleTime.fill(0);
     m_auraRaidUpdateMask = 0;
     m_bPassOnGroupLoot   = false;
 
@@ -272,6 +273,7 @@ Player::Player(WorldSession* session) : Unit(true), m_mover(this)
     ////////////////////Rest System/////////////////////
 
     m_mailsUpdated         = false;
+    m_mailsLoaded          = false;
     unReadMails            = 0;
     m_nextMailDelivereTime = time_t(0);
 
@@ -418,11 +420,6 @@ Player::~Player()
     for (uint8 i = 0; i < PLAYER_SLOTS_COUNT; ++i)
         delete m_items[i];
 
-    for (PlayerSpellMap::const_iterator itr = m_spells.begin();
-         itr != m_spells.end();
-         ++itr)
-        delete itr->second;
-
     for (PlayerTalentMap::const_iterator itr = m_talents.begin();
          itr != m_talents.end();
          ++itr)
@@ -2930,9 +2927,12 @@ void Player::SendInitialSpells()
 
     uint16 spellCount = 0;
 
+    // every spell, glyph and talent takes an id and a slot
     WorldPacket data(SMSG_INITIAL_SPELLS,
-                     (1 + 2 + 4 * m_spells.size() + 2 +
-                      m_spellCooldowns.size() * (4 + 2 + 2 + 4 + 4)));
+                     (1 + 2 +
+                      (4 + 2) * (m_spells.size() + MAX_GLYPH_SLOT_INDEX +
+                                 m_talents.size()) +
+                      2 + m_spellCooldowns.size() * (4 + 2 + 2 + 4 + 4)));
     data << uint8(0);
 
     size_t countPos = data.wpos();
@@ -2941,10 +2941,10 @@ void Player::SendInitialSpells()
     for (PlayerSpellMap::const_iterator itr = m_spells.begin();
          itr != m_spells.end();
          ++itr) {
-        if (itr->second->State == PLAYERSPELL_REMOVED)
+        if (itr->second.State == PLAYERSPELL_REMOVED)
             continue;
 
-        if (!itr->second->Active || !itr->second->IsInSpec(GetActiveSpec()))
+        if (!itr->second.Active || !itr->second.IsInSpec(GetActiveSpec()))
             continue;
 
         data << uint32(itr->first);
@@ -3020,7 +3020,9 @@ void Player::SendInitialSpells()
                                             : 0); // category cooldown
     }
 
-    GetSession()->SendPacket(&data);
+    // handed to the socket as it is instead of being copied
+    GetSession()->SendPacket(
+        std::make_shared<WorldPacket const>(std::move(data)));
 }
 
 void Player::RemoveMail(uint32 id)
@@ -3254,10 +3256,10 @@ bool Player::addSpell(uint32 spellId,
         while (nextSpellInfo) {
             PlayerSpellMap::iterator itr = m_spells.find(nextSpellInfo->Id);
             if (itr != m_spells.end() &&
-                itr->second->State != PLAYERSPELL_REMOVED &&
-                itr->second->Active) {
+                itr->second.State != PLAYERSPELL_REMOVED &&
+                itr->second.Active) {
                 if (nextSpellInfo->GetRank() < spellInfo->GetRank()) {
-                    itr->second->Active = false;
+                    itr->second.Active = false;
                     if (IsInWorld()) {
                         WorldPacket data(SMSG_SUPERCEDED_SPELL, 4 + 4);
                         data << uint32(nextSpellInfo->Id);
@@ -3270,7 +3272,7 @@ bool Player::addSpell(uint32 spellId,
                     PlayerSpellMap::iterator itr2 =
                         m_spells.find(spellInfo->Id);
                     if (itr2 != m_spells.end())
-                        itr2->second->Active = false;
+                        itr2->second.Active = false;
                     return false;
                 }
             }
@@ -3295,7 +3297,7 @@ bool Player::_addSpell(uint32 spellId,
 
     // pussywizard: already found and temporary, nothing to do
     PlayerSpellMap::iterator itr = m_spells.find(spellId);
-    if (itr != m_spells.end() && itr->second->State == PLAYERSPELL_TEMPORARY)
+    if (itr != m_spells.end() && itr->second.State == PLAYERSPELL_TEMPORARY)
         return false;
 
     // xinef: send packet so client can properly recognize this new spell
@@ -3335,8 +3337,8 @@ bool Player::_addSpell(uint32 spellId,
                                // update information
     {
         // pussywizard: do nothing if already set as wanted
-        if (itr->second->State != PLAYERSPELL_REMOVED &&
-            (itr->second->specMask & addSpecMask) == addSpecMask)
+        if (itr->second.State != PLAYERSPELL_REMOVED &&
+            (itr->second.specMask & addSpecMask) == addSpecMask)
             return false;
 
         // pussywizard: need cast auras, learn linked spells, do professions
@@ -3346,28 +3348,28 @@ bool Player::_addSpell(uint32 spellId,
 
         // pussywizard: present in m_spells, not removed, already in current
         // spec, already active
-        if (itr->second->State != PLAYERSPELL_REMOVED &&
-            itr->second->IsInSpec(m_activeSpec))
+        if (itr->second.State != PLAYERSPELL_REMOVED &&
+            itr->second.IsInSpec(m_activeSpec))
             spellIsNew = false;
 
         // pussywizard: update info in m_spells
-        if (itr->second->State != PLAYERSPELL_NEW &&
-            (itr->second->specMask & addSpecMask) != addSpecMask)
-            itr->second->State = PLAYERSPELL_CHANGED;
-        itr->second->Active = true;
-        itr->second->specMask |= addSpecMask;
+        if (itr->second.State != PLAYERSPELL_NEW &&
+            (itr->second.specMask & addSpecMask) != addSpecMask)
+            itr->second.State = PLAYERSPELL_CHANGED;
+        itr->second.Active = true;
+        itr->second.specMask |= addSpecMask;
 
         if (!spellIsNew)
             return true;
     }
     else // pussywizard: not found in m_spells
     {
-        PlayerSpell* newspell = new PlayerSpell;
-        newspell->Active      = true;
-        newspell->State       = temporary ? PLAYERSPELL_TEMPORARY
-                                          : (isBeingLoaded() ? PLAYERSPELL_UNCHANGED
-                                                             : PLAYERSPELL_NEW);
-        newspell->specMask    = addSpecMask;
+        PlayerSpell newspell;
+        newspell.Active   = true;
+        newspell.State    = temporary ? PLAYERSPELL_TEMPORARY
+                                      : (isBeingLoaded() ? PLAYERSPELL_UNCHANGED
+                                                         : PLAYERSPELL_NEW);
+        newspell.specMask = addSpecMask;
 
         m_spells[spellId] = newspell;
     }
@@ -3384,7 +3386,7 @@ bool Player::_addSpell(uint32 spellId,
                  "TRYING TO LEARN SPELL WITH EFFECT LEARN 2: {}, PLAYER: {}",
                  spellId,
                  GetGUID().ToString());
-        m_spells.erase(spellInfo->Id); // mem leak, but should never happen
+        m_spells.erase(spellInfo->Id);
         return false;
         // ABORT();
     }
@@ -3558,8 +3560,8 @@ void Player::learnSpell(uint32 spellId,
         // (otherwise no need to learn already learnt)
         PlayerSpellMap::iterator itr = m_spells.find(nextSpell);
         if (itr != m_spells.end() &&
-            itr->second->State != PLAYERSPELL_REMOVED &&
-            !itr->second->IsInSpec(m_activeSpec))
+            itr->second.State != PLAYERSPELL_REMOVED &&
+            !itr->second.IsInSpec(m_activeSpec))
             learnSpell(nextSpell, temporary);
     }
 
@@ -3573,8 +3575,8 @@ void Player::learnSpell(uint32 spellId,
          ++itr) {
         PlayerSpellMap::iterator itr2 = m_spells.find(itr->second);
         if (itr2 != m_spells.end() &&
-            itr2->second->State != PLAYERSPELL_REMOVED &&
-            !itr2->second->IsInSpec(m_activeSpec))
+            itr2->second.State != PLAYERSPELL_REMOVED &&
+            !itr2->second.IsInSpec(m_activeSpec))
             learnSpell(itr2->first, temporary);
     }
 }
@@ -3589,12 +3591,12 @@ void Player::removeSpell(uint32 spell_id,
 
     // pussywizard: nothing to do if already removed or not in specs of
     // removeSpecMask
-    if (itr->second->State == PLAYERSPELL_REMOVED ||
-        (itr->second->specMask & removeSpecMask) == 0)
+    if (itr->second.State == PLAYERSPELL_REMOVED ||
+        (itr->second.specMask & removeSpecMask) == 0)
         return;
 
     // pussywizard: avoid any possible bugs
-    if (onlyTemporary && itr->second->State != PLAYERSPELL_TEMPORARY)
+    if (onlyTemporary && itr->second.State != PLAYERSPELL_TEMPORARY)
         return;
 
     // pussywizard: remove non-talent higher ranks (recursive)
@@ -3621,8 +3623,8 @@ void Player::removeSpell(uint32 spell_id,
     if (itr == m_spells.end())
         return;
 
-    itr->second->specMask =
-        (((uint8)itr->second->specMask) &
+    itr->second.specMask =
+        (((uint8)itr->second.specMask) &
          ~removeSpecMask); // pussywizard: update specMask in map
 
     // pussywizard: some more conditions needed for spells like pyroblast
@@ -3630,18 +3632,16 @@ void Player::removeSpell(uint32 spell_id,
     // in db with specMask = 0)
     if (GetTalentSpellCost(firstRankSpellId) == 0 &&
         !sSpellMgr->IsAdditionalTalentSpell(firstRankSpellId) &&
-        itr->second->specMask == 0) {
-        if (itr->second->State == PLAYERSPELL_NEW ||
-            itr->second->State == PLAYERSPELL_TEMPORARY) {
-            delete itr->second;
+        itr->second.specMask == 0) {
+        if (itr->second.State == PLAYERSPELL_NEW ||
+            itr->second.State == PLAYERSPELL_TEMPORARY)
             m_spells.erase(itr);
-        }
         else
-            itr->second->State = PLAYERSPELL_REMOVED;
+            itr->second.State = PLAYERSPELL_REMOVED;
     }
-    else if (itr->second->State != PLAYERSPELL_NEW &&
-             itr->second->State != PLAYERSPELL_TEMPORARY)
-        itr->second->State = PLAYERSPELL_CHANGED;
+    else if (itr->second.State != PLAYERSPELL_NEW &&
+             itr->second.State != PLAYERSPELL_TEMPORARY)
+        itr->second.State = PLAYERSPELL_CHANGED;
 
     // xinef: this is used for talents and they are not removed in removeSpell
     // function... xinef: however ill leave this here just in case pussywizard:
@@ -3769,7 +3769,7 @@ bool Player::Has310Flyer(bool checkAllSpells, uint32 excludeSpellId)
              itr != m_spells.end();
              ++itr) {
             // pussywizard:
-            if (itr->second->State == PLAYERSPELL_REMOVED)
+            if (itr->second.State == PLAYERSPELL_REMOVED)
                 continue;
 
             if (itr->first == excludeSpellId)
@@ -3824,19 +3824,18 @@ void Player::RemoveArenaSpellCooldowns(bool removeActivePetCooldowns)
     // remove cooldowns on spells that have < 10 min CD
     uint32 infTime =
         GameTime::GetGameTimeMS().count() + infinityCooldownDelayCheck;
-    SpellCooldowns::iterator itr, next;
-    for (itr = m_spellCooldowns.begin(); itr != m_spellCooldowns.end();
-         itr = next) {
-        next = itr;
-        ++next;
+    for (SpellCooldowns::iterator itr = m_spellCooldowns.begin();
+         itr != m_spellCooldowns.end();) {
         SpellInfo const* spellInfo = sSpellMgr->CheckSpellInfo(itr->first);
         if (!spellInfo) {
+            ++itr;
             continue;
         }
 
+        bool remove = false;
         if (spellInfo->HasAttribute(
                 SPELL_ATTR4_IGNORE_DEFAULT_ARENA_RESTRICTIONS))
-            RemoveSpellCooldown(itr->first, true);
+            remove = true;
         else if (spellInfo->RecoveryTime < 10 * MINUTE * IN_MILLISECONDS &&
                  spellInfo->CategoryRecoveryTime <
                      10 * MINUTE * IN_MILLISECONDS &&
@@ -3848,7 +3847,14 @@ void Player::RemoveArenaSpellCooldowns(bool removeActivePetCooldowns)
                                              // have maxduration > 10 minutes
                                              // (eg item cooldowns with no
                                              // spell.dbc cooldown info)
-            RemoveSpellCooldown(itr->first, true);
+            remove = true;
+
+        if (remove) {
+            SendClearCooldown(itr->first, this);
+            itr = m_spellCooldowns.erase(itr);
+        }
+        else
+            ++itr;
     }
 
     // pet cooldowns
@@ -3936,7 +3942,7 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans,
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
     stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    std::vector<CharacterDatabasePreparedStatement*> statements{stmt};
 
     time_t curTime   = GameTime::GetGameTime().count();
     uint32 curMSTime = GameTime::GetGameTimeMS().count();
@@ -3955,7 +3961,7 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans,
         }
 
         if (itr->second.end <= curMSTime + 1000)
-            m_spellCooldowns.erase(itr++);
+            itr = m_spellCooldowns.erase(itr);
         else if (itr->second.end <= infTime &&
                  (logout ||
                   itr->second.end >
@@ -3984,9 +3990,12 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans,
         else
             ++itr;
     }
-    // if something changed execute
-    if (!first_round)
-        trans->Append(ss.str().c_str());
+    // cooldowns are saved as absolute times, so they only change when a
+    // cooldown was started or has expired
+    AppendSaveStatements(trans,
+                         PLAYER_SAVE_SPELL_COOLDOWNS,
+                         statements,
+                         first_round ? std::string() : ss.str());
 }
 
 uint32 Player::resetTalentsCost() const
@@ -4198,8 +4207,8 @@ bool Player::HasSpell(uint32 spell) const
 {
     PlayerSpellMap::const_iterator itr = m_spells.find(spell);
     return (itr != m_spells.end() &&
-            itr->second->State != PLAYERSPELL_REMOVED &&
-            itr->second->IsInSpec(m_activeSpec));
+            itr->second.State != PLAYERSPELL_REMOVED &&
+            itr->second.IsInSpec(m_activeSpec));
 }
 
 bool Player::HasTalent(uint32 spell, uint8 /*spec*/) const
@@ -4214,8 +4223,8 @@ bool Player::HasActiveSpell(uint32 spell) const
 {
     PlayerSpellMap::const_iterator itr = m_spells.find(spell);
     return (itr != m_spells.end() &&
-            itr->second->State != PLAYERSPELL_REMOVED && itr->second->Active &&
-            itr->second->IsInSpec(m_activeSpec));
+            itr->second.State != PLAYERSPELL_REMOVED && itr->second.Active &&
+            itr->second.IsInSpec(m_activeSpec));
 }
 
 TrainerSpellState
@@ -4445,7 +4454,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid,
         if (resultPets) {
             do {
                 ObjectGuid::LowType petguidlow = (*resultPets)[0].Get<uint32>();
-                Pet::DeleteFromDB(petguidlow);
+                Pet::DeleteFromDB(petguidlow, trans);
             } while (resultPets->NextRow());
         }
 
@@ -6174,6 +6183,12 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(
+    std::shared_ptr<WorldPacket const> const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId) const
 {
     WorldPacket data(SMSG_TRIGGER_CINEMATIC, 4);
@@ -7119,6 +7134,12 @@ void Player::_ApplyItemMods(Item* item, uint8 slot, bool apply)
               "applying mods for item {} ",
               item->GetGUID().ToString());
 
+    // apply the whole item as one batch like _ApplyAllStatBonuses does,
+    // instead of recalculating the dependent stats for each item stat
+    bool const batchStats = CanModifyStats();
+    if (batchStats)
+        SetCanModifyStats(false);
+
     uint8 attacktype = Player::GetAttackBySlot(slot);
 
     if (item->HasSocket()) // only (un)equipping of items with sockets can
@@ -7138,6 +7159,11 @@ void Player::_ApplyItemMods(Item* item, uint8 slot, bool apply)
     ApplyItemEquipSpell(item, apply);
     ApplyEnchantment(item, apply);
 
+    if (batchStats) {
+        SetCanModifyStats(true);
+        UpdateAllStats();
+    }
+
     LOG_DEBUG("entities.player.items", "_ApplyItemMods complete.");
 }
 
@@ -8275,6 +8301,10 @@ void Player::_ApplyAllItemMods()
 
 void Player::_ApplyAllLevelScaleItemMods(bool apply)
 {
+    bool const batchStats = CanModifyStats();
+    if (batchStats)
+        SetCanModifyStats(false);
+
     for (uint8 i = 0; i < INVENTORY_SLOT_BAG_END; ++i) {
         if (m_items[i]) {
             if (m_items[i]->IsBroken() || !CanUseAttackType(GetAttackBySlot(i)))
@@ -8287,6 +8317,11 @@ void Player::_ApplyAllLevelScaleItemMods(bool apply)
             _ApplyItemMods(m_items[i], i, apply);
         }
     }
+
+    if (batchStats) {
+        SetCanModifyStats(true);
+        UpdateAllStats();
+    }
 }
 
 void Player::_ApplyAmmoBonuses()
@@ -10565,8 +10600,9 @@ void Player::VehicleSpellInitialize()
             continue;
         }
 
-        ConditionList conditions = sConditionMgr->GetConditionsForVehicleSpell(
-            vehicle->GetEntry(), spellId);
+        ConditionList const& conditions =
+            sConditionMgr->GetConditionsForVehicleSpell(
+                vehicle->GetEntry(), spellId);
         if (!sConditionMgr->IsObjectMeetToConditions(
                 this, vehicle, conditions)) {
             LOG_DEBUG("condition",
@@ -11557,7 +11593,7 @@ void Player::ProhibitSpellSchool(SpellSchoolMask idSchoolMask, uint32 unTimeMs)
     for (PlayerSpellMap::const_iterator itr = m_spells.begin();
          itr != m_spells.end();
          ++itr) {
-        if (itr->second->State == PLAYERSPELL_REMOVED)
+        if (itr->second.State == PLAYERSPELL_REMOVED)
             continue;
         uint32           unSpellId = itr->first;
         SpellInfo const* spellInfo = sSpellMgr->AssertSpellInfo(unSpellId);
@@ -11808,8 +11844,9 @@ bool Player::BuyItemFromVendorSlot(ObjectGuid vendorguid,
         return false;
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(
-        creature->GetEntry(), item);
+    ConditionList const& conditions =
+        sConditionMgr->GetConditionsForNpcVendorEvent(
+            creature->GetEntry(), item);
     if (!sConditionMgr->IsObjectMeetToConditions(this, creature, conditions)) {
         // LOG_DEBUG("condition", "BuyItemFromVendor: conditions not met for
         // creature entry {} item {}", creature->GetEntry(), item);
@@ -12856,13 +12893,46 @@ void Player::SendUpdateToOutOfRangeGroupMembers()
 {
     if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
         return;
+
+    static constexpr WorldIntConfigs throttleIntervals[] = {
+        CONFIG_GROUP_STATS_HEALTH_INTERVAL,
+        CONFIG_GROUP_STATS_POSITION_INTERVAL,
+        CONFIG_GROUP_STATS_AURAS_INTERVAL};
+    static_assert(std::size(throttleIntervals) == MAX_GROUP_UPDATE_THROTTLES);
+    static_assert(std::tuple_size_v<decltype(m_groupUpdateThrottleTime)> ==
+                  MAX_GROUP_UPDATE_THROTTLES);
+
+    // hold back throttled fields until their interval passed, the changes of
+    // all updates in between go out in one packet
+    uint32 const now  = getMSTime();
+    uint32       held = GROUP_UPDATE_FLAG_NONE;
+    for (uint8 i = 0; i < MAX_GROUP_UPDATE_THROTTLES; ++i) {
+        uint32 const flags = m_groupUpdateMask & GroupUpdateThrottleFlags[i];
+        if (!flags)
+            continue;
+
+        if (getMSTimeDiff(m_groupUpdateThrottleTime[i], now) <
+            sWorld->getIntConfig(throttleIntervals[i]))
+            held |= flags;
+        else
+            m_groupUpdateThrottleTime[i] = now;
+    }
+
+    m_groupUpdateMask &= ~held;
+    if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE) {
+        m_groupUpdateMask = held;
+        return;
+    }
+
     if (Group* group = GetGroup())
         group->UpdatePlayerOutOfRange(this);
 
-    m_groupUpdateMask    = GROUP_UPDATE_FLAG_NONE;
-    m_auraRaidUpdateMask = 0;
-    if (Pet* pet = GetPet())
-        pet->ResetAuraUpdateMaskForRaid();
+    m_groupUpdateMask = held;
+    if (!(held & GROUP_UPDATE_FLAG_AURAS))
+        m_auraRaidUpdateMask = 0;
+    if (!(held & GROUP_UPDATE_FLAG_PET_AURAS))
+        if (Pet* pet = GetPet())
+            pet->ResetAuraUpdateMaskForRaid();
 }
 
 void Player::SendTransferAborted(uint32              mapid,
@@ -14941,7 +15011,8 @@ Player::StoreLootItem(uint8 lootSlot, Loot* loot, InventoryResult& msg)
                                                    item->itemid,
                                                    item->count,
                                                    loot,
-                                                   item->itemIndex);
+                                                   item->itemIndex,
+                                                   this);
 
         sScriptMgr->OnLootItem(this, newitem, item->count, this->GetLootGUID());
     }
@@ -15669,8 +15740,9 @@ bool Player::CanSeeSpellClickOn(Creature const* c) const
         if (!itr->second.IsFitToRequirements(this, c))
             return false;
 
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(
-            c->GetEntry(), itr->second.spellId);
+        ConditionList const& conds =
+            sConditionMgr->GetConditionsForSpellClickEvent(
+                c->GetEntry(), itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(
             const_cast<Player*>(this), const_cast<Creature*>(c));
         if (sConditionMgr->IsObjectMeetToConditions(info, conds))
@@ -15685,7 +15757,7 @@ bool Player::CanSeeVendor(Creature const* creature) const
     if (!creature->HasNpcFlag(UNIT_NPC_FLAG_VENDOR))
         return true;
 
-    ConditionList conditions =
+    ConditionList const& conditions =
         sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
     if (!sConditionMgr->IsObjectMeetToConditions(
             const_cast<Player*>(this),
@@ -15996,10 +16068,12 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
+    std::vector<CharacterDatabasePreparedStatement*> statements;
+
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    statements.push_back(stmt);
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
@@ -16011,7 +16085,9 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(6, m_entryPointData.taxiPath[0]);
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
-    trans->Append(stmt);
+    statements.push_back(stmt);
+
+    AppendSaveStatements(trans, PLAYER_SAVE_ENTRY_POINT, statements);
 }
 
 void Player::DeleteEquipmentSet(uint64 setGuid)
@@ -16575,11 +16651,11 @@ void Player::ActivateSpec(uint8 spec)
     // in new one (or are in new spec, but not in the old one)
     for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();
          ++itr) {
-        if (!itr->second->Active || itr->second->State == PLAYERSPELL_REMOVED)
+        if (!itr->second.Active || itr->second.State == PLAYERSPELL_REMOVED)
             continue;
 
         // pussywizard: was => isn't
-        if (itr->second->IsInSpec(oldSpec) && !itr->second->IsInSpec(spec)) {
+        if (itr->second.IsInSpec(oldSpec) && !itr->second.IsInSpec(spec)) {
             SendLearnPacket(itr->first, false);
             // We want to remove all auras of the unlearned spell
             _removeTalentAurasAndSpells(itr->first);
@@ -16587,8 +16663,8 @@ void Player::ActivateSpec(uint8 spec)
             removedSpecAuras.insert(itr->first);
         }
         // pussywizard: wasn't => is
-        else if (!itr->second->IsInSpec(oldSpec) &&
-                 itr->second->IsInSpec(spec)) {
+        else if (!itr->second.IsInSpec(oldSpec) &&
+                 itr->second.IsInSpec(spec)) {
             SendLearnPacket(itr->first, true);
 
             removedSpecAuras.erase(itr->first);
@@ -16850,8 +16926,8 @@ void Player::PrepareCharmAISpells()
 
     for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();
          ++itr) {
-        if (itr->second->State == PLAYERSPELL_REMOVED || !itr->second->Active ||
-            !itr->second->IsInSpec(GetActiveSpec()))
+        if (itr->second.State == PLAYERSPELL_REMOVED || !itr->second.Active ||
+            !itr->second.IsInSpec(GetActiveSpec()))
             continue;
 
         SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(itr->first);
@@ -17328,11 +17404,13 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
+    std::vector<CharacterDatabasePreparedStatement*> statements;
+
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(
             CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
-    trans->Append(stmt);
+    statements.push_back(stmt);
 
     for (InstanceTimeMap::const_iterator itr = _instanceResetTimes.begin();
          itr != _instanceResetTimes.end();
@@ -17342,8 +17420,10 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
         stmt->SetData(0, GetSession()->GetAccountId());
         stmt->SetData(1, itr->first);
         stmt->SetData(2, (int64)itr->second);
-        trans->Append(stmt);
+        statements.push_back(stmt);
     }
+
+    AppendSaveStatements(trans, PLAYER_SAVE_INSTANCE_TIMES, statements);
 }
 
 bool Player::IsInWhisperWhiteList(ObjectGuid guid)
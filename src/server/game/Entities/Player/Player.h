@@ -43,6 +43,9 @@
 #include "TradeData.h"
 #include "Unit.h"
 #include "WorldSession.h"
+#include <array>
+#include <atomic>
+#include <boost/container/flat_map.hpp>
 #include <string>
 #include <vector>
 
@@ -132,7 +135,7 @@ struct PlayerSpell {
     bool Active : 1; // UPPER CASE TO CAUSE CONSOLE ERRORS (CHECK EVERY USAGE)!
                      // lower rank of a spell are not useable, but learnt
     uint8 specMask : 8;
-    bool  IsInSpec(uint8 spec) { return (specMask & (1 << spec)); }
+    bool  IsInSpec(uint8 spec) const { return (specMask & (1 << spec)); }
 };
 
 struct PlayerTalent {
@@ -197,7 +200,7 @@ struct SpellModifier {
 };
 
 typedef std::unordered_map<uint32, PlayerTalent*> PlayerTalentMap;
-typedef std::unordered_map<uint32, PlayerSpell*>  PlayerSpellMap;
+typedef std::unordered_map<uint32, PlayerSpell>   PlayerSpellMap;
 typedef std::list<SpellModifier*>                 SpellModList;
 
 typedef GuidList WhisperListContainer;
@@ -211,7 +214,9 @@ struct SpellCooldown {
     bool   needSendToClient : 1;
 };
 
-typedef std::map<uint32, SpellCooldown> SpellCooldowns;
+// checked on every cast attempt and holds a few dozen entries, a sorted
+// vector is faster to search than a tree; erasing invalidates iterators
+typedef boost::container::flat_map<uint32, SpellCooldown> SpellCooldowns;
 typedef std::unordered_map<uint32 /*instanceId*/, time_t /*releaseTime*/>
     InstanceTimeMap;
 
@@ -624,8 +629,9 @@ enum AtLoginFlags {
     AT_LOGIN_RESURRECT         = 0x800
 };
 
-typedef std::map<uint32, QuestStatusData> QuestStatusMap;
-typedef std::unordered_set<uint32>        RewardedQuestSet;
+typedef std::map<uint32, QuestStatusData>       QuestStatusMap;
+typedef std::unordered_set<uint32>              RewardedQuestSet;
+typedef std::unordered_multimap<uint32, uint32> QuestObjectiveIndex;
 
 //               quest,  keep
 typedef std::map<uint32, bool> QuestStatusSaveMap;
@@ -663,6 +669,18 @@ struct SkillStatusData {
 
 typedef std::unordered_map<uint32, SkillStatusData> SkillStatusMap;
 
+// Save parts without own change tracking, their statements are only written
+// when they differ from the previous save, see Player::AppendSaveStatements
+enum PlayerSaveSubsystem : uint8 {
+    PLAYER_SAVE_AURAS = 0,
+    PLAYER_SAVE_SPELL_COOLDOWNS,
+    PLAYER_SAVE_ENTRY_POINT,
+    PLAYER_SAVE_STATS,
+    PLAYER_SAVE_INSTANCE_TIMES,
+    PLAYER_SAVE_SETTINGS,
+    MAX_PLAYER_SAVE_SUBSYSTEMS
+};
+
 class Quest;
 class Spell;
 class Item;
@@ -878,8 +896,6 @@ enum PlayerLoginQueryIndex {
     PLAYER_LOGIN_QUERY_LOAD_REPUTATION            = 7,
     PLAYER_LOGIN_QUERY_LOAD_INVENTORY             = 8,
     PLAYER_LOGIN_QUERY_LOAD_ACTIONS               = 9,
-    PLAYER_LOGIN_QUERY_LOAD_MAILS                 = 10,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS            = 11,
     PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST           = 13,
     PLAYER_LOGIN_QUERY_LOAD_HOME_BIND             = 14,
     PLAYER_LOGIN_QUERY_LOAD_SPELL_COOLDOWNS       = 15,
@@ -1771,6 +1787,7 @@ public:
     void             ResetSeasonalQuestStatus(uint16 event_id);
 
     [[nodiscard]] uint16 FindQuestSlot(uint32 quest_id) const;
+    void UpdateQuestObjectiveIndex(uint32 oldQuestId, uint32 newQuestId);
     [[nodiscard]] uint32 GetQuestSlotQuestId(uint16 slot) const
     {
         return GetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET +
@@ -1795,6 +1812,7 @@ public:
     }
     void SetQuestSlot(uint16 slot, uint32 quest_id, uint32 timer = 0)
     {
+        UpdateQuestObjectiveIndex(GetQuestSlotQuestId(slot), quest_id);
         SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET +
                            QUEST_ID_OFFSET,
                        quest_id);
@@ -1933,6 +1951,12 @@ public:
 
     void SaveToDB(bool create, bool logout);
     void SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout);
+
+    // Statements left out of saves because their data was unchanged
+    static uint64 GetSkippedSaveStatements()
+    {
+        return _skippedSaveStatements;
+    }
     void SaveInventoryAndGoldToDB(
         CharacterDatabaseTransaction
             trans); // fast save function for item/money cheating preventing
@@ -1961,6 +1985,7 @@ public:
     static void DeleteOldCharacters(uint32 keepDays);
 
     bool m_mailsUpdated;
+    bool m_mailsLoaded; // mailbox is read on the first mailbox interaction
 
     void SetBindPoint(ObjectGuid guid);
     void SendTalentWipeConfirm(ObjectGuid guid);
@@ -2038,6 +2063,11 @@ public:
     uint32 GetMailSize() { return m_mail.size(); }
     Mail*  GetMail(uint32 id);
 
+    //! Reads the mails and their items, GetMails() only holds the mails
+    //! delivered during this session until then
+    void               LoadMailIfNeeded();
+    [[nodiscard]] bool IsMailLoaded() const { return m_mailsLoaded; }
+
     [[nodiscard]] PlayerMails const& GetMails() const { return m_mail; }
     void                             SendItemRetrievalMail(
                                     uint32 itemEntry,
@@ -2904,6 +2934,8 @@ public:
     void SendInitWorldStates(uint32 zone, uint32 area);
     void SendUpdateWorldState(uint32 variable, uint32 value) const;
     void SendDirectMessage(WorldPacket const* data) const;
+    void
+    SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const;
     void SendBGWeekendWorldStates();
     void SendBattlefieldWorldStates();
 
@@ -3626,6 +3658,14 @@ protected:
     void _SaveCharacter(bool create, CharacterDatabaseTransaction trans);
     void _SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans);
     void _SavePlayerSettings(CharacterDatabaseTransaction trans);
+    void AppendSaveStatements(
+        CharacterDatabaseTransaction                      trans,
+        PlayerSaveSubsystem                               subsystem,
+        std::vector<CharacterDatabasePreparedStatement*>& statements,
+        std::string const&                                sql = {});
+
+    std::array<std::size_t, MAX_PLAYER_SAVE_SUBSYSTEMS> m_saveDigests{};
+    static std::atomic<uint64>                          _skippedSaveStatements;
 
     /*********************************************************/
     /***              ENVIRONMENTAL SYSTEM                 ***/
@@ -3670,6 +3710,12 @@ protected:
     QuestStatusMap     m_QuestStatus;
     QuestStatusSaveMap m_QuestStatusSave;
 
+    // quests of the quest log by the target of their objectives, kept in sync
+    // by SetQuestSlot so credit events do not scan the whole log
+    QuestObjectiveIndex m_questsByCreature;
+    QuestObjectiveIndex m_questsByGameObject;
+    QuestObjectiveIndex m_questsByItem;
+
     RewardedQuestSet   m_RewardedQuests;
     QuestStatusSaveMap m_RewardedQuestsSave;
     void               SendQuestGiverStatusMultiple();
@@ -3773,6 +3819,9 @@ protected:
     uint64         m_auraRaidUpdateMask;
     bool           m_bPassOnGroupLoot;
 
+    // getMSTime() of the last update per GroupUpdateThrottle
+    std::array<uint32, 3> m_groupUpdateThrottleTime;
+
     // last used pet number (for BG's)
     uint32 m_lastpetnumber;
 
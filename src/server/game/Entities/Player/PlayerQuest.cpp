@@ -32,11 +32,92 @@
 #include "SpellAuraEffects.h"
 #include "SpellMgr.h"
 #include "WorldSession.h"
+#include <boost/container/static_vector.hpp>
 
 /*********************************************************/
 /***                    QUEST SYSTEM                   ***/
 /*********************************************************/
 
+namespace {
+typedef boost::container::static_vector<uint32, MAX_QUEST_LOG_SIZE> QuestIdList;
+
+void AddQuestObjective(QuestObjectiveIndex& index,
+                       uint32               target,
+                       uint32               questId)
+{
+    auto bounds = index.equal_range(target);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        if (itr->second == questId)
+            return;
+
+    index.emplace(target, questId);
+}
+
+void RemoveQuestObjective(QuestObjectiveIndex& index,
+                          uint32               target,
+                          uint32               questId)
+{
+    auto bounds = index.equal_range(target);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr) {
+        if (itr->second == questId) {
+            index.erase(itr);
+            return;
+        }
+    }
+}
+
+// copied out, completing a quest can run scripts that change the quest log
+QuestIdList GetQuestsFor(QuestObjectiveIndex const& index, uint32 target)
+{
+    QuestIdList quests;
+    auto        bounds = index.equal_range(target);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        quests.push_back(itr->second);
+
+    return quests;
+}
+} // namespace
+
+void Player::UpdateQuestObjectiveIndex(uint32 oldQuestId, uint32 newQuestId)
+{
+    if (oldQuestId == newQuestId)
+        return;
+
+    if (Quest const* quest = sObjectMgr->GetQuestTemplate(oldQuestId)) {
+        for (uint8 j = 0; j < QUEST_OBJECTIVES_COUNT; ++j) {
+            if (quest->RequiredNpcOrGo[j] > 0)
+                RemoveQuestObjective(
+                    m_questsByCreature, quest->RequiredNpcOrGo[j], oldQuestId);
+            else if (quest->RequiredNpcOrGo[j] < 0)
+                RemoveQuestObjective(m_questsByGameObject,
+                                     -quest->RequiredNpcOrGo[j],
+                                     oldQuestId);
+        }
+
+        for (uint8 j = 0; j < QUEST_ITEM_OBJECTIVES_COUNT; ++j)
+            if (quest->RequiredItemId[j])
+                RemoveQuestObjective(
+                    m_questsByItem, quest->RequiredItemId[j], oldQuestId);
+    }
+
+    if (Quest const* quest = sObjectMgr->GetQuestTemplate(newQuestId)) {
+        for (uint8 j = 0; j < QUEST_OBJECTIVES_COUNT; ++j) {
+            if (quest->RequiredNpcOrGo[j] > 0)
+                AddQuestObjective(
+                    m_questsByCreature, quest->RequiredNpcOrGo[j], newQuestId);
+            else if (quest->RequiredNpcOrGo[j] < 0)
+                AddQuestObjective(m_questsByGameObject,
+                                  -quest->RequiredNpcOrGo[j],
+                                  newQuestId);
+        }
+
+        for (uint8 j = 0; j < QUEST_ITEM_OBJECTIVES_COUNT; ++j)
+            if (quest->RequiredItemId[j])
+                AddQuestObjective(
+                    m_questsByItem, quest->RequiredItemId[j], newQuestId);
+    }
+}
+
 void Player::PrepareQuestMenu(ObjectGuid guid)
 {
     QuestRelationBounds objectQR;
@@ -1271,8 +1352,9 @@ bool Player::SatisfyQuestStatus(Quest const* qInfo, bool msg) const
 
 bool Player::SatisfyQuestConditions(Quest const* qInfo, bool msg)
 {
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(
-        CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, qInfo->GetQuestId());
+    ConditionList const& conditions =
+        sConditionMgr->GetConditionsForNotGroupedEntry(
+            CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, qInfo->GetQuestId());
     if (!sConditionMgr->IsObjectMeetToConditions(this, conditions)) {
         if (msg)
             SendCanTakeQuestResponse(INVALIDREASON_DONT_HAVE_REQ);
@@ -1750,7 +1832,7 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object* questgiver)
         if (!quest)
             continue;
 
-        ConditionList conditions =
+        ConditionList const& conditions =
             sConditionMgr->GetConditionsForNotGroupedEntry(
                 CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
         if (!sConditionMgr->IsObjectMeetToConditions(this, conditions))
@@ -1781,7 +1863,7 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object* questgiver)
         if (!quest)
             continue;
 
-        ConditionList conditions =
+        ConditionList const& conditions =
             sConditionMgr->GetConditionsForNotGroupedEntry(
                 CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
         if (!sConditionMgr->IsObjectMeetToConditions(this, conditions))
@@ -1935,12 +2017,12 @@ void Player::GroupEventHappens(uint32 questId, WorldObject const* pEventObject)
 
 void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 {
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i) {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (questid == 0)
+    for (uint32 questid : GetQuestsFor(m_questsByItem, entry)) {
+        QuestStatusMap::iterator statusItr = m_QuestStatus.find(questid);
+        if (statusItr == m_QuestStatus.end())
             continue;
 
-        QuestStatusData& q_status = m_QuestStatus[questid];
+        QuestStatusData& q_status = statusItr->second;
 
         if (q_status.Status != QUEST_STATUS_INCOMPLETE)
             continue;
@@ -1973,11 +2055,7 @@ void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 
 void Player::ItemRemovedQuestCheck(uint32 entry, uint32 count)
 {
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i) {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (!questid)
-            continue;
-
+    for (uint32 questid : GetQuestsFor(m_questsByItem, entry)) {
         Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
         if (!qInfo)
             continue;
@@ -2039,17 +2117,18 @@ void Player::KilledMonsterCredit(uint32 entry, ObjectGuid guid)
                               addkillcount,
                               guid ? GetMap()->GetCreature(guid) : nullptr);
 
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i) {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (!questid)
-            continue;
-
+    for (uint32 questid : GetQuestsFor(m_questsByCreature, real_entry)) {
         Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
         if (!qInfo)
             continue;
+
+        QuestStatusMap::iterator statusItr = m_QuestStatus.find(questid);
+        if (statusItr == m_QuestStatus.end())
+            continue;
+
         // just if !ingroup || !noraidgroup || raidgroup
         // xinef: or is pvp quest, and player in BG/BF group
-        QuestStatusData& q_status = m_QuestStatus[questid];
+        QuestStatusData& q_status = statusItr->second;
         if (q_status.Status == QUEST_STATUS_INCOMPLETE &&
             (!GetGroup() || !GetGroup()->isRaidGroup() ||
              qInfo->IsAllowedInRaid(GetMap()->GetDifficulty()) ||
@@ -2159,16 +2238,16 @@ void Player::KilledPlayerCreditForQuest(uint16 count, Quest const* quest)
 void Player::KillCreditGO(uint32 entry, ObjectGuid guid)
 {
     uint16 addCastCount = 1;
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i) {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (!questid)
-            continue;
-
+    for (uint32 questid : GetQuestsFor(m_questsByGameObject, entry)) {
         Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
         if (!qInfo)
             continue;
 
-        QuestStatusData& q_status = m_QuestStatus[questid];
+        QuestStatusMap::iterator statusItr = m_QuestStatus.find(questid);
+        if (statusItr == m_QuestStatus.end())
+            continue;
+
+        QuestStatusData& q_status = statusItr->second;
 
         if (q_status.Status == QUEST_STATUS_INCOMPLETE) {
             if (qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_CAST) /*&& !qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_KILL)*/)
@@ -90,6 +90,9 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
         return;
     }
 
+    std::vector<CharacterDatabasePreparedStatement*> statements;
+    statements.reserve(m_charSettingsMap.size());
+
     for (auto& itr : m_charSettingsMap) {
         std::ostringstream data;
 
@@ -102,8 +105,10 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
         stmt->SetData(0, GetGUID().GetCounter());
         stmt->SetData(1, itr.first);
         stmt->SetData(2, data.str());
-        trans->Append(stmt);
+        statements.push_back(stmt);
     }
+
+    AppendSaveStatements(trans, PLAYER_SAVE_SETTINGS, statements);
 }
 
 void Player::UpdatePlayerSetting(std::string source, uint8 index, uint32 value)
@@ -54,6 +54,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerStateJournal.h"
 #include "QueryHolder.h"
 #include "QuestDef.h"
 #include "ReputationMgr.h"
@@ -73,6 +74,7 @@
 #include "Weather.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <unordered_set>
 
 /// @todo: this import is not necessary for compilation and marked as unused by
 /// the IDE
@@ -3411,7 +3413,7 @@ void Player::DestroyItem(uint8 bag, uint8 slot, bool update)
 
         // Xinef: item is removed, remove loot from storage if any
         if (proto->Flags & ITEM_FLAG_HAS_LOOT)
-            sLootItemStorage->RemoveStoredLoot(pItem->GetGUID());
+            sLootItemStorage->RemoveStoredLoot(pItem->GetGUID(), this);
 
         if (IsInWorld() && update) {
             pItem->RemoveFromWorld();
@@ -5926,10 +5928,13 @@ bool Player::LoadFromDB(ObjectGuid                          playerGuid,
         now - logoutTime); // uint64 is excessive for a time_diff in seconds..
                            // uint32 allows for 136~ year difference.
 
-    // randomize first save time in range [CONFIG_INTERVAL_SAVE] around
-    // [CONFIG_INTERVAL_SAVE] this must help in case next save after mass player
-    // load after server startup
-    m_nextSave = urand(m_nextSave / 2, m_nextSave * 3 / 2);
+    // spread the first save over [CONFIG_INTERVAL_SAVE] around
+    // [CONFIG_INTERVAL_SAVE] by guid, golden ratio hashing places consecutive
+    // guids far apart so the saves after a mass player load at server startup
+    // are evenly distributed over the interval instead of randomly clustered
+    uint32 const saveSlot = uint32(GetGUID().GetCounter() * 2654435761u);
+    m_nextSave =
+        m_nextSave / 2 + uint32((uint64(saveSlot) * m_nextSave) >> 32);
 
     // set value, including drunk invisibility detection
     // calculate sobering. after 15 minutes logged out, the player will be sober
@@ -6094,10 +6099,9 @@ bool Player::LoadFromDB(ObjectGuid                          playerGuid,
     m_reputationMgr->LoadFromDB(
         holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_REPUTATION));
 
-    // xinef: load mails before inventory, so problematic items can be added to
-    // already loaded mails
-    _LoadMail(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAILS),
-              holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS));
+    // mails are loaded on the first mailbox interaction, problematic items
+    // mailed by the inventory load are merged into them then
+    UpdateNextMailTimeAndUnreads();
 
     _LoadInventory(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_INVENTORY),
                    time_diff);
@@ -6960,14 +6964,21 @@ void Player::_LoadMail(PreparedQueryResult mailsResult,
 {
     time_t cur_time = GameTime::GetGameTime().count();
 
-    m_mail.clear();
+    // mails delivered during this session are already in memory with their
+    // items
+    std::unordered_set<uint32> knownMails;
+    for (Mail const* mail : m_mail)
+        knownMails.insert(mail->messageID);
 
     std::unordered_map<uint32, Mail*> mailById;
 
     if (mailsResult) {
         do {
             Field* fields = mailsResult->Fetch();
-            Mail*  m      = new Mail;
+            if (knownMails.count(fields[0].Get<uint32>()))
+                continue;
+
+            Mail* m = new Mail;
 
             m->messageID      = fields[0].Get<uint32>();
             m->messageType    = fields[1].Get<uint8>();
@@ -7011,6 +7022,9 @@ void Player::_LoadMail(PreparedQueryResult mailsResult,
         do {
             Field* fields = mailItemsResult->Fetch();
             uint32 mailId = fields[14].Get<uint32>();
+            if (knownMails.count(mailId))
+                continue;
+
             _LoadMailedItem(GetGUID(), this, mailId, mailById[mailId], fields);
         } while (mailItemsResult->NextRow());
     }
@@ -7018,6 +7032,24 @@ void Player::_LoadMail(PreparedQueryResult mailsResult,
     UpdateNextMailTimeAndUnreads();
 }
 
+void Player::LoadMailIfNeeded()
+{
+    if (m_mailsLoaded)
+        return;
+
+    m_mailsLoaded = true;
+
+    CharacterDatabasePreparedStatement* stmt =
+        CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL);
+    stmt->SetData(0, GetGUID().GetCounter());
+    stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
+    PreparedQueryResult mailsResult = CharacterDatabase.Query(stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+    stmt->SetData(0, GetGUID().GetCounter());
+    _LoadMail(mailsResult, CharacterDatabase.Query(stmt));
+}
+
 void Player::LoadPet()
 {
     // fixme: the pet should still be loaded if the player is not in world
@@ -7956,6 +7988,41 @@ bool Player::_LoadHomeBind(PreparedQueryResult result)
 /***                   SAVE SYSTEM                     ***/
 /*********************************************************/
 
+std::atomic<uint64> Player::_skippedSaveStatements{0};
+
+void Player::AppendSaveStatements(
+    CharacterDatabaseTransaction                      trans,
+    PlayerSaveSubsystem                               subsystem,
+    std::vector<CharacterDatabasePreparedStatement*>& statements,
+    std::string const&                                sql)
+{
+    std::size_t digest = std::hash<std::string>()(sql);
+    for (CharacterDatabasePreparedStatement* stmt : statements)
+        digest ^= stmt->GetParametersHash() + 0x9e3779b9 + (digest << 6) +
+                  (digest >> 2);
+
+    // the rows in the database are the ones of the previous save already
+    if (digest == m_saveDigests[subsystem]) {
+        _skippedSaveStatements += statements.size() + (sql.empty() ? 0 : 1);
+
+        for (CharacterDatabasePreparedStatement* stmt : statements)
+            delete stmt;
+
+        statements.clear();
+        return;
+    }
+
+    m_saveDigests[subsystem] = digest;
+
+    for (CharacterDatabasePreparedStatement* stmt : statements)
+        trans->Append(stmt);
+
+    statements.clear();
+
+    if (!sql.empty())
+        trans->Append(sql);
+}
+
 void Player::SaveToDB(bool create, bool logout)
 {
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
@@ -7982,6 +8049,9 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans,
     m_additionalSaveTimer = 0;
     m_additionalSaveMask  = 0;
 
+    // the full save supersedes the journaled position
+    sPlayerStateJournal->ResetPlayer(GetGUID().GetCounter());
+
     // first save/honor gain after midnight will also update the player's honor
     // fields
     UpdateHonorFields();
@@ -8027,7 +8097,7 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans,
 
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
-        pet->SavePetToDB(PET_SAVE_AS_CURRENT);
+        pet->SavePetToDB(PET_SAVE_AS_CURRENT, trans);
 }
 
 // fast save function for item/money cheating preventing - save only inventory
@@ -8097,10 +8167,12 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
 {
+    std::vector<CharacterDatabasePreparedStatement*> statements;
+
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
     stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    statements.push_back(stmt);
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin();
          itr != m_ownedAuras.end();
@@ -8148,8 +8220,10 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         stmt->SetData(index++, itr->second->GetMaxDuration());
         stmt->SetData(index++, itr->second->GetDuration());
         stmt->SetData(index, itr->second->GetCharges());
-        trans->Append(stmt);
+        statements.push_back(stmt);
     }
+
+    AppendSaveStatements(trans, PLAYER_SAVE_AURAS, statements);
 }
 
 void Player::_SaveInventory(CharacterDatabaseTransaction trans)
@@ -8165,7 +8239,7 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
         if (item->GetState() == ITEM_NEW) {
             // Xinef: item is removed, remove loot from storage if any
             if (item->GetTemplate()->Flags & ITEM_FLAG_HAS_LOOT)
-                sLootItemStorage->RemoveStoredLoot(item->GetGUID());
+                sLootItemStorage->RemoveStoredLoot(item->GetGUID(), this);
             continue;
         }
 
@@ -8181,7 +8255,7 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
 
         // Xinef: item is removed, remove loot from storage if any
         if (item->GetTemplate()->Flags & ITEM_FLAG_HAS_LOOT)
-            sLootItemStorage->RemoveStoredLoot(item->GetGUID());
+            sLootItemStorage->RemoveStoredLoot(item->GetGUID(), this);
     }
 
     // Updated played time for refundable items. We don't do this in
@@ -8220,6 +8294,9 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
          ++itr)
         itr->item->SetEnchantmentDuration(itr->slot, itr->leftduration, this);
 
+    // contents of opened and looted containers
+    sLootItemStorage->SaveToDB(this, trans);
+
     // if no changes
     if (m_itemUpdateQueue.empty())
         return;
@@ -8666,14 +8743,14 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
     for (PlayerSpellMap::iterator itr = m_spells.begin();
          itr != m_spells.end();) {
         // xinef: skip temporary spells
-        if (itr->second->State == PLAYERSPELL_TEMPORARY) {
+        if (itr->second.State == PLAYERSPELL_TEMPORARY) {
             ++itr;
             continue;
         }
 
         // xinef: Delete statement for removed / updated spell
-        if (itr->second->State == PLAYERSPELL_REMOVED ||
-            itr->second->State == PLAYERSPELL_CHANGED) {
+        if (itr->second.State == PLAYERSPELL_REMOVED ||
+            itr->second.State == PLAYERSPELL_CHANGED) {
             stmt = CharacterDatabase.GetPreparedStatement(
                 CHAR_DEL_CHAR_SPELL_BY_SPELL);
             stmt->SetData(0, GetGUID().GetCounter());
@@ -8682,21 +8759,20 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
         }
 
         // xinef: insert statement for new / updated spell
-        if (itr->second->State == PLAYERSPELL_NEW ||
-            itr->second->State == PLAYERSPELL_CHANGED) {
+        if (itr->second.State == PLAYERSPELL_NEW ||
+            itr->second.State == PLAYERSPELL_CHANGED) {
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL);
             stmt->SetData(0, GetGUID().GetCounter());
             stmt->SetData(1, itr->first);
-            stmt->SetData(2, itr->second->specMask);
+            stmt->SetData(2, itr->second.specMask);
             trans->Append(stmt);
         }
 
-        if (itr->second->State == PLAYERSPELL_REMOVED) {
-            delete itr->second;
+        if (itr->second.State == PLAYERSPELL_REMOVED) {
             m_spells.erase(itr++);
         }
         else {
-            itr->second->State = PLAYERSPELL_UNCHANGED;
+            itr->second.State = PLAYERSPELL_UNCHANGED;
             ++itr;
         }
     }
@@ -8711,11 +8787,12 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
         GetLevel() < sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE))
         return;
 
-    CharacterDatabasePreparedStatement* stmt = nullptr;
+    std::vector<CharacterDatabasePreparedStatement*> statements;
+    CharacterDatabasePreparedStatement*              stmt = nullptr;
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
     stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
+    statements.push_back(stmt);
 
     uint8 index = 0;
 
@@ -8745,7 +8822,9 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
                   GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 +
                                  static_cast<uint16>(CR_CRIT_TAKEN_SPELL)));
 
-    trans->Append(stmt);
+    statements.push_back(stmt);
+
+    AppendSaveStatements(trans, PLAYER_SAVE_STATS, statements);
 }
 
 void Player::outDebugValues() const
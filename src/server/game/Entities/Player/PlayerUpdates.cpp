@@ -1621,12 +1621,16 @@ void Player::UpdateVisibilityOf(T*                  target,
 
             target->BuildOutOfRangeUpdateBlock(&data);
             m_clientGUIDs.erase(target->GetGUID());
+            if (Unit* unit = target->ToUnit())
+                unit->RemoveObserver(GetGUID());
         }
     }
     else {
         if (CanSeeOrDetect(target, false, true)) {
             target->BuildCreateUpdateBlockForPlayer(&data, this);
             UpdateVisibilityOf_helper(m_clientGUIDs, target, visibleNow);
+            if (Unit* unit = target->ToUnit())
+                unit->AddObserver(GetGUID());
         }
     }
 }
@@ -1650,12 +1654,16 @@ void Player::UpdateVisibilityOf(WorldObject* target)
 
             target->DestroyForPlayer(this);
             m_clientGUIDs.erase(target->GetGUID());
+            if (Unit* unit = target->ToUnit())
+                unit->RemoveObserver(GetGUID());
         }
     }
     else {
         if (CanSeeOrDetect(target, false, true)) {
             target->SendUpdateToPlayer(this);
             m_clientGUIDs.insert(target->GetGUID());
+            if (Unit* unit = target->ToUnit())
+                unit->AddObserver(GetGUID());
 
             // target aura duration for caster show only if target exist at
             // caster client send data at target visibility change (adding to
@@ -1742,7 +1750,7 @@ void Player::UpdateForQuestWorldObjects()
                     //! converted to condition system to do the exact same thing
                     //! it did before. It definitely needs to be overlooked for
                     //! intended functionality.
-                    ConditionList conds =
+                    ConditionList const& conds =
                         sConditionMgr->GetConditionsForSpellClickEvent(
                             obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
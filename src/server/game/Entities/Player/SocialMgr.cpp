@@ -45,6 +45,9 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friendGuid, SocialFlag flag)
                                                  : SOCIALMGR_IGNORE_LIMIT))
         return false;
 
+    if ((flag & SOCIAL_FLAG_FRIEND) && !HasFriend(friendGuid))
+        sSocialMgr->AddFriendLister(friendGuid, GetPlayerGUID());
+
     auto itr = m_playerSocialMap.find(friendGuid);
     if (itr != m_playerSocialMap.end()) {
         itr->second.Flags |= flag;
@@ -80,6 +83,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid friendGuid, SocialFlag flag)
     if (itr == m_playerSocialMap.end()) // not exist
         return;
 
+    if ((flag & SOCIAL_FLAG_FRIEND) && (itr->second.Flags & SOCIAL_FLAG_FRIEND))
+        sSocialMgr->RemoveFriendLister(friendGuid, GetPlayerGUID());
+
     itr->second.Flags &= ~flag;
 
     if (itr->second.Flags == 0) {
@@ -213,6 +219,45 @@ SocialMgr* SocialMgr::instance()
     return &instance;
 }
 
+void SocialMgr::RemovePlayerSocial(ObjectGuid guid)
+{
+    auto itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    RemoveFriendListers(itr->second);
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::AddFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid)
+{
+    m_friendListers[friendGuid].push_back(listerGuid);
+}
+
+void SocialMgr::RemoveFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid)
+{
+    auto itr = m_friendListers.find(friendGuid);
+    if (itr == m_friendListers.end())
+        return;
+
+    std::vector<ObjectGuid>& listers = itr->second;
+    auto lister = std::find(listers.begin(), listers.end(), listerGuid);
+    if (lister != listers.end()) {
+        *lister = listers.back();
+        listers.pop_back();
+    }
+
+    if (listers.empty())
+        m_friendListers.erase(itr);
+}
+
+void SocialMgr::RemoveFriendListers(PlayerSocial const& social)
+{
+    for (auto const& [friendGuid, friendInfo] : social.m_playerSocialMap)
+        if (friendInfo.Flags & SOCIAL_FLAG_FRIEND)
+            RemoveFriendLister(friendGuid, social.GetPlayerGUID());
+}
+
 void SocialMgr::GetFriendInfo(Player*     player,
                               ObjectGuid  friendGUID,
                               FriendInfo& friendInfo)
@@ -317,29 +362,33 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket* packet)
     AccountTypes gmLevelInWhoList =
         AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
 
-    for (auto const& itr : m_socialMap) {
-        auto const& itr2 = itr.second.m_playerSocialMap.find(player->GetGUID());
-        if (itr2 != itr.second.m_playerSocialMap.end() &&
-            (itr2->second.Flags & SOCIAL_FLAG_FRIEND)) {
-            Player* pFriend = ObjectAccessor::FindPlayer(itr.first);
-
-            // PLAYER see his team only and PLAYER can't see MODERATOR, GAME
-            // MASTER, ADMINISTRATOR characters MODERATOR, GAME MASTER,
-            // ADMINISTRATOR can see all
-            if (pFriend &&
-                (!AccountMgr::IsPlayerAccount(
-                     pFriend->GetSession()->GetSecurity()) ||
-                 ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) &&
-                  security <= gmLevelInWhoList)) &&
-                player->IsVisibleGloballyFor(pFriend))
-                pFriend->GetSession()->SendPacket(packet);
-        }
+    auto listers = m_friendListers.find(player->GetGUID());
+    if (listers == m_friendListers.end())
+        return;
+
+    for (ObjectGuid const& listerGuid : listers->second) {
+        Player* pFriend = ObjectAccessor::FindPlayer(listerGuid);
+
+        // PLAYER see his team only and PLAYER can't see MODERATOR, GAME
+        // MASTER, ADMINISTRATOR characters MODERATOR, GAME MASTER,
+        // ADMINISTRATOR can see all
+        if (pFriend &&
+            (!AccountMgr::IsPlayerAccount(
+                 pFriend->GetSession()->GetSecurity()) ||
+             ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) &&
+              security <= gmLevelInWhoList)) &&
+            player->IsVisibleGloballyFor(pFriend))
+            pFriend->GetSession()->SendPacket(packet);
     }
 }
 
 PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid guid)
 {
     PlayerSocial* social = &m_socialMap[guid];
+
+    // a list loaded again replaces the old one
+    RemoveFriendListers(*social);
+    social->m_playerSocialMap.clear();
     social->SetPlayerGUID(guid);
 
     if (!result)
@@ -354,6 +403,8 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid guid)
         auto note  = fields[2].Get<std::string>();
 
         social->m_playerSocialMap[friendGuid] = FriendInfo(flags, note);
+        if (flags & SOCIAL_FLAG_FRIEND)
+            AddFriendLister(friendGuid, guid);
     } while (result->NextRow());
 
     return social;
@@ -23,6 +23,8 @@
 #include "DatabaseEnv.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 class Player;
 class WorldPacket;
@@ -130,6 +132,8 @@ private:
 };
 
 class SocialMgr {
+    friend class PlayerSocial;
+
 private:
     SocialMgr();
     ~SocialMgr();
@@ -137,7 +141,7 @@ private:
 public:
     static SocialMgr* instance();
     // Misc
-    void        RemovePlayerSocial(ObjectGuid guid) { m_socialMap.erase(guid); }
+    void        RemovePlayerSocial(ObjectGuid guid);
     static void GetFriendInfo(Player*     player,
                               ObjectGuid  friendGUID,
                               FriendInfo& friendInfo);
@@ -154,8 +158,18 @@ public:
     PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid guid);
 
 private:
+    // keeps m_friendListers in sync with the friend flags of the lists
+    void AddFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid);
+    void RemoveFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid);
+    void RemoveFriendListers(PlayerSocial const& social);
+
     typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
     SocialMap                                  m_socialMap;
+
+    // for every player, the loaded players who have them as friend
+    typedef std::unordered_map<ObjectGuid, std::vector<ObjectGuid>>
+                    FriendListerMap;
+    FriendListerMap m_friendListers;
 };
 
 #define sSocialMgr SocialMgr::instance()
@@ -165,7 +165,11 @@ void MotionTransport::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet&)
 
 void MotionTransport::Update(uint32 diff)
 {
-    uint32 const positionUpdateDelay = 1;
+    // the client moves transports along the path on its own, so the server
+    // position (and every passenger relocation with it) is only needed for
+    // grid, visibility and combat and may be refreshed less often
+    uint32 const positionUpdateDelay = std::max<uint32>(
+        1, sWorld->getIntConfig(CONFIG_TRANSPORT_POSITION_UPDATE_INTERVAL));
 
     if (AI())
         AI()->UpdateAI(diff);
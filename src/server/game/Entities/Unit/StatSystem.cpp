@@ -26,6 +26,20 @@
 #include "SpellMgr.h"
 #include "Unit.h"
 
+namespace {
+// read on every stat update, so parse them once per config (re)load
+ConfigValue<bool> const& StatsLimitsEnable =
+    sConfigMgr->RegisterOption<bool>("Stats.Limits.Enable", false);
+ConfigValue<float> const& StatsLimitsDodge =
+    sConfigMgr->RegisterOption<float>("Stats.Limits.Dodge", 95.0f);
+ConfigValue<float> const& StatsLimitsParry =
+    sConfigMgr->RegisterOption<float>("Stats.Limits.Parry", 95.0f);
+ConfigValue<float> const& StatsLimitsBlock =
+    sConfigMgr->RegisterOption<float>("Stats.Limits.Block", 95.0f);
+ConfigValue<float> const& StatsLimitsCrit =
+    sConfigMgr->RegisterOption<float>("Stats.Limits.Crit", 95.0f);
+} // namespace
+
 inline bool _ModifyUInt32(bool apply, uint32& baseValue, int32& amount)
 {
     // If amount is negative, change sign and value of apply.
@@ -681,12 +695,8 @@ void Player::UpdateBlockPercentage()
         // Increase from rating
         value += GetRatingBonusValue(CR_BLOCK);
 
-        if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false)) {
-            value =
-                value > sConfigMgr->GetOption<float>("Stats.Limits.Block",
-                                                     95.0f)
-                    ? sConfigMgr->GetOption<float>("Stats.Limits.Block", 95.0f)
-                    : value;
+        if (StatsLimitsEnable.Get()) {
+            value = std::min(value, StatsLimitsBlock.Get());
         }
 
         value = value < 0.0f ? 0.0f : value;
@@ -727,10 +737,8 @@ void Player::UpdateCritPercentage(WeaponAttackType attType)
               int32(GetMaxSkillValueForLevel())) *
              0.04f;
 
-    if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false)) {
-        value = value > sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f)
-                    ? sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f)
-                    : value;
+    if (StatsLimitsEnable.Get()) {
+        value = std::min(value, StatsLimitsCrit.Get());
     }
 
     value = value < 0.0f ? 0.0f : value;
@@ -834,12 +842,8 @@ void Player::UpdateParryPercentage()
 
         value = std::max(diminishing + nondiminishing, 0.0f);
 
-        if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false)) {
-            value =
-                value > sConfigMgr->GetOption<float>("Stats.Limits.Parry",
-                                                     95.0f)
-                    ? sConfigMgr->GetOption<float>("Stats.Limits.Parry", 95.0f)
-                    : value;
+        if (StatsLimitsEnable.Get()) {
+            value = std::min(value, StatsLimitsParry.Get());
         }
     }
 
@@ -882,11 +886,8 @@ void Player::UpdateDodgePercentage()
     m_realDodge = m_realDodge < 0.0f ? 0.0f : m_realDodge;
     float value = std::max(diminishing + nondiminishing, 0.0f);
 
-    if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false)) {
-        value =
-            value > sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f)
-                ? sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f)
-                : value;
+    if (StatsLimitsEnable.Get()) {
+        value = std::min(value, StatsLimitsDodge.Get());
     }
 
     SetStatFloatValue(PLAYER_DODGE_PERCENTAGE, value);
@@ -59,6 +59,7 @@
 #include "SpellAuras.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
+#include "SpellScript.h"
 #include "StringConvert.h"
 #include "TargetedMovementGenerator.h"
 #include "TemporarySummon.h"
@@ -73,6 +74,32 @@
 #include "WorldPacket.h"
 #include <math.h>
 
+namespace {
+
+// Proc flags ProcDamageAndSpellFor may trigger the aura at
+uint32 GetAuraProcTriggerMask(Aura const* aura)
+{
+    // check proc hooks are called before the proc flags are tested
+    for (AuraScript* script : aura->m_loadedScripts)
+        if (script->DoCheckProc.size())
+            return ~uint32(0);
+
+    SpellInfo const* spellInfo = aura->GetSpellInfo();
+
+    // handled by the new proc system, see IsTriggeredAtSpellProcEvent
+    if (sSpellMgr->GetSpellProcEntry(spellInfo->Id))
+        return 0;
+
+    SpellProcEventEntry const* spellProcEvent =
+        sSpellMgr->GetSpellProcEvent(spellInfo->Id);
+    if (spellProcEvent && spellProcEvent->procFlags)
+        return spellProcEvent->procFlags;
+
+    return spellInfo->ProcFlags;
+}
+
+} // namespace
+
 float baseMoveSpeed[MAX_MOVE_TYPE] = {
     2.5f,      // MOVE_WALK
     7.0f,      // MOVE_RUN
@@ -258,6 +285,8 @@ Unit::Unit(bool isWorldObject)
     m_objectType |= TYPEMASK_UNIT;
     m_objectTypeId = TYPEID_UNIT;
 
+    m_appliedAuraProcGeneration = sSpellMgr->GetSpellProcGeneration();
+
     m_updateFlag = (UPDATEFLAG_LIVING | UPDATEFLAG_STATIONARY_POSITION);
 
     m_attackTimer[BASE_ATTACK]         = 0;
@@ -446,7 +475,7 @@ void Unit::Update(uint32 p_time)
             if (m_delayed_unit_relocation_timer <= p_time) {
                 m_delayed_unit_relocation_timer = 0;
                 // ExecuteDelayedUnitRelocationEvent();
-                FindMap()->i_objectsForDelayedVisibility.insert(this);
+                FindMap()->AddToDelayedVisibility(this);
             }
             else
                 m_delayed_unit_relocation_timer -= p_time;
@@ -5101,6 +5130,7 @@ void Unit::_AddAura(UnitAura* aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
     m_ownedAuras.insert(AuraMap::value_type(aura->GetId(), aura));
+    ++m_ownedAuraIdCounts[uint8(aura->GetId())];
 
     _RemoveNoStackAurasDueToAura(aura);
 
@@ -5165,6 +5195,9 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
 
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+    ++m_appliedAuraIdCounts[uint8(aurId)];
+    aurApp->SetProcTriggerMask(GetAuraProcTriggerMask(aura));
+    AddAppliedAuraProcFlags(aurApp->GetProcTriggerMask());
 
     // xinef: do not insert our application to interruptible list if application
     // target is not the owner (area auras) xinef: even if it gets removed, it
@@ -5265,6 +5298,8 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i,
 
     // Remove all pointers from lists here to prevent possible pointer
     // invalidation on spellcast/auraapply/auraremove
+    --m_appliedAuraIdCounts[uint8(i->first)];
+    RemoveAppliedAuraProcFlags(aurApp->GetProcTriggerMask());
     m_appliedAuras.erase(i);
 
     // xinef: do not insert our application to interruptible list if application
@@ -5407,6 +5442,7 @@ void Unit::RemoveOwnedAura(AuraMap::iterator& i, AuraRemoveMode removeMode)
     if (m_auraUpdateIterator == i && m_auraUpdateIterator != m_ownedAuras.end())
         ++m_auraUpdateIterator;
 
+    --m_ownedAuraIdCounts[uint8(i->first)];
     m_ownedAuras.erase(i);
     m_removedAuras.push_back(aura);
 
@@ -5461,6 +5497,9 @@ Aura* Unit::GetOwnedAura(uint32     spellId,
                          uint8      reqEffMask,
                          Aura*      except) const
 {
+    if (!m_ownedAuraIdCounts[uint8(spellId)])
+        return nullptr;
+
     AuraMapBounds range = m_ownedAuras.equal_range(spellId);
     for (AuraMap::const_iterator itr = range.first; itr != range.second;
          ++itr) {
@@ -6362,6 +6401,9 @@ AuraApplication* Unit::GetAuraApplication(uint32           spellId,
                                           uint8            reqEffMask,
                                           AuraApplication* except) const
 {
+    if (!m_appliedAuraIdCounts[uint8(spellId)])
+        return nullptr;
+
     AuraApplicationMapBounds range = m_appliedAuras.equal_range(spellId);
     for (; range.first != range.second; ++range.first) {
         AuraApplication* app  = range.first->second;
@@ -6486,6 +6528,9 @@ bool Unit::HasAuraEffect(uint32     spellId,
                          uint8      effIndex,
                          ObjectGuid caster) const
 {
+    if (!m_appliedAuraIdCounts[uint8(spellId)])
+        return false;
+
     AuraApplicationMapBounds range = m_appliedAuras.equal_range(spellId);
     for (AuraApplicationMap::const_iterator itr = range.first;
          itr != range.second;
@@ -6500,6 +6545,9 @@ bool Unit::HasAuraEffect(uint32     spellId,
 
 uint32 Unit::GetAuraCount(uint32 spellId) const
 {
+    if (!m_appliedAuraIdCounts[uint8(spellId)])
+        return 0;
+
     uint32                   count = 0;
     AuraApplicationMapBounds range = m_appliedAuras.equal_range(spellId);
 
@@ -7244,7 +7292,8 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage* log)
     //     data << float(log->GlanceChance);
     //     data << float(log->CrushChance);
     // }
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data,
+                         log->target == this ? log->attacker : log->target);
 }
 
 void Unit::SendSpellNonMeleeDamageLog(Unit*            target,
@@ -7375,7 +7424,7 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo)
         return;
     }
 
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data, pInfo->auraEff->GetCaster());
 }
 
 void Unit::SendSpellMiss(Unit* target, uint32 spellID, SpellMissInfo missInfo)
@@ -7389,7 +7438,7 @@ void Unit::SendSpellMiss(Unit* target, uint32 spellID, SpellMissInfo missInfo)
     data << target->GetGUID(); // target GUID
     data << uint8(missInfo);
     // end loop
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data, target);
 }
 
 void Unit::SendSpellDamageResist(Unit* target, uint32 spellId)
@@ -7399,7 +7448,7 @@ void Unit::SendSpellDamageResist(Unit* target, uint32 spellId)
     data << target->GetGUID();
     data << uint32(spellId);
     data << uint8(0); // bool - log format: 0-default, 1-debug
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data, target);
 }
 
 void Unit::SendSpellDamageImmune(Unit* target, uint32 spellId)
@@ -7409,7 +7458,26 @@ void Unit::SendSpellDamageImmune(Unit* target, uint32 spellId)
     data << target->GetGUID();
     data << uint32(spellId);
     data << uint8(0); // bool - log format: 0-default, 1-debug
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data, target);
+}
+
+void Unit::SendCombatLogMessage(WorldPacket const* data,
+                                Unit const*        other) const
+{
+    float range = sWorld->getFloatConfig(CONFIG_COMBAT_LOG_RANGE);
+    if (range <= 0.0f || range >= GetVisibilityRange()) {
+        SendMessageToSet(data, true);
+        return;
+    }
+
+    // the other unit may be further away than the range, it must still see
+    // the log of what happened to it or what it did
+    Player const* otherPlayer = other && other != this
+                                    ? other->ToPlayer()
+                                    : nullptr;
+    SendMessageToSetInRange(data, range, true, false, otherPlayer);
+    if (otherPlayer)
+        otherPlayer->SendDirectMessage(data);
 }
 
 void Unit::SendAttackStateUpdate(CalcDamageInfo* damageInfo)
@@ -9740,9 +9808,9 @@ bool Unit::HandleDummyAuraProc(Unit*                victim,
                  itr != sp_list.end();
                  ++itr) {
                 // check if shown in spell book
-                if (!itr->second->Active ||
-                    !itr->second->IsInSpec(ToPlayer()->GetActiveSpec()) ||
-                    itr->second->State == PLAYERSPELL_REMOVED)
+                if (!itr->second.Active ||
+                    !itr->second.IsInSpec(ToPlayer()->GetActiveSpec()) ||
+                    itr->second.State == PLAYERSPELL_REMOVED)
                     continue;
 
                 SpellInfo const* spellProto =
@@ -11526,17 +11594,8 @@ Unit::GetFactionReactionTo(FactionTemplateEntry const* factionTemplateEntry,
     }
 
     // common faction based check
-    if (factionTemplateEntry->IsHostileTo(*targetFactionTemplateEntry))
-        return REP_HOSTILE;
-    if (factionTemplateEntry->IsFriendlyTo(*targetFactionTemplateEntry))
-        return REP_FRIENDLY;
-    if (targetFactionTemplateEntry->IsFriendlyTo(*factionTemplateEntry))
-        return REP_FRIENDLY;
-    if (factionTemplateEntry->factionFlags &
-        FACTION_TEMPLATE_FLAG_HATES_ALL_EXCEPT_FRIENDS)
-        return REP_HOSTILE;
-    // neutral by default
-    return REP_NEUTRAL;
+    return GetFactionTemplateReaction(factionTemplateEntry,
+                                      targetFactionTemplateEntry);
 }
 
 bool Unit::IsHostileTo(Unit const* unit) const
@@ -12579,7 +12638,7 @@ void Unit::SendHealSpellLog(HealInfo const& healInfo, bool critical)
     data << uint32(healInfo.GetAbsorb()); // Absorb amount
     data << uint8(critical ? 1 : 0);
     data << uint8(0); // unused
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data, healInfo.GetTarget());
 }
 
 int32 Unit::HealBySpell(HealInfo& healInfo, bool critical)
@@ -12611,7 +12670,7 @@ void Unit::SendEnergizeSpellLog(Unit*  victim,
     data << uint32(spellID);
     data << uint32(powerType);
     data << uint32(damage);
-    SendMessageToSet(&data, true);
+    SendCombatLogMessage(&data, victim);
 }
 
 void Unit::EnergizeBySpell(Unit*  victim,
@@ -17549,6 +17608,10 @@ void Unit::RemoveFromWorld()
         if (IsVehicle())
             RemoveVehicleKit();
 
+        // visibility updates can be deferred to a later map update
+        if (Map* map = FindMap())
+            map->RemoveFromDelayedVisibility(this);
+
         RemoveCharmAuras();
         RemoveBindSightAuras();
         RemoveNotOwnSingleTargetAuras();
@@ -18282,6 +18345,13 @@ void Unit::ProcDamageAndSpellFor(bool             isVictim,
         }
     }
 
+    if (m_appliedAuraProcGeneration != sSpellMgr->GetSpellProcGeneration())
+        UpdateAppliedAuraProcFlags();
+
+    // no applied aura can trigger at any of these flags
+    if (!(procFlag & m_appliedAuraProcFlags))
+        return;
+
     Unit* actor        = isVictim ? target : this;
     Unit* actionTarget = !isVictim ? target : this;
 
@@ -18303,6 +18373,9 @@ void Unit::ProcDamageAndSpellFor(bool             isVictim,
     for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin();
          itr != GetAppliedAuras().end();
          ++itr) {
+        if (!(procFlag & itr->second->GetProcTriggerMask()))
+            continue;
+
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
@@ -18359,7 +18432,7 @@ void Unit::ProcDamageAndSpellFor(bool             isVictim,
         }
 
         // do checks using conditions table
-        ConditionList conditions =
+        ConditionList const& conditions =
             sConditionMgr->GetConditionsForNotGroupedEntry(
                 CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
         ConditionSourceInfo condInfo = ConditionSourceInfo(
@@ -18769,6 +18842,32 @@ void Unit::ProcDamageAndSpellFor(bool             isVictim,
         SetCantProc(false);
 }
 
+void Unit::AddAppliedAuraProcFlags(uint32 mask)
+{
+    for (uint8 i = 0; mask; ++i, mask >>= 1)
+        if ((mask & 1) && !m_appliedAuraProcFlagCounts[i]++)
+            m_appliedAuraProcFlags |= uint32(1) << i;
+}
+
+void Unit::RemoveAppliedAuraProcFlags(uint32 mask)
+{
+    for (uint8 i = 0; mask; ++i, mask >>= 1)
+        if ((mask & 1) && !--m_appliedAuraProcFlagCounts[i])
+            m_appliedAuraProcFlags &= ~(uint32(1) << i);
+}
+
+void Unit::UpdateAppliedAuraProcFlags()
+{
+    m_appliedAuraProcFlagCounts.fill(0);
+    m_appliedAuraProcFlags      = 0;
+    m_appliedAuraProcGeneration = sSpellMgr->GetSpellProcGeneration();
+
+    for (auto const& [auraId, aurApp] : m_appliedAuras) {
+        aurApp->SetProcTriggerMask(GetAuraProcTriggerMask(aurApp->GetBase()));
+        AddAppliedAuraProcFlags(aurApp->GetProcTriggerMask());
+    }
+}
+
 void Unit::GetProcAurasTriggeredOnEvent(
     std::list<AuraApplication*>& aurasTriggeringProc,
     std::list<AuraApplication*>* procAuras,
@@ -19012,6 +19111,32 @@ void Unit::SendMovementFlagUpdate(bool self /* = false */)
     SendMessageToSet(&data, self);
 }
 
+void Unit::SendMessageToObservers(WorldPacket const* data,
+                                  Player const*      skipped_rcvr)
+{
+    if (!IsInWorld())
+        return;
+
+    // copy of data shared by all receivers, made for the first one
+    std::shared_ptr<WorldPacket const> sharedData;
+    for (auto itr = m_observers.begin(); itr != m_observers.end();) {
+        Player* player = ObjectAccessor::GetPlayer(GetMap(), *itr);
+        if (!player || !player->HaveAtClient(this)) {
+            itr = m_observers.erase(itr);
+            continue;
+        }
+
+        ++itr;
+        if (player == this || player == skipped_rcvr)
+            continue;
+
+        if (!sharedData)
+            sharedData = std::make_shared<WorldPacket const>(*data);
+
+        player->GetSession()->SendPacket(sharedData);
+    }
+}
+
 bool Unit::IsSitState() const
 {
     uint8 s = getStandState();
@@ -21981,8 +22106,9 @@ bool Unit::HandleSpellClick(Unit* clicker, int8 seatId)
             continue;
 
         //! Check database conditions
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(
-            spellClickEntry, itr->second.spellId);
+        ConditionList const& conds =
+            sConditionMgr->GetConditionsForSpellClickEvent(
+                spellClickEntry, itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(clicker, this);
         if (!sConditionMgr->IsObjectMeetToConditions(info, conds))
             continue;
@@ -23399,7 +23525,26 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
+    // fields with these flags are sent even when they did not change
+    uint32 const alwaysSentFlags =
+        _fieldNotifyFlags | (visibleFlag & UF_FLAG_SPECIAL_INFO);
+    uint32 const auraStateBlock =
+        HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK)
+            ? uint32(UNIT_FIELD_AURASTATE / UpdateMask::CLIENT_UPDATE_MASK_BITS)
+            : uint32(UNIT_UPDATE_FIELD_BLOCKS);
+
     for (uint16 index = 0; index < m_valuesCount; ++index) {
+        if (updateType == UPDATETYPE_VALUES &&
+            index % UpdateMask::CLIENT_UPDATE_MASK_BITS == 0) {
+            uint32 block = index / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+            if (!_changesMask.GetBlock(block) &&
+                !(UnitUpdateFieldBlockFlags[block] & alwaysSentFlags) &&
+                block != auraStateBlock) {
+                index += UpdateMask::CLIENT_UPDATE_MASK_BITS - 1;
+                continue;
+            }
+        }
+
         if (_fieldNotifyFlags & flags[index] ||
             ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
             ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index)
@@ -31,6 +31,7 @@
 #include "SpellAuraDefines.h"
 #include "SpellDefines.h"
 #include "ThreatMgr.h"
+#include <array>
 #include <functional>
 #include <utility>
 
@@ -2102,6 +2103,13 @@ public:
                                HealInfo*        healInfo            = nullptr,
                                uint32 procPhase = 2 /*PROC_SPELL_PHASE_HIT*/);
 
+    // Proc flags ProcDamageAndSpellFor can find a triggering aura for
+    [[nodiscard]] uint32 GetAppliedAuraProcFlags() const
+    {
+        return m_appliedAuraProcFlags;
+    }
+    void UpdateAppliedAuraProcFlags();
+
     void GetProcAurasTriggeredOnEvent(
         std::list<AuraApplication*>& aurasTriggeringProc,
         std::list<AuraApplication*>* procAuras,
@@ -2599,6 +2607,9 @@ public:
     void SendSpellMiss(Unit* target, uint32 spellID, SpellMissInfo missInfo);
     void SendSpellDamageResist(Unit* target, uint32 spellId);
     void SendSpellDamageImmune(Unit* target, uint32 spellId);
+    // Combat log to the set within CombatLog.Range, other is the second unit
+    // of the event and always receives it
+    void SendCombatLogMessage(WorldPacket const* data, Unit const* other) const;
 
     void NearTeleportTo(Position& pos,
                         bool      casting         = false,
@@ -2647,6 +2658,15 @@ public:
     // type, uint32 MovementFlags, uint32 Time, Player* player = nullptr);
     void SendMovementFlagUpdate(bool self = false);
 
+    // Players that have this unit at their client, filled by the visibility
+    // updates. Entries are guids checked against HaveAtClient on use, so a
+    // stale one is dropped instead of ever being sent to.
+    void AddObserver(ObjectGuid guid) { m_observers.insert(guid); }
+    void RemoveObserver(ObjectGuid guid) { m_observers.erase(guid); }
+    // Relays a packet to the observers only, without visiting the grid.
+    void SendMessageToObservers(WorldPacket const* data,
+                                Player const*      skipped_rcvr);
+
     virtual bool SetWalk(bool enable);
     virtual bool SetDisableGravity(bool disable,
                                    bool packetOnly          = false,
@@ -4001,6 +4021,20 @@ protected:
     AuraMap::iterator  m_auraUpdateIterator;
     uint32             m_removedAurasCount;
 
+    // Auras per low byte of the spell id in m_ownedAuras / m_appliedAuras,
+    // lookups of spells the unit has no aura of skip the map walk
+    std::array<uint16, 256> m_ownedAuraIdCounts{};
+    std::array<uint16, 256> m_appliedAuraIdCounts{};
+
+    // Applied auras per proc flag bit, m_appliedAuraProcFlags has the bits
+    // with a non zero count; rebuilt when the proc tables are reloaded
+    std::array<uint16, 32> m_appliedAuraProcFlagCounts{};
+    uint32                 m_appliedAuraProcFlags = 0;
+    uint32                 m_appliedAuraProcGeneration;
+
+    void AddAppliedAuraProcFlags(uint32 mask);
+    void RemoveAppliedAuraProcFlags(uint32 mask);
+
     AuraEffectList m_modAuras[TOTAL_AURAS];
     AuraList       m_scAuras; // casted singlecast auras
     AuraApplicationList
@@ -4019,6 +4053,7 @@ protected:
 
     CharmInfo*       m_charmInfo;
     SharedVisionList m_sharedVision;
+    GuidUnorderedSet m_observers;
 
     MotionMaster* i_motionMaster;
 
@@ -599,12 +599,17 @@ void Vehicle::RelocatePassengers()
 {
     ASSERT(_me->GetMap());
 
-    std::vector<std::pair<Unit*, Position>> seatRelocation;
-    seatRelocation.reserve(Seats.size());
+    // called on every move of the base, usually with all seats empty, so
+    // collect on the stack (seats are bounded by the dbc) instead of the heap
+    std::array<std::pair<Unit*, Position>, MAX_VEHICLE_SEATS> seatRelocation;
+    std::size_t                                              count = 0;
 
     // not sure that absolute position calculation is correct, it must depend on
     // vehicle pitch angle
     for (auto const& itr : Seats) {
+        if (!itr.second.Passenger.Guid)
+            continue;
+
         if (Unit* passenger = ObjectAccessor::GetUnit(
                 *GetBase(), itr.second.Passenger.Guid)) {
             ASSERT(passenger->IsInWorld());
@@ -612,12 +617,12 @@ void Vehicle::RelocatePassengers()
             float px, py, pz, po;
             passenger->m_movementInfo.transport.pos.GetPosition(px, py, pz, po);
             CalculatePassengerPosition(px, py, pz, &po);
-            seatRelocation.emplace_back(passenger, Position(px, py, pz, po));
+            seatRelocation[count++] = {passenger, Position(px, py, pz, po)};
         }
     }
 
-    for (auto const& pair : seatRelocation)
-        pair.first->UpdatePosition(pair.second);
+    for (std::size_t i = 0; i < count; ++i)
+        seatRelocation[i].first->UpdatePosition(seatRelocation[i].second);
 }
 
 void Vehicle::Dismiss()
@@ -507,6 +507,8 @@ void GameEventMgr::LoadFromDB()
                 GuidLowList& crelist =
                     mGameEventCreatureGuids[internal_event_id];
                 crelist.push_back(guid);
+                if (event_id > 0)
+                    _creatureGuidEvents[guid].push_back(event_id);
 
                 ++count;
             } while (result->NextRow());
@@ -567,6 +569,8 @@ void GameEventMgr::LoadFromDB()
                 GuidLowList& golist =
                     mGameEventGameobjectGuids[internal_event_id];
                 golist.push_back(guid);
+                if (event_id > 0)
+                    _gameObjectGuidEvents[guid].push_back(event_id);
 
                 ++count;
             } while (result->NextRow());
@@ -1831,37 +1835,27 @@ bool GameEventMgr::hasGameObjectQuestActiveEventExcept(uint32 quest_id,
 bool GameEventMgr::hasCreatureActiveEventExcept(
     ObjectGuid::LowType creature_guid, uint16 event_id)
 {
-    for (ActiveEvents::iterator e_itr = m_ActiveEvents.begin();
-         e_itr != m_ActiveEvents.end();
-         ++e_itr) {
-        if ((*e_itr) != event_id) {
-            int32 internal_event_id = mGameEvent.size() + (*e_itr) - 1;
-            for (GuidLowList::iterator itr =
-                     mGameEventCreatureGuids[internal_event_id].begin();
-                 itr != mGameEventCreatureGuids[internal_event_id].end();
-                 ++itr)
-                if (*itr == creature_guid)
-                    return true;
-        }
-    }
+    auto itr = _creatureGuidEvents.find(creature_guid);
+    if (itr == _creatureGuidEvents.end())
+        return false;
+
+    for (uint16 otherEventId : itr->second)
+        if (otherEventId != event_id && IsActiveEvent(otherEventId))
+            return true;
+
     return false;
 }
 bool GameEventMgr::hasGameObjectActiveEventExcept(ObjectGuid::LowType go_guid,
                                                   uint16              event_id)
 {
-    for (ActiveEvents::iterator e_itr = m_ActiveEvents.begin();
-         e_itr != m_ActiveEvents.end();
-         ++e_itr) {
-        if ((*e_itr) != event_id) {
-            int32 internal_event_id = mGameEvent.size() + (*e_itr) - 1;
-            for (GuidLowList::iterator itr =
-                     mGameEventGameobjectGuids[internal_event_id].begin();
-                 itr != mGameEventGameobjectGuids[internal_event_id].end();
-                 ++itr)
-                if (*itr == go_guid)
-                    return true;
-        }
-    }
+    auto itr = _gameObjectGuidEvents.find(go_guid);
+    if (itr == _gameObjectGuidEvents.end())
+        return false;
+
+    for (uint16 otherEventId : itr->second)
+        if (otherEventId != event_id && IsActiveEvent(otherEventId))
+            return true;
+
     return false;
 }
 
@@ -165,7 +165,7 @@ private:
                                         uint16              event_id);
     void SetHolidayEventTime(GameEventData& event);
 
-    typedef std::list<ObjectGuid::LowType>             GuidLowList;
+    typedef std::vector<ObjectGuid::LowType>           GuidLowList;
     typedef std::list<uint32>                          IdList;
     typedef std::vector<GuidLowList>                   GameEventGuidMap;
     typedef std::vector<IdList>                        GameEventIdMap;
@@ -201,6 +201,13 @@ private:
     bool                       isSystemInit;
     GameEventSeasonalQuestsMap _gameEventSeasonalQuestsMap;
 
+    typedef std::unordered_map<ObjectGuid::LowType, std::vector<uint16>>
+        GuidEventsMap;
+    // positive events listing each spawn, checked on unspawn so a spawn
+    // shared with another active event stays in the world
+    GuidEventsMap _creatureGuidEvents;
+    GuidEventsMap _gameObjectGuidEvents;
+
 public:
     GameEventGuidMap    mGameEventCreatureGuids;
     GameEventGuidMap    mGameEventGameobjectGuids;
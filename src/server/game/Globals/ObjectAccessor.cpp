@@ -25,6 +25,7 @@
 #include "Log.h"
 #include "Map.h"
 #include "MapMgr.h"
+#include "MapUpdater.h"
 #include "ObjectDefines.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -44,6 +45,10 @@ void HashMapHolder<T>::Insert(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+
+    Shard&                              shard = GetShard(o->GetGUID());
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    shard.Objects.Insert(o->GetGUID().GetRawValue(), o);
 }
 
 template <class T>
@@ -52,15 +57,32 @@ void HashMapHolder<T>::Remove(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+
+    Shard&                              shard = GetShard(o->GetGUID());
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    shard.Objects.Erase(o->GetGUID().GetRawValue());
 }
 
 template <class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    Shard&                              shard = GetShard(guid);
+    std::shared_lock<std::shared_mutex> lock(shard.Lock);
+
+    return shard.Objects.Find(guid.GetRawValue());
+}
+
+template <class T>
+auto HashMapHolder<T>::GetShard(ObjectGuid guid) -> Shard&
+{
+    static std::array<Shard, SHARD_COUNT> _shards;
+
+    static_assert(SHARD_COUNT == 16, "shard index uses the top 4 hash bits");
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    // the flat maps use the low bits of the same hash for their slots
+    uint64 const hash =
+        Acore::FlatHashMap<uint64, T*>::Hash(guid.GetRawValue());
+    return _shards[hash >> 60];
 }
 
 template <class T>
@@ -260,15 +282,73 @@ Player* ObjectAccessor::FindConnectedPlayer(ObjectGuid const guid)
     return HashMapHolder<Player>::Find(guid);
 }
 
-void ObjectAccessor::SaveAllPlayers()
+void ObjectAccessor::SaveAllPlayers(bool parallel /*= false*/)
 {
     std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
 
-    HashMapHolder<Player>::MapType const& m = GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin();
-         itr != m.end();
-         ++itr)
-        itr->second->SaveToDB(false, false);
+    HashMapHolder<Player>::MapType const& m       = GetPlayers();
+    MapUpdater*                           updater = sMapMgr->GetMapUpdater();
+    if (!parallel || !updater->activated()) {
+        for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin();
+             itr != m.end();
+             ++itr)
+            itr->second->SaveToDB(false, false);
+
+        return;
+    }
+
+    // players per transaction, large enough to keep the async connections
+    // busy with few commits
+    static constexpr size_t SAVE_BATCH_SIZE = 50;
+
+    uint32 const oldMSTime = getMSTime();
+
+    size_t const        total = m.size();
+    std::atomic<size_t> saved{0};
+
+    // players of one map are only ever saved by the same worker
+    std::unordered_map<Map*, std::vector<Player*>> playersByMap;
+    for (auto const& [guid, player] : m) {
+        if (Map* map = player->FindMap())
+            playersByMap[map].push_back(player);
+        else {
+            player->SaveToDB(false, false);
+            ++saved;
+        }
+    }
+
+    for (auto& [map, players] : playersByMap) {
+        updater->schedule_task(
+            [players = std::move(players), total, &saved]() {
+                for (size_t i = 0; i < players.size(); i += SAVE_BATCH_SIZE) {
+                    size_t const end =
+                        std::min(i + SAVE_BATCH_SIZE, players.size());
+
+                    CharacterDatabaseTransaction trans =
+                        CharacterDatabase.BeginTransaction();
+                    for (size_t j = i; j < end; ++j)
+                        players[j]->SaveToDB(trans, false, false);
+
+                    CharacterDatabase.CommitTransaction(trans);
+
+                    // report every 10% of the players
+                    size_t const before = saved.fetch_add(end - i);
+                    if (before * 10 / total != (before + end - i) * 10 / total)
+                        LOG_INFO("server",
+                                 "> Saved {}/{} players",
+                                 before + end - i,
+                                 total);
+                }
+            },
+            map->GetLastUpdateCost());
+    }
+
+    updater->wait();
+
+    LOG_INFO("server",
+             "> Saved {} players in {} ms",
+             total,
+             GetMSTimeDiffToNow(oldMSTime));
 }
 
 Player* ObjectAccessor::FindPlayerByName(std::string const& name,
@@ -20,9 +20,11 @@
 #define ACORE_OBJECTACCESSOR_H
 
 #include "Define.h"
+#include "FlatHashMap.h"
 #include "GridDefines.h"
 #include "Object.h"
 #include "UpdateData.h"
+#include <array>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
@@ -46,6 +48,17 @@ class HashMapHolder {
     // Non instanceable only static
     HashMapHolder() = default;
 
+    /// Lookup copy of the container split by guid, every shard has its own
+    /// lock so lookups from different map threads rarely share a lock
+    struct alignas(64) Shard {
+        std::shared_mutex              Lock;
+        Acore::FlatHashMap<uint64, T*> Objects;
+    };
+
+    static constexpr std::size_t SHARD_COUNT = 16;
+
+    static Shard& GetShard(ObjectGuid guid);
+
 public:
     typedef std::unordered_map<ObjectGuid, T*> MapType;
 
@@ -55,6 +68,7 @@ public:
 
     static T* Find(ObjectGuid guid);
 
+    /// Only for iterating, lookups go through Find
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
@@ -100,7 +114,10 @@ void RemoveObject(T* object)
     HashMapHolder<T>::Remove(object);
 }
 
-void SaveAllPlayers();
+//! Saves every online player. With parallel the players of each map are
+//! saved in batched transactions on the map update workers, this must only
+//! be used from the world thread while the maps are not being updated
+void SaveAllPlayers(bool parallel = false);
 
 template <>
 void AddObject(Player* player);
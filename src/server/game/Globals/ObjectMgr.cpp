@@ -264,6 +264,13 @@ bool normalizePlayerName(std::string& name)
     if (name.find(" ") != std::string::npos)
         return false;
 
+    // nearly every name is plain ASCII, fold it in place
+    if (IsAsciiString(name)) {
+        std::transform(name.begin(), name.end(), name.begin(), charToLower);
+        name[0] = charToUpper(name[0]);
+        return true;
+    }
+
     std::wstring tmp;
     if (!Utf8toWStr(name, tmp))
         return false;
@@ -346,8 +353,15 @@ bool SpellClickInfo::IsFitToRequirements(Unit const* clicker,
 
 ObjectMgr::ObjectMgr()
     : _auctionId(1), _equipmentSetGuid(1), _mailId(1), _hiPetNumber(1),
-      _creatureSpawnId(1), _gameObjectSpawnId(1), DBCLocaleIndex(LOCALE_enUS)
+      _creatureSpawnId(1), _gameObjectSpawnId(1), DBCLocaleIndex(LOCALE_enUS),
+      _loadedLocaleMask((1 << TOTAL_LOCALES) - 1)
 {
+    CreateGuidGenerator<HighGuid::Player>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Item>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Mo_Transport>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Group>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Instance>(_guidGenerators);
+
     for (uint8 i = 0; i < MAX_CLASSES; ++i) {
         _playerClassInfo[i] = nullptr;
         for (uint8 j = 0; j < MAX_RACES; ++j)
@@ -467,7 +481,7 @@ void ObjectMgr::LoadCreatureLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         CreatureLocale& data = _creatureLocaleStore[ID];
@@ -502,7 +516,7 @@ void ObjectMgr::LoadGossipMenuItemsLocales()
         uint16 OptionID = fields[1].Get<uint16>();
 
         LocaleConstant locale = GetLocaleByName(fields[2].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         GossipMenuItemsLocale& data =
@@ -538,7 +552,10 @@ void ObjectMgr::LoadPetNamesLocales()
     do {
         Field*         fields = result->Fetch();
         LocaleConstant locale = GetLocaleByName(fields[0].Get<std::string>());
-        std::string    word   = fields[1].Get<std::string>();
+        if (locale != LOCALE_enUS && !ShouldLoadLocale(locale))
+            continue;
+
+        std::string word = fields[1].Get<std::string>();
 
         uint32                            entry = fields[2].Get<uint32>();
         bool                              half  = fields[3].Get<bool>();
@@ -579,7 +596,7 @@ void ObjectMgr::LoadPointOfInterestLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         PointOfInterestLocale& data = _pointOfInterestLocaleStore[ID];
@@ -1059,6 +1076,43 @@ void ObjectMgr::LoadCreatureCustomIDs()
     }
 }
 
+/**
+ * @brief Load config option Locales.Loaded into the loaded locale mask
+ */
+void ObjectMgr::LoadLocaleSettings()
+{
+    std::string stringLocales =
+        sConfigMgr->GetOption<std::string>("Locales.Loaded", "");
+    std::vector<std::string_view> locales =
+        Acore::Tokenize(stringLocales, ',', false);
+
+    // an empty list keeps every locale, as before the option existed
+    if (locales.empty()) {
+        _loadedLocaleMask = (1 << TOTAL_LOCALES) - 1;
+        return;
+    }
+
+    _loadedLocaleMask = 0;
+    std::string loadedLocalesStr;
+    for (std::string_view name : locales) {
+        LocaleConstant locale = GetLocaleByName(std::string(name));
+        if (locale == LOCALE_enUS && name != localeNames[LOCALE_enUS]) {
+            LOG_ERROR("server.loading",
+                      "Locales.Loaded contains unknown locale '{}', skipped.",
+                      name);
+            continue;
+        }
+
+        _loadedLocaleMask |= (1 << locale);
+        loadedLocalesStr += localeNames[locale];
+        loadedLocalesStr += " ";
+    }
+
+    LOG_INFO("server.loading",
+             "Loading localized world data only for locales: {}",
+             loadedLocalesStr.empty() ? "<none>" : loadedLocalesStr);
+}
+
 void ObjectMgr::CheckCreatureTemplate(CreatureTemplate const* cInfo)
 {
     if (!cInfo)
@@ -2947,6 +3001,21 @@ void ObjectMgr::LoadCreatures()
     LOG_INFO("server.loading", " ");
 }
 
+static void InsertCellGuid(CellGuidSet& guids, ObjectGuid::LowType guid)
+{
+    // spawns are mostly added in guid order, making this an append
+    auto itr = std::lower_bound(guids.begin(), guids.end(), guid);
+    if (itr == guids.end() || *itr != guid)
+        guids.insert(itr, guid);
+}
+
+static void EraseCellGuid(CellGuidSet& guids, ObjectGuid::LowType guid)
+{
+    auto itr = std::lower_bound(guids.begin(), guids.end(), guid);
+    if (itr != guids.end() && *itr == guid)
+        guids.erase(itr);
+}
+
 void ObjectMgr::AddCreatureToGrid(ObjectGuid::LowType guid,
                                   CreatureData const* data)
 {
@@ -2958,7 +3027,7 @@ void ObjectMgr::AddCreatureToGrid(ObjectGuid::LowType guid,
             CellObjectGuids& cell_guids =
                 _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)]
                                     [cellCoord.GetId()];
-            cell_guids.creatures.insert(guid);
+            InsertCellGuid(cell_guids.creatures, guid);
         }
     }
 }
@@ -2974,7 +3043,7 @@ void ObjectMgr::RemoveCreatureFromGrid(ObjectGuid::LowType guid,
             CellObjectGuids& cell_guids =
                 _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)]
                                     [cellCoord.GetId()];
-            cell_guids.creatures.erase(guid);
+            EraseCellGuid(cell_guids.creatures, guid);
         }
     }
 }
@@ -3368,7 +3437,7 @@ void ObjectMgr::AddGameobjectToGrid(ObjectGuid::LowType   guid,
             CellObjectGuids& cell_guids =
                 _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)]
                                     [cellCoord.GetId()];
-            cell_guids.gameobjects.insert(guid);
+            InsertCellGuid(cell_guids.gameobjects, guid);
         }
     }
 }
@@ -3384,7 +3453,7 @@ void ObjectMgr::RemoveGameobjectFromGrid(ObjectGuid::LowType   guid,
             CellObjectGuids& cell_guids =
                 _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)]
                                     [cellCoord.GetId()];
-            cell_guids.gameobjects.erase(guid);
+            EraseCellGuid(cell_guids.gameobjects, guid);
         }
     }
 }
@@ -3406,7 +3475,7 @@ void ObjectMgr::LoadItemLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         ItemLocale& data = _itemLocaleStore[ID];
@@ -4355,7 +4424,7 @@ void ObjectMgr::LoadItemSetNameLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         ItemSetNameLocale& data = _itemSetNameLocaleStore[ID];
@@ -6754,7 +6823,7 @@ void ObjectMgr::LoadQuestLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         QuestLocale& data = _questLocaleStore[ID];
@@ -7574,7 +7643,7 @@ void ObjectMgr::LoadPageTextLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         PageTextLocale& data = _pageTextLocaleStore[ID];
@@ -7889,7 +7958,7 @@ void ObjectMgr::LoadNpcTextLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         NpcTextLocale& data = _npcTextLocaleStore[ID];
@@ -8244,7 +8313,7 @@ void ObjectMgr::LoadQuestGreetingsLocales()
         std::string localeName = fields[2].Get<std::string>();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         QuestGreetingLocale& data =
@@ -8278,7 +8347,7 @@ void ObjectMgr::LoadQuestOfferRewardLocale()
         std::string localeName = fields[1].Get<std::string>();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         QuestOfferRewardLocale& data = _questOfferRewardLocaleStore[id];
@@ -8310,7 +8379,7 @@ void ObjectMgr::LoadQuestRequestItemsLocale()
         std::string localeName = fields[1].Get<std::string>();
 
         LocaleConstant locale = GetLocaleByName(localeName);
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         QuestRequestItemsLocale& data = _questRequestItemsLocaleStore[id];
@@ -8962,6 +9031,9 @@ void ObjectMgr::SetHighestGuids()
         GetGuidSequenceGenerator<HighGuid::Item>()
             .GetNextAfterMaxUsed()); // One-time query
 
+    GetGuidSequenceGenerator<HighGuid::Item>().SetLeaseSize(
+        sWorld->getIntConfig(CONFIG_MAP_UPDATE_ITEM_GUID_BLOCK));
+
     result = WorldDatabase.Query("SELECT MAX(guid) FROM transports");
     if (result)
         GetGuidSequenceGenerator<HighGuid::Mo_Transport>().Set(
@@ -9076,7 +9148,7 @@ void ObjectMgr::LoadGameObjectLocales()
         uint32 ID = fields[0].Get<uint32>();
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         GameObjectLocale& data = _gameObjectLocaleStore[ID];
@@ -12125,7 +12197,7 @@ void ObjectMgr::LoadBroadcastTextLocales()
         }
 
         LocaleConstant locale = GetLocaleByName(fields[1].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!ShouldLoadLocale(locale))
             continue;
 
         AddLocaleString(
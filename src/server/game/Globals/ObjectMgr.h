@@ -38,6 +38,7 @@
 #include "QuestDef.h"
 #include "TemporarySummon.h"
 #include "VehicleDefines.h"
+#include <array>
 #include <functional>
 #include <limits>
 #include <map>
@@ -518,7 +519,9 @@ struct BroadcastText {
 
 typedef std::unordered_map<uint32, BroadcastText> BroadcastTextContainer;
 
-typedef std::set<ObjectGuid::LowType> CellGuidSet;
+// sorted by guid, cells hold few spawns so a flat vector is much smaller
+// and faster to walk than a node based set
+typedef std::vector<ObjectGuid::LowType> CellGuidSet;
 
 struct CellObjectGuids {
     CellGuidSet creatures;
@@ -1173,6 +1176,7 @@ public:
     void LoadCreatureTemplateResistances();
     void LoadCreatureTemplateSpells();
     void LoadCreatureCustomIDs();
+    void LoadLocaleSettings();
     void CheckCreatureTemplate(CreatureTemplate const* cInfo);
     void CheckCreatureMovement(char const*           table,
                                uint64                id,
@@ -1683,6 +1687,12 @@ public:
         return _gossipMenuItemsStore.equal_range(uiMenuId);
     }
 
+    // enUS strings live in the base tables and are never stored as locales
+    [[nodiscard]] bool ShouldLoadLocale(LocaleConstant locale) const
+    {
+        return locale != LOCALE_enUS && (_loadedLocaleMask & (1 << locale));
+    }
+
     static void AddLocaleString(std::string&&             s,
                                 LocaleConstant            locale,
                                 std::vector<std::string>& data);
@@ -1753,19 +1763,11 @@ private:
     template <HighGuid high>
     inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
     {
-        auto itr = _guidGenerators.find(high);
-        if (itr == _guidGenerators.end())
-            itr = _guidGenerators
-                      .insert(std::make_pair(
-                          high,
-                          std::unique_ptr<ObjectGuidGenerator<high>>(
-                              new ObjectGuidGenerator<high>())))
-                      .first;
-
-        return *itr->second;
+        return *_guidGenerators[ObjectGuidTraits<high>::GeneratorSlot];
     }
 
-    std::map<HighGuid, std::unique_ptr<ObjectGuidGeneratorBase>>
+    std::array<std::unique_ptr<ObjectGuidGeneratorBase>,
+               MAX_GLOBAL_GUID_GENERATORS>
         _guidGenerators;
 
     QuestMap            _questTemplates;
@@ -1820,6 +1822,7 @@ private:
     VehicleAccessoryContainer _vehicleAccessoryStore;
 
     LocaleConstant DBCLocaleIndex;
+    uint32         _loadedLocaleMask; // from config, locales of *_locale tables
 
     PageTextContainer         _pageTextStore;
     InstanceTemplateContainer _instanceTemplateStore;
@@ -20,14 +20,86 @@
 #define _GRIDREFMANAGER
 
 #include "RefMgr.h"
+#include <iterator>
+#include <vector>
 
 template <class OBJECT>
 class GridReference;
 
+/*
+ * Besides the intrusive list every linked reference owns a slot in a
+ * contiguous table. Visitors iterate that table instead of chasing the list
+ * nodes through the objects, freed slots are kept on a free list and reused
+ * by the next link. Iterators are index based, so references may be linked
+ * or unlinked while a visit is in progress.
+ */
 template <class OBJECT>
 class GridRefMgr : public RefMgr<GridRefMgr<OBJECT>, OBJECT> {
+    friend class GridReference<OBJECT>;
+
 public:
-    typedef LinkedListHead::Iterator<GridReference<OBJECT>> iterator;
+    class iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef GridReference<OBJECT>     value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef GridReference<OBJECT>*    pointer;
+        typedef GridReference<OBJECT>&    reference;
+
+        iterator() : _mgr(nullptr), _slot(0) {}
+        iterator(GridRefMgr* mgr, std::size_t slot) : _mgr(mgr), _slot(slot)
+        {
+            SkipFreeSlots();
+        }
+
+        reference operator*() const { return *_mgr->_slots[_slot]; }
+        pointer   operator->() const { return _mgr->_slots[_slot]; }
+
+        iterator& operator++()
+        {
+            ++_slot;
+            SkipFreeSlots();
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(iterator const& right) const
+        {
+            if (IsEnd() || right.IsEnd())
+                return IsEnd() == right.IsEnd();
+
+            return _mgr == right._mgr && _slot == right._slot;
+        }
+
+        bool operator!=(iterator const& right) const
+        {
+            return !(*this == right);
+        }
+
+    private:
+        [[nodiscard]] bool IsEnd() const
+        {
+            return !_mgr || _slot >= _mgr->_slots.size();
+        }
+
+        void SkipFreeSlots()
+        {
+            while (!IsEnd() && !_mgr->_slots[_slot])
+                ++_slot;
+        }
+
+        GridRefMgr* _mgr;
+        std::size_t _slot;
+    };
+
+    // references must release their slots before the table is destroyed
+    ~GridRefMgr() override { this->clearReferences(); }
 
     GridReference<OBJECT>* getFirst()
     {
@@ -40,9 +112,37 @@ public:
             RefMgr<GridRefMgr<OBJECT>, OBJECT>::getLast();
     }
 
-    iterator begin() { return iterator(getFirst()); }
-    iterator end() { return iterator(nullptr); }
-    iterator rbegin() { return iterator(getLast()); }
-    iterator rend() { return iterator(nullptr); }
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(); }
+
+private:
+    void AddSlot(GridReference<OBJECT>* ref)
+    {
+        if (_freeSlots.empty()) {
+            ref->_slot = uint32(_slots.size());
+            _slots.push_back(ref);
+            return;
+        }
+
+        ref->_slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        _slots[ref->_slot] = ref;
+    }
+
+    void RemoveSlot(GridReference<OBJECT>* ref)
+    {
+        _slots[ref->_slot] = nullptr;
+
+        // last reference gone, start over with an empty table
+        if (_freeSlots.size() + 1 == _slots.size()) {
+            _slots.clear();
+            _freeSlots.clear();
+        }
+        else
+            _freeSlots.push_back(ref->_slot);
+    }
+
+    std::vector<GridReference<OBJECT>*> _slots;
+    std::vector<uint32>                 _freeSlots;
 };
 #endif
@@ -26,23 +26,29 @@ class GridRefMgr;
 
 template <class OBJECT>
 class GridReference : public Reference<GridRefMgr<OBJECT>, OBJECT> {
+    friend class GridRefMgr<OBJECT>;
+
 protected:
     void targetObjectBuildLink() override
     {
         // called from link()
         this->getTarget()->insertFirst(this);
         this->getTarget()->incSize();
+        this->getTarget()->AddSlot(this);
     }
     void targetObjectDestroyLink() override
     {
         // called from unlink()
-        if (this->isValid())
+        if (this->isValid()) {
             this->getTarget()->decSize();
+            this->getTarget()->RemoveSlot(this);
+        }
     }
     void sourceObjectDestroyLink() override
     {
         // called from invalidate()
         this->getTarget()->decSize();
+        this->getTarget()->RemoveSlot(this);
     }
 
 public:
@@ -52,5 +58,8 @@ public:
     {
         return (GridReference*)Reference<GridRefMgr<OBJECT>, OBJECT>::next();
     }
+
+private:
+    uint32 _slot{0}; // index in the slot table of the target GridRefMgr
 };
 #endif
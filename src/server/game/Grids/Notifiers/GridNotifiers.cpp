@@ -78,10 +78,9 @@ void VisibleNotifier::SendToSelf()
     for (GuidUnorderedSet::const_iterator it = vis_guids.begin();
          it != vis_guids.end();
          ++it) {
-        if (WorldObject* obj = ObjectAccessor::GetWorldObject(i_player, *it)) {
-            if (i_largeOnly != obj->IsVisibilityOverridden())
-                continue;
-        }
+        WorldObject* obj = ObjectAccessor::GetWorldObject(i_player, *it);
+        if (obj && i_largeOnly != obj->IsVisibilityOverridden())
+            continue;
 
         // pussywizard: static transports are removed only in
         // RemovePlayerFromMap and here if can no longer detect (eg. phase
@@ -93,6 +92,8 @@ void VisibleNotifier::SendToSelf()
 
         i_player.m_clientGUIDs.erase(*it);
         i_data.AddOutOfRangeGUID(*it);
+        if (Unit* unit = obj ? obj->ToUnit() : nullptr)
+            unit->RemoveObserver(i_player.GetGUID());
 
         if ((*it).IsPlayer()) {
             Player* player = ObjectAccessor::FindPlayer(*it);
@@ -165,6 +166,11 @@ inline void CreatureUnitRelocationWorker(Creature* c, Unit* u)
         return;
     }
 
+    // stealth alerts are not bound to the aggro range
+    if (c->IsOutOfMoveInLineOfSightRange(u) &&
+        !(u->GetTypeId() == TYPEID_PLAYER && u->HasStealthAura()))
+        return;
+
     if (!c->HasUnitState(UNIT_STATE_SIGHTLESS)) {
         if (c->IsAIEnabled && c->CanSeeOrDetect(u, false, true)) {
             c->AI()->MoveInLineOfSight_Safe(u);
@@ -118,6 +118,10 @@ struct MessageDistDeliverer {
     float              i_distSq;
     TeamId             teamId;
     Player const*      skipped_receiver;
+
+    // copy of i_message shared by all receivers, made for the first one
+    std::shared_ptr<WorldPacket const> i_sharedMessage;
+
     MessageDistDeliverer(WorldObject const* src,
                          WorldPacket const* msg,
                          float              dist,
@@ -150,7 +154,10 @@ struct MessageDistDeliverer {
         if (!player->HaveAtClient(i_source))
             return;
 
-        player->GetSession()->SendPacket(i_message);
+        if (!i_sharedMessage)
+            i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+        player->GetSession()->SendPacket(i_sharedMessage);
     }
 };
 
@@ -982,8 +989,8 @@ public:
     }
     bool operator()(Unit* u)
     {
-        if (u->IsAlive() && u->IsInCombat() && !i_obj->IsHostileTo(u) &&
-            i_obj->IsWithinDistInMap(u, i_range) &&
+        if (u->IsAlive() && u->IsInCombat() &&
+            i_obj->IsWithinDistInMap(u, i_range) && !i_obj->IsHostileTo(u) &&
             u->GetMaxHealth() - u->GetHealth() > i_hp) {
             i_hp = u->GetMaxHealth() - u->GetHealth();
             return true;
@@ -1010,8 +1017,8 @@ public:
 
     bool operator()(Unit* u)
     {
-        if (u->IsAlive() && u->IsInCombat() && !i_obj->IsHostileTo(u) &&
-            i_obj->IsWithinDistInMap(u, i_range) &&
+        if (u->IsAlive() && u->IsInCombat() &&
+            i_obj->IsWithinDistInMap(u, i_range) && !i_obj->IsHostileTo(u) &&
             i_minHpPct <= u->GetHealthPct() &&
             u->GetHealthPct() <= i_maxHpPct && u->GetHealthPct() < i_hpPct) {
             i_hpPct = u->GetHealthPct();
@@ -1035,8 +1042,8 @@ public:
     }
     bool operator()(Unit* u)
     {
-        if (u->IsAlive() && u->IsInCombat() && !i_obj->IsHostileTo(u) &&
-            i_obj->IsWithinDistInMap(u, i_range) &&
+        if (u->IsAlive() && u->IsInCombat() &&
+            i_obj->IsWithinDistInMap(u, i_range) && !i_obj->IsHostileTo(u) &&
             (u->isFeared() || u->IsCharmed() || u->isFrozen() ||
              u->HasUnitState(UNIT_STATE_STUNNED) ||
              u->HasUnitState(UNIT_STATE_CONFUSED))) {
@@ -1064,8 +1071,9 @@ public:
     }
     bool operator()(Unit* u)
     {
-        if (u->IsAlive() && u->IsInCombat() && !i_obj->IsHostileTo(u) &&
-            i_obj->IsWithinDistInMap(u, i_range) && !(u->HasAura(i_spell))) {
+        if (u->IsAlive() && u->IsInCombat() &&
+            i_obj->IsWithinDistInMap(u, i_range) && !i_obj->IsHostileTo(u) &&
+            !(u->HasAura(i_spell))) {
             return true;
         }
         return false;
@@ -1375,11 +1383,13 @@ public:
             }
         }
 
-        if (i_funit->_IsValidAttackTarget(
+        // the range check is far cheaper than the attack target validation,
+        // and most units of the visited cells are out of range anyway
+        if (i_obj->IsWithinDistInMap(u, i_range) &&
+            i_funit->_IsValidAttackTarget(
                 u,
                 _spellInfo,
-                i_obj->GetTypeId() == TYPEID_DYNAMICOBJECT ? i_obj : nullptr) &&
-            i_obj->IsWithinDistInMap(u, i_range))
+                i_obj->GetTypeId() == TYPEID_DYNAMICOBJECT ? i_obj : nullptr))
             return true;
 
         return false;
@@ -2064,17 +2074,12 @@ class LocalizedPacketDo {
 public:
     explicit LocalizedPacketDo(Builder& builder) : i_builder(builder) {}
 
-    ~LocalizedPacketDo()
-    {
-        for (size_t i = 0; i < i_data_cache.size(); ++i)
-            delete i_data_cache[i];
-    }
     void operator()(Player* p);
 
 private:
     Builder& i_builder;
-    std::vector<WorldPacket*>
-        i_data_cache; // 0 = default, i => i-1 locale index
+    // built on first use for each locale
+    std::array<Optional<WorldPacket>, TOTAL_LOCALES> i_data_cache;
 };
 
 // Prepare using Builder localized packets with caching and send to player
@@ -2086,16 +2091,15 @@ public:
 
     ~LocalizedPacketListDo()
     {
-        for (size_t i = 0; i < i_data_cache.size(); ++i)
-            for (size_t j = 0; j < i_data_cache[i].size(); ++j)
-                delete i_data_cache[i][j];
+        for (WorldPacketList const& data_list : i_data_cache)
+            for (WorldPacket* data : data_list)
+                delete data;
     }
     void operator()(Player* p);
 
 private:
-    Builder&                     i_builder;
-    std::vector<WorldPacketList> i_data_cache;
-    // 0 = default, i => i-1 locale index
+    Builder&                                   i_builder;
+    std::array<WorldPacketList, TOTAL_LOCALES> i_data_cache;
 };
 } // namespace Acore
 #endif
@@ -515,49 +515,28 @@ void Acore::PlayerLastSearcher<Check>::Visit(PlayerMapType& m)
 template <class Builder>
 void Acore::LocalizedPacketDo<Builder>::operator()(Player* p)
 {
-    LocaleConstant loc_idx   = p->GetSession()->GetSessionDbLocaleIndex();
-    uint32         cache_idx = loc_idx + 1;
-    WorldPacket*   data;
+    LocaleConstant         loc_idx = p->GetSession()->GetSessionDbLocaleIndex();
+    Optional<WorldPacket>& data    = i_data_cache[loc_idx];
 
     // create if not cached yet
-    if (i_data_cache.size() < cache_idx + 1 || !i_data_cache[cache_idx]) {
-        if (i_data_cache.size() < cache_idx + 1)
-            i_data_cache.resize(cache_idx + 1);
+    if (!data)
+        i_builder(data.emplace(), loc_idx);
 
-        data = new WorldPacket();
-
-        i_builder(*data, loc_idx);
-
-        i_data_cache[cache_idx] = data;
-    }
-    else
-        data = i_data_cache[cache_idx];
-
-    p->SendDirectMessage(data);
+    p->SendDirectMessage(&*data);
 }
 
 template <class Builder>
 void Acore::LocalizedPacketListDo<Builder>::operator()(Player* p)
 {
     LocaleConstant   loc_idx   = p->GetSession()->GetSessionDbLocaleIndex();
-    uint32           cache_idx = loc_idx + 1;
-    WorldPacketList* data_list;
+    WorldPacketList& data_list = i_data_cache[loc_idx];
 
     // create if not cached yet
-    if (i_data_cache.size() < cache_idx + 1 ||
-        i_data_cache[cache_idx].empty()) {
-        if (i_data_cache.size() < cache_idx + 1)
-            i_data_cache.resize(cache_idx + 1);
-
-        data_list = &i_data_cache[cache_idx];
-
-        i_builder(*data_list, loc_idx);
-    }
-    else
-        data_list = &i_data_cache[cache_idx];
+    if (data_list.empty())
+        i_builder(data_list, loc_idx);
 
-    for (size_t i = 0; i < data_list->size(); ++i)
-        p->SendDirectMessage((*data_list)[i]);
+    for (WorldPacket* data : data_list)
+        p->SendDirectMessage(data);
 }
 
 #endif // ACORE_GRIDNOTIFIERSIMPL_H
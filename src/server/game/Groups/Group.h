@@ -124,6 +124,20 @@ enum GroupUpdateFlags {
     GROUP_UPDATE_FULL = 0x0007FFFF, // all known flags
 };
 
+// fields sent to out of range members at most every Group.MemberStats.*
+enum GroupUpdateThrottle : uint8 {
+    GROUP_UPDATE_THROTTLE_HEALTH,
+    GROUP_UPDATE_THROTTLE_POSITION,
+    GROUP_UPDATE_THROTTLE_AURAS,
+    MAX_GROUP_UPDATE_THROTTLES
+};
+
+static constexpr uint32 GroupUpdateThrottleFlags[MAX_GROUP_UPDATE_THROTTLES] = {
+    GROUP_UPDATE_FLAG_CUR_HP | GROUP_UPDATE_FLAG_CUR_POWER |
+        GROUP_UPDATE_FLAG_PET_CUR_HP | GROUP_UPDATE_FLAG_PET_CUR_POWER,
+    GROUP_UPDATE_FLAG_POSITION,
+    GROUP_UPDATE_FLAG_AURAS | GROUP_UPDATE_FLAG_PET_AURAS};
+
 enum lfgGroupFlags {
     GROUP_LFG_FLAG_APPLY_RANDOM_BUFF  = 0x001,
     GROUP_LFG_FLAG_IS_RANDOM_INSTANCE = 0x002,
@@ -148,7 +148,7 @@ Guild::LogHolder<Entry>::LogHolder()
     : m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry>
                                             ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT
                                             : CONFIG_GUILD_EVENT_LOG_COUNT)),
-      m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
+      m_newest(0), m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
 {
 }
 
@@ -156,7 +156,8 @@ template <typename Entry>
 template <typename... Ts>
 void Guild::LogHolder<Entry>::LoadEvent(Ts&&... args)
 {
-    Entry const& newEntry = m_log.emplace_front(std::forward<Ts>(args)...);
+    // Events are loaded from the newest to the oldest
+    Entry const& newEntry = m_log.emplace_back(std::forward<Ts>(args)...);
     if (m_nextGUID == uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
         m_nextGUID = newEntry.GetGUID();
 }
@@ -166,14 +167,26 @@ template <typename... Ts>
 void Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans,
                                        Ts&&... args)
 {
-    // Check max records limit
-    if (!CanInsert()) {
-        m_log.pop_front();
+    Entry* entry;
+    // Check max records limit, a full log overwrites its oldest entry
+    if (!CanInsert() && !m_log.empty()) {
+        m_newest = (m_newest + m_log.size() - 1) % m_log.size();
+        entry    = &(m_log[m_newest] = Entry(std::forward<Ts>(args)...));
+    }
+    else {
+        // The ring only rotates once full, so m_newest is still the front
+        entry = &*m_log.emplace(m_log.begin(), std::forward<Ts>(args)...);
     }
-    // Add event to list
-    Entry const& entry = m_log.emplace_back(std::forward<Ts>(args)...);
     // Save to DB
-    entry.SaveToDB(trans);
+    entry->SaveToDB(trans);
+}
+
+template <typename Entry>
+template <typename Worker>
+void Guild::LogHolder<Entry>::DoForAllEntries(Worker&& worker) const
+{
+    for (size_t i = m_log.size(); i > 0; --i)
+        worker(m_log[(m_newest + i - 1) % m_log.size()]);
 }
 
 template <typename Entry>
@@ -1301,7 +1314,7 @@ void Guild::UpdateMemberData(Player* player, uint8 dataid, uint32 value)
                       value);
             return;
         }
-        // HandleRoster();
+        _InvalidateRosterCache();
     }
 }
 
@@ -1312,6 +1325,7 @@ void Guild::OnPlayerStatusChange(Player* player, uint32 flag, bool state)
             member->AddFlag(flag);
         else
             member->RemFlag(flag);
+        _InvalidateRosterCache();
     }
 }
 
@@ -1334,6 +1348,21 @@ bool Guild::SetName(std::string_view const& name)
 
 void Guild::HandleRoster(WorldSession* session)
 {
+    bool sendOfficerNote =
+        _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
+
+    // Every member's LastSave is relative to the current game time, so a
+    // cached roster is only reused within the second it was built in
+    Seconds      now    = GameTime::GetGameTime();
+    WorldPacket& cached = m_rosterCache[sendOfficerNote];
+    if (m_rosterCacheTime[sendOfficerNote] == now) {
+        LOG_DEBUG("guild",
+                  "SMSG_GUILD_ROSTER [{}] (cached)",
+                  session->GetPlayerInfo());
+        session->SendPacket(&cached);
+        return;
+    }
+
     WorldPackets::Guild::GuildRoster roster;
 
     roster.RankData.reserve(m_ranks.size());
@@ -1349,8 +1378,6 @@ void Guild::HandleRoster(WorldSession* session)
         }
     }
 
-    bool sendOfficerNote =
-        _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
     roster.MemberData.reserve(m_members.size());
     for (auto const& [guid, member] : m_members) {
         WorldPackets::Guild::GuildRosterMemberData& memberData =
@@ -1359,9 +1386,8 @@ void Guild::HandleRoster(WorldSession* session)
         memberData.Guid     = member.GetGUID();
         memberData.RankID   = int32(member.GetRankId());
         memberData.AreaID   = int32(member.GetZoneId());
-        memberData.LastSave = float(
-            float(GameTime::GetGameTime().count() - member.GetLogoutTime()) /
-            DAY);
+        memberData.LastSave =
+            float(float(now.count() - member.GetLogoutTime()) / DAY);
 
         memberData.Status  = member.GetFlags();
         memberData.Level   = member.GetLevel();
@@ -1377,8 +1403,12 @@ void Guild::HandleRoster(WorldSession* session)
     roster.WelcomeText = m_motd;
     roster.InfoText    = m_info;
 
+    roster.Write();
+    cached                             = roster.Move();
+    m_rosterCacheTime[sendOfficerNote] = now;
+
     LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
-    session->SendPacket(roster.Write());
+    session->SendPacket(&cached);
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -1415,6 +1445,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string_view motd)
             session, GUILD_COMMAND_EDIT_MOTD, ERR_GUILD_PERMISSIONS);
     else {
         m_motd = motd;
+        _InvalidateRosterCache();
 
         sScriptMgr->OnGuildMOTDChanged(this, m_motd);
 
@@ -1436,6 +1467,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string_view info)
     // Player must have rights to set guild's info
     if (_HasRankRight(session->GetPlayer(), GR_RIGHT_MODIFY_GUILD_INFO)) {
         m_info = info;
+        _InvalidateRosterCache();
 
         sScriptMgr->OnGuildInfoChanged(this, m_info);
 
@@ -1531,6 +1563,7 @@ void Guild::HandleSetMemberNote(WorldSession*    session,
         else
             member->SetOfficerNote(note);
 
+        _InvalidateRosterCache();
         HandleRoster(session);
     }
 }
@@ -1551,6 +1584,7 @@ void Guild::HandleSetRankInfo(
     else if (RankInfo* rankInfo = GetRankInfo(rankId)) {
         rankInfo->SetName(name);
         rankInfo->SetRights(rights);
+        _InvalidateRosterCache();
         _SetRankBankMoneyPerDay(rankId, moneyPerDay);
 
         for (auto& rightsAndSlot : rightsAndSlots)
@@ -1800,6 +1834,7 @@ void Guild::HandleUpdateMemberRank(WorldSession*    session,
 
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         member->ChangeRank(newRankId);
+        _InvalidateRosterCache();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER
                          : GUILD_EVENT_LOG_PROMOTE_PLAYER,
                   player->GetGUID(),
@@ -1857,6 +1892,7 @@ void Guild::HandleRemoveRank(WorldSession* session, uint8 rankId)
 
     // match what the sql statement does
     m_ranks.erase(m_ranks.begin() + rankId, m_ranks.end());
+    _InvalidateRosterCache();
 
     _BroadcastEvent(
         GE_RANK_DELETED, ObjectGuid::Empty, std::to_string(m_ranks.size()));
@@ -1991,6 +2027,7 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        _InvalidateRosterCache();
     }
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
 }
@@ -2020,13 +2057,11 @@ void Guild::SendInfo(WorldSession* session) const
 
 void Guild::SendEventLog(WorldSession* session) const
 {
-    std::list<EventLogEntry> const& eventLog = m_eventLog.GetGuildLog();
-
     WorldPackets::Guild::GuildEventLogQueryResults packet;
-    packet.Entry.reserve(eventLog.size());
+    packet.Entry.reserve(m_eventLog.GetSize());
 
-    for (EventLogEntry const& entry : eventLog)
-        entry.WritePacket(packet);
+    m_eventLog.DoForAllEntries(
+        [&packet](EventLogEntry const& entry) { entry.WritePacket(packet); });
 
     session->SendPacket(packet.Write());
     LOG_DEBUG(
@@ -2037,15 +2072,16 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
 {
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS) {
-        std::list<BankEventLogEntry> const& bankEventLog =
-            m_bankEventLog[tabId].GetGuildLog();
+        LogHolder<BankEventLogEntry> const& bankEventLog =
+            m_bankEventLog[tabId];
 
         WorldPackets::Guild::GuildBankLogQueryResults packet;
         packet.Tab = tabId;
 
-        packet.Entry.reserve(bankEventLog.size());
-        for (BankEventLogEntry const& entry : bankEventLog)
+        packet.Entry.reserve(bankEventLog.GetSize());
+        bankEventLog.DoForAllEntries([&packet](BankEventLogEntry const& entry) {
             entry.WritePacket(packet);
+        });
 
         session->SendPacket(packet.Write());
         LOG_DEBUG(
@@ -2147,6 +2183,7 @@ void Guild::SendLoginInfo(WorldSession* session)
     if (Member* member = GetMember(player->GetGUID())) {
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+        _InvalidateRosterCache();
     }
 }
 
@@ -2414,17 +2451,19 @@ void Guild::BroadcastToGuild(WorldSession*    session,
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
+    auto const shared = std::make_shared<WorldPacket const>(*packet);
     for (auto const& [guid, member] : m_members)
         if (member.IsRank(rankId))
             if (Player* player = member.FindPlayer())
-                player->GetSession()->SendPacket(packet);
+                player->GetSession()->SendPacket(shared);
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
+    auto const shared = std::make_shared<WorldPacket const>(*packet);
     for (auto const& [guid, member] : m_members)
         if (Player* player = member.FindPlayer())
-            player->GetSession()->SendPacket(packet);
+            player->GetSession()->SendPacket(shared);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session,
@@ -2495,6 +2534,8 @@ bool Guild::AddMember(ObjectGuid guid, uint8 rankId)
         return false;
     }
 
+    _InvalidateRosterCache();
+
     Member&     member = memberIt->second;
     std::string name;
     if (player) {
@@ -2596,6 +2637,7 @@ void Guild::DeleteMember(ObjectGuid guid,
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     m_members.erase(lowguid);
+    _InvalidateRosterCache();
 
     // If player not online data in data field will be loaded from guild tabs no
     // need to update it !!
@@ -2618,6 +2660,7 @@ bool Guild::ChangeMemberRank(ObjectGuid guid, uint8 newRank)
         _GetLowestRankId()) // Validate rank (allow only existing ranks)
         if (Member* member = GetMember(guid)) {
             member->ChangeRank(newRank);
+            _InvalidateRosterCache();
 
             if (newRank == GR_GUILDMASTER) {
                 m_leaderGuid = guid;
@@ -2743,6 +2786,7 @@ bool Guild::_CreateRank(std::string_view name, uint32 rights)
     // Ranks represent sequence 0, 1, 2, ... where 0 means guildmaster
     RankInfo info(m_id, newRankId, name, rights, 0);
     m_ranks.push_back(info);
+    _InvalidateRosterCache();
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     info.CreateMissingTabsIfNeeded(_GetPurchasedTabsSize(), trans);
@@ -2810,6 +2854,7 @@ void Guild::_SetLeaderGUID(Member& pLeader)
 {
     m_leaderGuid = pLeader.GetGUID();
     pLeader.ChangeRank(GR_GUILDMASTER);
+    _InvalidateRosterCache();
 
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
@@ -2820,8 +2865,10 @@ void Guild::_SetLeaderGUID(Member& pLeader)
 
 void Guild::_SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay)
 {
-    if (RankInfo* rankInfo = GetRankInfo(rankId))
+    if (RankInfo* rankInfo = GetRankInfo(rankId)) {
         rankInfo->SetBankMoneyPerDay(moneyPerDay);
+        _InvalidateRosterCache();
+    }
 }
 
 void Guild::_SetRankBankTabRightsAndSlots(
@@ -2830,8 +2877,10 @@ void Guild::_SetRankBankTabRightsAndSlots(
     if (rightsAndSlots.GetTabId() >= _GetPurchasedTabsSize())
         return;
 
-    if (RankInfo* rankInfo = GetRankInfo(rankId))
+    if (RankInfo* rankInfo = GetRankInfo(rankId)) {
         rankInfo->SetBankTabSlotsAndRights(rightsAndSlots, saveToDB);
+        _InvalidateRosterCache();
+    }
 }
 
 inline std::string Guild::_GetRankName(uint8 rankId) const
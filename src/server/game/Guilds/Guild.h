@@ -549,14 +549,19 @@ private:
         template <typename... Ts>
         void   AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
         uint32 GetNextGUID();
-        std::list<Entry>&       GetGuildLog() { return m_log; }
-        std::list<Entry> const& GetGuildLog() const { return m_log; }
+        size_t GetSize() const { return m_log.size(); }
+        // Calls worker for every entry, from the oldest to the newest
+        template <typename Worker>
+        void DoForAllEntries(Worker&& worker) const;
 
     private:
-        uint32           m_guildId;
-        std::list<Entry> m_log;
-        uint32 const     m_maxRecords;
-        uint32           m_nextGUID;
+        // Entries are kept in a ring, newest first starting at m_newest, so
+        // that a full log is rotated by overwriting its oldest slot.
+        uint32             m_guildId;
+        std::vector<Entry> m_log;
+        size_t             m_newest;
+        uint32 const       m_maxRecords;
+        uint32             m_nextGUID;
     };
 
     // Class encapsulating guild rank data
@@ -977,11 +982,15 @@ protected:
     std::unordered_map<uint32, Member> m_members;
     std::vector<BankTab>               m_bankTabs;
 
-    // These are actually ordered lists. The first element is the oldest entry.
     LogHolder<EventLogEntry> m_eventLog;
     std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1>
         m_bankEventLog = {};
 
+    // Serialized SMSG_GUILD_ROSTER without and with officer notes, and the
+    // game time each one was built at
+    std::array<WorldPacket, 2> m_rosterCache;
+    std::array<Seconds, 2>     m_rosterCacheTime = {};
+
 private:
     inline uint8 _GetRanksSize() const { return uint8(m_ranks.size()); }
     inline const RankInfo* GetRankInfo(uint8 rankId) const
@@ -1001,6 +1010,8 @@ private:
         return false;
     }
 
+    inline void _InvalidateRosterCache() { m_rosterCacheTime = {}; }
+
     inline uint8 _GetLowestRankId() const { return uint8(m_ranks.size() - 1); }
 
     inline uint8 _GetPurchasedTabsSize() const
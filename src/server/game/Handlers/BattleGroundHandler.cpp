@@ -417,9 +417,7 @@ void WorldSession::HandlePVPLogDataOpcode(WorldPacket& /*recvData*/)
     if (bg->isArena())
         return;
 
-    WorldPacket data;
-    bg->BuildPvPLogDataPacket(data);
-    SendPacket(&data);
+    SendPacket(bg->GetPvPLogDataPacket());
 
     LOG_DEBUG("network", "WORLD: Sent MSG_PVP_LOG_DATA Message");
 }
@@ -23,6 +23,7 @@
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
+#include "QueryResponseCache.h"
 #include "ScriptMgr.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
@@ -531,10 +532,18 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recvData)
 
     ItemTemplate const* pProto = sObjectMgr->GetItemTemplate(item);
     if (pProto) {
+        LocaleConstant loc_idx = GetSessionDbLocaleIndex();
+
+        WorldPacket queryData;
+        if (sQueryResponseCache->Get(
+                QUERY_RESPONSE_ITEM, item, loc_idx, queryData)) {
+            SendPacket(&queryData);
+            return;
+        }
+
         std::string Name        = pProto->Name1;
         std::string Description = pProto->Description;
 
-        int loc_idx = GetSessionDbLocaleIndex();
         if (loc_idx >= 0) {
             if (ItemLocale const* il =
                     sObjectMgr->GetItemLocale(pProto->ItemId)) {
@@ -544,7 +553,7 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recvData)
             }
         }
         // guess size
-        WorldPacket queryData(SMSG_ITEM_QUERY_SINGLE_RESPONSE, 600);
+        queryData.Initialize(SMSG_ITEM_QUERY_SINGLE_RESPONSE, 600);
         queryData << pProto->ItemId;
         queryData << pProto->Class;
         queryData << pProto->SubClass;
@@ -671,6 +680,8 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recvData)
             << pProto->Duration; // added in 2.4.2.8209, duration (seconds)
         queryData << pProto->ItemLimitCategory; // WotLK, ItemLimitCategory
         queryData << pProto->HolidayId;         // Holiday.dbc?
+        sQueryResponseCache->Store(
+            QUERY_RESPONSE_ITEM, item, loc_idx, queryData);
         SendPacket(&queryData);
     }
     else {
@@ -1134,7 +1145,7 @@ void WorldSession::SendListInventory(ObjectGuid vendorGuid, uint32 vendorEntry)
                     continue;
                 }
 
-                ConditionList conditions =
+                ConditionList const& conditions =
                     sConditionMgr->GetConditionsForNpcVendorEvent(
                         vendor->GetEntry(), item->item);
                 if (!sConditionMgr->IsObjectMeetToConditions(
@@ -239,7 +239,8 @@ void WorldSession::HandleLootMoneyOpcode(WorldPacket& /*recvData*/)
 
         // Delete the money loot record from the DB
         if (loot->containerGUID)
-            sLootItemStorage->RemoveStoredLootMoney(loot->containerGUID, loot);
+            sLootItemStorage->RemoveStoredLootMoney(
+                loot->containerGUID, loot, player);
 
         // Delete container if empty
         if (loot->isLooted() && guid.IsItem())
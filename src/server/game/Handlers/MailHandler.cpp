@@ -56,6 +56,7 @@ bool WorldSession::CanOpenMailBox(ObjectGuid guid)
     else
         return false;
 
+    _player->LoadMailIfNeeded();
     return true;
 }
 
@@ -193,7 +194,7 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
     uint16 mails_count =
         0; // do not allow to send to one player more than 100 mails
 
-    if (receive) {
+    if (receive && receive->IsMailLoaded()) {
         rc_teamId   = receive->GetTeamId();
         mails_count = receive->GetMailSize();
     }
@@ -204,6 +205,9 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
             rc_teamId   = Player::TeamIdForRace(playerData->Race);
             mails_count = playerData->MailCount;
         }
+
+        if (receive)
+            rc_teamId = receive->GetTeamId();
     }
     // do not allow to have more than 100 mails in mailbox.. mails count is in
     // opcode uint8!!! - so max can be 255..
@@ -939,6 +943,8 @@ void WorldSession::HandleQueryNextMailTime(WorldPacket& /*recvData*/)
 {
     WorldPacket data(MSG_QUERY_NEXT_MAIL_TIME, 8);
 
+    // until the mailbox is opened only the mails delivered during this session
+    // are known, the client shows the notice without senders then
     if (_player->unReadMails > 0) {
         data << float(0);  // float
         data << uint32(0); // count
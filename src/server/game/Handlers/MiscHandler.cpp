@@ -36,6 +36,7 @@
 #include "LootMgr.h"
 #include "MapMgr.h"
 #include "MiscPackets.h"
+#include "MovementPackets.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -298,30 +299,26 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
               zonesCount,
               strCount);
 
-    std::wstring str[4]; // 4 is client limit
+    // all matching is done on lowercased UTF-8, a byte substring match of
+    // valid UTF-8 is also a match on whole characters
+    std::string str[4]; // 4 is client limit
     for (uint32 i = 0; i < strCount; ++i) {
         std::string temp;
         recvData >> temp; // user entered string, it used as universal search
                           // pattern(guild+player name)?
 
-        if (!Utf8toWStr(temp, str[i]))
+        if (!Utf8ToLower(temp, str[i]))
             continue;
 
-        wstrToLower(str[i]);
-
         LOG_DEBUG("network.who", "String {}: {}", i, temp);
     }
 
-    std::wstring wpacketPlayerName;
-    std::wstring wpacketGuildName;
-    if (!(Utf8toWStr(packetPlayerName, wpacketPlayerName) &&
-          Utf8toWStr(packetGuildName, wpacketGuildName)))
+    std::string lowerPacketPlayerName;
+    std::string lowerPacketGuildName;
+    if (!(Utf8ToLower(packetPlayerName, lowerPacketPlayerName) &&
+          Utf8ToLower(packetGuildName, lowerPacketGuildName)))
         return;
 
-    wstrToLower(wpacketPlayerName);
-    wstrToLower(wpacketGuildName);
-    ;
-
     // client send in case not set max level value 100 but Acore supports 255
     // max level, update it to show GMs with characters after 100 level
     if (levelMax >= MAX_LEVEL)
@@ -339,7 +336,8 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         matchCount); // placeholder, count of players matching criteria
     data << uint32(displaycount); // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList()) {
+    for (auto const& target :
+         sWhoListCacheMgr->GetWhoList(levelMin, levelMax)) {
         if (AccountMgr::IsPlayerAccount(security)) {
             // player can see member of other team only if
             // CONFIG_ALLOW_TWO_SIDE_WHO_LIST
@@ -362,11 +360,8 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
             continue;
         }
 
-        // check if target's level is in level range
+        // level range is already applied by the who list cache
         uint8 lvl = target.GetLevel();
-        if (lvl < levelMin || lvl > levelMax) {
-            continue;
-        }
 
         // check if class matches classmask
         uint8 class_ = target.GetClass();
@@ -397,30 +392,37 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
             continue;
         }
 
-        std::wstring const& wideplayername = target.GetWidePlayerName();
-        if (!(wpacketPlayerName.empty() ||
-              wideplayername.find(wpacketPlayerName) != std::wstring::npos)) {
+        std::string const& lowerplayername = target.GetLowerPlayerName();
+        if (!(lowerPacketPlayerName.empty() ||
+              lowerplayername.find(lowerPacketPlayerName) !=
+                  std::string::npos)) {
             continue;
         }
 
-        std::wstring const& wideguildname = target.GetWideGuildName();
-        if (!(wpacketGuildName.empty() ||
-              wideguildname.find(wpacketGuildName) != std::wstring::npos)) {
+        std::string const& lowerguildname = target.GetLowerGuildName();
+        if (!(lowerPacketGuildName.empty() ||
+              lowerguildname.find(lowerPacketGuildName) != std::string::npos)) {
             continue;
         }
 
-        std::string aname;
-        if (AreaTableEntry const* areaEntry =
-                sAreaTableStore.LookupEntry(playerZoneId)) {
-            aname = areaEntry->area_name[GetSessionDbcLocale()];
+        // the zone name is only needed for the search strings, convert it
+        // once per target instead of once per string
+        std::string lowerareaname;
+        if (strCount) {
+            if (AreaTableEntry const* areaEntry =
+                    sAreaTableStore.LookupEntry(playerZoneId)) {
+                if (!Utf8ToLower(areaEntry->area_name[GetSessionDbcLocale()],
+                                 lowerareaname))
+                    lowerareaname.clear();
+            }
         }
 
         bool s_show = true;
         for (uint32 i = 0; i < strCount; ++i) {
             if (!str[i].empty()) {
-                if (wideguildname.find(str[i]) != std::wstring::npos ||
-                    wideplayername.find(str[i]) != std::wstring::npos ||
-                    Utf8FitTo(aname, str[i])) {
+                if (lowerguildname.find(str[i]) != std::string::npos ||
+                    lowerplayername.find(str[i]) != std::string::npos ||
+                    lowerareaname.find(str[i]) != std::string::npos) {
                     s_show = true;
                     break;
                 }
@@ -1986,6 +1988,10 @@ void WorldSession::HandleUpdateMissileTrajectory(WorldPacket& recvPacket)
         uint32 opcode;
         recvPacket >> opcode;
         recvPacket.SetOpcode(opcode);
-        HandleMovementOpcodes(recvPacket);
+
+        WorldPackets::Movement::ClientPlayerMovement movement(
+            std::move(recvPacket));
+        movement.Read();
+        HandleMovementOpcodes(movement);
     }
 }
@@ -28,6 +28,7 @@
 #include "Log.h"
 #include "MapMgr.h"
 #include "MathUtil.h"
+#include "MovementPackets.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Pet.h"
@@ -380,9 +381,10 @@ void WorldSession::HandleMoveTeleportAck(WorldPacket& recvData)
         plMover->SetClientControl(plMover, false, true);
 }
 
-void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
+void WorldSession::HandleMovementOpcodes(
+    WorldPackets::Movement::ClientPlayerMovement& packet)
 {
-    uint16 opcode = recvData.GetOpcode();
+    uint16 opcode = packet.GetOpcode();
 
     Unit* mover = _player->m_mover;
 
@@ -392,32 +394,23 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
 
     // ignore, waiting processing in WorldSession::HandleMoveWorldportAckOpcode
     // and WorldSession::HandleMoveTeleportAck
-    if (plrMover && plrMover->IsBeingTeleported()) {
-        recvData.rfinish(); // prevent warnings spam
+    if (plrMover && plrMover->IsBeingTeleported())
         return;
-    }
 
-    /* extract packet */
-    ObjectGuid guid;
-    recvData >> guid.ReadAsPacked();
+    ObjectGuid guid = packet.Status.guid;
 
     // prevent tampered movement data
-    if (!guid || guid != mover->GetGUID()) {
-        recvData.rfinish(); // prevent warnings spam
+    if (!guid || guid != mover->GetGUID())
         return;
-    }
 
     // pussywizard: typical check for incomming movement packets | prevent
     // tampered movement data
     if (!mover || !(mover->IsInWorld()) || mover->IsDuringRemoveFromWorld() ||
-        guid != mover->GetGUID()) {
-        recvData.rfinish(); // prevent warnings spam
+        guid != mover->GetGUID())
         return;
-    }
 
-    MovementInfo movementInfo;
-    movementInfo.guid = guid;
-    ReadMovementInfo(recvData, &movementInfo);
+    MovementInfo& movementInfo = packet.Status;
+    ValidateMovementInfo(&movementInfo);
 
     // Stop emote on move
     if (Player* plrMover = mover->ToPlayer()) {
@@ -432,12 +425,10 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
             sScriptMgr->AnticheatUpdateMovementInfo(plrMover, movementInfo);
         }
 
-        recvData.rfinish(); // prevent warnings spam
         return;
     }
 
     if (!mover->movespline->Finalized()) {
-        recvData.rfinish(); // prevent warnings spam
         return;
     }
 
@@ -473,7 +464,6 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
                 // teleported, skip packets that were broadcast before
                 // teleport");
             }
-            recvData.rfinish(); // prevent warnings spam
             return;
         }
 
@@ -490,7 +480,6 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
                 sScriptMgr->AnticheatUpdateMovementInfo(plrMover, movementInfo);
             }
 
-            recvData.rfinish(); // prevent warnings spam
             return;
         }
 
@@ -592,7 +581,7 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
     }
 
     /* process position-change */
-    WorldPacket data(opcode, recvData.size());
+    WorldPacket data(opcode, packet.GetSize());
     int64       movementTime = (int64)movementInfo.time + _timeSyncClockDelta;
     if (_timeSyncClockDelta == 0 || movementTime < 0 ||
         movementTime > 0xFFFFFFFF) {
@@ -607,7 +596,7 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
 
     movementInfo.guid = mover->GetGUID();
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+    mover->SendMessageToObservers(&data, _player);
 
     mover->m_movementInfo = movementInfo;
 
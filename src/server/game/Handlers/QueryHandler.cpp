@@ -25,6 +25,7 @@
 #include "Opcodes.h"
 #include "Pet.h"
 #include "Player.h"
+#include "QueryResponseCache.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -104,11 +105,19 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
 
     CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(entry);
     if (ci) {
+        LocaleConstant loc_idx = GetSessionDbLocaleIndex();
+
+        WorldPacket data;
+        if (sQueryResponseCache->Get(
+                QUERY_RESPONSE_CREATURE, entry, loc_idx, data)) {
+            SendPacket(&data);
+            return;
+        }
+
         std::string Name, Title;
         Name  = ci->Name;
         Title = ci->SubName;
 
-        LocaleConstant loc_idx = GetSessionDbLocaleIndex();
         if (loc_idx >= 0) {
             if (CreatureLocale const* cl =
                     sObjectMgr->GetCreatureLocale(entry)) {
@@ -117,7 +126,7 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
             }
         }
         // guess size
-        WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 100);
+        data.Initialize(SMSG_CREATURE_QUERY_RESPONSE, 100);
         data << uint32(entry); // creature entry
         data << Name;
         data << uint8(0) << uint8(0)
@@ -148,6 +157,8 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
                 data << uint32(0);
 
         data << uint32(ci->movementId); // CreatureMovementInfo.dbc
+        sQueryResponseCache->Store(
+            QUERY_RESPONSE_CREATURE, entry, loc_idx, data);
         SendPacket(&data);
     }
     else {
@@ -171,6 +182,15 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
 
     const GameObjectTemplate* info = sObjectMgr->GetGameObjectTemplate(entry);
     if (info) {
+        LocaleConstant localeConstant = GetSessionDbLocaleIndex();
+
+        WorldPacket data;
+        if (sQueryResponseCache->Get(
+                QUERY_RESPONSE_GAMEOBJECT, entry, localeConstant, data)) {
+            SendPacket(&data);
+            return;
+        }
+
         std::string Name;
         std::string IconName;
         std::string CastBarCaption;
@@ -179,7 +199,6 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
         IconName       = info->IconName;
         CastBarCaption = info->castBarCaption;
 
-        LocaleConstant localeConstant = GetSessionDbLocaleIndex();
         if (localeConstant >= LOCALE_enUS)
             if (GameObjectLocale const* gameObjectLocale =
                     sObjectMgr->GetGameObjectLocale(entry)) {
@@ -194,7 +213,7 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
                   "WORLD: CMSG_GAMEOBJECT_QUERY '{}' - Entry: {}. ",
                   info->name,
                   entry);
-        WorldPacket data(SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
+        data.Initialize(SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
         data << uint32(entry);
         data << uint32(info->type);
         data << uint32(info->displayId);
@@ -217,6 +236,8 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
             for (size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
                 data << uint32(0);
 
+        sQueryResponseCache->Store(
+            QUERY_RESPONSE_GAMEOBJECT, entry, localeConstant, data);
         SendPacket(&data);
         LOG_DEBUG("network", "WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
@@ -288,9 +309,18 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
 
     recvData >> guid;
 
+    LocaleConstant locale = GetSessionDbLocaleIndex();
+
+    WorldPacket data;
+    if (sQueryResponseCache->Get(
+            QUERY_RESPONSE_NPC_TEXT, textID, locale, data)) {
+        SendPacket(&data);
+        return;
+    }
+
     GossipText const* gossip = sObjectMgr->GetGossipText(textID);
 
-    WorldPacket data(SMSG_NPC_TEXT_UPDATE, 100); // guess size
+    data.Initialize(SMSG_NPC_TEXT_UPDATE, 100); // guess size
     data << textID;
 
     if (!gossip) {
@@ -310,7 +340,6 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
     else {
         std::string text0[MAX_GOSSIP_TEXT_OPTIONS],
             text1[MAX_GOSSIP_TEXT_OPTIONS];
-        LocaleConstant locale = GetSessionDbLocaleIndex();
 
         for (uint8 i = 0; i < MAX_GOSSIP_TEXT_OPTIONS; ++i) {
             BroadcastText const* bct = sObjectMgr->GetBroadcastText(
@@ -353,6 +382,9 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
                 data << gossip->Options[i].Emotes[j]._Emote;
             }
         }
+
+        sQueryResponseCache->Store(
+            QUERY_RESPONSE_NPC_TEXT, textID, locale, data);
     }
 
     SendPacket(&data);
@@ -367,10 +399,21 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
     recvData >> pageID;
     recvData.read_skip<uint64>(); // guid
 
+    LocaleConstant loc_idx = GetSessionDbLocaleIndex();
+
     while (pageID) {
         PageText const* pageText = sObjectMgr->GetPageText(pageID);
+
+        WorldPacket data;
+        if (pageText && sQueryResponseCache->Get(
+                            QUERY_RESPONSE_PAGE_TEXT, pageID, loc_idx, data)) {
+            SendPacket(&data);
+            pageID = pageText->NextPage;
+            continue;
+        }
+
         // guess size
-        WorldPacket data(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
+        data.Initialize(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
         data << pageID;
 
         if (!pageText) {
@@ -381,7 +424,6 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
         else {
             std::string Text = pageText->Text;
 
-            int loc_idx = GetSessionDbLocaleIndex();
             if (loc_idx >= 0)
                 if (PageTextLocale const* player =
                         sObjectMgr->GetPageTextLocale(pageID))
@@ -389,6 +431,8 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
 
             data << Text;
             data << uint32(pageText->NextPage);
+            sQueryResponseCache->Store(
+                QUERY_RESPONSE_PAGE_TEXT, pageID, loc_idx, data);
             pageID = pageText->NextPage;
         }
         SendPacket(&data);
@@ -19,6 +19,7 @@
 #include "DBCStores.h"
 #include "GameObjectAI.h"
 #include "Log.h"
+#include "MovementPackets.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
@@ -52,7 +53,12 @@ void WorldSession::HandleClientCastFlags(WorldPacket&      recvPacket,
         recvPacket >> hasMovementData;
         if (hasMovementData) {
             recvPacket.SetOpcode(recvPacket.read<uint32>());
-            HandleMovementOpcodes(recvPacket);
+
+            // the movement block is the tail of the cast packet
+            WorldPackets::Movement::ClientPlayerMovement movement(
+                std::move(recvPacket));
+            movement.Read();
+            HandleMovementOpcodes(movement);
         }
     }
 }
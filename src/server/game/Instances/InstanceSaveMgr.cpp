@@ -297,6 +297,18 @@ void InstanceSaveMgr::DeleteInstanceSavedData(uint32 instanceId)
     }
 }
 
+void InstanceSaveMgr::DeleteInstanceSavedData(
+    uint32 instanceId, CharacterDatabaseTransaction trans)
+{
+    if (instanceId) {
+        CharacterDatabasePreparedStatement* stmt =
+            CharacterDatabase.GetPreparedStatement(
+                CHAR_DELETE_INSTANCE_SAVED_DATA);
+        stmt->SetData(0, instanceId);
+        trans->Append(stmt);
+    }
+}
+
 void InstanceSaveMgr::LoadInstances()
 {
     uint32 oldMSTime = getMSTime();
@@ -595,7 +607,8 @@ void InstanceSaveMgr::Update()
     }
 }
 
-void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
+void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr,
+                                 CharacterDatabaseTransaction   trans)
 {
     lock_instLists = true;
 
@@ -616,19 +629,20 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
             CharacterDatabase.GetPreparedStatement(
                 CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE);
         stmt->SetData(0, itr->second->GetInstanceId());
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
         stmt = CharacterDatabase.GetPreparedStatement(
             CHAR_DEL_INSTANCE_BY_INSTANCE);
         stmt->SetData(0, itr->second->GetInstanceId());
-        CharacterDatabase.Execute(stmt);
-        DeleteInstanceSavedData(itr->second->GetInstanceId());
+        trans->Append(stmt);
+        DeleteInstanceSavedData(itr->second->GetInstanceId(), trans);
 
         // clear respawn times if the map is already unloaded and won't do it by
         // itself
         if (!sMapMgr->FindMap(itr->second->GetMapId(),
                               itr->second->GetInstanceId()))
             Map::DeleteRespawnTimesInDB(itr->second->GetMapId(),
-                                        itr->second->GetInstanceId());
+                                        itr->second->GetInstanceId(),
+                                        trans);
 
         sScriptMgr->OnInstanceIdRemoved(itr->second->GetInstanceId());
 
@@ -636,11 +650,9 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
         m_instanceSaveById.erase(itr);
     }
     else {
-        // delete character_instance per id where extended = 0, transtaction
-        // with set extended = 0, transaction is used to avoid mysql thread
+        // delete character_instance per id where extended = 0, together with
+        // set extended = 0 in the reset transaction to avoid mysql thread
         // races
-        CharacterDatabaseTransaction trans =
-            CharacterDatabase.BeginTransaction();
         CharacterDatabasePreparedStatement* stmt =
             CharacterDatabase.GetPreparedStatement(
                 CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED);
@@ -650,7 +662,6 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
             CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED);
         stmt->SetData(0, itr->second->GetInstanceId());
         trans->Append(stmt);
-        CharacterDatabase.CommitTransaction(trans);
 
         // update reset time and extended reset time for instance save
         itr->second->SetResetTime(GetResetTimeFor(
@@ -702,6 +713,11 @@ void InstanceSaveMgr::_ResetOrWarnAll(uint32     mapid,
         ScheduleReset(time_t(next_reset - 3600),
                       InstResetEvent(1, mapid, difficulty));
 
+        // the whole reset of the map goes to the DB in one transaction
+        // instead of several statements per instance
+        CharacterDatabaseTransaction trans =
+            CharacterDatabase.BeginTransaction();
+
         // update it in the DB
         CharacterDatabasePreparedStatement* stmt =
             CharacterDatabase.GetPreparedStatement(
@@ -709,7 +725,7 @@ void InstanceSaveMgr::_ResetOrWarnAll(uint32     mapid,
         stmt->SetData(0, next_reset);
         stmt->SetData(1, uint16(mapid));
         stmt->SetData(2, uint8(difficulty));
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
 
         // remove all binds to instances of the given map and delete from db
         // (delete per instance id, no mass deletion!) do this after new reset
@@ -720,8 +736,10 @@ void InstanceSaveMgr::_ResetOrWarnAll(uint32     mapid,
             itr2 = itr++;
             if (itr2->second->GetMapId() == mapid &&
                 itr2->second->GetDifficulty() == difficulty)
-                _ResetSave(itr2);
+                _ResetSave(itr2, trans);
         }
+
+        CharacterDatabase.CommitTransaction(trans);
     }
 
     // now loop all existing maps to warn / reset
@@ -234,6 +234,8 @@ public:
 
     void SanitizeInstanceSavedData();
     void DeleteInstanceSavedData(uint32 instanceId);
+    void DeleteInstanceSavedData(uint32                       instanceId,
+                                 CharacterDatabaseTransaction trans);
 
 protected:
     static uint16            ResetTimeDelay[];
@@ -245,7 +247,8 @@ private:
                                                 Difficulty difficulty,
                                                 bool       warn,
                                                 time_t     resetTime);
-    void                        _ResetSave(InstanceSaveHashMap::iterator& itr);
+    void                        _ResetSave(InstanceSaveHashMap::iterator& itr,
+                                           CharacterDatabaseTransaction trans);
     bool                        lock_instLists{false};
     InstanceSaveHashMap         m_instanceSaveById;
     ResetTimeByMapDifficultyMap m_resetTimeByMapDifficulty;
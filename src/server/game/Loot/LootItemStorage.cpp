@@ -19,11 +19,17 @@
 #include "LootItemStorage.h"
 #include "DatabaseEnv.h"
 #include "ObjectMgr.h"
+#include "Player.h"
 #include "PreparedStatement.h"
 
 LootItemStorage::LootItemStorage() {}
 
-LootItemStorage::~LootItemStorage() {}
+LootItemStorage::~LootItemStorage()
+{
+    for (auto& [playerGUID, statements] : _pendingWrites)
+        for (CharacterDatabasePreparedStatement* stmt : statements)
+            delete stmt;
+}
 
 LootItemStorage* LootItemStorage::instance()
 {
@@ -78,10 +84,9 @@ void LootItemStorage::LoadStorageFromDB()
 void LootItemStorage::RemoveEntryFromDB(ObjectGuid containerGUID,
                                         uint32     itemid,
                                         uint32     count,
-                                        uint32     itemIndex)
+                                        uint32     itemIndex,
+                                        Player*    player)
 {
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(
             CHAR_DEL_ITEMCONTAINER_SINGLE_ITEM);
@@ -89,13 +94,13 @@ void LootItemStorage::RemoveEntryFromDB(ObjectGuid containerGUID,
     stmt->SetData(1, itemid);
     stmt->SetData(2, count);
     stmt->SetData(3, itemIndex);
-    trans->Append(stmt);
-
-    CharacterDatabase.CommitTransaction(trans);
+    _pendingWrites[player->GetGUID()].push_back(stmt);
 }
 
-void LootItemStorage::AddNewStoredLoot(Loot* loot, Player* /*player*/)
+void LootItemStorage::AddNewStoredLoot(Loot* loot, Player* player)
 {
+    std::lock_guard<std::mutex> guard(_lock);
+
     if (lootItemStore.find(loot->containerGUID) != lootItemStore.end()) {
         LOG_INFO("misc",
                  "LootItemStorage::AddNewStoredLoot (A1) - {}!",
@@ -103,10 +108,12 @@ void LootItemStorage::AddNewStoredLoot(Loot* loot, Player* /*player*/)
         return;
     }
 
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    std::vector<CharacterDatabasePreparedStatement*>& pending =
+        _pendingWrites[player->GetGUID()];
     CharacterDatabasePreparedStatement* stmt = nullptr;
 
     StoredLootItemList& itemList = lootItemStore[loot->containerGUID];
+    itemList.reserve(loot->items.size() + 1);
 
     // Gold at first
     if (loot->gold) {
@@ -139,7 +146,7 @@ void LootItemStorage::AddNewStoredLoot(Loot* loot, Player* /*player*/)
         stmt->SetData(index++, false);
         stmt->SetData(index++, false);
         stmt->SetData(index++, 0);
-        trans->Append(stmt);
+        pending.push_back(stmt);
     }
 
     // And normal items
@@ -194,10 +201,8 @@ void LootItemStorage::AddNewStoredLoot(Loot* loot, Player* /*player*/)
             stmt->SetData(index++, li->needs_quest);
             stmt->SetData(index++, conditionLootId);
 
-            trans->Append(stmt);
+            pending.push_back(stmt);
         }
-
-    CharacterDatabase.CommitTransaction(trans);
 }
 
 bool LootItemStorage::LoadStoredLoot(Item* item, Player* player)
@@ -207,6 +212,8 @@ bool LootItemStorage::LoadStoredLoot(Item* item, Player* player)
         return false;
     }
 
+    std::lock_guard<std::mutex> guard(_lock);
+
     Loot*                       loot = &item->loot;
     LootItemContainer::iterator itr  = lootItemStore.find(loot->containerGUID);
     if (itr == lootItemStore.end())
@@ -274,8 +281,11 @@ void LootItemStorage::RemoveStoredLootItem(ObjectGuid containerGUID,
                                            uint32     itemid,
                                            uint32     count,
                                            Loot*      loot,
-                                           uint32     itemIndex)
+                                           uint32     itemIndex,
+                                           Player*    player)
 {
+    std::lock_guard<std::mutex> guard(_lock);
+
     LootItemContainer::iterator itr = lootItemStore.find(containerGUID);
     if (itr == lootItemStore.end())
         return;
@@ -285,7 +295,7 @@ void LootItemStorage::RemoveStoredLootItem(ObjectGuid containerGUID,
          it2 != itemList.end();
          ++it2)
         if (it2->itemid == itemid && it2->count == count) {
-            RemoveEntryFromDB(containerGUID, itemid, count, itemIndex);
+            RemoveEntryFromDB(containerGUID, itemid, count, itemIndex, player);
             itemList.erase(it2);
             break;
         }
@@ -297,8 +307,11 @@ void LootItemStorage::RemoveStoredLootItem(ObjectGuid containerGUID,
 }
 
 void LootItemStorage::RemoveStoredLootMoney(ObjectGuid containerGUID,
-                                            Loot*      loot)
+                                            Loot*      loot,
+                                            Player*    player)
 {
+    std::lock_guard<std::mutex> guard(_lock);
+
     LootItemContainer::iterator itr = lootItemStore.find(containerGUID);
     if (itr == lootItemStore.end())
         return;
@@ -308,7 +321,7 @@ void LootItemStorage::RemoveStoredLootMoney(ObjectGuid containerGUID,
          it2 != itemList.end();
          ++it2)
         if (it2->itemid == 0) {
-            RemoveEntryFromDB(containerGUID, 0, it2->count, 0);
+            RemoveEntryFromDB(containerGUID, 0, it2->count, 0, player);
             itemList.erase(it2);
             break;
         }
@@ -319,17 +332,35 @@ void LootItemStorage::RemoveStoredLootMoney(ObjectGuid containerGUID,
         lootItemStore.erase(itr);
 }
 
-void LootItemStorage::RemoveStoredLoot(ObjectGuid containerGUID)
+void LootItemStorage::RemoveStoredLoot(ObjectGuid containerGUID,
+                                       Player*    player)
 {
-    lootItemStore.erase(containerGUID);
+    std::lock_guard<std::mutex> guard(_lock);
 
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    lootItemStore.erase(containerGUID);
 
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(
             CHAR_DEL_ITEMCONTAINER_CONTAINER);
     stmt->SetData(0, containerGUID.GetCounter());
-    trans->Append(stmt);
+    _pendingWrites[player->GetGUID()].push_back(stmt);
+}
+
+void LootItemStorage::SaveToDB(Player*                      player,
+                               CharacterDatabaseTransaction trans)
+{
+    std::vector<CharacterDatabasePreparedStatement*> statements;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
 
-    CharacterDatabase.CommitTransaction(trans);
+        auto itr = _pendingWrites.find(player->GetGUID());
+        if (itr == _pendingWrites.end())
+            return;
+
+        statements = std::move(itr->second);
+        _pendingWrites.erase(itr);
+    }
+
+    for (CharacterDatabasePreparedStatement* stmt : statements)
+        trans->Append(stmt);
 }
@@ -20,10 +20,11 @@
 #define ACORE_LOOTITEMSTORAGE_H
 
 #include "Common.h"
+#include "DatabaseEnvFwd.h"
 #include "Item.h"
 #include "LootMgr.h"
-#include <list>
-#include <map>
+#include <mutex>
+#include <vector>
 
 struct StoredLootItem {
     StoredLootItem(uint32 i,
@@ -61,7 +62,7 @@ struct StoredLootItem {
     uint32 conditionLootId;
 };
 
-typedef std::list<StoredLootItem>                          StoredLootItemList;
+typedef std::vector<StoredLootItem>                        StoredLootItemList;
 typedef std::unordered_map<ObjectGuid, StoredLootItemList> LootItemContainer;
 
 class LootItemStorage {
@@ -73,11 +74,9 @@ public:
     static LootItemStorage* instance();
 
     void LoadStorageFromDB();
-    void RemoveEntryFromDB(ObjectGuid containerGUID,
-                           uint32     itemid,
-                           uint32     count,
-                           uint32     itemIndex);
 
+    // Changes to the stored loot are written together with the inventory of
+    // the player that caused them, see SaveToDB()
     void AddNewStoredLoot(Loot* loot, Player* player);
     bool LoadStoredLoot(Item* item, Player* player);
 
@@ -85,12 +84,30 @@ public:
                               uint32     itemid,
                               uint32     count,
                               Loot*      loot,
-                              uint32     itemIndex);
-    void RemoveStoredLootMoney(ObjectGuid containerGUID, Loot* loot);
-    void RemoveStoredLoot(ObjectGuid containerGUID);
+                              uint32     itemIndex,
+                              Player*    player);
+    void RemoveStoredLootMoney(ObjectGuid containerGUID,
+                               Loot*      loot,
+                               Player*    player);
+    void RemoveStoredLoot(ObjectGuid containerGUID, Player* player);
+
+    /// Appends the pending changes caused by the player to its save
+    void SaveToDB(Player* player, CharacterDatabaseTransaction trans);
 
 private:
+    void RemoveEntryFromDB(ObjectGuid containerGUID,
+                           uint32     itemid,
+                           uint32     count,
+                           uint32     itemIndex,
+                           Player*    player);
+
     LootItemContainer lootItemStore;
+
+    // statements not written yet, per player guid
+    std::unordered_map<ObjectGuid,
+                       std::vector<CharacterDatabasePreparedStatement*>>
+               _pendingWrites;
+    std::mutex _lock;
 };
 
 #define sLootItemStorage LootItemStorage::instance()
@@ -29,6 +29,7 @@
 #include "SpellMgr.h"
 #include "Util.h"
 #include "World.h"
+#include <boost/container/small_vector.hpp>
 
 static Rates const qualityToRate[MAX_ITEM_QUALITY] = {
     RATE_DROP_ITEM_POOR,      // ITEM_QUALITY_POOR
@@ -71,6 +72,10 @@ LootStore LootTemplates_Player("player_loot_template", "team id", true);
 
 // Selects invalid loot items to be removed from group possible entries (before
 // rolling)
+// Candidates of a single group roll. Groups are small, so this stays in place
+// instead of allocating a list node per candidate on every roll.
+typedef boost::container::small_vector<LootStoreItem*, 16> PossibleLootList;
+
 struct LootGroupInvalidSelector
     : public Acore::unary_function<LootStoreItem*, bool> {
     explicit LootGroupInvalidSelector(Loot const& loot, uint16 lootMode)
@@ -1462,14 +1467,18 @@ LootStoreItem const* LootTemplate::LootGroup::Roll(Loot&            loot,
                                                    LootStore const& store,
                                                    uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
+    PossibleLootList         possibleLoot;
+    std::remove_copy_if(ExplicitlyChanced.begin(),
+                        ExplicitlyChanced.end(),
+                        std::back_inserter(possibleLoot),
+                        isInvalid);
 
     if (!possibleLoot.empty()) // First explicitly chanced entries are checked
     {
         float roll = (float)rand_chance();
 
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin();
+        for (PossibleLootList::const_iterator itr = possibleLoot.begin();
              itr != possibleLoot.end();
              ++itr) // check each explicitly chanced entry in the template and
                     // modify its chance based on quality.
@@ -1493,8 +1502,11 @@ LootStoreItem const* LootTemplate::LootGroup::Roll(Loot&            loot,
             player, EqualChanced, loot, store))
         return nullptr;
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    possibleLoot.clear();
+    std::remove_copy_if(EqualChanced.begin(),
+                        EqualChanced.end(),
+                        std::back_inserter(possibleLoot),
+                        isInvalid);
     if (!possibleLoot.empty()) // If nothing selected yet - an item is taken
                                // from equal-chanced part
         return Acore::Containers::SelectRandomContainerElement(possibleLoot);
@@ -31,12 +31,16 @@
 #include "MapInstanced.h"
 #include "Metric.h"
 #include "MiscPackets.h"
+#include "MoveSpline.h"
+#include "MoveSplineInit.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "Vehicle.h"
@@ -321,9 +325,19 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent)
       m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), _instanceResetPeriod(0),
       m_activeNonPlayersIter(m_activeNonPlayers.end()),
       _transportsUpdateIter(_transports.end()), i_scriptLock(false),
-      _defaultLight(GetDefaultMapLight(id))
+      _defaultLight(GetDefaultMapLight(id)), _lastUpdateCost(0),
+      _pathsThisUpdate(0)
 {
     m_parentMap = (_parent ? _parent : this);
+
+    CreateGuidGenerator<HighGuid::Transport>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Unit>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Vehicle>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Pet>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::GameObject>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::DynamicObject>(_guidGenerators);
+    CreateGuidGenerator<HighGuid::Corpse>(_guidGenerators);
+
     for (unsigned int idx = 0; idx < MAX_NUMBER_OF_GRIDS; ++idx) {
         for (unsigned int j = 0; j < MAX_NUMBER_OF_GRIDS; ++j) {
             // z code
@@ -589,6 +603,7 @@ bool Map::EnsureGridLoaded(const Cell& cell)
         loader.LoadN();
 
         Balance();
+        _stats.AddGridLoad();
         return true;
         //}
     }
@@ -790,59 +805,27 @@ bool Map::IsGridLoaded(const GridCoord& p) const
             isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOfPlayer(
-    Player* player,
-    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
-        gridVisitor,
-    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
-        worldVisitor,
-    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
-        largeGridVisitor,
-    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
-        largeWorldVisitor)
+void Map::MarkNearbyCellsOfPlayer(Player* player)
 {
     // check for valid position
     if (!player->IsPositionValid())
         return;
 
     // check normal grid activation range of the player
-    VisitNearbyCellsOf(
-        player, gridVisitor, worldVisitor, largeGridVisitor, largeWorldVisitor);
+    MarkNearbyCellsOf(player);
 
     // check maximum visibility distance for large creatures
     CellArea area = Cell::CalculateCellArea(player->GetPositionX(),
                                             player->GetPositionY(),
                                             MAX_VISIBILITY_DISTANCE);
 
-    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x) {
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
         for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord;
-             ++y) {
-            // marked cells are those that have been visited
-            // don't visit the same cell twice
-            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (isCellMarkedLarge(cell_id))
-                continue;
-
-            markCellLarge(cell_id);
-            CellCoord pair(x, y);
-            Cell      cell(pair);
-
-            Visit(cell, largeGridVisitor);
-            Visit(cell, largeWorldVisitor);
-        }
-    }
+             ++y)
+            markCellLarge((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
 }
 
-void Map::VisitNearbyCellsOf(
-    WorldObject* obj,
-    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
-        gridVisitor,
-    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
-        worldVisitor,
-    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
-        largeGridVisitor,
-    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
-        largeWorldVisitor)
+void Map::MarkNearbyCellsOf(WorldObject* obj)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
@@ -861,43 +844,116 @@ void Map::VisitNearbyCellsOf(
     for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x) {
         for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord;
              ++y) {
-            // marked cells are those that have been visited
-            // don't visit the same cell twice
             uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (isCellMarked(cell_id))
-                continue;
-
             markCell(cell_id);
-            CellCoord pair(x, y);
+            markCellLarge(cell_id);
+        }
+    }
+}
+
+void Map::VisitMarkedCells(
+    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
+        gridVisitor,
+    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
+        worldVisitor,
+    TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
+        largeGridVisitor,
+    TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
+        largeWorldVisitor)
+{
+    // every cell is visited exactly once, in cell id order so that
+    // neighbouring cells of the same grid are visited one after another; only
+    // the marked bits are cleared instead of resetting the whole bitsets
+    auto visitCells = [this](std::vector<uint32>& cells,
+                             auto&                 bits,
+                             auto&                 gridVisitor,
+                             auto&                 worldVisitor) {
+        std::sort(cells.begin(), cells.end());
+        for (uint32 cell_id : cells) {
+            CellCoord pair(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP,
+                           cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP);
             Cell      cell(pair);
             // cell.SetNoCreate(); // in mmaps this is missing
 
             Visit(cell, gridVisitor);
             Visit(cell, worldVisitor);
-
-            if (!isCellMarkedLarge(cell_id)) {
-                markCellLarge(cell_id);
-                Visit(cell, largeGridVisitor);
-                Visit(cell, largeWorldVisitor);
-            }
+            bits.reset(cell_id);
         }
+
+        cells.clear();
+    };
+
+    visitCells(_markedCells, marked_cells, gridVisitor, worldVisitor);
+    visitCells(_markedCellsLarge,
+               marked_cells_large,
+               largeGridVisitor,
+               largeWorldVisitor);
+}
+
+void Map::MarkCellsNearPlayers()
+{
+    marked_cells_near.reset();
+
+    float distance =
+        sWorld->getFloatConfig(CONFIG_MAP_UPDATE_FAR_OBJECTS_DISTANCE);
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin();
+         itr != m_mapRefMgr.end();
+         ++itr) {
+        Player* player = itr->GetSource();
+        if (!player || !player->IsInWorld() || !player->IsPositionValid())
+            continue;
+
+        CellArea area = Cell::CalculateCellArea(
+            player->GetPositionX(), player->GetPositionY(), distance);
+
+        for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord;
+             ++x)
+            for (uint32 y = area.low_bound.y_coord;
+                 y <= area.high_bound.y_coord;
+                 ++y)
+                marked_cells_near.set((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x);
     }
 }
 
+bool Map::IsCellNearPlayers(float x, float y) const
+{
+    CellCoord p = Acore::ComputeCellCoord(x, y);
+    if (!p.IsCoordValid())
+        return true;
+
+    return marked_cells_near.test(p.GetId());
+}
+
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
 {
+    TICK_PROFILE_SCOPE(sTickProfiler->IsEnabled()
+                           ? "map " + std::to_string(GetId())
+                           : std::string());
+    AC_PROFILE_ZONE("Map::Update");
+    AC_PROFILE_ZONE_TEXT(GetMapName(), std::strlen(GetMapName()));
+
+    TimePoint const updateStart = std::chrono::steady_clock::now();
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
+    _pathsThisUpdate = 0;
+
     /// update worldsessions for existing players
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end();
-         ++m_mapRefIter) {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld()) {
-            // player->Update(t_diff);
-            WorldSession*    session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(s_diff, updater);
+    {
+        TICK_PROFILE_SCOPE("sessions");
+        AC_PROFILE_ZONE("Map::Update sessions");
+        MapStats::PhaseTimer phaseTimer(_stats, MAP_PHASE_SESSIONS);
+        for (m_mapRefIter = m_mapRefMgr.begin();
+             m_mapRefIter != m_mapRefMgr.end();
+             ++m_mapRefIter) {
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld()) {
+                // player->Update(t_diff);
+                WorldSession*    session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(s_diff, updater);
+            }
         }
     }
 
@@ -921,8 +977,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
     }
 
     /// update active cells around players and active objects
-    resetMarkedCells();
-    resetMarkedCellsLarge();
+    if (sWorld->getIntConfig(CONFIG_MAP_UPDATE_FAR_OBJECTS_TICKS) > 1)
+        MarkCellsNearPlayers();
 
     Acore::ObjectUpdater updater(t_diff, false);
 
@@ -944,57 +1000,22 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
     std::vector<Creature*> updateList;
     updateList.reserve(10);
 
-    // non-player active objects, increasing iterator in the loop in case of
-    // object removal
-    for (m_activeNonPlayersIter = m_activeNonPlayers.begin();
-         m_activeNonPlayersIter != m_activeNonPlayers.end();) {
-        WorldObject* obj = *m_activeNonPlayersIter;
-        ++m_activeNonPlayersIter;
-
-        if (!obj || !obj->IsInWorld())
-            continue;
-
-        VisitNearbyCellsOf(obj,
-                           grid_object_update,
-                           world_object_update,
-                           grid_large_object_update,
-                           world_large_object_update);
-    }
-
-    // the player iterator is stored in the map object
-    // to make sure calls to Map::Remove don't invalidate it
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end();
-         ++m_mapRefIter) {
-        Player* player = m_mapRefIter->GetSource();
-
-        if (!player || !player->IsInWorld())
-            continue;
+    auto updateActiveObject = [&](WorldObject* obj) {
+        MarkNearbyCellsOf(obj);
+    };
 
+    auto updatePlayer = [&](Player* player) {
         // update players at tick
         player->Update(s_diff);
 
-        VisitNearbyCellsOfPlayer(player,
-                                 grid_object_update,
-                                 world_object_update,
-                                 grid_large_object_update,
-                                 world_large_object_update);
+        MarkNearbyCellsOfPlayer(player);
 
         // If player is using far sight, visit that object too
         if (WorldObject* viewPoint = player->GetViewpoint()) {
-            if (Creature* viewCreature = viewPoint->ToCreature()) {
-                VisitNearbyCellsOf(viewCreature,
-                                   grid_object_update,
-                                   world_object_update,
-                                   grid_large_object_update,
-                                   world_large_object_update);
-            }
-            else if (DynamicObject* viewObject = viewPoint->ToDynObject()) {
-                VisitNearbyCellsOf(viewObject,
-                                   grid_object_update,
-                                   world_object_update,
-                                   grid_large_object_update,
-                                   world_large_object_update);
-            }
+            if (Creature* viewCreature = viewPoint->ToCreature())
+                MarkNearbyCellsOf(viewCreature);
+            else if (DynamicObject* viewObject = viewPoint->ToDynObject())
+                MarkNearbyCellsOf(viewObject);
         }
 
         // handle updates for creatures in combat with player and are more than
@@ -1016,18 +1037,107 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
                      updateList.begin();
                  itr != updateList.end();
                  ++itr)
-                VisitNearbyCellsOf(*itr,
-                                   grid_object_update,
-                                   world_object_update,
-                                   grid_large_object_update,
-                                   world_large_object_update);
+                MarkNearbyCellsOf(*itr);
+        }
+    };
+
+    {
+        TICK_PROFILE_SCOPE("objects");
+        AC_PROFILE_ZONE("Map::Update objects");
+        MapStats::PhaseTimer phaseTimer(_stats, MAP_PHASE_OBJECTS);
+
+        std::vector<uint16> regionByGrid;
+        uint16              regionCount = 1;
+        if (sWorld->getBoolConfig(CONFIG_MAP_UPDATE_REGIONS) && !Instanceable())
+            regionCount = BuildUpdateRegions(regionByGrid);
+
+        if (regionCount > 1) {
+            // objects are bucketed once per update, cross-region relocations of
+            // creatures and objects are committed by the move lists below
+            std::vector<std::vector<WorldObject*>> regionObjects(regionCount);
+            std::vector<std::vector<Player*>>      regionPlayers(regionCount);
+
+            auto regionOf = [&](WorldObject const* obj) {
+                GridCoord p = Acore::ComputeGridCoord(obj->GetPositionX(),
+                                                      obj->GetPositionY());
+                uint16    region =
+                    regionByGrid[p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord];
+                return region < regionCount ? region : uint16(0);
+            };
+
+            for (WorldObject* obj : m_activeNonPlayers)
+                if (obj && obj->IsInWorld())
+                    regionObjects[regionOf(obj)].push_back(obj);
+
+            for (MapRefMgr::iterator itr = m_mapRefMgr.begin();
+                 itr != m_mapRefMgr.end();
+                 ++itr) {
+                Player* player = itr->GetSource();
+                if (player && player->IsInWorld())
+                    regionPlayers[regionOf(player)].push_back(player);
+            }
+
+            for (uint16 region = 0; region < regionCount; ++region) {
+                for (WorldObject* obj : regionObjects[region]) {
+                    // may have been removed by an update earlier in this loop
+                    if (!m_activeNonPlayers.count(obj) || !obj->IsInWorld())
+                        continue;
+
+                    updateActiveObject(obj);
+                }
+
+                for (Player* player : regionPlayers[region]) {
+                    if (!player->IsInWorld() || player->FindMap() != this)
+                        continue;
+
+                    updatePlayer(player);
+                }
+            }
+
+            METRIC_VALUE("map_update_regions",
+                         uint64(regionCount),
+                         METRIC_TAG("map_id", std::to_string(GetId())));
+        }
+        else {
+            // non-player active objects, increasing iterator in the loop in
+            // case of object removal
+            for (m_activeNonPlayersIter = m_activeNonPlayers.begin();
+                 m_activeNonPlayersIter != m_activeNonPlayers.end();) {
+                WorldObject* obj = *m_activeNonPlayersIter;
+                ++m_activeNonPlayersIter;
+
+                if (!obj || !obj->IsInWorld())
+                    continue;
+
+                updateActiveObject(obj);
+            }
+
+            // the player iterator is stored in the map object
+            // to make sure calls to Map::Remove don't invalidate it
+            for (m_mapRefIter = m_mapRefMgr.begin();
+                 m_mapRefIter != m_mapRefMgr.end();
+                 ++m_mapRefIter) {
+                Player* player = m_mapRefIter->GetSource();
+
+                if (!player || !player->IsInWorld())
+                    continue;
+
+                updatePlayer(player);
+            }
         }
+
+        // objects around all players and active objects are updated in one
+        // pass, after every cell in range has been marked
+        VisitMarkedCells(grid_object_update,
+                         world_object_update,
+                         grid_large_object_update,
+                         world_large_object_update);
     }
 
     for (_transportsUpdateIter = _transports.begin();
          _transportsUpdateIter !=
          _transports.end();) // pussywizard: transports updated after
-                             // VisitNearbyCellsOf, grids around are loaded,
+                             // VisitMarkedCells, grids around are loaded,
                              // everything ok
     {
         MotionTransport* transport = *_transportsUpdateIter;
@@ -1039,21 +1149,43 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
         transport->Update(t_diff);
     }
 
-    SendObjectUpdates();
+    {
+        TICK_PROFILE_SCOPE("grid preload");
+        AC_PROFILE_ZONE("Map::Update grid preload");
+        MapStats::PhaseTimer phaseTimer(_stats, MAP_PHASE_GRID_PRELOAD);
+        PreloadGridsAhead();
+    }
+
+    {
+        TICK_PROFILE_SCOPE("object updates");
+        AC_PROFILE_ZONE("Map::Update object updates");
+        MapStats::PhaseTimer phaseTimer(_stats, MAP_PHASE_OBJECT_UPDATES);
+        SendObjectUpdates();
+    }
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty()) {
+        TICK_PROFILE_SCOPE("scripts");
+        AC_PROFILE_ZONE("Map::Update scripts");
+        MapStats::PhaseTimer phaseTimer(_stats, MAP_PHASE_SCRIPTS);
         i_scriptLock = true;
         ScriptsProcess();
         i_scriptLock = false;
     }
 
-    MoveAllCreaturesInMoveList();
-    MoveAllGameObjectsInMoveList();
-    MoveAllDynamicObjectsInMoveList();
+    {
+        TICK_PROFILE_SCOPE("relocations");
+        AC_PROFILE_ZONE("Map::Update relocations");
+        MapStats::PhaseTimer phaseTimer(_stats, MAP_PHASE_RELOCATIONS);
+        MoveAllCreaturesInMoveList();
+        MoveAllGameObjectsInMoveList();
+        MoveAllDynamicObjectsInMoveList();
+    }
 
     HandleDelayedVisibility();
 
+    DeleteRemovedRespawnTimesInDB();
+
     sScriptMgr->OnMapUpdate(this, t_diff);
 
     METRIC_VALUE("map_creatures",
@@ -1065,18 +1197,221 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
                  uint64(GetObjectsStore().Size<GameObject>()),
                  METRIC_TAG("map_id", std::to_string(GetId())),
                  METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _stats.AddUpdate(std::chrono::duration_cast<Microseconds>(
+        std::chrono::steady_clock::now() - updateStart));
+    if (_stats.Update(t_diff,
+                      m_mapRefMgr.getSize(),
+                      GetObjectsStore().Size<Creature>(),
+                      GetObjectsStore().Size<GameObject>()))
+        SendStatsMetrics();
+}
+
+void Map::SendStatsMetrics() const
+{
+    MapStatsWindow const window     = _stats.GetLastWindow();
+    std::string const    mapId      = std::to_string(GetId());
+    std::string const    instanceId = std::to_string(GetInstanceId());
+
+    METRIC_VALUE("map_update_time",
+                 uint64(window.UpdateTime.count()),
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    for (uint8 phase = 0; phase < MAP_PHASE_COUNT; ++phase)
+        METRIC_VALUE("map_update_phase_time",
+                     uint64(window.PhaseTime[phase].count()),
+                     METRIC_TAG("map_id", mapId),
+                     METRIC_TAG("map_instanceid", instanceId),
+                     METRIC_TAG("phase",
+                                GetMapUpdatePhaseName(MapUpdatePhase(phase))));
+    METRIC_VALUE("map_players",
+                 window.Players,
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    METRIC_VALUE("map_packets_sent",
+                 window.PacketsSent,
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    METRIC_VALUE("map_bytes_sent",
+                 window.BytesSent,
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    METRIC_VALUE("map_paths",
+                 window.Paths,
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    METRIC_VALUE("map_path_time",
+                 uint64(window.PathTime.count()),
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    METRIC_VALUE("map_los_queries",
+                 window.LosQueries,
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+    METRIC_VALUE("map_grid_loads",
+                 window.GridLoads,
+                 METRIC_TAG("map_id", mapId),
+                 METRIC_TAG("map_instanceid", instanceId));
+}
+
+void Map::PreloadGridsAhead()
+{
+    uint32 const lookahead =
+        sWorld->getIntConfig(CONFIG_GRID_PRELOAD_LOOKAHEAD);
+    if (!lookahead || Instanceable())
+        return;
+
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin();
+         itr != m_mapRefMgr.end();
+         ++itr) {
+        Player* player = itr->GetSource();
+        if (!player || !player->IsInWorld() || player->GetTransport())
+            continue;
+
+        float                       x      = player->GetPositionX();
+        float                       y      = player->GetPositionY();
+        Movement::MoveSpline const* spline = player->movespline;
+        if (!spline->Finalized() && spline->Duration() > 0) {
+            // taxi and other splines, take the point reached after lookahead
+            float const t =
+                std::min(1.0f,
+                         float(spline->timePassed() +
+                               lookahead * IN_MILLISECONDS) /
+                             spline->Duration());
+            G3D::Vector3 ahead;
+            spline->_Spline().evaluate_percent(t, ahead);
+            x = ahead.x;
+            y = ahead.y;
+        }
+        else if (player->isMoving()) {
+            uint32 const moveFlags = player->GetUnitMovementFlags();
+            float        angle     = player->GetOrientation();
+            if (moveFlags & MOVEMENTFLAG_BACKWARD)
+                angle += float(M_PI);
+
+            float const distance =
+                player->GetSpeed(Movement::SelectSpeedType(moveFlags)) *
+                lookahead;
+            x += std::cos(angle) * distance;
+            y += std::sin(angle) * distance;
+        }
+        else
+            continue;
+
+        // every grid the player could see from there
+        float const range = player->GetSightRange();
+
+        float minX = x - range, maxX = x + range;
+        float minY = y - range, maxY = y + range;
+        Acore::NormalizeMapCoord(minX);
+        Acore::NormalizeMapCoord(maxX);
+        Acore::NormalizeMapCoord(minY);
+        Acore::NormalizeMapCoord(maxY);
+
+        GridCoord const low  = Acore::ComputeGridCoord(minX, minY);
+        GridCoord const high = Acore::ComputeGridCoord(maxX, maxY);
+        for (uint32 gx = low.x_coord; gx <= high.x_coord; ++gx)
+            for (uint32 gy = low.y_coord; gy <= high.y_coord; ++gy)
+                if (!getNGrid(gx, gy)) {
+                    EnsureGridCreated(GridCoord(gx, gy));
+                    return;
+                }
+    }
+}
+
+bool Map::ConsumePathBudget()
+{
+    uint32 const budget = sWorld->getIntConfig(CONFIG_MOVEMAPS_PATH_BUDGET);
+    if (!budget)
+        return true;
+
+    if (_pathsThisUpdate >= budget)
+        return false;
+
+    ++_pathsThisUpdate;
+    return true;
+}
+
+void Map::AddToDelayedVisibility(Unit* unit)
+{
+    if (i_objectsForDelayedVisibility.insert(unit).second)
+        _delayedVisibilityQueue.push_back(unit);
+}
+
+void Map::RemoveFromDelayedVisibility(Unit* unit)
+{
+    i_objectsForDelayedVisibility.erase(unit);
 }
 
 void Map::HandleDelayedVisibility()
 {
-    if (i_objectsForDelayedVisibility.empty())
+    if (i_objectsForDelayedVisibility.empty()) {
+        _delayedVisibilityQueue.clear();
         return;
-    for (std::unordered_set<Unit*>::iterator itr =
-             i_objectsForDelayedVisibility.begin();
-         itr != i_objectsForDelayedVisibility.end();
-         ++itr)
-        (*itr)->ExecuteDelayedUnitRelocationEvent();
-    i_objectsForDelayedVisibility.clear();
+    }
+
+    uint32 const budget = sWorld->getIntConfig(CONFIG_VISIBILITY_UPDATE_BUDGET);
+    uint32 const start  = getMSTime();
+    while (!_delayedVisibilityQueue.empty()) {
+        Unit* unit = _delayedVisibilityQueue.front();
+        _delayedVisibilityQueue.pop_front();
+        if (!i_objectsForDelayedVisibility.erase(unit))
+            continue;
+
+        unit->ExecuteDelayedUnitRelocationEvent();
+
+        if (budget && GetMSTimeDiffToNow(start) >= budget)
+            break;
+    }
+}
+
+uint16 Map::BuildUpdateRegions(std::vector<uint16>& regionByGrid) const
+{
+    // flood fill over loaded grids, grids touching each other (diagonals
+    // included) share a region since activation and visibility ranges are
+    // shorter than a grid
+    uint16 const unassigned = std::numeric_limits<uint16>::max();
+    regionByGrid.assign(MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS, unassigned);
+
+    uint16                 regionCount = 0;
+    std::vector<GridCoord> pending;
+    for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x) {
+        for (uint32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y) {
+            if (!getNGrid(x, y) ||
+                regionByGrid[x * MAX_NUMBER_OF_GRIDS + y] != unassigned)
+                continue;
+
+            regionByGrid[x * MAX_NUMBER_OF_GRIDS + y] = regionCount;
+            pending.push_back(GridCoord(x, y));
+
+            while (!pending.empty()) {
+                GridCoord coord = pending.back();
+                pending.pop_back();
+
+                for (int32 dx = -1; dx <= 1; ++dx) {
+                    for (int32 dy = -1; dy <= 1; ++dy) {
+                        int32 nx = int32(coord.x_coord) + dx;
+                        int32 ny = int32(coord.y_coord) + dy;
+                        if (nx < 0 || ny < 0 || nx >= MAX_NUMBER_OF_GRIDS ||
+                            ny >= MAX_NUMBER_OF_GRIDS)
+                            continue;
+
+                        uint16& region =
+                            regionByGrid[nx * MAX_NUMBER_OF_GRIDS + ny];
+                        if (region != unassigned || !getNGrid(nx, ny))
+                            continue;
+
+                        region = regionCount;
+                        pending.push_back(GridCoord(nx, ny));
+                    }
+                }
+            }
+
+            ++regionCount;
+        }
+    }
+
+    return regionCount;
 }
 
 struct ResetNotifier {
@@ -1100,6 +1435,11 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
     player->getHostileRefMgr().deleteReferences(
         true); // pussywizard: multithreading crashfix
 
+    // units it still has at client must stop relaying their movement to it
+    for (ObjectGuid const& guid : player->m_clientGUIDs)
+        if (Unit* unit = ObjectAccessor::GetUnit(*player, guid))
+            unit->RemoveObserver(player->GetGUID());
+
     bool inWorld = player->IsInWorld();
     player->RemoveFromWorld();
     SendRemoveTransports(player);
@@ -1207,6 +1547,8 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
         player->GetVehicleKit()->RelocatePassengers();
     player->UpdatePositionData();
     player->UpdateObjectVisibility(false);
+
+    NotifyProximityTraps(player, x, y, z);
 }
 
 void Map::CreatureRelocation(
@@ -1229,6 +1571,8 @@ void Map::CreatureRelocation(
         creature->GetVehicleKit()->RelocatePassengers();
     creature->UpdatePositionData();
     creature->UpdateObjectVisibility(false);
+
+    NotifyProximityTraps(creature, x, y, z);
 }
 
 void Map::GameObjectRelocation(
@@ -1246,10 +1590,78 @@ void Map::GameObjectRelocation(
     else
         RemoveGameObjectFromMoveList(go);
 
+    bool proximityTrap = go->GetTrapProximityRadius() > 0.0f;
+    if (proximityTrap)
+        RemoveTrapFromProximityIndex(go);
+
     go->Relocate(x, y, z, o);
     go->UpdateModelPosition();
     go->SetPositionDataUpdate();
     go->UpdateObjectVisibility(false);
+
+    if (proximityTrap) {
+        AddTrapToProximityIndex(go);
+        go->OnUnitInTrapRange();
+    }
+}
+
+// Units bigger than this may enter a trap from a cell it is not indexed in
+#define TRAP_PROXIMITY_UNIT_REACH 5.0f
+
+template <class Fn>
+void Map::ForEachTrapProximityCell(GameObject const* trap, Fn&& fn)
+{
+    float reach = trap->GetTrapProximityRadius() + TRAP_PROXIMITY_UNIT_REACH;
+
+    CellCoord low  = Acore::ComputeCellCoord(trap->GetPositionX() - reach,
+                                            trap->GetPositionY() - reach);
+    CellCoord high = Acore::ComputeCellCoord(trap->GetPositionX() + reach,
+                                             trap->GetPositionY() + reach);
+
+    for (uint32 x = std::min(low.x_coord, high.x_coord);
+         x <= std::max(low.x_coord, high.x_coord);
+         ++x)
+        for (uint32 y = std::min(low.y_coord, high.y_coord);
+             y <= std::max(low.y_coord, high.y_coord);
+             ++y)
+            fn(CellCoord(x, y).GetId());
+}
+
+void Map::AddTrapToProximityIndex(GameObject* trap)
+{
+    ForEachTrapProximityCell(
+        trap, [&](uint32 cellId) { _proximityTraps[cellId].push_back(trap); });
+}
+
+void Map::RemoveTrapFromProximityIndex(GameObject* trap)
+{
+    ForEachTrapProximityCell(trap, [&](uint32 cellId) {
+        auto itr = _proximityTraps.find(cellId);
+        if (itr == _proximityTraps.end())
+            return;
+
+        std::vector<GameObject*>& traps = itr->second;
+        traps.erase(std::remove(traps.begin(), traps.end(), trap),
+                    traps.end());
+        if (traps.empty())
+            _proximityTraps.erase(itr);
+    });
+}
+
+void Map::NotifyProximityTraps(Unit* unit, float x, float y, float z)
+{
+    if (_proximityTraps.empty())
+        return;
+
+    auto itr = _proximityTraps.find(Acore::ComputeCellCoord(x, y).GetId());
+    if (itr == _proximityTraps.end())
+        return;
+
+    for (GameObject* trap : itr->second) {
+        float radius = trap->GetTrapProximityRadius() + unit->GetObjectSize();
+        if (trap->InSamePhase(unit) && trap->IsInRange(x, y, z, radius))
+            trap->OnUnitInTrapRange();
+    }
 }
 
 void Map::DynamicObjectRelocation(
@@ -1474,6 +1886,8 @@ void Map::RemoveAllPlayers()
 
 void Map::UnloadAll()
 {
+    DeleteRemovedRespawnTimesInDB();
+
     // clear all delayed moves, useless anyway do this moves before map unload.
     _creaturesToMove.clear();
     _gameObjectsToMove.clear();
@@ -1552,69 +1966,51 @@ bool GridMap::loadData(char* filename)
     // Unload old data if exist
     unloadData();
 
-    map_fileheader header;
     // Not return error if file not found
-    FILE* in = fopen(filename, "rb");
-    if (!in)
+    if (!_file.Open(filename))
         return true;
 
-    if (fread(&header, sizeof(header), 1, in) != 1) {
-        fclose(in);
+    map_fileheader header;
+    if (!readHeader(0, header))
         return false;
-    }
 
     if (header.mapMagic == MapMagic.asUInt &&
         header.versionMagic == MapVersionMagic) {
         // loadup area data
         if (header.areaMapOffset &&
-            !loadAreaData(in, header.areaMapOffset, header.areaMapSize)) {
+            !loadAreaData(header.areaMapOffset, header.areaMapSize)) {
             LOG_ERROR("maps", "Error loading map area data\n");
-            fclose(in);
             return false;
         }
         // loadup height data
         if (header.heightMapOffset &&
-            !loadHeightData(in, header.heightMapOffset, header.heightMapSize)) {
+            !loadHeightData(header.heightMapOffset, header.heightMapSize)) {
             LOG_ERROR("maps", "Error loading map height data\n");
-            fclose(in);
             return false;
         }
         // loadup liquid data
         if (header.liquidMapOffset &&
-            !loadLiquidData(in, header.liquidMapOffset, header.liquidMapSize)) {
+            !loadLiquidData(header.liquidMapOffset, header.liquidMapSize)) {
             LOG_ERROR("maps", "Error loading map liquids data\n");
-            fclose(in);
             return false;
         }
         // loadup holes data (if any. check header.holesOffset)
         if (header.holesSize &&
-            !loadHolesData(in, header.holesOffset, header.holesSize)) {
+            !loadHolesData(header.holesOffset, header.holesSize)) {
             LOG_ERROR("maps", "Error loading map holes data\n");
-            fclose(in);
             return false;
         }
-        fclose(in);
         return true;
     }
     LOG_ERROR("maps",
               "Map file '{}' is from an incompatible clientversion. Please "
               "recreate using the mapextractor.",
               filename);
-    fclose(in);
     return false;
 }
 
 void GridMap::unloadData()
 {
-    delete[] _areaMap;
-    delete[] m_V9;
-    delete[] m_V8;
-    delete[] _maxHeight;
-    delete[] _minHeight;
-    delete[] _liquidEntry;
-    delete[] _liquidFlags;
-    delete[] _liquidMap;
-    delete[] _holes;
     _areaMap       = nullptr;
     m_V9           = nullptr;
     m_V8           = nullptr;
@@ -1625,64 +2021,93 @@ void GridMap::unloadData()
     _liquidMap     = nullptr;
     _holes         = nullptr;
     _gridGetHeight = &GridMap::getHeightFromFlat;
+    _copies.clear();
+    _file.Close();
 }
 
-bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
+template <typename T>
+bool GridMap::readHeader(uint32 offset, T& header) const
 {
-    map_areaHeader header;
-    fseek(in, offset, SEEK_SET);
+    if (offset > _file.GetSize() || sizeof(T) > _file.GetSize() - offset)
+        return false;
+
+    memcpy(&header, _file.GetData() + offset, sizeof(T));
+    return true;
+}
+
+template <typename T>
+T const* GridMap::mapArray(uint32 offset, uint32 count)
+{
+    std::size_t const size = std::size_t(count) * sizeof(T);
+    if (offset > _file.GetSize() || size > _file.GetSize() - offset)
+        return nullptr;
+
+    uint8 const* data = _file.GetData() + offset;
+
+    // the extractor doesn't pad sections, e.g. uint8 heights leave the flight
+    // bounds at an odd offset
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T)) {
+        _copies.emplace_back(new uint8[size]);
+        memcpy(_copies.back().get(), data, size);
+        data = _copies.back().get();
+    }
+
+    return reinterpret_cast<T const*>(data);
+}
 
-    if (fread(&header, sizeof(header), 1, in) != 1 ||
-        header.fourcc != MapAreaMagic.asUInt)
+bool GridMap::loadAreaData(uint32 offset, uint32 /*size*/)
+{
+    map_areaHeader header;
+    if (!readHeader(offset, header) || header.fourcc != MapAreaMagic.asUInt)
         return false;
 
     _gridArea = header.gridArea;
     if (!(header.flags & MAP_AREA_NO_AREA)) {
-        _areaMap = new uint16[16 * 16];
-        if (fread(_areaMap, sizeof(uint16), 16 * 16, in) != 16 * 16)
+        _areaMap = mapArray<uint16>(offset + sizeof(header), 16 * 16);
+        if (!_areaMap)
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHeightData(uint32 offset, uint32 /*size*/)
 {
     map_heightHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 ||
-        header.fourcc != MapHeightMagic.asUInt)
+    if (!readHeader(offset, header) || header.fourcc != MapHeightMagic.asUInt)
         return false;
 
+    offset += sizeof(header);
     _gridHeight = header.gridHeight;
     if (!(header.flags & MAP_HEIGHT_NO_HEIGHT)) {
         if ((header.flags & MAP_HEIGHT_AS_INT16)) {
-            m_uint16_V9 = new uint16[129 * 129];
-            m_uint16_V8 = new uint16[128 * 128];
-            if (fread(m_uint16_V9, sizeof(uint16), 129 * 129, in) !=
-                    129 * 129 ||
-                fread(m_uint16_V8, sizeof(uint16), 128 * 128, in) != 128 * 128)
+            m_uint16_V9 = mapArray<uint16>(offset, 129 * 129);
+            m_uint16_V8 = mapArray<uint16>(offset + sizeof(uint16) * 129 * 129,
+                                           128 * 128);
+            if (!m_uint16_V9 || !m_uint16_V8)
                 return false;
+            offset += sizeof(uint16) * (129 * 129 + 128 * 128);
             _gridIntHeightMultiplier =
                 (header.gridMaxHeight - header.gridHeight) / 65535;
             _gridGetHeight = &GridMap::getHeightFromUint16;
         }
         else if ((header.flags & MAP_HEIGHT_AS_INT8)) {
-            m_uint8_V9 = new uint8[129 * 129];
-            m_uint8_V8 = new uint8[128 * 128];
-            if (fread(m_uint8_V9, sizeof(uint8), 129 * 129, in) != 129 * 129 ||
-                fread(m_uint8_V8, sizeof(uint8), 128 * 128, in) != 128 * 128)
+            m_uint8_V9 = mapArray<uint8>(offset, 129 * 129);
+            m_uint8_V8 = mapArray<uint8>(offset + sizeof(uint8) * 129 * 129,
+                                         128 * 128);
+            if (!m_uint8_V9 || !m_uint8_V8)
                 return false;
+            offset += sizeof(uint8) * (129 * 129 + 128 * 128);
             _gridIntHeightMultiplier =
                 (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridMap::getHeightFromUint8;
         }
         else {
-            m_V9 = new float[129 * 129];
-            m_V8 = new float[128 * 128];
-            if (fread(m_V9, sizeof(float), 129 * 129, in) != 129 * 129 ||
-                fread(m_V8, sizeof(float), 128 * 128, in) != 128 * 128)
+            m_V9 = mapArray<float>(offset, 129 * 129);
+            m_V8 = mapArray<float>(offset + sizeof(float) * 129 * 129,
+                                   128 * 128);
+            if (!m_V9 || !m_V8)
                 return false;
+            offset += sizeof(float) * (129 * 129 + 128 * 128);
             _gridGetHeight = &GridMap::getHeightFromFloat;
         }
     }
@@ -1690,25 +2115,22 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
         _gridGetHeight = &GridMap::getHeightFromFlat;
 
     if (header.flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS) {
-        _maxHeight = new int16[3 * 3];
-        _minHeight = new int16[3 * 3];
-        if (fread(_maxHeight, sizeof(int16), 3 * 3, in) != 3 * 3 ||
-            fread(_minHeight, sizeof(int16), 3 * 3, in) != 3 * 3)
+        _maxHeight = mapArray<int16>(offset, 3 * 3);
+        _minHeight = mapArray<int16>(offset + sizeof(int16) * 3 * 3, 3 * 3);
+        if (!_maxHeight || !_minHeight)
             return false;
     }
 
     return true;
 }
 
-bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadLiquidData(uint32 offset, uint32 /*size*/)
 {
     map_liquidHeader header;
-    fseek(in, offset, SEEK_SET);
-
-    if (fread(&header, sizeof(header), 1, in) != 1 ||
-        header.fourcc != MapLiquidMagic.asUInt)
+    if (!readHeader(offset, header) || header.fourcc != MapLiquidMagic.asUInt)
         return false;
 
+    offset += sizeof(header);
     _liquidGlobalEntry = header.liquidType;
     _liquidGlobalFlags = header.liquidFlags;
     _liquidOffX        = header.offsetX;
@@ -1718,34 +2140,26 @@ bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
     _liquidLevel       = header.liquidLevel;
 
     if (!(header.flags & MAP_LIQUID_NO_TYPE)) {
-        _liquidEntry = new uint16[16 * 16];
-        if (fread(_liquidEntry, sizeof(uint16), 16 * 16, in) != 16 * 16)
-            return false;
-
-        _liquidFlags = new uint8[16 * 16];
-        if (fread(_liquidFlags, sizeof(uint8), 16 * 16, in) != 16 * 16)
+        _liquidEntry = mapArray<uint16>(offset, 16 * 16);
+        _liquidFlags =
+            mapArray<uint8>(offset + sizeof(uint16) * 16 * 16, 16 * 16);
+        if (!_liquidEntry || !_liquidFlags)
             return false;
+        offset += (sizeof(uint16) + sizeof(uint8)) * 16 * 16;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT)) {
-        _liquidMap = new float[uint32(_liquidWidth) * uint32(_liquidHeight)];
-        if (fread(
-                _liquidMap, sizeof(float), _liquidWidth * _liquidHeight, in) !=
-            (uint32(_liquidWidth) * uint32(_liquidHeight)))
+        _liquidMap = mapArray<float>(
+            offset, uint32(_liquidWidth) * uint32(_liquidHeight));
+        if (!_liquidMap)
             return false;
     }
     return true;
 }
 
-bool GridMap::loadHolesData(FILE* in, uint32 offset, uint32 /*size*/)
+bool GridMap::loadHolesData(uint32 offset, uint32 /*size*/)
 {
-    if (fseek(in, offset, SEEK_SET) != 0)
-        return false;
-
-    _holes = new uint16[16 * 16];
-    if (fread(_holes, sizeof(uint16), 16 * 16, in) != 16 * 16)
-        return false;
-
-    return true;
+    _holes = mapArray<uint16>(offset, 16 * 16);
+    return _holes != nullptr;
 }
 
 uint16 GridMap::getArea(float x, float y) const
@@ -1760,6 +2174,15 @@ uint16 GridMap::getArea(float x, float y) const
     return _areaMap[lx * 16 + ly];
 }
 
+std::atomic<uint8>& GridMap::GetWMOBlockState(float x, float y)
+{
+    x      = WMO_BLOCKS_PER_GRID * (32 - x / SIZE_OF_GRIDS);
+    y      = WMO_BLOCKS_PER_GRID * (32 - y / SIZE_OF_GRIDS);
+    int lx = (int)x & (WMO_BLOCKS_PER_GRID - 1);
+    int ly = (int)y & (WMO_BLOCKS_PER_GRID - 1);
+    return _wmoBlocks[lx * WMO_BLOCKS_PER_GRID + ly];
+}
+
 float GridMap::getHeightFromFlat(float /*x*/, float /*y*/) const
 {
     return _gridHeight;
@@ -1862,8 +2285,8 @@ float GridMap::getHeightFromUint8(float x, float y) const
     if (isHole(x_int, y_int))
         return INVALID_HEIGHT;
 
-    int32  a, b, c;
-    uint8* V9_h1_ptr = &m_uint8_V9[x_int * 128 + x_int + y_int];
+    int32        a, b, c;
+    uint8 const* V9_h1_ptr = &m_uint8_V9[x_int * 128 + x_int + y_int];
     if (x + y < 1) {
         if (x > y) {
             // 1 triangle (h1, h2, h5 points)
@@ -1927,8 +2350,8 @@ float GridMap::getHeightFromUint16(float x, float y) const
     if (isHole(x_int, y_int))
         return INVALID_HEIGHT;
 
-    int32   a, b, c;
-    uint16* V9_h1_ptr = &m_uint16_V9[x_int * 128 + x_int + y_int];
+    int32         a, b, c;
+    uint16 const* V9_h1_ptr = &m_uint16_V9[x_int * 128 + x_int + y_int];
     if (x + y < 1) {
         if (x > y) {
             // 1 triangle (h1, h2, h5 points)
@@ -2322,8 +2745,10 @@ bool Map::GetAreaInfo(uint32  phaseMask,
     int32           drootId;
     int32           dgroupId;
 
-    bool hasVmapAreaInfo = vmgr->GetAreaInfo(
-        GetId(), x, y, vmap_z, vflags, vadtId, vrootId, vgroupId);
+    bool hasVmapAreaInfo =
+        HasWMOAt(x, y) &&
+        vmgr->GetAreaInfo(
+            GetId(), x, y, vmap_z, vflags, vadtId, vrootId, vgroupId);
     bool hasDynamicAreaInfo = _dynamicTree.GetAreaInfo(
         x, y, dynamic_z, phaseMask, dflags, dadtId, drootId, dgroupId);
     auto useVmap = [&]() {
@@ -2367,6 +2792,34 @@ bool Map::GetAreaInfo(uint32  phaseMask,
     return false;
 }
 
+bool Map::HasWMOAt(float x, float y) const
+{
+    GridMap* gmap = const_cast<Map*>(this)->GetGrid(x, y);
+    if (!gmap)
+        return true;
+
+    std::atomic<uint8>& state = gmap->GetWMOBlockState(x, y);
+    uint8 known = state.load(std::memory_order_relaxed);
+    if (known != WMO_BLOCK_UNKNOWN)
+        return known == WMO_BLOCK_PRESENT;
+
+    // same block boundaries as GridMap::GetWMOBlockState
+    float bx   = std::floor(WMO_BLOCKS_PER_GRID * (32 - x / SIZE_OF_GRIDS));
+    float by   = std::floor(WMO_BLOCKS_PER_GRID * (32 - y / SIZE_OF_GRIDS));
+    float maxX = (32 - bx / WMO_BLOCKS_PER_GRID) * SIZE_OF_GRIDS;
+    float maxY = (32 - by / WMO_BLOCKS_PER_GRID) * SIZE_OF_GRIDS;
+
+    bool present = VMAP::VMapFactory::createOrGetVMapMgr()->HasWMOInArea(
+        GetId(),
+        maxX - SIZE_OF_WMO_BLOCK,
+        maxY - SIZE_OF_WMO_BLOCK,
+        maxX,
+        maxY);
+    state.store(present ? WMO_BLOCK_PRESENT : WMO_BLOCK_NONE,
+                std::memory_order_relaxed);
+    return present;
+}
+
 uint32 Map::GetAreaId(uint32 phaseMask, float x, float y, float z) const
 {
     uint32 mogpFlags;
@@ -2443,15 +2896,15 @@ LiquidData const Map::GetLiquidData(uint32 phaseMask,
     uint32          liquid_type   = 0;
     uint32          mogpFlags     = 0;
     bool            useGridLiquid = true;
-    if (vmgr->GetLiquidLevel(GetId(),
-                             x,
-                             y,
-                             z,
-                             ReqLiquidType,
-                             liquid_level,
-                             ground_level,
-                             liquid_type,
-                             mogpFlags)) {
+    if (HasWMOAt(x, y) && vmgr->GetLiquidLevel(GetId(),
+                                               x,
+                                               y,
+                                               z,
+                                               ReqLiquidType,
+                                               liquid_level,
+                                               ground_level,
+                                               liquid_type,
+                                               mogpFlags)) {
         useGridLiquid = !IsInWMOInterior(mogpFlags);
         LOG_DEBUG(
             "maps",
@@ -2545,7 +2998,8 @@ void Map::GetFullTerrainStatusForPosition(uint32 /*phaseMask*/,
     VMAP::AreaAndLiquidData vmapData;
     // VMAP::AreaAndLiquidData dynData;
     VMAP::AreaAndLiquidData* wmoData = nullptr;
-    vmgr->GetAreaAndLiquidData(GetId(), x, y, z, reqLiquidType, vmapData);
+    if (HasWMOAt(x, y))
+        vmgr->GetAreaAndLiquidData(GetId(), x, y, z, reqLiquidType, vmapData);
     // _dynamicTree.GetAreaAndLiquidData(x, y, z, phaseMask, reqLiquidType,
     // dynData);
 
@@ -2706,6 +3160,8 @@ bool Map::isInLineOfSight(float                  x1,
                           LineOfSightChecks      checks,
                           VMAP::ModelIgnoreFlags ignoreFlags) const
 {
+    _stats.AddLosQuery();
+
     if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS)) {
         if (IsBattlegroundOrArena()) {
             ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
@@ -2921,8 +3377,14 @@ inline void Map::setNGrid(NGridType* grid, uint32 x, uint32 y)
 
 void Map::SendObjectUpdates()
 {
-    UpdateDataMapType update_players;
-    UpdatePlayerSet   player_set;
+    if (_updateObjects.empty())
+        return;
+
+    // Scratch buffers of the updating thread, kept between ticks so the
+    // maps a thread updates don't allocate and free them on every update
+    thread_local UpdateDataMapType update_players;
+    thread_local UpdatePlayerSet   player_set;
+    thread_local WorldPacket       packet;
 
     while (!_updateObjects.empty()) {
         Object* obj = *_updateObjects.begin();
@@ -2932,14 +3394,26 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players, player_set);
     }
 
-    WorldPacket packet; // here we allocate a std::vector with a size of 0x10000
+    // Entries stay in the map with their buffers cleared, players that keep
+    // receiving updates reuse them instead of allocating a new UpdateData
+    // every tick. Entries left without data are players that got nothing
+    // this time (or updates of another map on this thread), drop those so
+    // the map only holds recent receivers and no stale player is used.
     for (UpdateDataMapType::iterator iter = update_players.begin();
-         iter != update_players.end();
-         ++iter) {
+         iter != update_players.end();) {
+        if (!iter->second.HasData()) {
+            iter = update_players.erase(iter);
+            continue;
+        }
+
         iter->second.BuildPacket(packet);
         iter->first->GetSession()->SendPacket(&packet);
-        packet.clear(); // clean the string
+        packet.clear(); // clean the string, keeps the capacity
+        iter->second.Clear();
+        ++iter;
     }
+
+    player_set.clear();
 }
 
 void Map::DelayedUpdate(const uint32 t_diff)
@@ -3073,10 +3547,12 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    // one copy queued on every socket instead of one copy per player
+    auto const shared = std::make_shared<WorldPacket const>(*data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin();
          itr != m_mapRefMgr.end();
          ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(shared);
 }
 
 template <class T>
@@ -3649,6 +4125,24 @@ BattlegroundMap::~BattlegroundMap()
     }
 }
 
+void BattlegroundMap::Update(const uint32 t_diff,
+                             const uint32 s_diff,
+                             bool /*thread*/)
+{
+    Map::Update(t_diff, s_diff);
+
+    if (m_bg) {
+        // the battleground is updated together with its map, on the map's
+        // update thread, instead of serially in BattlegroundMgr::Update
+        m_bg->Update(s_diff);
+
+        // arena spectator commands and world states queued during this
+        // update
+        m_bg->SpectatorsFlushCommands();
+        m_bg->FlushWorldStates();
+    }
+}
+
 void BattlegroundMap::InitVisibilityDistance()
 {
     // init visibility distance for BG/Arenas
@@ -3768,6 +4262,8 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId,
         respawnTime = now + YEAR;
 
     _creatureRespawnTimes[spawnId] = respawnTime;
+    // the replace below makes a pending delete of the old row unnecessary
+    std::erase(_creatureRespawnTimesToDelete, spawnId);
 
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
@@ -3780,14 +4276,9 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId,
 
 void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 {
-    _creatureRespawnTimes.erase(spawnId);
-
-    CharacterDatabasePreparedStatement* stmt =
-        CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, GetId());
-    stmt->SetData(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    // the stored times mirror the DB rows, nothing to delete without one
+    if (_creatureRespawnTimes.erase(spawnId))
+        _creatureRespawnTimesToDelete.push_back(spawnId);
 }
 
 void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
@@ -3804,6 +4295,8 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
         respawnTime = now + YEAR;
 
     _goRespawnTimes[spawnId] = respawnTime;
+    // the replace below makes a pending delete of the old row unnecessary
+    std::erase(_goRespawnTimesToDelete, spawnId);
 
     CharacterDatabasePreparedStatement* stmt =
         CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
@@ -3816,14 +4309,40 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 
 void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
 {
-    _goRespawnTimes.erase(spawnId);
+    // the stored times mirror the DB rows, nothing to delete without one
+    if (_goRespawnTimes.erase(spawnId))
+        _goRespawnTimesToDelete.push_back(spawnId);
+}
 
-    CharacterDatabasePreparedStatement* stmt =
-        CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, GetId());
-    stmt->SetData(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+void Map::DeleteRemovedRespawnTimesInDB()
+{
+    if (_creatureRespawnTimesToDelete.empty() &&
+        _goRespawnTimesToDelete.empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    for (ObjectGuid::LowType spawnId : _creatureRespawnTimesToDelete) {
+        CharacterDatabasePreparedStatement* stmt =
+            CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
+        stmt->SetData(0, spawnId);
+        stmt->SetData(1, GetId());
+        stmt->SetData(2, GetInstanceId());
+        trans->Append(stmt);
+    }
+
+    for (ObjectGuid::LowType spawnId : _goRespawnTimesToDelete) {
+        CharacterDatabasePreparedStatement* stmt =
+            CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
+        stmt->SetData(0, spawnId);
+        stmt->SetData(1, GetId());
+        stmt->SetData(2, GetInstanceId());
+        trans->Append(stmt);
+    }
+
+    CharacterDatabase.CommitTransaction(trans);
+
+    _creatureRespawnTimesToDelete.clear();
+    _goRespawnTimesToDelete.clear();
 }
 
 void Map::LoadRespawnTimes()
@@ -3860,6 +4379,8 @@ void Map::DeleteRespawnTimes()
 {
     _creatureRespawnTimes.clear();
     _goRespawnTimes.clear();
+    _creatureRespawnTimesToDelete.clear();
+    _goRespawnTimesToDelete.clear();
 
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
@@ -3880,6 +4401,24 @@ void Map::DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId)
     CharacterDatabase.Execute(stmt);
 }
 
+void Map::DeleteRespawnTimesInDB(uint16                       mapId,
+                                 uint32                       instanceId,
+                                 CharacterDatabaseTransaction trans)
+{
+    CharacterDatabasePreparedStatement* stmt =
+        CharacterDatabase.GetPreparedStatement(
+            CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    trans->Append(stmt);
+
+    stmt =
+        CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN_BY_INSTANCE);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    trans->Append(stmt);
+}
+
 void Map::UpdateEncounterState(EncounterCreditType type,
                                uint32              creditEntry,
                                Unit*               source)
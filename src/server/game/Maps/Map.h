@@ -22,24 +22,32 @@
 #include "Cell.h"
 #include "DBCStructure.h"
 #include "DataMap.h"
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
 #include "MapRefMgr.h"
+#include "MappedFile.h"
+#include "MapStats.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
 #include "Position.h"
 #include "SharedDefines.h"
 #include "TaskScheduler.h"
 #include "Timer.h"
+#include <array>
+#include <atomic>
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <vector>
 
 class Unit;
 class WorldPacket;
@@ -201,45 +209,70 @@ enum LineOfSightChecks {
         LINEOFSIGHT_CHECK_VMAP | LINEOFSIGHT_CHECK_GOBJECT_ALL
 };
 
+// resolution of the per grid WMO presence cache, see Map::HasWMOAt
+#define WMO_BLOCKS_PER_GRID 128
+#define SIZE_OF_WMO_BLOCK (SIZE_OF_GRIDS / WMO_BLOCKS_PER_GRID)
+
+enum WMOBlockState : uint8 {
+    WMO_BLOCK_UNKNOWN,
+    WMO_BLOCK_NONE,
+    WMO_BLOCK_PRESENT,
+};
+
 class GridMap {
     uint32 _flags;
     union {
-        float*  m_V9;
-        uint16* m_uint16_V9;
-        uint8*  m_uint8_V9;
+        float const*  m_V9;
+        uint16 const* m_uint16_V9;
+        uint8 const*  m_uint8_V9;
     };
     union {
-        float*  m_V8;
-        uint16* m_uint16_V8;
-        uint8*  m_uint8_V8;
+        float const*  m_V8;
+        uint16 const* m_uint16_V8;
+        uint8 const*  m_uint8_V8;
     };
-    int16* _maxHeight;
-    int16* _minHeight;
+    int16 const* _maxHeight;
+    int16 const* _minHeight;
     // Height level data
     float _gridHeight;
     float _gridIntHeightMultiplier;
 
     // Area data
-    uint16* _areaMap;
+    uint16 const* _areaMap;
 
     // Liquid data
-    float   _liquidLevel;
-    uint16* _liquidEntry;
-    uint8*  _liquidFlags;
-    float*  _liquidMap;
-    uint16  _gridArea;
-    uint16  _liquidGlobalEntry;
-    uint8   _liquidGlobalFlags;
-    uint8   _liquidOffX;
-    uint8   _liquidOffY;
-    uint8   _liquidWidth;
-    uint8   _liquidHeight;
-    uint16* _holes;
-
-    bool               loadAreaData(FILE* in, uint32 offset, uint32 size);
-    bool               loadHeightData(FILE* in, uint32 offset, uint32 size);
-    bool               loadLiquidData(FILE* in, uint32 offset, uint32 size);
-    bool               loadHolesData(FILE* in, uint32 offset, uint32 size);
+    float         _liquidLevel;
+    uint16 const* _liquidEntry;
+    uint8 const*  _liquidFlags;
+    float const*  _liquidMap;
+    uint16        _gridArea;
+    uint16        _liquidGlobalEntry;
+    uint8         _liquidGlobalFlags;
+    uint8         _liquidOffX;
+    uint8         _liquidOffY;
+    uint8         _liquidWidth;
+    uint8         _liquidHeight;
+    uint16 const* _holes;
+
+    // the arrays above point into the mapped .map file, sections which are
+    // not aligned for their element type are copied into _copies instead
+    Acore::MappedFile                     _file;
+    std::vector<std::unique_ptr<uint8[]>> _copies;
+
+    // WMOBlockState of every block, written by whichever map thread asks
+    // first. The vmap tile of the grid is loaded and unloaded together with
+    // this object, so the states never go stale.
+    std::array<std::atomic<uint8>, WMO_BLOCKS_PER_GRID * WMO_BLOCKS_PER_GRID>
+        _wmoBlocks{};
+
+    template <typename T>
+    bool readHeader(uint32 offset, T& header) const;
+    template <typename T>
+    T const*           mapArray(uint32 offset, uint32 count);
+    bool               loadAreaData(uint32 offset, uint32 size);
+    bool               loadHeightData(uint32 offset, uint32 size);
+    bool               loadLiquidData(uint32 offset, uint32 size);
+    bool               loadHolesData(uint32 offset, uint32 size);
     [[nodiscard]] bool isHole(int row, int col) const;
 
     // Get height functions and pointers
@@ -257,6 +290,7 @@ public:
     void unloadData();
 
     [[nodiscard]] uint16       getArea(float x, float y) const;
+    [[nodiscard]] std::atomic<uint8>& GetWMOBlockState(float x, float y);
     [[nodiscard]] inline float getHeight(float x, float y) const
     {
         return (this->*_gridGetHeight)(x, y);
@@ -343,18 +377,9 @@ public:
     template <class T>
     void RemoveFromMap(T*, bool);
 
-    void VisitNearbyCellsOf(
-        WorldObject* obj,
-        TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
-            gridVisitor,
-        TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
-            worldVisitor,
-        TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
-            largeGridVisitor,
-        TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
-            largeWorldVisitor);
-    void VisitNearbyCellsOfPlayer(
-        Player* player,
+    void MarkNearbyCellsOf(WorldObject* obj);
+    void MarkNearbyCellsOfPlayer(Player* player);
+    void VisitMarkedCells(
         TypeContainerVisitor<Acore::ObjectUpdater, GridTypeMapContainer>&
             gridVisitor,
         TypeContainerVisitor<Acore::ObjectUpdater, WorldTypeMapContainer>&
@@ -380,6 +405,12 @@ public:
     void DynamicObjectRelocation(
         DynamicObject* go, float x, float y, float z, float o);
 
+    // traps indexed by the cells their activation radius touches, units
+    // moving through those cells wake them up instead of every trap
+    // searching its surroundings on each update
+    void AddTrapToProximityIndex(GameObject* trap);
+    void RemoveTrapFromProximityIndex(GameObject* trap);
+
     template <class T, class CONTAINER>
     void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
 
@@ -413,6 +444,10 @@ public:
     }
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
+    void                      AddToDelayedVisibility(Unit* unit);
+    void                      RemoveFromDelayedVisibility(Unit* unit);
+    // Runs the pending relocation events within Visibility.UpdateBudget,
+    // units over the budget keep their place in line for the next update
     void                      HandleDelayedVisibility();
 
     // some calls like isInWater should not use vmaps due to processor power
@@ -445,6 +480,10 @@ public:
                                    float  collisionHeight,
                                    uint8  ReqLiquidType);
 
+    // false if no WMO overlaps the block around x, y, vmap area and liquid
+    // queries can then be skipped for any z
+    [[nodiscard]] bool HasWMOAt(float x, float y) const;
+
     [[nodiscard]] bool GetAreaInfo(uint32  phaseMask,
                                    float   x,
                                    float   y,
@@ -588,15 +627,29 @@ public:
     void         AddObjectToSwitchList(WorldObject* obj, bool on);
     virtual void DelayedUpdate(const uint32 diff);
 
-    void resetMarkedCells() { marked_cells.reset(); }
     bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
-    void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
-    void resetMarkedCellsLarge() { marked_cells_large.reset(); }
+    void markCell(uint32 pCellId)
+    {
+        if (!marked_cells.test(pCellId)) {
+            marked_cells.set(pCellId);
+            _markedCells.push_back(pCellId);
+        }
+    }
     bool isCellMarkedLarge(uint32 pCellId)
     {
         return marked_cells_large.test(pCellId);
     }
-    void markCellLarge(uint32 pCellId) { marked_cells_large.set(pCellId); }
+    void markCellLarge(uint32 pCellId)
+    {
+        if (!marked_cells_large.test(pCellId)) {
+            marked_cells_large.set(pCellId);
+            _markedCellsLarge.push_back(pCellId);
+        }
+    }
+
+    //! A player stood within MapUpdate.FarObjects.Distance of the cell of x, y
+    //! at the start of the current update
+    [[nodiscard]] bool IsCellNearPlayers(float x, float y) const;
 
     [[nodiscard]] bool   HavePlayers() const { return !m_mapRefMgr.IsEmpty(); }
     [[nodiscard]] uint32 GetPlayersCountExceptGMs() const;
@@ -897,6 +950,9 @@ public:
     void    RemoveOldCorpses();
 
     static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId);
+    static void DeleteRespawnTimesInDB(uint16                       mapId,
+                                       uint32                       instanceId,
+                                       CharacterDatabaseTransaction trans);
 
     void SendInitTransports(Player* player);
     void SendRemoveTransports(Player* player);
@@ -950,9 +1006,26 @@ public:
         return m_activeNonPlayers.size();
     }
 
+    // wall time of the last Update() call in microseconds, used by MapUpdater
+    // to schedule the most expensive maps first
+    [[nodiscard]] uint32 GetLastUpdateCost() const { return _lastUpdateCost; }
+    void SetLastUpdateCost(uint32 cost) { _lastUpdateCost = cost; }
+
+    // Takes one path calculation from this update's MoveMaps.PathBudget,
+    // returns false once it is used up
+    bool ConsumePathBudget();
+
+    // resource accounting of the last MapUpdate.Stats.Interval
+    [[nodiscard]] MapStats& GetStats() const { return _stats; }
+
+    // polygon corridors of recent PathGenerator queries on this map
+    [[nodiscard]] PathCache& GetPathCache() { return _pathCache; }
+
     virtual std::string GetDebugInfo() const;
 
 private:
+    void SendStatsMetrics() const;
+
     void LoadMapAndVMap(int gx, int gy);
     void LoadVMap(int gx, int gy);
     void LoadMap(int gx, int gy, bool reload = false);
@@ -999,8 +1072,16 @@ private:
 
     void UpdateActiveCells(const float& x, const float& y, const uint32 t_diff);
 
+    // labels every loaded grid with the id of its connected region, returns
+    // the number of regions
+    uint16 BuildUpdateRegions(std::vector<uint16>& regionByGrid) const;
+
     void SendObjectUpdates();
 
+    // creates one grid the players are moving towards, see
+    // GridPreloadLookahead
+    void PreloadGridsAhead();
+
 protected:
     std::mutex        Lock;
     std::mutex        GridLock;
@@ -1061,6 +1142,13 @@ private:
         marked_cells;
     std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP>
         marked_cells_large;
+    // ids of the bits set in marked_cells / marked_cells_large this update,
+    // visited and cleared by VisitMarkedCells
+    std::vector<uint32> _markedCells;
+    std::vector<uint32> _markedCellsLarge;
+    std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP>
+        marked_cells_near;
+    void MarkCellsNearPlayers();
 
     bool                             i_scriptLock;
     std::unordered_set<WorldObject*> i_objectsToRemove;
@@ -1097,6 +1185,11 @@ private:
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t>
         _creatureRespawnTimes;
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
+    // respawn rows removed since the last update, deleted in one transaction
+    std::vector<ObjectGuid::LowType> _creatureRespawnTimesToDelete;
+    std::vector<ObjectGuid::LowType> _goRespawnTimesToDelete;
+
+    void DeleteRemovedRespawnTimesInDB();
 
     ZoneDynamicInfoMap _zoneDynamicInfo;
     uint32             _defaultLight;
@@ -1104,20 +1197,13 @@ private:
     template <HighGuid high>
     inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
     {
-        auto itr = _guidGenerators.find(high);
-        if (itr == _guidGenerators.end())
-            itr = _guidGenerators
-                      .insert(std::make_pair(
-                          high,
-                          std::unique_ptr<ObjectGuidGenerator<high>>(
-                              new ObjectGuidGenerator<high>())))
-                      .first;
-
-        return *itr->second;
+        return *_guidGenerators[ObjectGuidTraits<high>::GeneratorSlot];
     }
 
-    std::map<HighGuid, std::unique_ptr<ObjectGuidGeneratorBase>>
-                                  _guidGenerators;
+    std::array<std::unique_ptr<ObjectGuidGeneratorBase>,
+               MAX_MAP_GUID_GENERATORS>
+        _guidGenerators;
+
     MapStoredObjectTypesContainer _objectsStore;
     CreatureBySpawnIdContainer    _creatureBySpawnIdStore;
     GameObjectBySpawnIdContainer  _gameobjectBySpawnIdStore;
@@ -1127,6 +1213,25 @@ private:
     std::unordered_set<Corpse*>             _corpseBones;
 
     std::unordered_set<Object*> _updateObjects;
+
+    uint32 _lastUpdateCost;
+    uint32 _pathsThisUpdate;
+
+    // mutable because const queries such as isInLineOfSight are counted too
+    mutable MapStats _stats;
+
+    PathCache _pathCache;
+
+    void NotifyProximityTraps(Unit* unit, float x, float y, float z);
+    template <class Fn>
+    void ForEachTrapProximityCell(GameObject const* trap, Fn&& fn);
+
+    // cell id -> traps whose activation radius reaches into the cell
+    std::unordered_map<uint32, std::vector<GameObject*>> _proximityTraps;
+
+    // i_objectsForDelayedVisibility in the order the units were queued,
+    // entries no longer in the set are stale and skipped
+    std::deque<Unit*> _delayedVisibilityQueue;
 };
 
 enum InstanceResetMethod {
@@ -1184,6 +1289,8 @@ public:
                     uint8  spawnMode);
     ~BattlegroundMap() override;
 
+    void Update(const uint32, const uint32, bool thread = true) override;
+
     bool       AddPlayerToMap(Player*) override;
     void       RemovePlayerFromMap(Player*, bool) override;
     EnterState CannotEnter(Player* player, bool loginCheck = false) override;
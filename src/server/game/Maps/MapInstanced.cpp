@@ -49,12 +49,20 @@ void MapInstanced::Update(const uint32 t, const uint32 s_diff, bool /*thread*/)
     // take care of loaded GridMaps (when unused, unload it!)
     Map::Update(t, s_diff, false);
 
+    MapUpdater* updater = sMapMgr->GetMapUpdater();
+
+    // instances torn down in this update, their objects are destroyed by a
+    // map updater worker while the remaining instances are being updated
+    std::vector<Map*> unloaded;
+
     // update the instanced maps
     InstancedMaps::iterator i = m_InstancedMaps.begin();
 
     while (i != m_InstancedMaps.end()) {
         if (i->second->CanUnload(t)) {
-            if (!DestroyInstance(i)) // iterator incremented
+            if (!DestroyInstance(
+                    i, updater->activated() ? &unloaded : nullptr)) // iterator
+                                                                    // incremented
             {
                 // m_unloadTimer
             }
@@ -62,14 +70,16 @@ void MapInstanced::Update(const uint32 t, const uint32 s_diff, bool /*thread*/)
         else {
             // update only here, because it may schedule some bad things before
             // delete
-            if (sMapMgr->GetMapUpdater()->activated())
-                sMapMgr->GetMapUpdater()->schedule_update(
-                    *i->second, t, s_diff);
+            if (updater->activated())
+                updater->schedule_update(*i->second, t, s_diff);
             else
                 i->second->Update(t, s_diff);
             ++i;
         }
     }
+
+    if (!unloaded.empty())
+        updater->schedule_unload(std::move(unloaded));
 }
 
 void MapInstanced::DelayedUpdate(const uint32 diff)
@@ -228,8 +238,13 @@ InstanceMap* MapInstanced::CreateInstance(uint32        InstanceId,
     InstanceMap* map = new InstanceMap(GetId(), InstanceId, difficulty, this);
     ASSERT(map->IsDungeon());
 
-    map->LoadRespawnTimes();
-    map->LoadCorpseData();
+    // a freshly generated instance id has never been handed out before, so
+    // there are no respawn times or corpses stored for it yet; only bound
+    // instances need the synchronous character database round trips
+    if (save) {
+        map->LoadRespawnTimes();
+        map->LoadCorpseData();
+    }
 
     if (save)
         map->CreateInstanceScript(
@@ -277,7 +292,8 @@ BattlegroundMap* MapInstanced::CreateBattleground(uint32        InstanceId,
 }
 
 // increments the iterator after erase
-bool MapInstanced::DestroyInstance(InstancedMaps::iterator& itr)
+bool MapInstanced::DestroyInstance(InstancedMaps::iterator& itr,
+                                   std::vector<Map*>*       unloadQueue)
 {
     itr->second->RemoveAllPlayers();
 
@@ -288,10 +304,17 @@ bool MapInstanced::DestroyInstance(InstancedMaps::iterator& itr)
 
     sScriptMgr->OnDestroyInstance(this, itr->second);
 
-    itr->second->UnloadAll();
+    // the map is detached here, unloading its grids and deleting it is left
+    // to the caller when it collects the destroyed maps
+    if (unloadQueue)
+        unloadQueue->push_back(itr->second);
+    else {
+        itr->second->UnloadAll();
+
+        // erase map
+        delete itr->second;
+    }
 
-    // erase map
-    delete itr->second;
     m_InstancedMaps.erase(itr++);
 
     return true;
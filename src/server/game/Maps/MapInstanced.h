@@ -45,7 +45,10 @@ public:
         InstancedMaps::const_iterator i = m_InstancedMaps.find(instanceId);
         return (i == m_InstancedMaps.end() ? nullptr : i->second);
     }
-    bool DestroyInstance(InstancedMaps::iterator& itr);
+    // with an unload queue the destroyed map is only detached and appended to
+    // it, the caller has to unload and delete it
+    bool DestroyInstance(InstancedMaps::iterator& itr,
+                         std::vector<Map*>*       unloadQueue = nullptr);
 
     InstancedMaps& GetInstancedMaps() { return m_InstancedMaps; }
     void           InitVisibilityDistance() override;
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapStats.h"
+#include "World.h"
+
+char const* GetMapUpdatePhaseName(MapUpdatePhase phase)
+{
+    switch (phase) {
+    case MAP_PHASE_SESSIONS:
+        return "sessions";
+    case MAP_PHASE_OBJECTS:
+        return "objects";
+    case MAP_PHASE_GRID_PRELOAD:
+        return "grid preload";
+    case MAP_PHASE_OBJECT_UPDATES:
+        return "object updates";
+    case MAP_PHASE_SCRIPTS:
+        return "scripts";
+    case MAP_PHASE_RELOCATIONS:
+        return "relocations";
+    default:
+        return "unknown";
+    }
+}
+
+MapStats::PhaseTimer::PhaseTimer(MapStats& stats, MapUpdatePhase phase)
+    : _stats(stats), _phase(phase), _start(std::chrono::steady_clock::now())
+{
+}
+
+MapStats::PhaseTimer::~PhaseTimer()
+{
+    _stats._current.PhaseTime[_phase] +=
+        std::chrono::duration_cast<Microseconds>(
+            std::chrono::steady_clock::now() - _start);
+}
+
+MapStats::PathTimer::PathTimer(MapStats& stats)
+    : _stats(stats), _start(std::chrono::steady_clock::now())
+{
+}
+
+MapStats::PathTimer::~PathTimer()
+{
+    _stats.AddPath(std::chrono::duration_cast<Microseconds>(
+        std::chrono::steady_clock::now() - _start));
+}
+
+void MapStats::AddUpdate(Microseconds elapsed)
+{
+    ++_current.Updates;
+    _current.UpdateTime += elapsed;
+    _current.MaxUpdateTime = std::max(_current.MaxUpdateTime, elapsed);
+}
+
+void MapStats::AddPacket(std::size_t size)
+{
+    _packetsSent.fetch_add(1, std::memory_order_relaxed);
+    _bytesSent.fetch_add(size, std::memory_order_relaxed);
+}
+
+void MapStats::AddPath(Microseconds elapsed)
+{
+    _paths.fetch_add(1, std::memory_order_relaxed);
+    _pathTime.fetch_add(elapsed.count(), std::memory_order_relaxed);
+}
+
+bool MapStats::Update(uint32 diff,
+                      uint32 players,
+                      uint32 creatures,
+                      uint32 gameObjects)
+{
+    _current.Duration += Milliseconds(diff);
+
+    Seconds const interval(
+        sWorld->getIntConfig(CONFIG_MAP_UPDATE_STATS_INTERVAL));
+    if (interval == 0s || _current.Duration < interval)
+        return false;
+
+    _current.PacketsSent = _packetsSent.exchange(0, std::memory_order_relaxed);
+    _current.BytesSent   = _bytesSent.exchange(0, std::memory_order_relaxed);
+    _current.Paths       = _paths.exchange(0, std::memory_order_relaxed);
+    _current.PathTime =
+        Microseconds(_pathTime.exchange(0, std::memory_order_relaxed));
+    _current.LosQueries  = _losQueries.exchange(0, std::memory_order_relaxed);
+    _current.GridLoads   = _gridLoads;
+    _current.Players     = players;
+    _current.Creatures   = creatures;
+    _current.GameObjects = gameObjects;
+
+    {
+        std::lock_guard<std::mutex> guard(_lastWindowLock);
+        _lastWindow = _current;
+    }
+
+    _current   = MapStatsWindow();
+    _gridLoads = 0;
+    return true;
+}
+
+MapStatsWindow MapStats::GetLastWindow() const
+{
+    std::lock_guard<std::mutex> guard(_lastWindowLock);
+    return _lastWindow;
+}
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __MAPSTATS_H
+#define __MAPSTATS_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+
+enum MapUpdatePhase : uint8 {
+    MAP_PHASE_SESSIONS,
+    MAP_PHASE_OBJECTS,
+    MAP_PHASE_GRID_PRELOAD,
+    MAP_PHASE_OBJECT_UPDATES,
+    MAP_PHASE_SCRIPTS,
+    MAP_PHASE_RELOCATIONS,
+    MAP_PHASE_COUNT
+};
+
+AC_GAME_API char const* GetMapUpdatePhaseName(MapUpdatePhase phase);
+
+/// Resources one map used during a stats window
+struct MapStatsWindow {
+    Milliseconds Duration{0};
+    uint32       Updates{0};
+    Microseconds UpdateTime{0};
+    Microseconds MaxUpdateTime{0};
+
+    std::array<Microseconds, MAP_PHASE_COUNT> PhaseTime{};
+
+    uint64       PacketsSent{0};
+    uint64       BytesSent{0};
+    uint32       Paths{0};
+    Microseconds PathTime{0};
+    uint64       LosQueries{0};
+    uint32       GridLoads{0};
+
+    // object counts at the end of the window
+    uint32 Players{0};
+    uint32 Creatures{0};
+    uint32 GameObjects{0};
+};
+
+/*
+ * Accounts the resources of one map. The update times are added by the map
+ * thread, packets, paths and line of sight queries may come from any thread.
+ * Every MapUpdate.Stats.Interval the counters are moved into the last window,
+ * which is what commands and metrics read.
+ */
+class AC_GAME_API MapStats {
+public:
+    class AC_GAME_API PhaseTimer {
+    public:
+        PhaseTimer(MapStats& stats, MapUpdatePhase phase);
+        ~PhaseTimer();
+
+    private:
+        MapStats&      _stats;
+        MapUpdatePhase _phase;
+        TimePoint      _start;
+    };
+
+    // adds the lifetime of the timer as one path calculation
+    class AC_GAME_API PathTimer {
+    public:
+        explicit PathTimer(MapStats& stats);
+        ~PathTimer();
+
+    private:
+        MapStats& _stats;
+        TimePoint _start;
+    };
+
+    void AddUpdate(Microseconds elapsed);
+    void AddPacket(std::size_t size);
+    void AddPath(Microseconds elapsed);
+    void AddLosQuery() { _losQueries.fetch_add(1, std::memory_order_relaxed); }
+    void AddGridLoad() { ++_gridLoads; }
+
+    // called by the map thread after each update, true when a window ended
+    bool Update(uint32 diff,
+                uint32 players,
+                uint32 creatures,
+                uint32 gameObjects);
+
+    MapStatsWindow GetLastWindow() const;
+
+private:
+    // only touched by the map thread
+    MapStatsWindow _current;
+    uint32         _gridLoads{0};
+
+    std::atomic<uint64> _packetsSent{0};
+    std::atomic<uint64> _bytesSent{0};
+    std::atomic<uint32> _paths{0};
+    std::atomic<int64>  _pathTime{0};
+    std::atomic<uint64> _losQueries{0};
+
+    mutable std::mutex _lastWindowLock;
+    MapStatsWindow     _lastWindow;
+};
+
+#endif
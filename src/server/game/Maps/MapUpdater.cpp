@@ -17,10 +17,17 @@
  */
 
 #include "MapUpdater.h"
+#include "Config.h"
 #include "DatabaseEnv.h"
 #include "LFGMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include "ProcessPriority.h"
+#include "Profiler.h"
+#include "ThreadWatchdog.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 class UpdateRequest {
 public:
@@ -28,28 +35,52 @@ public:
     virtual ~UpdateRequest() = default;
 
     virtual void call() = 0;
+
+    // estimated cost used to order the work queues, higher runs first
+    [[nodiscard]] virtual uint32 GetCost() const = 0;
+
+    // sticky requests stay in the queue of their worker
+    [[nodiscard]] bool IsSticky() const { return _sticky; }
+    void               SetSticky() { _sticky = true; }
+
+private:
+    bool _sticky = false;
 };
 
 class MapUpdateRequest : public UpdateRequest {
 public:
     MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
+        : m_map(m), m_updater(u), m_diff(d), s_diff(sd),
+          m_cost(m.GetLastUpdateCost())
     {
     }
 
     void call() override
     {
-        METRIC_TIMER("map_update_time_diff",
-                     METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-        m_map.Update(m_diff, s_diff);
+        auto start = std::chrono::steady_clock::now();
+
+        {
+            METRIC_TIMER("map_update_time_diff",
+                         METRIC_TAG("map_id", std::to_string(m_map.GetId())));
+            m_map.Update(m_diff, s_diff);
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        m_map.SetLastUpdateCost(uint32(std::min<int64>(
+            elapsed.count(), std::numeric_limits<uint32>::max())));
+
         m_updater.update_finished();
     }
 
+    [[nodiscard]] uint32 GetCost() const override { return m_cost; }
+
 private:
     Map&        m_map;
     MapUpdater& m_updater;
     uint32      m_diff;
     uint32      s_diff;
+    uint32      m_cost;
 };
 
 class LFGUpdateRequest : public UpdateRequest {
@@ -62,18 +93,88 @@ public:
         m_updater.update_finished();
     }
 
+    // pussywizard: lfg compatibles must be processed from the very beginning
+    [[nodiscard]] uint32 GetCost() const override
+    {
+        return std::numeric_limits<uint32>::max();
+    }
+
 private:
     MapUpdater& m_updater;
     uint32      m_diff;
 };
 
-MapUpdater::MapUpdater() : pending_requests(0) {}
+class TaskRequest : public UpdateRequest {
+public:
+    TaskRequest(std::function<void()> task, MapUpdater& u, uint32 cost)
+        : m_task(std::move(task)), m_updater(u), m_cost(cost)
+    {
+    }
+
+    void call() override
+    {
+        m_task();
+        m_updater.update_finished();
+    }
+
+    [[nodiscard]] uint32 GetCost() const override { return m_cost; }
+
+private:
+    std::function<void()> m_task;
+    MapUpdater&           m_updater;
+    uint32                m_cost;
+};
+
+class MapUnloadRequest : public UpdateRequest {
+public:
+    MapUnloadRequest(std::vector<Map*> maps, MapUpdater& u)
+        : m_maps(std::move(maps)), m_updater(u), m_cost(0)
+    {
+        // tearing a map down is about as expensive as updating it
+        for (Map* map : m_maps)
+            m_cost += map->GetLastUpdateCost();
+    }
+
+    void call() override
+    {
+        for (Map* map : m_maps) {
+            map->UnloadAll();
+            delete map;
+        }
+
+        m_updater.update_finished();
+    }
+
+    [[nodiscard]] uint32 GetCost() const override { return m_cost; }
+
+private:
+    std::vector<Map*> m_maps;
+    MapUpdater&       m_updater;
+    uint32            m_cost;
+};
+
+MapUpdater::MapUpdater()
+    : _cancelationToken(false), _queuedRequests(0), _stealableRequests(0),
+      _stickyContinents(false), pending_requests(0)
+{
+}
 
 void MapUpdater::activate(size_t num_threads)
 {
+    _processors = ParseProcessorList(
+        sConfigMgr->GetOption<std::string>("MapUpdate.Threads.Affinity", ""));
+    _stickyContinents = sConfigMgr->GetOption<bool>(
+        "MapUpdate.Threads.StickyContinents", false);
+    _stickyMapCount.assign(num_threads, 0);
+
+    _queues.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+        _queues.push_back(std::make_unique<WorkQueue>());
+
     _workerThreads.reserve(num_threads);
     for (size_t i = 0; i < num_threads; ++i) {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(
+            std::thread(&MapUpdater::WorkerThread, this, i));
     }
 }
 
@@ -83,13 +184,23 @@ void MapUpdater::deactivate()
 
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> guard(_workLock);
+        _workCondition.notify_all();
+    }
 
     for (auto& thread : _workerThreads) {
         if (thread.joinable()) {
             thread.join();
         }
     }
+
+    for (auto& queue : _queues) {
+        for (UpdateRequest* request : queue->requests)
+            delete request;
+
+        queue->requests.clear();
+    }
 }
 
 void MapUpdater::wait()
@@ -104,20 +215,64 @@ void MapUpdater::wait()
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    std::lock_guard<std::mutex> guard(_lock);
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++pending_requests;
+    }
+
+    UpdateRequest* request = new MapUpdateRequest(map, *this, diff, s_diff);
+    if (!_stickyContinents || map.Instanceable()) {
+        Enqueue(request);
+        return;
+    }
 
-    ++pending_requests;
+    request->SetSticky();
+    Enqueue(request, int32(GetStickyWorker(map.GetId())));
+}
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff, s_diff));
+size_t MapUpdater::GetStickyWorker(uint32 mapId)
+{
+    auto itr = _stickyWorkers.find(mapId);
+    if (itr != _stickyWorkers.end())
+        return itr->second;
+
+    // spread the continents evenly, their cost is not known yet
+    size_t const worker =
+        std::min_element(_stickyMapCount.begin(), _stickyMapCount.end()) -
+        _stickyMapCount.begin();
+    ++_stickyMapCount[worker];
+    _stickyWorkers.emplace(mapId, worker);
+    return worker;
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    std::lock_guard<std::mutex> guard(_lock);
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++pending_requests;
+    }
+
+    Enqueue(new LFGUpdateRequest(*this, diff));
+}
+
+void MapUpdater::schedule_unload(std::vector<Map*> maps)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++pending_requests;
+    }
+
+    Enqueue(new MapUnloadRequest(std::move(maps), *this));
+}
 
-    ++pending_requests;
+void MapUpdater::schedule_task(std::function<void()> task, uint32 cost)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++pending_requests;
+    }
 
-    _queue.Push(new LFGUpdateRequest(*this, diff));
+    Enqueue(new TaskRequest(std::move(task), *this, cost));
 }
 
 bool MapUpdater::activated() { return _workerThreads.size() > 0; }
@@ -131,20 +286,134 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::Enqueue(UpdateRequest* request, int32 worker)
 {
+    uint32 cost = request->GetCost();
+
+    // longest processing time first: hand the request to the queue with the
+    // least estimated work left and keep each queue sorted by cost
+    WorkQueue* target = nullptr;
+    if (worker >= 0)
+        target = _queues[worker].get();
+    else {
+        uint64 minCost = std::numeric_limits<uint64>::max();
+        for (auto& queue : _queues) {
+            std::lock_guard<std::mutex> guard(queue->lock);
+            if (queue->pendingCost < minCost) {
+                minCost = queue->pendingCost;
+                target  = queue.get();
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(target->lock);
+        auto itr = std::upper_bound(
+            target->requests.begin(),
+            target->requests.end(),
+            cost,
+            [](uint32 value, UpdateRequest const* queued) {
+                return value > queued->GetCost();
+            });
+        target->requests.insert(itr, request);
+        target->pendingCost += cost;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(_workLock);
+        ++target->queuedRequests;
+        ++_queuedRequests;
+        if (!request->IsSticky())
+            ++_stealableRequests;
+    }
+
+    // only the owner may take a sticky request, make sure it wakes up
+    if (request->IsSticky())
+        _workCondition.notify_all();
+    else
+        _workCondition.notify_one();
+}
+
+UpdateRequest* MapUpdater::PopRequest(size_t index)
+{
+    WorkQueue&                  queue = *_queues[index];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.requests.empty())
+        return nullptr;
+
+    UpdateRequest* request = queue.requests.front();
+    queue.requests.pop_front();
+    queue.pendingCost -= request->GetCost();
+    --queue.queuedRequests;
+    --_queuedRequests;
+    if (!request->IsSticky())
+        --_stealableRequests;
+    return request;
+}
+
+UpdateRequest* MapUpdater::StealRequest(size_t index)
+{
+    for (size_t i = 1; i < _queues.size(); ++i) {
+        WorkQueue& victim = *_queues[(index + i) % _queues.size()];
+
+        std::lock_guard<std::mutex> guard(victim.lock);
+
+        // steal from the cheap end, the owner keeps working on the heavy one
+        auto itr = std::find_if(victim.requests.rbegin(),
+                                victim.requests.rend(),
+                                [](UpdateRequest const* queued) {
+                                    return !queued->IsSticky();
+                                });
+        if (itr == victim.requests.rend())
+            continue;
+
+        UpdateRequest* request = *itr;
+        victim.requests.erase(std::next(itr).base());
+        victim.pendingCost -= request->GetCost();
+        --victim.queuedRequests;
+        --_queuedRequests;
+        --_stealableRequests;
+        return request;
+    }
+
+    return nullptr;
+}
+
+void MapUpdater::WorkerThread(size_t index)
+{
+    AC_PROFILE_THREAD_NAME("Map updater");
+    sThreadWatchdog->RegisterThread("Map updater " + std::to_string(index));
+
+    if (!_processors.empty())
+        SetThreadAffinity("maps",
+                          "Map updater " + std::to_string(index),
+                          _processors[index % _processors.size()]);
+
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
     while (1) {
-        UpdateRequest* request = nullptr;
+        UpdateRequest* request = PopRequest(index);
+        if (!request)
+            request = StealRequest(index);
+
+        if (!request) {
+            std::unique_lock<std::mutex> guard(_workLock);
+            while (!_queues[index]->queuedRequests && !_stealableRequests &&
+                   !_cancelationToken)
+                _workCondition.wait(guard);
 
-        _queue.WaitAndPop(request);
-        if (_cancelationToken)
-            return;
+            if (_cancelationToken && !_queuedRequests)
+                return;
 
-        request->call();
+            continue;
+        }
+
+        {
+            ThreadWatchdog::WorkScope watchdogScope;
+            request->call();
+        }
 
         delete request;
     }
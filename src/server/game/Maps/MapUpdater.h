@@ -20,14 +20,30 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 class Map;
 class UpdateRequest;
 
+/*
+ * Map updates are distributed over per-thread work queues. Every request
+ * carries the cost of its previous run, requests are kept ordered by that
+ * cost (largest first) and are pushed to the least loaded queue. A worker
+ * whose own queue runs dry steals from the tail of the other queues, so a
+ * single heavy map can never leave the remaining threads idle.
+ *
+ * With MapUpdate.Threads.StickyContinents every continent is always updated
+ * by the same worker and is never stolen, so its grids stay in the caches and
+ * on the NUMA node of that worker's processor (MapUpdate.Threads.Affinity).
+ */
 class MapUpdater {
 public:
     MapUpdater();
@@ -35,6 +51,12 @@ public:
 
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_lfg_update(uint32 diff);
+    // unloads and deletes maps that were already detached from their parent,
+    // wait() returns only after they are gone
+    void schedule_unload(std::vector<Map*> maps);
+    // runs any other work on the map update workers, only call this while the
+    // maps themselves are not being updated
+    void schedule_task(std::function<void()> task, uint32 cost);
     void wait();
     void activate(size_t num_threads);
     void deactivate();
@@ -42,13 +64,37 @@ public:
     void update_finished();
 
 private:
-    void WorkerThread();
+    struct WorkQueue {
+        std::mutex                 lock;
+        std::deque<UpdateRequest*> requests;
+        uint64                     pendingCost = 0;
+        std::atomic<size_t>        queuedRequests{0};
+    };
 
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+    void           WorkerThread(size_t index);
+    // worker is the queue of a sticky request, -1 picks the least loaded one
+    void           Enqueue(UpdateRequest* request, int32 worker = -1);
+    UpdateRequest* PopRequest(size_t index);
+    UpdateRequest* StealRequest(size_t index);
+    size_t         GetStickyWorker(uint32 mapId);
+
+    std::vector<std::unique_ptr<WorkQueue>> _queues;
 
     std::vector<std::thread> _workerThreads;
     std::atomic<bool>        _cancelationToken;
 
+    std::mutex              _workLock;
+    std::condition_variable _workCondition;
+    std::atomic<size_t>     _queuedRequests;
+    // requests that any worker may steal
+    std::atomic<size_t>     _stealableRequests;
+
+    std::vector<uint32> _processors;
+    bool                _stickyContinents;
+    // only used by the world thread that schedules the updates
+    std::unordered_map<uint32, size_t> _stickyWorkers;
+    std::vector<uint32>                _stickyMapCount;
+
     std::mutex              _lock;
     std::condition_variable _condition;
     size_t                  pending_requests;
@@ -23,7 +23,7 @@
 #include "Player.h"
 #include "SpellAuraEffects.h"
 
-Milliseconds AsyncAuctionListingMgr::auctionListingDiff = Milliseconds::zero();
+std::atomic<Milliseconds::rep> AsyncAuctionListingMgr::auctionListingDiff{0};
 std::list<AuctionListItemsDelayEvent>
     AsyncAuctionListingMgr::auctionListingList;
 std::list<AuctionListItemsDelayEvent>
@@ -21,6 +21,7 @@
 
 #include "AuctionHouseMgr.h"
 
+#include <atomic>
 #include <mutex>
 
 class AuctionListOwnerItemsDelayEvent : public BasicEvent {
@@ -85,9 +86,17 @@ public:
 
 class AsyncAuctionListingMgr {
 public:
-    static void Update(Milliseconds diff) { auctionListingDiff += diff; }
-    static Milliseconds GetDiff() { return auctionListingDiff; }
-    static void ResetDiff() { auctionListingDiff = Milliseconds::zero(); }
+    // Called from the world thread; the listing thread drains the elapsed
+    // time with TakeDiff, so the counter is atomic.
+    static void Update(Milliseconds diff)
+    {
+        auctionListingDiff.fetch_add(diff.count(), std::memory_order_relaxed);
+    }
+    static Milliseconds TakeDiff()
+    {
+        return Milliseconds(
+            auctionListingDiff.exchange(0, std::memory_order_relaxed));
+    }
     static std::list<AuctionListItemsDelayEvent>& GetList()
     {
         return auctionListingList;
@@ -99,7 +108,7 @@ public:
     static std::mutex& GetTempLock() { return auctionListingTempLock; }
 
 private:
-    static Milliseconds                          auctionListingDiff;
+    static std::atomic<Milliseconds::rep>        auctionListingDiff;
     static std::list<AuctionListItemsDelayEvent> auctionListingList;
     static std::list<AuctionListItemsDelayEvent> auctionListingListTemp;
     static std::mutex                            auctionListingTempLock;
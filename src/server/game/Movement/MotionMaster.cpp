@@ -520,6 +520,23 @@ void MotionMaster::MovePoint(uint32       id,
     }
 }
 
+void MotionMaster::MovePoint(uint32 id, Movement::PointsArray const& path)
+{
+    // Xinef: do not allow to move with UNIT_FLAG_DISABLE_MOVE
+    if (_owner->HasUnitFlag(UNIT_FLAG_DISABLE_MOVE) || path.empty())
+        return;
+
+    G3D::Vector3 const& dest = path.back();
+    if (_owner->GetTypeId() == TYPEID_PLAYER)
+        Mutate(new PointMovementGenerator<Player>(
+                   id, dest.x, dest.y, dest.z, 0.0f, 0.0f, &path, true, true),
+               MOTION_SLOT_ACTIVE);
+    else
+        Mutate(new PointMovementGenerator<Creature>(
+                   id, dest.x, dest.y, dest.z, 0.0f, 0.0f, &path, true, true),
+               MOTION_SLOT_ACTIVE);
+}
+
 void MotionMaster::MoveSplinePath(Movement::PointsArray* path)
 {
     // Xinef: do not allow to move with UNIT_FLAG_DISABLE_MOVE
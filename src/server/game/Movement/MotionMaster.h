@@ -243,6 +243,9 @@ public:
                    bool         forceDestination = true,
                    MovementSlot slot             = MOTION_SLOT_ACTIVE,
                    float        orientation      = 0.0f);
+    // point movement along a path planned by the caller, ends at its last
+    // point
+    void MovePoint(uint32 id, Movement::PointsArray const& path);
     void MoveSplinePath(Movement::PointsArray* path);
     void MoveSplinePath(uint32 path_id);
 
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCache.h"
+#include <algorithm>
+
+std::size_t PathCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hash = std::hash<dtPolyRef>()(key.StartPoly);
+    hash ^= std::hash<dtPolyRef>()(key.EndPoly) + 0x9e3779b9 + (hash << 6) +
+            (hash >> 2);
+    hash ^= (std::size_t(key.IncludeFlags) << 16 | key.ExcludeFlags) +
+            0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+uint32 PathCache::Find(Key const& key,
+                       uint32     tileGeneration,
+                       dtPolyRef* polys,
+                       uint32     maxPolys)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    ValidateGeneration(tileGeneration);
+
+    auto itr = _index.find(key);
+    if (itr == _index.end())
+        return 0;
+
+    std::vector<dtPolyRef> const& cached = itr->second->Polys;
+    if (cached.size() > maxPolys)
+        return 0;
+
+    _entries.splice(_entries.begin(), _entries, itr->second);
+    std::copy(cached.begin(), cached.end(), polys);
+    return uint32(cached.size());
+}
+
+void PathCache::Insert(Key const&       key,
+                       uint32           tileGeneration,
+                       dtPolyRef const* polys,
+                       uint32           count)
+{
+    if (!count)
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    ValidateGeneration(tileGeneration);
+
+    auto itr = _index.find(key);
+    if (itr != _index.end()) {
+        itr->second->Polys.assign(polys, polys + count);
+        _entries.splice(_entries.begin(), _entries, itr->second);
+        return;
+    }
+
+    if (_entries.size() >= PATH_CACHE_SIZE) {
+        _index.erase(_entries.back().CacheKey);
+        _entries.pop_back();
+    }
+
+    _entries.push_front({key, std::vector<dtPolyRef>(polys, polys + count)});
+    _index.emplace(key, _entries.begin());
+}
+
+void PathCache::ValidateGeneration(uint32 tileGeneration)
+{
+    if (tileGeneration == _generation)
+        return;
+
+    // a tile was loaded or unloaded, the cached refs may be stale or no
+    // longer the shortest way
+    _entries.clear();
+    _index.clear();
+    _generation = tileGeneration;
+}
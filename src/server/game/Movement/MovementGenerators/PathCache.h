@@ -0,0 +1,80 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PATH_CACHE_H
+#define _PATH_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#define PATH_CACHE_SIZE 512
+
+/*
+ * LRU cache of complete polygon corridors of one map, keyed by start and end
+ * polygon and the filter they were searched with. PathGenerator refines the
+ * end points of a cached corridor itself, so repeated chase, evade and follow
+ * queries over the same ground skip dtNavMeshQuery::findPath. The cache is
+ * dropped whenever the tile generation of the map changes.
+ */
+class PathCache {
+public:
+    struct Key {
+        dtPolyRef StartPoly;
+        dtPolyRef EndPoly;
+        uint16    IncludeFlags;
+        uint16    ExcludeFlags;
+
+        bool operator==(Key const& other) const = default;
+    };
+
+    // Copies the corridor into polys, returns its length or 0 if not cached
+    uint32 Find(Key const& key,
+                uint32     tileGeneration,
+                dtPolyRef* polys,
+                uint32     maxPolys);
+    void   Insert(Key const&       key,
+                  uint32           tileGeneration,
+                  dtPolyRef const* polys,
+                  uint32           count);
+
+private:
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry {
+        Key                    CacheKey;
+        std::vector<dtPolyRef> Polys;
+    };
+
+    typedef std::list<Entry> EntryList;
+
+    void ValidateGeneration(uint32 tileGeneration);
+
+    // most recently used first
+    EntryList                                             _entries;
+    std::unordered_map<Key, EntryList::iterator, KeyHash> _index;
+    uint32                                                _generation = 0;
+    std::mutex                                            _lock;
+};
+
+#endif
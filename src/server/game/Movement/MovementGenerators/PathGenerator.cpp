@@ -25,6 +25,8 @@
 #include "MMapMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include "Profiler.h"
+#include <optional>
 
 ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner)
@@ -68,6 +70,12 @@ bool PathGenerator::CalculatePath(float x,
                                   float destZ,
                                   bool  forceDest)
 {
+    AC_PROFILE_ZONE("PathGenerator::CalculatePath");
+
+    std::optional<MapStats::PathTimer> pathTimer;
+    if (Map* map = _source->FindMap())
+        pathTimer.emplace(map->GetStats());
+
     if (!Acore::IsValidMapCoord(destX, destY, destZ) ||
         !Acore::IsValidMapCoord(x, y, z))
         return false;
@@ -499,15 +507,44 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos,
             }
         }
         else {
-            dtResult = _navMeshQuery->findPath(
-                startPoly,     // start polygon
-                endPoly,       // end polygon
-                startPoint,    // start position
-                endPoint,      // end position
-                &_filter,      // polygon search filter
-                _pathPolyRefs, // [out] path
-                (int*)&_polyLength,
-                MAX_PATH_LENGTH); // max number of polygons in output path
+            // chase, evade and follow keep asking for the same corridors,
+            // only the end points are refined below
+            Map*                  map = _source->FindMap();
+            std::optional<uint32> tileGeneration =
+                MMAP::MMapFactory::createOrGetMMapMgr()->GetTileGeneration(
+                    _source->GetMapId());
+            PathCache::Key cacheKey{startPoly,
+                                    endPoly,
+                                    _filter.getIncludeFlags(),
+                                    _filter.getExcludeFlags()};
+
+            uint32 cachedLength = 0;
+            if (map && tileGeneration)
+                cachedLength = map->GetPathCache().Find(
+                    cacheKey, *tileGeneration, _pathPolyRefs, MAX_PATH_LENGTH);
+
+            if (cachedLength) {
+                _polyLength = cachedLength;
+                dtResult    = DT_SUCCESS;
+            }
+            else {
+                dtResult = _navMeshQuery->findPath(
+                    startPoly,     // start polygon
+                    endPoly,       // end polygon
+                    startPoint,    // start position
+                    endPoint,      // end position
+                    &_filter,      // polygon search filter
+                    _pathPolyRefs, // [out] path
+                    (int*)&_polyLength,
+                    MAX_PATH_LENGTH); // max number of polygons in output path
+
+                // only complete corridors are worth reusing
+                if (map && tileGeneration && dtStatusSucceed(dtResult) &&
+                    !dtStatusDetail(dtResult, DT_PARTIAL_RESULT) &&
+                    _polyLength && _pathPolyRefs[_polyLength - 1] == endPoly)
+                    map->GetPathCache().Insert(
+                        cacheKey, *tileGeneration, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult)) {
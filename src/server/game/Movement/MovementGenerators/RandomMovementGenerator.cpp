@@ -165,6 +165,8 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
                 Movement::PointsArray::iterator itrNext = finalPath.begin() + 1;
                 float                           zDiff, distDiff;
 
+                // slope checks first for the whole path, they are cheap and
+                // reject most paths before any segment pays for a ray cast
                 for (; itrNext != finalPath.end(); ++itr, ++itrNext) {
                     distDiff = std::sqrt(
                         ((*itr).x - (*itrNext).x) * ((*itr).x - (*itrNext).x) +
@@ -179,7 +181,11 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
                         _preComputedPaths.erase(pathIdx);
                         return;
                     }
+                }
 
+                itr     = finalPath.begin();
+                itrNext = finalPath.begin() + 1;
+                for (; itrNext != finalPath.end(); ++itr, ++itrNext) {
                     if (!map->isInLineOfSight(
                             (*itr).x,
                             (*itr).y,
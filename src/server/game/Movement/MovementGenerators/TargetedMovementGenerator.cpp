@@ -168,6 +168,13 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
                 return true;
             }
 
+            // out of path budget for this map update, keep following the
+            // current spline and try again on the next one
+            if (!owner->GetMap()->ConsumePathBudget()) {
+                _lastTargetPosition.reset();
+                return true;
+            }
+
             // figure out which way we want to move
             float x, y, z;
             target->GetPosition(x, y, z);
@@ -493,6 +500,11 @@ bool FollowMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
         }
     }
     else {
+        // out of path budget for this map update, keep following the current
+        // spline and try again on the next one
+        if (!owner->GetMap()->ConsumePathBudget())
+            return true;
+
         Position targetPosition = target->GetPosition();
         _lastTargetPosition     = targetPosition;
 
@@ -48,6 +48,8 @@ void WaypointMovementGenerator<Creature>::LoadPath(Creature* creature)
         return;
     }
 
+    i_splines = sWaypointMgr->GetPathSplines(path_id, creature);
+
     StartMoveNow(creature);
 }
 
@@ -186,12 +188,27 @@ bool WaypointMovementGenerator<Creature>::StartMove(Creature* creature)
                                               &formationDest.orientation);
     }
 
-    float z = node->z;
-    creature->UpdateAllowedPositionZ(node->x, node->y, z);
-    //! Do not use formationDest here, MoveTo requires transport offsets due to
-    //! DisableTransportPathTransformations() call but formationDest contains
-    //! global coordinates
-    init.MoveTo(node->x, node->y, z, true, true);
+    // reuse the shared navmesh path when we start from the previous node,
+    // anything else (spawn point, evade, knockback) is generated here
+    std::span<G3D::Vector3 const> segment;
+    if (i_splines && !transportPath && !creature->IsInWater())
+        segment = i_splines->GetSegment(i_currentNode);
+
+    if (segment.size() >= 2 &&
+        creature->GetExactDistSq(
+            segment.front().x, segment.front().y, segment.front().z) <
+            1.0f * 1.0f) {
+        init.MovebyPath(
+            Movement::PointsArray(segment.begin(), segment.end()));
+    }
+    else {
+        float z = node->z;
+        creature->UpdateAllowedPositionZ(node->x, node->y, z);
+        //! Do not use formationDest here, MoveTo requires transport offsets
+        //! due to DisableTransportPathTransformations() call but
+        //! formationDest contains global coordinates
+        init.MoveTo(node->x, node->y, z, true, true);
+    }
 
     if (node->orientation.has_value() && node->delay > 0)
         init.SetFacing(*node->orientation);
@@ -100,6 +100,8 @@ private:
     bool             m_isArrivalDone;
     uint32           path_id;
     bool             repeating;
+
+    std::shared_ptr<WaypointPathSplines const> i_splines;
 };
 
 /** FlightPathMovementGenerator generates movement of the player for the paths
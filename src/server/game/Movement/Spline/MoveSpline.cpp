@@ -33,7 +33,17 @@ Location MoveSpline::ComputePosition() const
         u = (time_passed - spline.length(point_Idx)) / (float)seg_time;
     Location c;
     c.orientation = initialOrientation;
-    spline.evaluate_percent(point_Idx, u, c);
+
+    bool const facingDone = splineflags.done && splineflags.isFacing();
+    bool const turnsAlongPath =
+        !facingDone && !splineflags.hasFlag(MoveSplineFlag::OrientationFixed |
+                                            MoveSplineFlag::Falling);
+
+    Vector3 hermite;
+    if (turnsAlongPath)
+        spline.evaluate_percent_and_derivative(point_Idx, u, c, hermite);
+    else
+        spline.evaluate_percent(point_Idx, u, c);
 
     if (splineflags.animation)
         ; // MoveSplineFlag::Animation disables falling or parabolic movement
@@ -42,7 +52,7 @@ Location MoveSpline::ComputePosition() const
     else if (splineflags.falling)
         computeFallElevation(c.z);
 
-    if (splineflags.done && splineflags.isFacing()) {
+    if (facingDone) {
         if (splineflags.final_angle)
             c.orientation = facing.angle;
         else if (splineflags.final_point)
@@ -50,12 +60,8 @@ Location MoveSpline::ComputePosition() const
         // nothing to do for MoveSplineFlag::Final_Target flag
     }
     else {
-        if (!splineflags.hasFlag(MoveSplineFlag::OrientationFixed |
-                                 MoveSplineFlag::Falling)) {
-            Vector3 hermite;
-            spline.evaluate_derivative(point_Idx, u, hermite);
+        if (turnsAlongPath)
             c.orientation = std::atan2(hermite.y, hermite.x);
-        }
 
         if (splineflags.orientationInversed)
             c.orientation = -c.orientation;
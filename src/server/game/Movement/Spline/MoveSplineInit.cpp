@@ -17,6 +17,7 @@
  */
 
 #include "MoveSplineInit.h"
+#include "Map.h"
 #include "MoveSpline.h"
 #include "MovementPacketBuilder.h"
 #include "Opcodes.h"
@@ -129,7 +130,15 @@ int32 MoveSplineInit::Launch()
     unit->m_movementInfo.SetMovementFlags(moveFlags);
     move_spline.Initialize(args);
 
-    WorldPacket data(SMSG_MONSTER_MOVE, 64);
+    // nobody on the map could receive the spline, e.g. formations and
+    // escorts walking on grids kept loaded by active objects
+    Map const* map = unit->FindMap();
+    if (map && !map->HavePlayers())
+        return move_spline.Duration();
+
+    // common part plus at most one uncompressed point per path node
+    WorldPacket data(SMSG_MONSTER_MOVE,
+                     64 + move_spline.spline.getPointCount() * sizeof(Vector3));
     data << unit->GetPackGUID();
     if (transport) {
         data.SetOpcode(SMSG_MONSTER_MOVE_TRANSPORT);
@@ -106,9 +106,10 @@ void WriteLinearPath(const Spline<int32>& spline, ByteBuffer& data)
         Vector3 middle = (real_path[0] + real_path[last_idx]) / 2.f;
         Vector3 offset;
         // first and last points already appended
+        ByteBuffer::Writer writer(data, (last_idx - 1) * sizeof(uint32));
         for (uint32 i = 1; i < last_idx; ++i) {
             offset = middle - real_path[i];
-            data.appendPackXYZ(offset.x, offset.y, offset.z);
+            writer << ByteBuffer::PackXYZ(offset.x, offset.y, offset.z);
         }
     }
 }
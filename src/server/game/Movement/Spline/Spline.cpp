@@ -37,6 +37,14 @@ SplineBase::EvaluationMethtod
         &SplineBase::UninitializedSplineEvaluationMethod,
 };
 
+SplineBase::BothEvaluationMethtod
+    SplineBase::both_evaluators[SplineBase::ModesEnd] = {
+        &SplineBase::EvaluateBothLinear,
+        &SplineBase::EvaluateBothCatmullRom,
+        &SplineBase::EvaluateBothBezier3,
+        &SplineBase::UninitializedSplineBothEvaluationMethod,
+};
+
 SplineBase::SegLenghtMethtod SplineBase::seglengths[SplineBase::ModesEnd] = {
     &SplineBase::SegLengthLinear,
     &SplineBase::SegLengthCatmullRom,
@@ -141,6 +149,23 @@ inline void C_Evaluate_Derivative(const Vector3* vertice,
              vertice[2] * weights[2] + vertice[3] * weights[3];
 }
 
+inline void C_Evaluate_Both(const Vector3* vertice,
+                            float          t,
+                            const Matrix4& matr,
+                            Vector3&       position,
+                            Vector3&       derivative)
+{
+    Vector4 weights(Vector4(t * t * t, t * t, t, 1.f) * matr);
+    Vector4 dweights(Vector4(3.f * t * t, 2.f * t, 1.f, 0.f) * matr);
+
+    position   = Vector3::zero();
+    derivative = Vector3::zero();
+    for (int i = 0; i < 4; ++i) {
+        position += vertice[i] * weights[i];
+        derivative += vertice[i] * dweights[i];
+    }
+}
+
 void SplineBase::EvaluateLinear(index_type index,
                                 float      u,
                                 Vector3&   result) const
@@ -191,6 +216,36 @@ void SplineBase::EvaluateDerivativeBezier3(index_type index,
     C_Evaluate_Derivative(&points[index], t, s_Bezier3Coeffs, result);
 }
 
+void SplineBase::EvaluateBothLinear(index_type index,
+                                    float      u,
+                                    Vector3&   position,
+                                    Vector3&   derivative) const
+{
+    ASSERT(index >= index_lo && index < index_hi);
+    derivative = points[index + 1] - points[index];
+    position   = points[index] + derivative * u;
+}
+
+void SplineBase::EvaluateBothCatmullRom(index_type index,
+                                        float      t,
+                                        Vector3&   position,
+                                        Vector3&   derivative) const
+{
+    ASSERT(index >= index_lo && index < index_hi);
+    C_Evaluate_Both(
+        &points[index - 1], t, s_catmullRomCoeffs, position, derivative);
+}
+
+void SplineBase::EvaluateBothBezier3(index_type index,
+                                     float      t,
+                                     Vector3&   position,
+                                     Vector3&   derivative) const
+{
+    index *= 3u;
+    ASSERT(index >= index_lo && index < index_hi);
+    C_Evaluate_Both(&points[index], t, s_Bezier3Coeffs, position, derivative);
+}
+
 float SplineBase::SegLengthLinear(index_type index) const
 {
     ASSERT(index >= index_lo && index < index_hi);
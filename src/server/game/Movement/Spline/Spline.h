@@ -70,6 +70,15 @@ protected:
     void EvaluateDerivativeBezier3(index_type, float, Vector3&) const;
     static EvaluationMethtod derivative_evaluators[ModesEnd];
 
+    void EvaluateBothLinear(index_type, float, Vector3&, Vector3&) const;
+    void EvaluateBothCatmullRom(index_type, float, Vector3&, Vector3&) const;
+    void EvaluateBothBezier3(index_type, float, Vector3&, Vector3&) const;
+    typedef void (SplineBase::*BothEvaluationMethtod)(index_type,
+                                                      float,
+                                                      Vector3&,
+                                                      Vector3&) const;
+    static BothEvaluationMethtod both_evaluators[ModesEnd];
+
     [[nodiscard]] float SegLengthLinear(index_type) const;
     [[nodiscard]] float SegLengthCatmullRom(index_type) const;
     [[nodiscard]] float SegLengthBezier3(index_type) const;
@@ -89,6 +98,13 @@ protected:
     {
         ABORT();
     }
+    void UninitializedSplineBothEvaluationMethod(index_type,
+                                                 float,
+                                                 Vector3&,
+                                                 Vector3&) const
+    {
+        ABORT();
+    }
     [[nodiscard]] float UninitializedSplineSegLenghtMethod(index_type) const
     {
         ABORT();
@@ -122,6 +138,16 @@ public:
         (this->*derivative_evaluators[m_mode])(Idx, u, hermite);
     }
 
+    /** Same as evaluate_percent and evaluate_derivative together, the control
+        points of the segment are only fetched once */
+    void evaluate_percent_and_derivative(index_type Idx,
+                                         float      u,
+                                         Vector3&   c,
+                                         Vector3&   hermite) const
+    {
+        (this->*both_evaluators[m_mode])(Idx, u, c, hermite);
+    }
+
     /**  Bounds for spline indexes. All indexes should be in range [first,
      * last). */
     [[nodiscard]] index_type first() const { return index_lo; }
@@ -210,6 +236,14 @@ public:
         SplineBase::evaluate_derivative(Idx, u, c);
     }
 
+    void evaluate_percent_and_derivative(index_type Idx,
+                                         float      u,
+                                         Vector3&   c,
+                                         Vector3&   hermite) const
+    {
+        SplineBase::evaluate_percent_and_derivative(Idx, u, c, hermite);
+    }
+
     // Assumes that t in range [0, 1]
     [[nodiscard]] index_type computeIndexInBounds(float t) const;
     void computeIndex(float t, index_type& out_idx, float& out_u) const;
@@ -17,9 +17,12 @@
  */
 
 #include "WaypointMgr.h"
+#include "Creature.h"
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "Log.h"
+#include "PathGenerator.h"
+#include <mutex>
 
 WaypointMgr::WaypointMgr() {}
 
@@ -123,6 +126,11 @@ void WaypointMgr::ReloadPath(uint32 id)
         _waypointStore.erase(itr);
     }
 
+    {
+        std::unique_lock<std::shared_mutex> lock(_splineLock);
+        _splineStore.erase(id);
+    }
+
     WorldDatabasePreparedStatement* stmt =
         WorldDatabase.GetPreparedStatement(WORLD_SEL_WAYPOINT_DATA_BY_ID);
 
@@ -170,3 +178,83 @@ void WaypointMgr::ReloadPath(uint32 id)
         path.push_back(wp);
     } while (result->NextRow());
 }
+
+std::shared_ptr<WaypointPathSplines const> WaypointMgr::GetPathSplines(
+    uint32 id, Creature const* creature)
+{
+    // flying and hovering heights depend on the creature, transport paths
+    // are offsets and need no navmesh
+    if (creature->CanFly() || creature->GetHoverHeight() != 0.0f ||
+        creature->GetTransport() ||
+        creature->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING))
+        return nullptr;
+
+    WaypointPath const* path = GetPath(id);
+    if (!path || path->size() < 2)
+        return nullptr;
+
+    uint64 key = (uint64(creature->GetMapId()) << 34) |
+                 (uint64(creature->CanSwim()) << 33) |
+                 (uint64(creature->CanEnterWater()) << 32) |
+                 creature->GetPhaseMask();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(_splineLock);
+        auto itr = _splineStore.find(id);
+        if (itr != _splineStore.end()) {
+            auto splineItr = itr->second.find(key);
+            if (splineItr != itr->second.end())
+                return splineItr->second;
+        }
+    }
+
+    // built outside the lock, another map may race us to the same key and
+    // the first result is kept
+    std::shared_ptr<WaypointPathSplines const> splines =
+        BuildPathSplines(*path, creature);
+
+    std::unique_lock<std::shared_mutex> lock(_splineLock);
+    return _splineStore[id].try_emplace(key, std::move(splines)).first->second;
+}
+
+std::shared_ptr<WaypointPathSplines const> WaypointMgr::BuildPathSplines(
+    WaypointPath const& path, Creature const* creature) const
+{
+    std::vector<G3D::Vector3> nodes;
+    nodes.reserve(path.size());
+    for (WaypointData const* node : path) {
+        float z = node->z;
+        creature->UpdateAllowedPositionZ(node->x, node->y, z);
+        nodes.emplace_back(node->x, node->y, z);
+    }
+
+    auto splines = std::make_shared<WaypointPathSplines>();
+    splines->offsets.reserve(nodes.size() + 1);
+
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        splines->offsets.push_back(uint32(splines->points.size()));
+
+        G3D::Vector3 const& from = nodes[(i + nodes.size() - 1) % nodes.size()];
+        G3D::Vector3 const& to   = nodes[i];
+
+        PathGenerator generator(creature);
+        if (!generator.CalculatePath(
+                from.x, from.y, from.z, to.x, to.y, to.z, true))
+            continue;
+
+        // tiles not loaded yet or no way through, leave the segment to the
+        // runtime path generation
+        if (generator.GetPathType() &
+            (PATHFIND_NOPATH | PATHFIND_NOT_USING_PATH))
+            continue;
+
+        Movement::PointsArray const& points = generator.GetPath();
+        splines->points.insert(
+            splines->points.end(), points.begin(), points.end());
+    }
+
+    splines->offsets.push_back(uint32(splines->points.size()));
+    splines->points.shrink_to_fit();
+
+    return splines;
+}
@@ -20,10 +20,16 @@
 #define ACORE_WAYPOINTMANAGER_H
 
 #include "Common.h"
+#include <G3D/Vector3.h>
+#include <memory>
 #include <optional>
+#include <shared_mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
+class Creature;
+
 enum WaypointMoveType {
     WAYPOINT_MOVE_TYPE_WALK,
     WAYPOINT_MOVE_TYPE_RUN,
@@ -46,6 +52,24 @@ struct WaypointData {
 typedef std::vector<WaypointData*>               WaypointPath;
 typedef std::unordered_map<uint32, WaypointPath> WaypointPathContainer;
 
+// Navmesh paths between the nodes of a waypoint path, built once per map and
+// shared by every creature walking it. Segment i leads from the node before i
+// to node i and spans points[offsets[i], offsets[i + 1]).
+struct WaypointPathSplines {
+    std::vector<G3D::Vector3> points;
+    std::vector<uint32>       offsets;
+
+    // Returns an empty span if the segment could not be built
+    std::span<G3D::Vector3 const> GetSegment(uint32 node) const
+    {
+        if (node + 1 >= offsets.size())
+            return {};
+
+        return {points.data() + offsets[node],
+                points.data() + offsets[node + 1]};
+    }
+};
+
 class WaypointMgr {
 public:
     static WaypointMgr* instance();
@@ -66,11 +90,26 @@ public:
         return nullptr;
     }
 
+    // Returns the shared splines of a path for creatures moving like the
+    // given one, nullptr if they can not be shared
+    std::shared_ptr<WaypointPathSplines const> GetPathSplines(
+        uint32 id, Creature const* creature);
+
 private:
     WaypointMgr();
     ~WaypointMgr();
 
+    std::shared_ptr<WaypointPathSplines const> BuildPathSplines(
+        WaypointPath const& path, Creature const* creature) const;
+
     WaypointPathContainer _waypointStore;
+
+    // path id -> map, phase and movement capabilities -> splines
+    std::unordered_map<
+        uint32,
+        std::unordered_map<uint64, std::shared_ptr<WaypointPathSplines const>>>
+                      _splineStore;
+    std::shared_mutex _splineLock;
 };
 
 #define sWaypointMgr WaypointMgr::instance()
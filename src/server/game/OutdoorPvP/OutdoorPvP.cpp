@@ -17,7 +17,6 @@
  */
 
 #include "OutdoorPvP.h"
-#include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "Group.h"
 #include "Map.h"
@@ -370,19 +369,24 @@ bool OPvPCapturePoint::Update(uint32 diff)
         }
     }
 
-    std::list<Player*>                 players;
+    // only players inside the zones of this outdoor pvp can take part in the
+    // capture, so scan that set instead of searching the grid around the
+    // point; empty zones cost nothing
     Acore::AnyPlayerInObjectRangeCheck checker(_capturePoint, radius);
-    Acore::PlayerListSearcher<Acore::AnyPlayerInObjectRangeCheck> searcher(
-        _capturePoint, players, checker);
-    Cell::VisitWorldObjects(_capturePoint, searcher, radius);
+    uint32 const phaseMask = _capturePoint->GetPhaseMask();
+
+    for (uint8 team = 0; team < PVP_TEAMS_COUNT; ++team) {
+        for (ObjectGuid const& playerGuid : _pvp->GetPlayers(TeamId(team))) {
+            Player* player = ObjectAccessor::GetPlayer(*_capturePoint,
+                                                       playerGuid);
+            if (!player || !player->InSamePhase(phaseMask) ||
+                !checker(player) || !player->IsOutdoorPvPActive())
+                continue;
 
-    for (auto& itr : players) {
-        Player* const player = itr;
-        if (player->IsOutdoorPvPActive()) {
             if (_activePlayers[player->GetTeamId()]
                     .insert(player->GetGUID())
                     .second)
-                HandlePlayerEnter(itr);
+                HandlePlayerEnter(player);
         }
     }
 
@@ -271,6 +271,12 @@ public:
 
     Map* GetMap() const { return _map; }
 
+    // players currently inside the zones of this outdoor pvp
+    PlayerSet const& GetPlayers(TeamId teamId) const
+    {
+        return _players[teamId];
+    }
+
 protected:
     void BroadcastPacket(WorldPacket& data) const;
 
@@ -334,15 +334,40 @@ void PoolGroup<T>::SpawnObject(ActivePoolData& spawns,
         }
 
         if (!EqualChanced.empty() && rolledObjects.empty()) {
-            std::copy_if(EqualChanced.begin(),
-                         EqualChanced.end(),
-                         std::back_inserter(rolledObjects),
-                         [/*triggerFrom, */ &spawns](PoolObject const& object) {
-                             return /*object.guid == triggerFrom ||*/ !spawns
-                                 .IsActiveObject<T>(object.guid);
-                         });
-
-            Acore::Containers::RandomResize(rolledObjects, count);
+            // Pools usually keep only a few of their members spawned, so
+            // random picks find inactive ones quickly without filtering the
+            // whole list
+            for (int tries = count * 4;
+                 tries > 0 && int(rolledObjects.size()) < count;
+                 --tries) {
+                PoolObject const& object =
+                    Acore::Containers::SelectRandomContainerElement(
+                        EqualChanced);
+                if (spawns.IsActiveObject<T>(object.guid))
+                    continue;
+
+                if (std::none_of(rolledObjects.begin(),
+                                 rolledObjects.end(),
+                                 [&object](PoolObject const& rolled) {
+                                     return rolled.guid == object.guid;
+                                 }))
+                    rolledObjects.push_back(object);
+            }
+
+            // Most members are spawned already, choose among the rest
+            if (int(rolledObjects.size()) < count) {
+                rolledObjects.clear();
+                std::copy_if(
+                    EqualChanced.begin(),
+                    EqualChanced.end(),
+                    std::back_inserter(rolledObjects),
+                    [/*triggerFrom, */ &spawns](PoolObject const& object) {
+                        return /*object.guid == triggerFrom ||*/ !spawns
+                            .IsActiveObject<T>(object.guid);
+                    });
+
+                Acore::Containers::RandomResize(rolledObjects, count);
+            }
         }
 
         // try to spawn rolled objects
@@ -40,8 +40,8 @@ struct PoolObject {
 class Pool // for Pool of Pool case
 {};
 
-typedef std::unordered_set<uint32> ActivePoolObjects;
-typedef std::map<uint32, uint32>   ActivePoolPools;
+typedef std::unordered_set<uint32>         ActivePoolObjects;
+typedef std::unordered_map<uint32, uint32> ActivePoolPools;
 
 class ActivePoolData {
 public:
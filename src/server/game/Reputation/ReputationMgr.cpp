@@ -130,6 +130,10 @@ int32 ReputationMgr::GetReputation(FactionEntry const* factionEntry) const
 
 ReputationRank ReputationMgr::GetRank(FactionEntry const* factionEntry) const
 {
+    if (FactionState const* state =
+            factionEntry ? GetState(factionEntry) : nullptr)
+        return state->Rank;
+
     int32 reputation = GetReputation(factionEntry);
     return ReputationToRank(reputation);
 }
@@ -201,14 +205,12 @@ void ReputationMgr::SendState(FactionState const* faction)
     data << uint32(faction->ReputationListID);
     data << uint32(faction->Standing);
 
-    for (FactionStateList::iterator itr = _factions.begin();
-         itr != _factions.end();
-         ++itr) {
-        if (itr->second.needSend) {
-            itr->second.needSend = false;
-            if (itr->second.ReputationListID != faction->ReputationListID) {
-                data << uint32(itr->second.ReputationListID);
-                data << uint32(itr->second.Standing);
+    for (FactionState& state : _factions) {
+        if (state.needSend) {
+            state.needSend = false;
+            if (state.ReputationListID != faction->ReputationListID) {
+                data << uint32(state.ReputationListID);
+                data << uint32(state.Standing);
                 ++count;
             }
         }
@@ -220,33 +222,16 @@ void ReputationMgr::SendState(FactionState const* faction)
 
 void ReputationMgr::SendInitialReputations()
 {
-    WorldPacket data(SMSG_INITIALIZE_FACTIONS, (4 + 128 * 5));
-    data << uint32(0x00000080);
-
-    RepListID a = 0;
-
-    for (FactionStateList::iterator itr = _factions.begin();
-         itr != _factions.end();
-         ++itr) {
-        // fill in absent fields
-        for (; a != itr->first; a++) {
-            data << uint8(0x00);
-            data << uint32(0x00000000);
-        }
-
-        // fill in encountered data
-        data << uint8(itr->second.Flags);
-        data << uint32(itr->second.Standing);
+    WorldPacket data(SMSG_INITIALIZE_FACTIONS,
+                     (4 + MAX_REPUTATION_LIST_ID * 5));
+    data << uint32(MAX_REPUTATION_LIST_ID);
 
-        itr->second.needSend = false;
+    // slots without a faction are zeroed and written as they are
+    for (FactionState& state : _factions) {
+        data << uint8(state.Flags);
+        data << uint32(state.Standing);
 
-        ++a;
-    }
-
-    // fill in absent fields
-    for (; a != 128; a++) {
-        data << uint8(0x00);
-        data << uint32(0x00000000);
+        state.needSend = false;
     }
 
     _player->SendDirectMessage(&data);
@@ -254,10 +239,9 @@ void ReputationMgr::SendInitialReputations()
 
 void ReputationMgr::SendStates()
 {
-    for (FactionStateList::iterator itr = _factions.begin();
-         itr != _factions.end();
-         ++itr)
-        SendState(&(itr->second));
+    for (FactionState const& state : _factions)
+        if (state.ID)
+            SendState(&state);
 }
 
 void ReputationMgr::SendVisible(FactionState const* faction) const
@@ -273,7 +257,8 @@ void ReputationMgr::SendVisible(FactionState const* faction) const
 
 void ReputationMgr::Initialize()
 {
-    _factions.clear();
+    _factions.fill(FactionState());
+    _pendingSave.reset();
     _visibleFactionCount  = 0;
     _honoredFactionCount  = 0;
     _reveredFactionCount  = 0;
@@ -284,21 +269,33 @@ void ReputationMgr::Initialize()
         FactionEntry const* factionEntry = sFactionStore.LookupEntry(i);
 
         if (factionEntry && (factionEntry->reputationListID >= 0)) {
-            FactionState newFaction;
+            if (uint32(factionEntry->reputationListID) >=
+                MAX_REPUTATION_LIST_ID) {
+                LOG_ERROR("reputation",
+                          "ReputationMgr::Initialize: faction {} has "
+                          "reputation list id {}, the client only supports "
+                          "{} reputations.",
+                          factionEntry->ID,
+                          factionEntry->reputationListID,
+                          MAX_REPUTATION_LIST_ID);
+                continue;
+            }
+
+            FactionState& newFaction =
+                _factions[factionEntry->reputationListID];
             newFaction.ID               = factionEntry->ID;
             newFaction.ReputationListID = factionEntry->reputationListID;
             newFaction.Standing         = 0;
             newFaction.Flags            = GetDefaultStateFlags(factionEntry);
             newFaction.needSend         = true;
-            newFaction.needSave         = true;
             newFaction.roundedUp        = false;
+            newFaction.Rank             = GetBaseRank(factionEntry);
+            _pendingSave.set(newFaction.ReputationListID);
 
             if (newFaction.Flags & FACTION_FLAG_VISIBLE)
                 ++_visibleFactionCount;
 
-            UpdateRankCounters(REP_HOSTILE, GetBaseRank(factionEntry));
-
-            _factions[newFaction.ReputationListID] = newFaction;
+            UpdateRankCounters(REP_HOSTILE, newFaction.Rank);
         }
     }
 }
@@ -342,12 +339,12 @@ bool ReputationMgr::SetReputation(FactionEntry const*      factionEntry,
                 spillOverRepOut *= factionEntry->spilloverRateOut;
                 if (FactionEntry const* parent =
                         sFactionStore.LookupEntry(factionEntry->team)) {
-                    FactionStateList::iterator parentState =
-                        _factions.find(parent->reputationListID);
+                    FactionState const* parentState =
+                        GetState(parent->reputationListID);
                     // some team factions have own reputation standing, in this
                     // case do not spill to other sub-factions
-                    if (parentState != _factions.end() &&
-                        (parentState->second.Flags & FACTION_FLAG_SPECIAL)) {
+                    if (parentState &&
+                        (parentState->Flags & FACTION_FLAG_SPECIAL)) {
                         SetOneFactionReputation(
                             parent, spillOverRepOut, incremental);
                     }
@@ -383,9 +380,8 @@ bool ReputationMgr::SetReputation(FactionEntry const*      factionEntry,
     bool spillOverOnly = repMaxCap ? GetRank(factionEntry) > *repMaxCap : false;
 
     // spillover done, update faction itself
-    FactionStateList::iterator faction =
-        _factions.find(factionEntry->reputationListID);
-    if (faction != _factions.end()) {
+    if (FactionState const* faction =
+            GetState(factionEntry->reputationListID)) {
         // Xinef: if we update spillover only, do not update main reputation
         // (rank exceeds creature reward rate)
         if (!spillOverOnly) {
@@ -395,7 +391,7 @@ bool ReputationMgr::SetReputation(FactionEntry const*      factionEntry,
 
         // only this faction gets reported to client, even if it has no own
         // visible standing
-        SendState(&faction->second);
+        SendState(faction);
     }
     return res;
 }
@@ -405,9 +401,8 @@ bool ReputationMgr::SetOneFactionReputation(FactionEntry const* factionEntry,
                                             bool                incremental,
                                             Optional<ReputationRank> repMaxCap)
 {
-    FactionStateList::iterator itr =
-        _factions.find(factionEntry->reputationListID);
-    if (itr != _factions.end()) {
+    if (FactionState* faction =
+            GetMutableState(factionEntry->reputationListID)) {
         int32 BaseRep = GetBaseReputation(factionEntry);
 
         if (incremental) {
@@ -417,18 +412,18 @@ bool ReputationMgr::SetOneFactionReputation(FactionEntry const* factionEntry,
         int32 standing = 0;
         float stand2;
         if (fabs(modff(stand, &stand2)) < 1.f) {
-            if (itr->second.roundedUp) {
+            if (faction->roundedUp) {
                 standing = static_cast<int32>(ceil(stand));
             }
             else {
                 standing = static_cast<int32>(stand);
             }
 
-            itr->second.roundedUp = !itr->second.roundedUp;
+            faction->roundedUp = !faction->roundedUp;
         }
 
         if (incremental) {
-            standing += itr->second.Standing + BaseRep;
+            standing += faction->Standing + BaseRep;
         }
 
         if (standing > Reputation_Cap)
@@ -437,7 +432,7 @@ bool ReputationMgr::SetOneFactionReputation(FactionEntry const* factionEntry,
             standing = Reputation_Bottom;
 
         ReputationRank old_rank =
-            ReputationToRank(itr->second.Standing + BaseRep);
+            ReputationToRank(faction->Standing + BaseRep);
         ReputationRank new_rank = ReputationToRank(standing);
         if (repMaxCap && new_rank > *repMaxCap) {
             standing = ReputationRankToStanding(*repMaxCap);
@@ -446,14 +441,14 @@ bool ReputationMgr::SetOneFactionReputation(FactionEntry const* factionEntry,
 
         if (sScriptMgr->OnPlayerReputationChange(
                 _player, factionEntry->ID, standing, incremental)) {
-            itr->second.Standing = standing - BaseRep;
-            itr->second.needSend = true;
-            itr->second.needSave = true;
+            faction->Standing = standing - BaseRep;
+            faction->Rank     = new_rank;
+            SetChanged(faction);
 
-            SetVisible(&itr->second);
+            SetVisible(faction);
 
             if (new_rank <= REP_HOSTILE)
-                SetAtWar(&itr->second, true);
+                SetAtWar(faction, true);
 
             if (new_rank > old_rank)
                 _sendFactionIncreased = true;
@@ -507,12 +502,9 @@ void ReputationMgr::SetVisible(FactionEntry const* factionEntry)
     if (factionEntry->reputationListID < 0)
         return;
 
-    FactionStateList::iterator itr =
-        _factions.find(factionEntry->reputationListID);
-    if (itr == _factions.end())
-        return;
-
-    SetVisible(&itr->second);
+    if (FactionState* faction =
+            GetMutableState(factionEntry->reputationListID))
+        SetVisible(faction);
 }
 
 void ReputationMgr::SetVisible(FactionState* faction)
@@ -529,8 +521,7 @@ void ReputationMgr::SetVisible(FactionState* faction)
         return;
 
     faction->Flags |= FACTION_FLAG_VISIBLE;
-    faction->needSend = true;
-    faction->needSave = true;
+    SetChanged(faction);
 
     ++_visibleFactionCount;
 
@@ -539,19 +530,18 @@ void ReputationMgr::SetVisible(FactionState* faction)
 
 void ReputationMgr::SetAtWar(RepListID repListID, bool on)
 {
-    FactionStateList::iterator itr = _factions.find(repListID);
-    if (itr == _factions.end())
+    FactionState* faction = GetMutableState(repListID);
+    if (!faction)
         return;
 
     // always invisible or hidden faction can't change war state
-    if (itr->second.Flags &
-        (FACTION_FLAG_INVISIBLE_FORCED | FACTION_FLAG_HIDDEN))
+    if (faction->Flags & (FACTION_FLAG_INVISIBLE_FORCED | FACTION_FLAG_HIDDEN))
         return;
 
-    SetAtWar(&itr->second, on);
+    SetAtWar(faction, on);
 }
 
-void ReputationMgr::SetAtWar(FactionState* faction, bool atWar) const
+void ReputationMgr::SetAtWar(FactionState* faction, bool atWar)
 {
     // not allow declare war to own faction
     if (atWar && (faction->Flags & FACTION_FLAG_PEACE_FORCED))
@@ -566,20 +556,16 @@ void ReputationMgr::SetAtWar(FactionState* faction, bool atWar) const
     else
         faction->Flags &= ~FACTION_FLAG_AT_WAR;
 
-    faction->needSend = true;
-    faction->needSave = true;
+    SetChanged(faction);
 }
 
 void ReputationMgr::SetInactive(RepListID repListID, bool on)
 {
-    FactionStateList::iterator itr = _factions.find(repListID);
-    if (itr == _factions.end())
-        return;
-
-    SetInactive(&itr->second, on);
+    if (FactionState* faction = GetMutableState(repListID))
+        SetInactive(faction, on);
 }
 
-void ReputationMgr::SetInactive(FactionState* faction, bool inactive) const
+void ReputationMgr::SetInactive(FactionState* faction, bool inactive)
 {
     // always invisible or hidden faction can't be inactive
     if (inactive && ((faction->Flags &
@@ -596,8 +582,13 @@ void ReputationMgr::SetInactive(FactionState* faction, bool inactive) const
     else
         faction->Flags &= ~FACTION_FLAG_INACTIVE;
 
+    SetChanged(faction);
+}
+
+void ReputationMgr::SetChanged(FactionState* faction)
+{
     faction->needSend = true;
-    faction->needSave = true;
+    _pendingSave.set(faction->ReputationListID);
 }
 
 void ReputationMgr::LoadFromDB(PreparedQueryResult result)
@@ -615,9 +606,10 @@ void ReputationMgr::LoadFromDB(PreparedQueryResult result)
 
             FactionEntry const* factionEntry =
                 sFactionStore.LookupEntry(fields[0].Get<uint16>());
-            if (factionEntry && (factionEntry->reputationListID >= 0)) {
-                FactionState* faction =
-                    &_factions[factionEntry->reputationListID];
+            FactionState* faction =
+                factionEntry ? GetMutableState(factionEntry->reputationListID)
+                             : nullptr;
+            if (faction) {
 
                 // update standing to current
                 faction->Standing = fields[1].Get<int32>();
@@ -628,6 +620,7 @@ void ReputationMgr::LoadFromDB(PreparedQueryResult result)
                 ReputationRank new_rank =
                     ReputationToRank(BaseRep + faction->Standing);
                 UpdateRankCounters(old_rank, new_rank);
+                faction->Rank = new_rank;
 
                 uint32 dbFactionFlags = fields[2].Get<uint16>();
 
@@ -665,7 +658,7 @@ void ReputationMgr::LoadFromDB(PreparedQueryResult result)
                 // reset changed flag if values similar to saved in DB
                 if (faction->Flags == dbFactionFlags) {
                     faction->needSend = false;
-                    faction->needSave = false;
+                    _pendingSave.reset(faction->ReputationListID);
                 }
 
                 faction->roundedUp = false;
@@ -676,28 +669,25 @@ void ReputationMgr::LoadFromDB(PreparedQueryResult result)
 
 void ReputationMgr::SaveToDB(CharacterDatabaseTransaction trans)
 {
-    for (FactionStateList::iterator itr = _factions.begin();
-         itr != _factions.end();
-         ++itr) {
-        if (itr->second.needSave) {
-            CharacterDatabasePreparedStatement* stmt =
-                CharacterDatabase.GetPreparedStatement(
-                    CHAR_DEL_CHAR_REPUTATION_BY_FACTION);
-            stmt->SetData(0, _player->GetGUID().GetCounter());
-            stmt->SetData(1, uint16(itr->second.ID));
-            trans->Append(stmt);
-
-            stmt = CharacterDatabase.GetPreparedStatement(
-                CHAR_INS_CHAR_REPUTATION_BY_FACTION);
-            stmt->SetData(0, _player->GetGUID().GetCounter());
-            stmt->SetData(1, uint16(itr->second.ID));
-            stmt->SetData(2, itr->second.Standing);
-            stmt->SetData(3, uint16(itr->second.Flags));
-            trans->Append(stmt);
-
-            itr->second.needSave = false;
-        }
+    if (_pendingSave.none())
+        return;
+
+    for (RepListID id = 0; id < MAX_REPUTATION_LIST_ID; ++id) {
+        if (!_pendingSave.test(id))
+            continue;
+
+        FactionState const& faction = _factions[id];
+        CharacterDatabasePreparedStatement* stmt =
+            CharacterDatabase.GetPreparedStatement(
+                CHAR_REP_CHAR_REPUTATION_BY_FACTION);
+        stmt->SetData(0, _player->GetGUID().GetCounter());
+        stmt->SetData(1, uint16(faction.ID));
+        stmt->SetData(2, faction.Standing);
+        stmt->SetData(3, uint16(faction.Flags));
+        trans->Append(stmt);
     }
+
+    _pendingSave.reset();
 }
 
 void ReputationMgr::UpdateRankCounters(ReputationRank old_rank,
@@ -24,6 +24,8 @@
 #include "Language.h"
 #include "QueryResult.h"
 #include "SharedDefines.h"
+#include <array>
+#include <bitset>
 #include <map>
 
 constexpr std::array<uint32, MAX_REPUTATION_RANK> ReputationRankStrIndex = {
@@ -37,18 +39,25 @@ constexpr std::array<uint32, MAX_REPUTATION_RANK> ReputationRankStrIndex = {
     LANG_REP_EXALTED};
 
 typedef uint32 RepListID;
+
+// reputation list ids are dense, the client has exactly this many slots
+constexpr RepListID MAX_REPUTATION_LIST_ID = 128;
+
 struct FactionState {
-    uint32    ID;
-    RepListID ReputationListID;
-    int32     Standing;
-    uint8     Flags;
-    bool      needSend;
-    bool      needSave;
-    bool      roundedUp;
+    uint32    ID               = 0; // 0 for list slots without a faction
+    RepListID ReputationListID = 0;
+    int32     Standing         = 0;
+    uint8     Flags            = 0;
+    bool      needSend         = false;
+    bool      roundedUp        = false;
+
+    // rank of base reputation + Standing, kept in sync with Standing
+    ReputationRank Rank = REP_NEUTRAL;
 };
 
-typedef std::map<RepListID, FactionState> FactionStateList;
-typedef std::map<uint32, ReputationRank>  ForcedReactions;
+// indexed by reputation list id
+typedef std::array<FactionState, MAX_REPUTATION_LIST_ID> FactionStateList;
+typedef std::map<uint32, ReputationRank> ForcedReactions;
 
 class Player;
 
@@ -90,8 +99,8 @@ public: // accessors
 
     FactionState const* GetState(RepListID id) const
     {
-        FactionStateList::const_iterator repItr = _factions.find(id);
-        return repItr != _factions.end() ? &repItr->second : nullptr;
+        return id < MAX_REPUTATION_LIST_ID && _factions[id].ID ? &_factions[id]
+                                                                : nullptr;
     }
 
     bool IsAtWar(uint32 faction_id) const;
@@ -157,9 +166,15 @@ private: // internal helper functions
                          bool                     incremental,
                          bool                     noSpillOver = false,
                          Optional<ReputationRank> repMaxCap   = {});
+    FactionState* GetMutableState(RepListID id)
+    {
+        return id < MAX_REPUTATION_LIST_ID && _factions[id].ID ? &_factions[id]
+                                                                : nullptr;
+    }
+    void   SetChanged(FactionState* faction);
     void   SetVisible(FactionState* faction);
-    void   SetAtWar(FactionState* faction, bool atWar) const;
-    void   SetInactive(FactionState* faction, bool inactive) const;
+    void   SetAtWar(FactionState* faction, bool atWar);
+    void   SetInactive(FactionState* faction, bool inactive);
     void   SendVisible(FactionState const* faction) const;
     void   UpdateRankCounters(ReputationRank old_rank, ReputationRank new_rank);
 
@@ -173,6 +188,9 @@ private:
     uint8            _exaltedFactionCount : 8;
     bool             _sendFactionIncreased; //! Play visual effect on next
                                             //! SMSG_SET_FACTION_STANDING sent
+
+    // factions with changes that are not saved yet, by reputation list id
+    std::bitset<MAX_REPUTATION_LIST_ID> _pendingSave;
 };
 
 #endif
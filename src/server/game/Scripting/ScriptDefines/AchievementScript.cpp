@@ -51,8 +51,8 @@ bool ScriptMgr::IsRealmCompleted(AchievementGlobalMgr const* globalmgr,
 }
 
 void ScriptMgr::OnBeforeCheckCriteria(
-    AchievementMgr*                                   mgr,
-    std::list<AchievementCriteriaEntry const*> const* achievementCriteriaList)
+    AchievementMgr*                     mgr,
+    AchievementCriteriaEntryList const* achievementCriteriaList)
 {
     CALL_ENABLED_HOOKS(
         AchievementScript,
@@ -63,7 +63,7 @@ public:
 
     virtual void OnBeforeCheckCriteria(
         AchievementMgr* /*mgr*/,
-        std::list<
+        std::vector<
             AchievementCriteriaEntry const*> const* /*achievementCriteriaList*/)
     {
     }
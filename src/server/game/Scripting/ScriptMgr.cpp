@@ -30,12 +30,19 @@ namespace {
 template <typename T>
 inline void SCR_CLEAR()
 {
-    for (auto const& [scriptID, script] :
-         ScriptRegistry<T>::ScriptPointerList) {
-        delete script;
-    }
+    ScriptRegistry<T>::Clear();
+}
 
-    ScriptRegistry<T>::ScriptPointerList.clear();
+template <typename... T>
+inline void CollectScriptIds(std::unordered_set<uint32>& ids)
+{
+    (
+        [&ids]() {
+            for (auto const& [scriptId, script] :
+                 ScriptRegistry<T>::ScriptPointerList)
+                ids.insert(scriptId);
+        }(),
+        ...);
 }
 } // namespace
 
@@ -196,42 +203,46 @@ void ScriptMgr::LoadDatabase()
 
 void ScriptMgr::CheckIfScriptsInDatabaseExist()
 {
+    // Gather the ids of every registry once, each name then needs a single
+    // lookup instead of one per registry
+    std::unordered_set<uint32> ids;
+    CollectScriptIds<SpellScriptLoader,
+                     ServerScript,
+                     WorldScript,
+                     FormulaScript,
+                     WorldMapScript,
+                     InstanceMapScript,
+                     BattlegroundMapScript,
+                     ItemScript,
+                     CreatureScript,
+                     GameObjectScript,
+                     AreaTriggerScript,
+                     BattlegroundScript,
+                     OutdoorPvPScript,
+                     CommandScript,
+                     WeatherScript,
+                     AuctionHouseScript,
+                     ConditionScript,
+                     VehicleScript,
+                     DynamicObjectScript,
+                     TransportScript,
+                     AchievementCriteriaScript,
+                     PlayerScript,
+                     GuildScript,
+                     BGScript,
+                     AchievementScript,
+                     ArenaTeamScript,
+                     SpellSC,
+                     MiscScript,
+                     PetScript,
+                     CommandSC,
+                     ArenaScript,
+                     GroupScript,
+                     DatabaseScript>(ids);
+
     for (auto const& scriptName : sObjectMgr->GetScriptNames()) {
         if (uint32 sid = sObjectMgr->GetScriptId(scriptName)) {
-            if (!ScriptRegistry<SpellScriptLoader>::GetScriptById(sid) &&
-                !ScriptRegistry<ServerScript>::GetScriptById(sid) &&
-                !ScriptRegistry<WorldScript>::GetScriptById(sid) &&
-                !ScriptRegistry<FormulaScript>::GetScriptById(sid) &&
-                !ScriptRegistry<WorldMapScript>::GetScriptById(sid) &&
-                !ScriptRegistry<InstanceMapScript>::GetScriptById(sid) &&
-                !ScriptRegistry<BattlegroundMapScript>::GetScriptById(sid) &&
-                !ScriptRegistry<ItemScript>::GetScriptById(sid) &&
-                !ScriptRegistry<CreatureScript>::GetScriptById(sid) &&
-                !ScriptRegistry<GameObjectScript>::GetScriptById(sid) &&
-                !ScriptRegistry<AreaTriggerScript>::GetScriptById(sid) &&
-                !ScriptRegistry<BattlegroundScript>::GetScriptById(sid) &&
-                !ScriptRegistry<OutdoorPvPScript>::GetScriptById(sid) &&
-                !ScriptRegistry<CommandScript>::GetScriptById(sid) &&
-                !ScriptRegistry<WeatherScript>::GetScriptById(sid) &&
-                !ScriptRegistry<AuctionHouseScript>::GetScriptById(sid) &&
-                !ScriptRegistry<ConditionScript>::GetScriptById(sid) &&
-                !ScriptRegistry<VehicleScript>::GetScriptById(sid) &&
-                !ScriptRegistry<DynamicObjectScript>::GetScriptById(sid) &&
-                !ScriptRegistry<TransportScript>::GetScriptById(sid) &&
-                !ScriptRegistry<AchievementCriteriaScript>::GetScriptById(
-                    sid) &&
-                !ScriptRegistry<PlayerScript>::GetScriptById(sid) &&
-                !ScriptRegistry<GuildScript>::GetScriptById(sid) &&
-                !ScriptRegistry<BGScript>::GetScriptById(sid) &&
-                !ScriptRegistry<AchievementScript>::GetScriptById(sid) &&
-                !ScriptRegistry<ArenaTeamScript>::GetScriptById(sid) &&
-                !ScriptRegistry<SpellSC>::GetScriptById(sid) &&
-                !ScriptRegistry<MiscScript>::GetScriptById(sid) &&
-                !ScriptRegistry<PetScript>::GetScriptById(sid) &&
-                !ScriptRegistry<CommandSC>::GetScriptById(sid) &&
-                !ScriptRegistry<ArenaScript>::GetScriptById(sid) &&
-                !ScriptRegistry<GroupScript>::GetScriptById(sid) &&
-                !ScriptRegistry<DatabaseScript>::GetScriptById(sid)) {
+            if (!ids.count(sid)) {
                 LOG_ERROR("sql.sql",
                           "Script named '{}' is assigned in the database, but "
                           "has no code!",
@@ -39,6 +39,8 @@
 #include "Weather.h"
 #include "World.h"
 #include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 
 // Add support old api modules
 #include "AllScriptsObjects.h"
@@ -1372,12 +1374,20 @@ public:
 
             // We're dealing with a code-only script; just add it.
             ScriptPointerList[_scriptIdCounter++] = script;
+            _registeredScripts.insert(script);
             sScriptMgr->IncreaseScriptCount();
         }
     }
 
     static void AddALScripts()
     {
+        // Name lookup for the replacement check below, built once instead of
+        // scanning ScriptPointerList for every database bound script
+        std::unordered_map<std::string, TScript*> scriptsByName;
+        scriptsByName.reserve(ScriptPointerList.size() + ALScripts.size());
+        for (auto const& [id, registered] : ScriptPointerList)
+            scriptsByName.emplace(registered->GetName(), registered);
+
         for (ScriptVectorIterator it = ALScripts.begin(); it != ALScripts.end();
              ++it) {
             TScript* const script = (*it).first;
@@ -1395,17 +1405,10 @@ public:
                 uint32 id = sObjectMgr->GetScriptId(script->GetName().c_str());
                 if (id) {
                     // Try to find an existing script.
-                    TScript const* oldScript = nullptr;
-                    for (auto iterator = ScriptPointerList.begin();
-                         iterator != ScriptPointerList.end();
-                         ++iterator) {
-                        // If the script names match...
-                        if (iterator->second->GetName() == script->GetName()) {
-                            // ... It exists.
-                            oldScript = iterator->second;
-                            break;
-                        }
-                    }
+                    TScript* oldScript = nullptr;
+                    auto     itr       = scriptsByName.find(script->GetName());
+                    if (itr != scriptsByName.end())
+                        oldScript = itr->second;
 
                     // If the script is already assigned -> delete it!
                     if (oldScript) {
@@ -1416,11 +1419,14 @@ public:
                                     break;
                                 }
 
+                        _registeredScripts.erase(oldScript);
                         delete oldScript;
                     }
 
                     // Assign new script!
                     ScriptPointerList[id] = script;
+                    _registeredScripts.insert(script);
+                    scriptsByName[script->GetName()] = script;
 
                     // Increment script count only with new scripts
                     if (!oldScript) {
@@ -1443,6 +1449,8 @@ public:
 
                 // We're dealing with a code-only script; just add it.
                 ScriptPointerList[_scriptIdCounter++] = script;
+                _registeredScripts.insert(script);
+                scriptsByName.emplace(script->GetName(), script);
                 sScriptMgr->IncreaseScriptCount();
             }
         }
@@ -1458,26 +1466,28 @@ public:
         return nullptr;
     }
 
+    // Deletes all registered scripts, used on shutdown.
+    static void Clear()
+    {
+        for (auto const& [id, script] : ScriptPointerList)
+            delete script;
+
+        ScriptPointerList.clear();
+        _registeredScripts.clear();
+    }
+
 private:
     // See if the script is using the same memory as another script. If this
     // happens, it means that someone forgot to allocate new memory for a
     // script.
     static bool _checkMemory(TScript* const script)
     {
-        // See if the script is using the same memory as another script. If this
-        // happens, it means that someone forgot to allocate new memory for a
-        // script.
-        for (ScriptMapIterator it = ScriptPointerList.begin();
-             it != ScriptPointerList.end();
-             ++it) {
-            if (it->second == script) {
-                LOG_ERROR("scripts",
-                          "Script '{}' has same memory pointer as '{}'.",
-                          script->GetName(),
-                          it->second->GetName());
+        if (_registeredScripts.count(script)) {
+            LOG_ERROR("scripts",
+                      "Script '{}' has same memory pointer as another script.",
+                      script->GetName());
 
-                return false;
-            }
+            return false;
         }
 
         return true;
@@ -1485,6 +1495,9 @@ private:
 
     // Counter used for code-only scripts.
     static uint32 _scriptIdCounter;
+    // Every pointer stored in ScriptPointerList, keeps _checkMemory constant
+    // time instead of a scan over all scripts for each registration.
+    static std::unordered_set<TScript*> _registeredScripts;
 };
 
 // Instantiate static members of ScriptRegistry.
@@ -1497,5 +1510,7 @@ template <class TScript>
 std::vector<std::vector<TScript*>> ScriptRegistry<TScript>::EnabledHooks;
 template <class TScript>
 uint32 ScriptRegistry<TScript>::_scriptIdCounter = 0;
+template <class TScript>
+std::unordered_set<TScript*> ScriptRegistry<TScript>::_registeredScripts;
 
 #endif
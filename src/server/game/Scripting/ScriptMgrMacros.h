@@ -21,9 +21,10 @@
 
 #include "ScriptMgr.h"
 
-template <typename ScriptName>
-inline Optional<bool>
-IsValidBoolScript(std::function<bool(ScriptName*)> executeHook)
+// The hooks are taken as template parameters so that the lambdas are called
+// directly instead of through a std::function per script.
+template <typename ScriptName, typename Hook>
+inline Optional<bool> IsValidBoolScript(Hook&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return {};
@@ -37,8 +38,8 @@ IsValidBoolScript(std::function<bool(ScriptName*)> executeHook)
     return false;
 }
 
-template <typename ScriptName, class T>
-inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
+template <typename ScriptName, class T, typename Hook>
+inline T* GetReturnAIScript(Hook&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return nullptr;
@@ -53,8 +54,8 @@ inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
     return nullptr;
 }
 
-template <typename ScriptName>
-inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
+template <typename ScriptName, typename Hook>
+inline void ExecuteScript(Hook&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return;
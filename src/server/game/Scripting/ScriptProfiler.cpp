@@ -0,0 +1,215 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptProfiler.h"
+#include "Config.h"
+#include "Metric.h"
+#include <algorithm>
+
+ScriptProfiler::ScriptProfiler()
+    : _sampleRate(0), _reportInterval(0), _reportTimer(0), _reportTopCount(0)
+{
+}
+
+ScriptProfiler* ScriptProfiler::instance()
+{
+    static ScriptProfiler instance;
+    return &instance;
+}
+
+char const* ScriptProfiler::GetTypeName(ScriptProfileType type)
+{
+    switch (type) {
+    case SCRIPT_PROFILE_CREATURE_AI:
+        return "creature_ai";
+    case SCRIPT_PROFILE_GAMEOBJECT_AI:
+        return "gameobject_ai";
+    case SCRIPT_PROFILE_SMART_SCRIPT:
+        return "smart_script";
+    case SCRIPT_PROFILE_SPELL_SCRIPT:
+        return "spell_script";
+    case SCRIPT_PROFILE_AURA_SCRIPT:
+        return "aura_script";
+    default:
+        return "unknown";
+    }
+}
+
+void ScriptProfiler::LoadFromConfig()
+{
+    _sampleRate =
+        sConfigMgr->GetOption<uint32>("ScriptProfiler.SampleRate", 0);
+    _reportInterval = Milliseconds(
+        sConfigMgr->GetOption<uint32>("ScriptProfiler.MetricInterval", 60000));
+    _reportTopCount =
+        sConfigMgr->GetOption<uint32>("ScriptProfiler.MetricTopCount", 20);
+
+    if (!_sampleRate)
+        Reset();
+}
+
+bool ScriptProfiler::ShouldSample()
+{
+    uint32 const rate = _sampleRate.load(std::memory_order_relaxed);
+    if (!rate)
+        return false;
+
+    thread_local uint32 calls = 0;
+    if (++calls < rate)
+        return false;
+
+    calls = 0;
+    return true;
+}
+
+void ScriptProfiler::Record(ScriptProfileType type,
+                            std::string_view  name,
+                            Microseconds      elapsed)
+{
+    uint64 const value = uint64(std::max<int64>(elapsed.count(), 0));
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    ScriptMap& scripts = _scripts[type];
+    auto       itr     = scripts.find(name);
+    if (itr == scripts.end())
+        itr = scripts.emplace(std::string(name), ScriptSamples()).first;
+
+    ScriptSamples& samples = itr->second;
+    ++samples.Count;
+    samples.Total += value;
+    samples.Max = std::max(samples.Max, value);
+    ++samples.IntervalCount;
+    samples.IntervalTotal += value;
+}
+
+void ScriptProfiler::Update(uint32 diff)
+{
+    if (!IsEnabled() || _reportInterval == 0s || !sMetric->IsEnabled())
+        return;
+
+    _reportTimer += Milliseconds(diff);
+    if (_reportTimer < _reportInterval)
+        return;
+
+    _reportTimer = 0s;
+
+    struct IntervalStats {
+        ScriptProfileType Type;
+        std::string       Name;
+        uint64            Count;
+        uint64            Total;
+    };
+
+    std::vector<IntervalStats> top;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        for (uint8 type = 0; type < SCRIPT_PROFILE_TYPE_COUNT; ++type) {
+            for (auto& [name, samples] : _scripts[type]) {
+                if (samples.IntervalCount)
+                    top.push_back({ScriptProfileType(type),
+                                   name,
+                                   samples.IntervalCount,
+                                   samples.IntervalTotal});
+
+                samples.IntervalCount = 0;
+                samples.IntervalTotal = 0;
+            }
+        }
+    }
+
+    std::size_t const count =
+        std::min<std::size_t>(top.size(), _reportTopCount);
+    std::partial_sort(top.begin(),
+                      top.begin() + count,
+                      top.end(),
+                      [](IntervalStats const& a, IntervalStats const& b) {
+                          return a.Total > b.Total;
+                      });
+
+    // scaled by the sample rate to estimate the time of all calls
+    uint32 const rate = _sampleRate;
+    for (std::size_t i = 0; i < count; ++i) {
+        METRIC_VALUE("script_time",
+                     top[i].Total * rate,
+                     METRIC_TAG("type", GetTypeName(top[i].Type)),
+                     METRIC_TAG("script", top[i].Name));
+        METRIC_VALUE("script_calls",
+                     top[i].Count * rate,
+                     METRIC_TAG("type", GetTypeName(top[i].Type)),
+                     METRIC_TAG("script", top[i].Name));
+    }
+}
+
+std::vector<ScriptProfiler::ScriptStats>
+ScriptProfiler::GetStats(uint32 count) const
+{
+    std::vector<ScriptStats> result;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        for (uint8 type = 0; type < SCRIPT_PROFILE_TYPE_COUNT; ++type)
+            for (auto const& [name, samples] : _scripts[type])
+                result.push_back({ScriptProfileType(type),
+                                  name,
+                                  samples.Count,
+                                  Microseconds(samples.Total),
+                                  Microseconds(samples.Max)});
+    }
+
+    std::sort(result.begin(),
+              result.end(),
+              [](ScriptStats const& a, ScriptStats const& b) {
+                  return a.Total > b.Total;
+              });
+    if (result.size() > count)
+        result.resize(count);
+
+    return result;
+}
+
+void ScriptProfiler::Reset()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    for (ScriptMap& scripts : _scripts)
+        scripts.clear();
+}
+
+ScriptProfilerScope::ScriptProfilerScope()
+    : _sampled(sScriptProfiler->ShouldSample()),
+      _type(SCRIPT_PROFILE_CREATURE_AI)
+{
+    if (_sampled)
+        _start = std::chrono::steady_clock::now();
+}
+
+ScriptProfilerScope::~ScriptProfilerScope()
+{
+    if (!_sampled || _name.empty())
+        return;
+
+    sScriptProfiler->Record(_type,
+                            _name,
+                            std::chrono::duration_cast<Microseconds>(
+                                std::chrono::steady_clock::now() - _start));
+}
+
+void ScriptProfilerScope::SetScript(ScriptProfileType type, std::string name)
+{
+    _type = type;
+    _name = std::move(name);
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SCRIPTPROFILER_H
+#define __SCRIPTPROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum ScriptProfileType : uint8 {
+    SCRIPT_PROFILE_CREATURE_AI,
+    SCRIPT_PROFILE_GAMEOBJECT_AI,
+    SCRIPT_PROFILE_SMART_SCRIPT,
+    SCRIPT_PROFILE_SPELL_SCRIPT,
+    SCRIPT_PROFILE_AURA_SCRIPT,
+    SCRIPT_PROFILE_TYPE_COUNT
+};
+
+/*
+ * Samples the wall time of AI updates, SmartAI updates and spell and aura
+ * script hooks. One in ScriptProfiler.SampleRate calls of every thread is
+ * timed, the samples are summed up per script name (or SmartAI source) since
+ * the last reset and the estimated totals are sent to sMetric.
+ */
+class AC_GAME_API ScriptProfiler {
+public:
+    struct ScriptStats {
+        ScriptProfileType Type;
+        std::string       Name;
+        uint64            Samples;
+        Microseconds      Total;
+        Microseconds      Max;
+    };
+
+    static ScriptProfiler* instance();
+
+    static char const* GetTypeName(ScriptProfileType type);
+
+    void   LoadFromConfig();
+    bool   IsEnabled() const { return _sampleRate != 0; }
+    uint32 GetSampleRate() const { return _sampleRate; }
+
+    // true for one in ScriptProfiler.SampleRate calls of this thread
+    bool ShouldSample();
+
+    void Record(ScriptProfileType type,
+                std::string_view  name,
+                Microseconds      elapsed);
+
+    // sends the most expensive scripts of the interval to sMetric
+    void Update(uint32 diff);
+
+    // sorted by sampled time, the most expensive first
+    std::vector<ScriptStats> GetStats(uint32 count) const;
+    void                     Reset();
+
+private:
+    struct ScriptSamples {
+        uint64 Count = 0;
+        uint64 Total = 0;
+        uint64 Max   = 0;
+        // sampled since the last metric report
+        uint64 IntervalCount = 0;
+        uint64 IntervalTotal = 0;
+    };
+
+    typedef std::map<std::string, ScriptSamples, std::less<>> ScriptMap;
+
+    ScriptProfiler();
+
+    mutable std::mutex                               _lock;
+    std::array<ScriptMap, SCRIPT_PROFILE_TYPE_COUNT> _scripts;
+
+    std::atomic<uint32> _sampleRate;
+    Milliseconds        _reportInterval;
+    Milliseconds        _reportTimer;
+    uint32              _reportTopCount;
+};
+
+#define sScriptProfiler ScriptProfiler::instance()
+
+/*
+ * Times its own lifetime when sampled. The script is only named when
+ * IsSampled() so that building the name costs nothing for the other calls.
+ */
+class AC_GAME_API ScriptProfilerScope {
+public:
+    ScriptProfilerScope();
+    ~ScriptProfilerScope();
+
+    ScriptProfilerScope(ScriptProfilerScope const&)            = delete;
+    ScriptProfilerScope& operator=(ScriptProfilerScope const&) = delete;
+
+    bool IsSampled() const { return _sampled; }
+    void SetScript(ScriptProfileType type, std::string name);
+
+private:
+    bool              _sampled;
+    ScriptProfileType _type;
+    std::string       _name;
+    TimePoint         _start;
+};
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NetworkStats.h"
+#include "Config.h"
+#include "Metric.h"
+#include "Opcodes.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+struct NetworkStats::ThreadCounters {
+    struct Counters {
+        std::atomic<uint64> Packets{0};
+        std::atomic<uint64> RawBytes{0};
+        std::atomic<uint64> SentBytes{0};
+    };
+
+    std::array<Counters, NUM_OPCODE_HANDLERS> Opcodes;
+};
+
+namespace {
+// only written by the owning thread, relaxed loads and stores are enough
+void Increment(std::atomic<uint64>& counter, uint64 value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+}
+
+void Subtract(OpcodeTraffic& traffic, OpcodeTraffic const& base)
+{
+    traffic.Packets -= base.Packets;
+    traffic.RawBytes -= base.RawBytes;
+    traffic.SentBytes -= base.SentBytes;
+}
+} // namespace
+
+NetworkStats::NetworkStats()
+    : _reportInterval(0), _reportTimer(0), _reportTopCount(0)
+{
+}
+
+NetworkStats::~NetworkStats() = default;
+
+NetworkStats* NetworkStats::instance()
+{
+    static NetworkStats instance;
+    return &instance;
+}
+
+void NetworkStats::LoadFromConfig()
+{
+    _reportInterval = Milliseconds(sConfigMgr->GetOption<uint32>(
+        "Network.Stats.MetricInterval", 60000));
+    _reportTopCount =
+        sConfigMgr->GetOption<uint32>("Network.Stats.MetricTopCount", 20);
+}
+
+NetworkStats::ThreadCounters& NetworkStats::GetThreadCounters()
+{
+    // network threads live until shutdown, their counters are never freed
+    thread_local ThreadCounters* counters = nullptr;
+    if (!counters) {
+        std::lock_guard<std::mutex> guard(_lock);
+        counters = _threads.emplace_back(std::make_unique<ThreadCounters>())
+                       .get();
+    }
+
+    return *counters;
+}
+
+void NetworkStats::AddPacket(uint16      opcode,
+                             std::size_t rawBytes,
+                             std::size_t sentBytes)
+{
+    if (opcode >= NUM_OPCODE_HANDLERS)
+        return;
+
+    ThreadCounters::Counters& counters = GetThreadCounters().Opcodes[opcode];
+    Increment(counters.Packets, 1);
+    Increment(counters.RawBytes, rawBytes);
+    Increment(counters.SentBytes, sentBytes);
+}
+
+std::vector<OpcodeTraffic> NetworkStats::Collect() const
+{
+    std::vector<OpcodeTraffic> totals(NUM_OPCODE_HANDLERS);
+    for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+        totals[opcode].Opcode = opcode;
+
+    for (std::unique_ptr<ThreadCounters> const& thread : _threads) {
+        for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode) {
+            ThreadCounters::Counters const& counters = thread->Opcodes[opcode];
+            totals[opcode].Packets +=
+                counters.Packets.load(std::memory_order_relaxed);
+            totals[opcode].RawBytes +=
+                counters.RawBytes.load(std::memory_order_relaxed);
+            totals[opcode].SentBytes +=
+                counters.SentBytes.load(std::memory_order_relaxed);
+        }
+    }
+
+    return totals;
+}
+
+void NetworkStats::Update(uint32 diff)
+{
+    if (_reportInterval == 0s || !sMetric->IsEnabled())
+        return;
+
+    _reportTimer += Milliseconds(diff);
+    if (_reportTimer < _reportInterval)
+        return;
+
+    _reportTimer = 0s;
+
+    std::vector<OpcodeTraffic> interval;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        interval = Collect();
+
+        std::vector<OpcodeTraffic> totals = interval;
+        if (!_reportTotals.empty())
+            for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+                Subtract(interval[opcode], _reportTotals[opcode]);
+
+        _reportTotals = std::move(totals);
+    }
+
+    NetworkTraffic sum;
+    for (OpcodeTraffic const& traffic : interval) {
+        sum.Packets += traffic.Packets;
+        sum.RawBytes += traffic.RawBytes;
+        sum.SentBytes += traffic.SentBytes;
+    }
+
+    METRIC_VALUE("net_sent_packets", sum.Packets);
+    METRIC_VALUE("net_raw_bytes", sum.RawBytes);
+    METRIC_VALUE("net_sent_bytes", sum.SentBytes);
+
+    std::size_t const count =
+        std::min<std::size_t>(interval.size(), _reportTopCount);
+    std::partial_sort(interval.begin(),
+                      interval.begin() + count,
+                      interval.end(),
+                      [](OpcodeTraffic const& a, OpcodeTraffic const& b) {
+                          return a.SentBytes > b.SentBytes;
+                      });
+
+    for (std::size_t i = 0; i < count && interval[i].Packets; ++i) {
+        std::string const opcode =
+            GetOpcodeNameForLogging(Opcodes(interval[i].Opcode));
+        METRIC_VALUE("net_opcode_packets",
+                     interval[i].Packets,
+                     METRIC_TAG("opcode", opcode));
+        METRIC_VALUE("net_opcode_bytes",
+                     interval[i].SentBytes,
+                     METRIC_TAG("opcode", opcode));
+    }
+}
+
+std::vector<OpcodeTraffic> NetworkStats::GetOpcodes() const
+{
+    std::vector<OpcodeTraffic> opcodes;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        opcodes = Collect();
+        if (!_resetTotals.empty())
+            for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+                Subtract(opcodes[opcode], _resetTotals[opcode]);
+    }
+
+    opcodes.erase(std::remove_if(opcodes.begin(),
+                                 opcodes.end(),
+                                 [](OpcodeTraffic const& traffic) {
+                                     return !traffic.Packets;
+                                 }),
+                  opcodes.end());
+    std::sort(opcodes.begin(),
+              opcodes.end(),
+              [](OpcodeTraffic const& a, OpcodeTraffic const& b) {
+                  return a.SentBytes > b.SentBytes;
+              });
+    return opcodes;
+}
+
+void NetworkStats::Reset()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _resetTotals = Collect();
+}
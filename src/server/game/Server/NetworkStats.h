@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __NETWORKSTATS_H
+#define __NETWORKSTATS_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// Outbound traffic of one opcode or one socket
+struct NetworkTraffic {
+    uint64 Packets   = 0;
+    // header and payload before compression
+    uint64 RawBytes  = 0;
+    // header and payload as written to the socket
+    uint64 SentBytes = 0;
+};
+
+struct OpcodeTraffic : NetworkTraffic {
+    uint16 Opcode = 0;
+};
+
+/*
+ * Counts the packets and bytes the network threads write per server opcode.
+ * Every network thread adds to its own counters, readers sum them up. Packets
+ * compressed by the socket are counted with their uncompressed opcode.
+ */
+class AC_GAME_API NetworkStats {
+public:
+    static NetworkStats* instance();
+
+    void LoadFromConfig();
+
+    void AddPacket(uint16 opcode, std::size_t rawBytes, std::size_t sentBytes);
+
+    // sends the opcodes with the most traffic of the interval to sMetric
+    void Update(uint32 diff);
+
+    // traffic since the last reset, sorted by sent bytes
+    std::vector<OpcodeTraffic> GetOpcodes() const;
+    void                       Reset();
+
+private:
+    struct ThreadCounters;
+
+    NetworkStats();
+    ~NetworkStats();
+
+    ThreadCounters&            GetThreadCounters();
+    std::vector<OpcodeTraffic> Collect() const;
+
+    mutable std::mutex                           _lock;
+    std::vector<std::unique_ptr<ThreadCounters>> _threads;
+    // totals at the last reset and the last metric report
+    std::vector<OpcodeTraffic>                   _resetTotals;
+    std::vector<OpcodeTraffic>                   _reportTotals;
+
+    Milliseconds _reportInterval;
+    Milliseconds _reportTimer;
+    uint32       _reportTopCount;
+};
+
+#define sNetworkStats NetworkStats::instance()
+
+#endif
@@ -27,6 +27,7 @@
 #include "GuildPackets.h"
 #include "LFGPackets.h"
 #include "MiscPackets.h"
+#include "MovementPackets.h"
 #include "PetPackets.h"
 #include "TotemPackets.h"
 #include "WorldStatePackets.h"
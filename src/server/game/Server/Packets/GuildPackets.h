@@ -208,7 +208,7 @@ public:
 
 class GuildEvent final : public ServerPacket {
 public:
-    GuildEvent() : ServerPacket(SMSG_GUILD_EVENT) {}
+    GuildEvent() : ServerPacket(SMSG_GUILD_EVENT, 1 + 1 + 3 * 24 + 8) {}
 
     WorldPacket const* Write() override;
 
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementPackets.h"
+#include "Unit.h"
+#include <bit>
+#include <cmath>
+#include <span>
+
+namespace {
+/// Unchecked reads from a range whose length was validated by the caller.
+class MovementInfoReader {
+public:
+    explicit MovementInfoReader(std::span<uint8 const> data) : _data(data) {}
+
+    template <typename T>
+    T Read()
+    {
+        T value;
+        std::memcpy(&value, _data.data() + _pos, sizeof(T));
+        EndianConvert(value);
+        _pos += sizeof(T);
+        return value;
+    }
+
+    float ReadFloat()
+    {
+        float value = Read<float>();
+        if (!std::isfinite(value))
+            throw ByteBufferInvalidValueException("float", "infinity");
+
+        return value;
+    }
+
+    void ReadPosition(Position& pos)
+    {
+        float x = ReadFloat();
+        float y = ReadFloat();
+        float z = ReadFloat();
+        float o = ReadFloat();
+        pos.Relocate(x, y, z, o);
+    }
+
+    ObjectGuid ReadPackedGuid()
+    {
+        uint8  mask = Read<uint8>();
+        uint64 guid = 0;
+        for (uint8 i = 0; i < 8; ++i)
+            if (mask & (uint8(1) << i))
+                guid |= uint64(Read<uint8>()) << (i * 8);
+
+        return ObjectGuid(guid);
+    }
+
+private:
+    std::span<uint8 const> _data;
+    std::size_t            _pos = 0;
+};
+} // namespace
+
+void WorldPackets::Movement::ReadMovementInfo(ByteBuffer&   data,
+                                              MovementInfo& movementInfo)
+{
+    // flags, flags2, time, position
+    std::size_t constexpr headerSize = 4 + 2 + 4 + 4 * 4;
+
+    std::size_t const offset = data.rpos();
+    if (data.size() < offset + headerSize)
+        throw ByteBufferPositionException(
+            false, offset, data.size(), headerSize);
+
+    uint32 const flags  = data.read<uint32>(offset);
+    uint16 const flags2 = data.read<uint16>(offset + 4);
+
+    std::size_t size = headerSize;
+    if (flags & MOVEMENTFLAG_ONTRANSPORT) {
+        // the packed guid length is only known once its mask byte is in range
+        if (data.size() < offset + size + 1)
+            throw ByteBufferPositionException(
+                false, offset, data.size(), size + 1);
+
+        size += 1 + std::popcount(data.read<uint8>(offset + size));
+        size += 4 * 4 + 4 + 1;
+        if (flags2 & MOVEMENTFLAG2_INTERPOLATED_MOVEMENT)
+            size += 4;
+    }
+
+    if ((flags & (MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) ||
+        (flags2 & MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING))
+        size += 4;
+
+    size += 4;
+    if (flags & MOVEMENTFLAG_FALLING)
+        size += 4 * 4;
+
+    if (flags & MOVEMENTFLAG_SPLINE_ELEVATION)
+        size += 4;
+
+    if (data.size() < offset + size)
+        throw ByteBufferPositionException(
+            false, offset, data.size(), size);
+
+    MovementInfoReader reader({data.contents() + offset, size});
+    movementInfo.flags  = reader.Read<uint32>();
+    movementInfo.flags2 = reader.Read<uint16>();
+    movementInfo.time   = reader.Read<uint32>();
+    reader.ReadPosition(movementInfo.pos);
+
+    if (movementInfo.HasMovementFlag(MOVEMENTFLAG_ONTRANSPORT)) {
+        movementInfo.transport.guid = reader.ReadPackedGuid();
+        reader.ReadPosition(movementInfo.transport.pos);
+        movementInfo.transport.time = reader.Read<uint32>();
+        movementInfo.transport.seat = reader.Read<int8>();
+
+        if (movementInfo.HasExtraMovementFlag(
+                MOVEMENTFLAG2_INTERPOLATED_MOVEMENT))
+            movementInfo.transport.time2 = reader.Read<uint32>();
+    }
+
+    if (movementInfo.HasMovementFlag(
+            MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) ||
+        movementInfo.HasExtraMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING))
+        movementInfo.pitch = reader.ReadFloat();
+
+    movementInfo.fallTime = reader.Read<uint32>();
+
+    if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING)) {
+        movementInfo.jump.zspeed   = reader.ReadFloat();
+        movementInfo.jump.sinAngle = reader.ReadFloat();
+        movementInfo.jump.cosAngle = reader.ReadFloat();
+        movementInfo.jump.xyspeed  = reader.ReadFloat();
+    }
+
+    if (movementInfo.HasMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION))
+        movementInfo.splineElevation = reader.ReadFloat();
+
+    data.rpos(offset + size);
+}
+
+void WorldPackets::Movement::ClientPlayerMovement::Read()
+{
+    _worldPacket >> Status.guid.ReadAsPacked();
+    ReadMovementInfo(_worldPacket, Status);
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MovementPackets_h__
+#define MovementPackets_h__
+
+#include "Object.h"
+#include "Packet.h"
+
+namespace WorldPackets {
+namespace Movement {
+/// Parses a movement block in one pass. The length implied by its flags is
+/// checked against the buffer before any field is read, so a truncated
+/// packet is rejected before the MovementInfo is touched.
+void ReadMovementInfo(ByteBuffer& data, MovementInfo& movementInfo);
+
+/// All MSG_MOVE_* opcodes sent by the client: the mover followed by its
+/// movement block.
+class ClientPlayerMovement final : public ClientPacket {
+public:
+    ClientPlayerMovement(WorldPacket&& packet) : ClientPacket(std::move(packet))
+    {
+    }
+
+    void Read() override;
+
+    MovementInfo Status;
+};
+} // namespace Movement
+} // namespace WorldPackets
+
+#endif // MovementPackets_h__
@@ -1091,7 +1091,7 @@ void OpcodeTable::Initialize()
     /*0x127*/ DEFINE_SERVER_OPCODE_HANDLER(SMSG_SET_PROFICIENCY, STATUS_NEVER);
     /*0x128*/ DEFINE_HANDLER(CMSG_SET_ACTION_BUTTON,
                              STATUS_LOGGEDIN,
-                             PROCESS_THREADUNSAFE,
+                             PROCESS_THREADSAFE,
                              &WorldSession::HandleSetActionButtonOpcode);
     /*0x129*/ DEFINE_SERVER_OPCODE_HANDLER(SMSG_ACTION_BUTTONS, STATUS_NEVER);
     /*0x12A*/ DEFINE_SERVER_OPCODE_HANDLER(SMSG_INITIAL_SPELLS, STATUS_NEVER);
@@ -1664,11 +1664,11 @@ void OpcodeTable::Initialize()
                                            STATUS_NEVER);
     /*0x20A*/ DEFINE_HANDLER(CMSG_REQUEST_ACCOUNT_DATA,
                              STATUS_AUTHED,
-                             PROCESS_THREADUNSAFE,
+                             PROCESS_THREADSAFE,
                              &WorldSession::HandleRequestAccountData);
     /*0x20B*/ DEFINE_HANDLER(CMSG_UPDATE_ACCOUNT_DATA,
                              STATUS_AUTHED,
-                             PROCESS_THREADUNSAFE,
+                             PROCESS_THREADSAFE,
                              &WorldSession::HandleUpdateAccountData);
     /*0x20C*/ DEFINE_SERVER_OPCODE_HANDLER(SMSG_UPDATE_ACCOUNT_DATA,
                                            STATUS_NEVER);
@@ -2208,7 +2208,7 @@ void OpcodeTable::Initialize()
                              &WorldSession::Handle_NULL);
     /*0x2BF*/ DEFINE_HANDLER(CMSG_SET_ACTIONBAR_TOGGLES,
                              STATUS_AUTHED,
-                             PROCESS_THREADUNSAFE,
+                             PROCESS_THREADSAFE,
                              &WorldSession::HandleSetActionBarToggles);
     /*0x2C0*/ DEFINE_HANDLER(UMSG_DELETE_GUILD_CHARTER,
                              STATUS_NEVER,
@@ -2799,7 +2799,7 @@ void OpcodeTable::Initialize()
     /*0x38B*/ DEFINE_SERVER_OPCODE_HANDLER(SMSG_REALM_SPLIT, STATUS_NEVER);
     /*0x38C*/ DEFINE_HANDLER(CMSG_REALM_SPLIT,
                              STATUS_AUTHED,
-                             PROCESS_THREADUNSAFE,
+                             PROCESS_THREADSAFE,
                              &WorldSession::HandleRealmSplitOpcode);
     /*0x38D*/ DEFINE_HANDLER(CMSG_MOVE_CHNG_TRANSPORT,
                              STATUS_LOGGEDIN,
@@ -3895,7 +3895,7 @@ void OpcodeTable::Initialize()
                              &WorldSession::Handle_NULL);
     /*0x4FF*/ DEFINE_HANDLER(CMSG_READY_FOR_ACCOUNT_DATA_TIMES,
                              STATUS_AUTHED,
-                             PROCESS_THREADUNSAFE,
+                             PROCESS_THREADSAFE,
                              &WorldSession::HandleReadyForAccountDataTimes);
     /*0x500*/ DEFINE_HANDLER(CMSG_QUERY_QUESTS_COMPLETED,
                              STATUS_LOGGEDIN,
@@ -33,6 +33,8 @@
 #include "Hyperlinks.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "MessageBufferPool.h"
+#include "MovementPackets.h"
 #include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -41,9 +43,12 @@
 #include "PacketUtilities.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerStateJournal.h"
+#include "Profiler.h"
 #include "QueryHolder.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "WardenMac.h"
@@ -203,11 +208,14 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
     return GetPlayer() ? GetPlayer()->GetGUID().GetCounter() : 0;
 }
 
-/// Send a packet to the client
-void WorldSession::SendPacket(WorldPacket const* packet)
+/// Accounts a packet about to be sent, false if it must not be sent
+bool WorldSession::PrepareSendPacket(WorldPacket const& packet)
 {
     if (!m_Socket)
-        return;
+        return false;
+
+    if (_player && _player->IsInWorld())
+        _player->GetMap()->GetStats().AddPacket(packet.size());
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -224,10 +232,10 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
     if ((cur_time - lastTime) < 60) {
         sendPacketCount += 1;
-        sendPacketBytes += packet->size();
+        sendPacketBytes += packet.size();
 
         sendLastPacketCount += 1;
-        sendLastPacketBytes += packet->size();
+        sendLastPacketBytes += packet.size();
     }
     else {
         uint64 minTime  = uint64(cur_time - lastTime);
@@ -252,17 +260,31 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
         lastTime            = cur_time;
         sendLastPacketCount = 1;
-        sendLastPacketBytes = packet->wpos(); // wpos is real written size
+        sendLastPacketBytes = packet.wpos(); // wpos is real written size
     }
 #endif // !ACORE_DEBUG
 
-    if (!sScriptMgr->CanPacketSend(this, *packet)) {
+    return sScriptMgr->CanPacketSend(this, packet);
+}
+
+/// Send a packet to the client
+void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!PrepareSendPacket(*packet))
         return;
-    }
 
     m_Socket->SendPacket(*packet);
 }
 
+/// Send a packet shared with other sessions, the bytes are not copied
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!PrepareSendPacket(*packet))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -304,6 +326,8 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 {
+    AC_PROFILE_ZONE("WorldSession::Update");
+
     ///- Before we process anything:
     /// If necessary, kick the player because the client didn't send anything
     /// for too long (or they've been idling in character select)
@@ -328,13 +352,32 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     time_t                    currentTime = GameTime::GetGameTime().count();
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 150;
+    //! Expensive requests waiting for the handler budget, the ones received
+    //! beyond that are dropped
+    constexpr uint32 MAX_DEFERRED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 50;
+    uint32           deferredPackets = 0;
+
+    //! Take everything this update may process under a single queue lock
+    //! instead of locking once per packet, the filter is still evaluated in
+    //! order right before each packet is handled
+    std::vector<WorldPacket*> pendingPackets;
+    std::size_t               nextPacket = 0;
+    _recvQueue.drain(pendingPackets,
+                     MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE + 1);
+
+    while (m_Socket && nextPacket < pendingPackets.size() &&
+           updater.Process(pendingPackets[nextPacket])) {
+        packet = pendingPackets[nextPacket++];
 
-    while (m_Socket && _recvQueue.next(packet, updater)) {
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
 
         METRIC_DETAILED_TIMER("worldsession_update_opcode_time",
                               METRIC_TAG("opcode", opHandle->Name));
+        TimePoint opcodeStart = sTickProfiler->IsOpcodeProfilingEnabled() ||
+                                        AntiDOS.IsHandlerTimeBudgeted(opcode)
+                                    ? std::chrono::steady_clock::now()
+                                    : TimePoint();
         LOG_DEBUG(
             "network", "message id {} ({}) under READ", opcode, opHandle->Name);
 
@@ -361,7 +404,21 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     }
                 }
                 else if (_player->IsInWorld()) {
-                    if (AntiDOS.EvaluateOpcode(*packet, currentTime)) {
+                    if (AntiDOS.IsHandlerBudgetExhausted(opcode)) {
+                        if (deferredPackets <
+                            MAX_DEFERRED_PACKETS_IN_SAME_WORLDSESSION_UPDATE) {
+                            requeuePackets.push_back(packet);
+                            deletePacket = false;
+                            ++deferredPackets;
+                        }
+                        else
+                            LOG_DEBUG("network",
+                                      "Dropping {} from {}: handler budget "
+                                      "spent",
+                                      opHandle->Name,
+                                      GetPlayerInfo());
+                    }
+                    else if (AntiDOS.EvaluateOpcode(*packet, currentTime)) {
                         if (!sScriptMgr->CanPacketReceive(this, *packet)) {
                             break;
                         }
@@ -516,8 +573,19 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             }
         }
 
-        if (deletePacket)
+        if (opcodeStart != TimePoint()) {
+            Microseconds elapsed = std::chrono::duration_cast<Microseconds>(
+                std::chrono::steady_clock::now() - opcodeStart);
+            if (sTickProfiler->IsOpcodeProfilingEnabled())
+                sTickProfiler->RecordOpcode(opHandle->Name, elapsed);
+            if (deletePacket)
+                AntiDOS.ChargeHandlerTime(opcode, elapsed);
+        }
+
+        if (deletePacket) {
+            Acore::MessageBufferPool::Release(packet->Move());
             delete packet;
+        }
 
         deletePacket = true;
 
@@ -530,6 +598,11 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             break;
     }
 
+    // delayed packets go back first, followed by whatever was taken from the
+    // queue but not processed, so the original order is kept
+    requeuePackets.insert(requeuePackets.end(),
+                          pendingPackets.begin() + nextPacket,
+                          pendingPackets.end());
     _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
 
     METRIC_VALUE("processed_packets", processedPackets);
@@ -595,6 +668,11 @@ bool WorldSession::IsSocketClosed() const
     return !m_Socket || !m_Socket->IsOpen();
 }
 
+NetworkTraffic WorldSession::GetTraffic() const
+{
+    return m_Socket ? m_Socket->GetTraffic() : NetworkTraffic();
+}
+
 void WorldSession::HandleTeleportTimeout(bool updateInSessions)
 {
     // pussywizard: handle teleport ack timeout
@@ -762,6 +840,8 @@ void WorldSession::LogoutPlayer(bool save)
             }
             _player->SaveToDB(false, true);
         }
+        else
+            sPlayerStateJournal->ResetPlayer(_player->GetGUID().GetCounter());
 
         ///- Leave all channels before player delete...
         _player->CleanupChannels();
@@ -1103,48 +1183,21 @@ void WorldSession::SaveTutorialsData(CharacterDatabaseTransaction trans)
 
 void WorldSession::ReadMovementInfo(WorldPacket& data, MovementInfo* mi)
 {
-    data >> mi->flags;
-    data >> mi->flags2;
-    data >> mi->time;
-    data >> mi->pos.PositionXYZOStream();
-
-    if (mi->HasMovementFlag(MOVEMENTFLAG_ONTRANSPORT)) {
-        data >> mi->transport.guid.ReadAsPacked();
-
-        data >> mi->transport.pos.PositionXYZOStream();
-        data >> mi->transport.time;
-        data >> mi->transport.seat;
-
-        if (mi->HasExtraMovementFlag(MOVEMENTFLAG2_INTERPOLATED_MOVEMENT))
-            data >> mi->transport.time2;
-    }
-
-    if (mi->HasMovementFlag(
-            MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) ||
-        (mi->HasExtraMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING)))
-        data >> mi->pitch;
-
-    data >> mi->fallTime;
-
-    if (mi->HasMovementFlag(MOVEMENTFLAG_FALLING)) {
-        data >> mi->jump.zspeed;
-        data >> mi->jump.sinAngle;
-        data >> mi->jump.cosAngle;
-        data >> mi->jump.xyspeed;
-    }
-
-    if (mi->HasMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION))
-        data >> mi->splineElevation;
+    WorldPackets::Movement::ReadMovementInfo(data, *mi);
+    ValidateMovementInfo(mi);
+}
 
-        //! Anti-cheat checks. Please keep them in seperate if() blocks to
-        //! maintain a clear overview. Might be subject to latency, so just
-        //! remove improper flags.
+void WorldSession::ValidateMovementInfo(MovementInfo* mi)
+{
+    //! Anti-cheat checks. Please keep them in seperate if() blocks to
+    //! maintain a clear overview. Might be subject to latency, so just
+    //! remove improper flags.
 #ifdef ACORE_DEBUG
 #define REMOVE_VIOLATING_FLAGS(check, maskToRemove)                            \
     {                                                                          \
         if (check) {                                                           \
             LOG_DEBUG("entities.unit",                                         \
-                      "WorldSession::ReadMovementInfo: Violation of "          \
+                      "WorldSession::ValidateMovementInfo: Violation of "      \
                       "MovementFlags found ({}). "                             \
                       "MovementFlags: {}, MovementFlags2: {} for player {}. "  \
                       "Mask {} will be removed.",                              \
@@ -1837,8 +1890,69 @@ WorldSession::DosProtection::GetMaxPacketCounterAllowed(uint16 opcode) const
 
 WorldSession::DosProtection::DosProtection(WorldSession* s)
     : Session(s),
-      _policy((Policy)sWorld->getIntConfig(CONFIG_PACKET_SPOOF_POLICY))
+      _policy((Policy)sWorld->getIntConfig(CONFIG_PACKET_SPOOF_POLICY)),
+      _handlerBudgetRate(
+          sWorld->getIntConfig(CONFIG_PACKET_SPOOF_HANDLER_BUDGET)),
+      _handlerBudget(_handlerBudgetRate),
+      _handlerBudgetRefillTime(std::chrono::steady_clock::now())
+{
+}
+
+bool WorldSession::DosProtection::IsHandlerTimeBudgeted(uint16 opcode) const
+{
+    if (!_handlerBudgetRate)
+        return false;
+
+    switch (opcode) {
+    case CMSG_AUCTION_LIST_ITEMS:
+    case CMSG_AUCTION_LIST_BIDDER_ITEMS:
+    case CMSG_AUCTION_LIST_OWNER_ITEMS:
+    case CMSG_AUCTION_LIST_PENDING_SALES:
+    case CMSG_WHO:
+    case CMSG_GUILD_ROSTER:
+    case CMSG_GUILD_BANK_QUERY_TAB:
+    case CMSG_ARENA_TEAM_ROSTER:
+    case CMSG_CALENDAR_GET_CALENDAR:
+    case CMSG_QUERY_INSPECT_ACHIEVEMENTS:
+    case CMSG_ITEM_QUERY_SINGLE:
+    case CMSG_ITEM_NAME_QUERY:
+    case CMSG_CREATURE_QUERY:
+    case CMSG_GAMEOBJECT_QUERY:
+    case CMSG_QUEST_QUERY:
+    case CMSG_QUEST_POI_QUERY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool WorldSession::DosProtection::IsHandlerBudgetExhausted(uint16 opcode) const
+{
+    if (!IsHandlerTimeBudgeted(opcode))
+        return false;
+
+    TimePoint now = std::chrono::steady_clock::now();
+    int64     refill =
+        std::chrono::duration_cast<Microseconds>(now - _handlerBudgetRefillTime)
+            .count() *
+        _handlerBudgetRate / 1000000;
+
+    // keep the remainder for the next call when less than a microsecond of
+    // budget was earned
+    if (refill > 0) {
+        _handlerBudget =
+            std::min<int64>(_handlerBudget + refill, _handlerBudgetRate);
+        _handlerBudgetRefillTime = now;
+    }
+
+    return _handlerBudget <= 0;
+}
+
+void WorldSession::DosProtection::ChargeHandlerTime(uint16       opcode,
+                                                    Microseconds elapsed) const
 {
+    if (IsHandlerTimeBudgeted(opcode))
+        _handlerBudget -= elapsed.count();
 }
 
 void WorldSession::ResetTimeSync()
@@ -31,6 +31,7 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "GossipDef.h"
+#include "NetworkStats.h"
 #include "Packet.h"
 #include "SharedDefines.h"
 #include "World.h"
@@ -142,6 +143,10 @@ namespace Misc {
 class RandomRollClient;
 }
 
+namespace Movement {
+class ClientPlayerMovement;
+}
+
 namespace Pet {
 class DismissCritter;
 class PetAbandon;
@@ -331,9 +336,11 @@ public:
     void SendAddonsInfo();
 
     void ReadMovementInfo(WorldPacket& data, MovementInfo* mi);
+    void ValidateMovementInfo(MovementInfo* mi);
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
     void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
     void SendNotification(uint32 string_id, ...);
     void SendPetNameInvalid(uint32             error,
@@ -526,6 +533,9 @@ public:
     uint32 GetLatency() const { return m_latency; }
     void   SetLatency(uint32 latency) { m_latency = latency; }
 
+    // outbound traffic of the current connection
+    NetworkTraffic GetTraffic() const;
+
     std::atomic<time_t> m_timeOutTime;
     void                UpdateTimeOutTime(uint32 diff)
     {
@@ -697,7 +707,8 @@ public:                                  // opcodes handlers
     void HandleMoveWorldportAckOpcode(WorldPacket& recvPacket);
     void HandleMoveWorldportAck(); // for server-side calls
 
-    void HandleMovementOpcodes(WorldPacket& recvPacket);
+    void HandleMovementOpcodes(
+        WorldPackets::Movement::ClientPlayerMovement& packet);
     void HandleSetActiveMoverOpcode(WorldPacket& recvData);
     void HandleMoveNotActiveMover(WorldPacket& recvData);
     void HandleDismissControlledVehicle(WorldPacket& recvData);
@@ -1192,6 +1203,12 @@ protected:
         DosProtection(WorldSession* s);
         bool EvaluateOpcode(WorldPacket& p, time_t time) const;
 
+        // expensive requests share a budget of handler time per session, the
+        // ones received while it is spent wait for it to refill
+        [[nodiscard]] bool IsHandlerTimeBudgeted(uint16 opcode) const;
+        bool               IsHandlerBudgetExhausted(uint16 opcode) const;
+        void ChargeHandlerTime(uint16 opcode, Microseconds elapsed) const;
+
     protected:
         enum Policy { POLICY_LOG, POLICY_KICK, POLICY_BAN };
 
@@ -1206,6 +1223,13 @@ protected:
         // functions
         mutable PacketThrottlingMap _PacketThrottlingMap;
 
+        // handler time per second allowed for budgeted opcodes, 0 disables
+        uint32 _handlerBudgetRate;
+        // microseconds left, negative after a request that cost more than
+        // what was left
+        mutable int64     _handlerBudget;
+        mutable TimePoint _handlerBudgetRefillTime;
+
         DosProtection(DosProtection const& right)            = delete;
         DosProtection& operator=(DosProtection const& right) = delete;
     } AntiDOS;
@@ -1224,6 +1248,8 @@ private:
                              const char*  reason);
     void LogUnprocessedTail(WorldPacket* packet);
 
+    bool PrepareSendPacket(WorldPacket const& packet);
+
     // EnumData helpers
     bool IsLegitCharacterForAccount(ObjectGuid guid)
     {
@@ -24,6 +24,7 @@
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "IPLocation.h"
+#include "MessageBufferPool.h"
 #include "Opcodes.h"
 #include "PacketLog.h"
 #include "Random.h"
@@ -36,73 +37,137 @@
 
 using boost::asio::ip::tcp;
 
-void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
-{
-    z_stream c_stream;
+namespace {
+// Deflate state of a network thread, initialized once and reset for every
+// packet instead of paying deflateInit/deflateEnd per packet
+class DeflateContext {
+public:
+    DeflateContext() : _stream(), _level(0), _initialized(false) {}
+
+    ~DeflateContext() { Release(); }
+
+    DeflateContext(DeflateContext const&)            = delete;
+    DeflateContext& operator=(DeflateContext const&) = delete;
+
+    z_stream* Acquire(int level)
+    {
+        int z_res = Z_OK;
+        if (!_initialized) {
+            _stream        = z_stream();
+            _stream.zalloc = (alloc_func)0;
+            _stream.zfree  = (free_func)0;
+            _stream.opaque = (voidpf)0;
+
+            z_res = deflateInit(&_stream, level);
+            if (z_res != Z_OK) {
+                LOG_ERROR("entities.object",
+                          "Can't compress update packet (zlib: deflateInit) "
+                          "Error code: {} ({})",
+                          z_res,
+                          zError(z_res));
+                return nullptr;
+            }
+
+            _initialized = true;
+            _level       = level;
+            return &_stream;
+        }
+
+        z_res = deflateReset(&_stream);
+        if (z_res == Z_OK && level != _level) {
+            // nothing is pending after a reset, so this can't need a flush
+            z_res  = deflateParams(&_stream, level, Z_DEFAULT_STRATEGY);
+            _level = level;
+        }
+
+        if (z_res != Z_OK) {
+            LOG_ERROR("entities.object",
+                      "Can't compress update packet (zlib: deflateReset) "
+                      "Error code: {} ({})",
+                      z_res,
+                      zError(z_res));
+            Release();
+            return nullptr;
+        }
+
+        return &_stream;
+    }
+
+    // Drops a stream left in an unknown state, the next packet starts over
+    void Release()
+    {
+        if (_initialized)
+            deflateEnd(&_stream);
 
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree  = (free_func)0;
-    c_stream.opaque = (voidpf)0;
+        _initialized = false;
+    }
+
+private:
+    z_stream _stream;
+    int      _level;
+    bool     _initialized;
+};
+
+thread_local DeflateContext deflateContext;
+
+int GetCompressionLevel(int src_size)
+{
+    uint32 const largePacketSize =
+        sWorld->getIntConfig(CONFIG_COMPRESSION_LARGE_PACKET_SIZE);
+    if (largePacketSize && uint32(src_size) >= largePacketSize)
+        return sWorld->getIntConfig(CONFIG_COMPRESSION_LARGE_PACKET_LEVEL);
 
     // default Z_BEST_SPEED (1)
-    int z_res =
-        deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK) {
-        LOG_ERROR("entities.object",
-                  "Can't compress update packet (zlib: deflateInit) Error "
-                  "code: {} ({})",
-                  z_res,
-                  zError(z_res));
+    return sWorld->getIntConfig(CONFIG_COMPRESSION);
+}
+} // namespace
+
+void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
+{
+    z_stream* c_stream = deflateContext.Acquire(GetCompressionLevel(src_size));
+    if (!c_stream) {
         *dst_size = 0;
         return;
     }
 
-    c_stream.next_out  = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in   = (Bytef*)src;
-    c_stream.avail_in  = (uInt)src_size;
+    c_stream->next_out  = (Bytef*)dst;
+    c_stream->avail_out = *dst_size;
+    c_stream->next_in   = (Bytef*)src;
+    c_stream->avail_in  = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
+    int z_res = deflate(c_stream, Z_NO_FLUSH);
     if (z_res != Z_OK) {
         LOG_ERROR(
             "entities.object",
             "Can't compress update packet (zlib: deflate) Error code: {} ({})",
             z_res,
             zError(z_res));
+        deflateContext.Release();
         *dst_size = 0;
         return;
     }
 
-    if (c_stream.avail_in != 0) {
+    if (c_stream->avail_in != 0) {
         LOG_ERROR("entities.object",
                   "Can't compress update packet (zlib: deflate not greedy)");
+        deflateContext.Release();
         *dst_size = 0;
         return;
     }
 
-    z_res = deflate(&c_stream, Z_FINISH);
+    z_res = deflate(c_stream, Z_FINISH);
     if (z_res != Z_STREAM_END) {
         LOG_ERROR("entities.object",
                   "Can't compress update packet (zlib: deflate should report "
                   "Z_STREAM_END instead {} ({})",
                   z_res,
                   zError(z_res));
+        deflateContext.Release();
         *dst_size = 0;
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK) {
-        LOG_ERROR("entities.object",
-                  "Can't compress update packet (zlib: deflateEnd) Error code: "
-                  "{} ({})",
-                  z_res,
-                  zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    *dst_size = c_stream.total_out;
+    *dst_size = c_stream->total_out;
 }
 
 void EncryptableAndCompressiblePacket::CompressIfNeeded()
@@ -110,7 +175,8 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     if (!NeedsCompression())
         return;
 
-    uint32 pSize = size();
+    ByteBuffer const& payload = GetPayload();
+    uint32            pSize   = payload.size();
 
     uint32     destsize = compressBound(pSize);
     ByteBuffer buf(destsize + sizeof(uint32));
@@ -119,7 +185,7 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     buf.put<uint32>(0, pSize);
     compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32),
                  &destsize,
-                 (void*)contents(),
+                 (void*)payload.contents(),
                  pSize);
     if (destsize == 0)
         return;
@@ -128,11 +194,23 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
 
     ByteBuffer::operator=(std::move(buf));
     SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    _shared.reset();
+}
+
+MessageBuffer EncryptableAndCompressiblePacket::MovePayload()
+{
+    if (!_shared)
+        return MessageBuffer(Move());
+
+    uint8 const*      data = _shared->contents();
+    std::size_t const size = _shared->size();
+    return MessageBuffer(std::move(_shared), data, size);
 }
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
     : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr),
-      _authed(false), _sendBufferSize(4096)
+      _authed(false), _sendBufferSize(4096), _sentPackets(0), _rawBytes(0),
+      _sentBytes(0)
 {
     Acore::Crypto::GetRandomBytes(_authSeed);
     _headerBuffer.Resize(sizeof(ClientPktHeader));
@@ -183,47 +261,60 @@ bool WorldSocket::Update()
 {
     EncryptableAndCompressiblePacket* queued;
     if (_bufferQueue.Dequeue(queued)) {
-        // Allocate buffer only when it's needed but not on every Update() call.
-        MessageBuffer buffer(_sendBufferSize);
-        std::size_t   currentPacketSize;
+        // Small packets are copied next to each other into shared buffers,
+        // larger payloads are queued as they are and sent with the same
+        // gathered write. Buffers are only allocated when they are needed.
+        MessageBuffer buffer(0);
+        uint64        packets = 0, rawBytes = 0, sentBytes = 0;
         do {
+            uint16 const      opcode  = queued->GetOpcode();
+            std::size_t const rawSize = queued->GetPayload().size();
+
             queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            ByteBuffer const& payload = queued->GetPayload();
+            ServerPktHeader   header(payload.size() + 2, queued->GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            bool const zeroCopy = payload.size() >= ZERO_COPY_PACKET_SIZE;
+
+            std::size_t const currentPacketSize =
+                header.getHeaderLength() + (zeroCopy ? 0 : payload.size());
+
+            std::size_t const sentSize =
+                header.getHeaderLength() + payload.size();
+            sNetworkStats->AddPacket(
+                opcode, header.getHeaderLength() + rawSize, sentSize);
+            ++packets;
+            rawBytes += header.getHeaderLength() + rawSize;
+            sentBytes += sentSize;
 
             if (buffer.GetRemainingSpace() < currentPacketSize) {
-                QueuePacket(std::move(buffer));
-                buffer.Resize(_sendBufferSize);
-            }
+                if (buffer.GetActiveSize() > 0)
+                    QueuePacket(std::move(buffer));
 
-            if (buffer.GetRemainingSpace() >= currentPacketSize) {
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                buffer.Reset();
+                buffer.Resize(std::max(_sendBufferSize, currentPacketSize));
             }
-            else // Single packet larger than current buffer size
-            {
-                // Resize buffer to fit current packet
-                buffer.Resize(currentPacketSize);
-
-                // Grow future buffers to current packet size if still below
-                // limit
-                if (currentPacketSize <= 65536)
-                    _sendBufferSize = currentPacketSize;
-
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+
+            buffer.Write(header.header, header.getHeaderLength());
+
+            if (zeroCopy) {
+                QueuePacket(std::move(buffer));
+                QueuePacket(queued->MovePayload());
             }
+            else if (!payload.empty())
+                buffer.Write(payload.contents(), payload.size());
 
             delete queued;
         } while (_bufferQueue.Dequeue(queued));
 
         if (buffer.GetActiveSize() > 0)
             QueuePacket(std::move(buffer));
+
+        _sentPackets.fetch_add(packets, std::memory_order_relaxed);
+        _rawBytes.fetch_add(rawBytes, std::memory_order_relaxed);
+        _sentBytes.fetch_add(sentBytes, std::memory_order_relaxed);
     }
 
     if (!BaseSocket::Update())
@@ -234,6 +325,15 @@ bool WorldSocket::Update()
     return true;
 }
 
+NetworkTraffic WorldSocket::GetTraffic() const
+{
+    NetworkTraffic traffic;
+    traffic.Packets   = _sentPackets.load(std::memory_order_relaxed);
+    traffic.RawBytes  = _rawBytes.load(std::memory_order_relaxed);
+    traffic.SentBytes = _sentBytes.load(std::memory_order_relaxed);
+    return traffic;
+}
+
 void WorldSocket::HandleSendAuthSession()
 {
     WorldPacket packet(SMSG_AUTH_CHALLENGE, 40);
@@ -337,7 +437,12 @@ bool WorldSocket::ReadHeaderHandler()
     }
 
     header->size -= sizeof(header->cmd);
-    _packetBuffer.Resize(header->size);
+
+    // storage recycled from handled packets, it moves into the WorldPacket
+    // once the payload is complete
+    _packetBuffer =
+        MessageBuffer(Acore::MessageBufferPool::Acquire(header->size));
+    _packetBuffer.Reset();
 
     return true;
 }
@@ -564,6 +669,19 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(
+            *packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(
+        packet, _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
 {
     std::shared_ptr<AuthSession> authSession = std::make_shared<AuthSession>();
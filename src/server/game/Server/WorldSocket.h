@@ -22,6 +22,7 @@
 #include "AuthCrypt.h"
 #include "Common.h"
 #include "MPSCQueue.h"
+#include "NetworkStats.h"
 #include "ServerPktHeader.h"
 #include "Socket.h"
 #include "Util.h"
@@ -39,19 +40,38 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // Refers to a packet queued on several sockets instead of copying it
+    EncryptableAndCompressiblePacket(
+        std::shared_ptr<WorldPacket const> packet, bool encrypt)
+        : WorldPacket(packet->GetOpcode(), 0), _shared(std::move(packet)),
+          _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
 
     bool NeedsCompression() const
     {
-        return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100;
+        return GetOpcode() == SMSG_UPDATE_OBJECT && GetPayload().size() > 100;
     }
 
     void CompressIfNeeded();
 
+    /// bytes to send, the shared packet until it is replaced by compression
+    ByteBuffer const& GetPayload() const
+    {
+        return _shared ? *_shared : *this;
+    }
+
+    /// hands the payload to the socket write queue without copying it
+    MessageBuffer MovePayload();
+
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
-    bool _encrypt;
+    std::shared_ptr<WorldPacket const> _shared;
+    bool                               _encrypt;
 };
 
 namespace WorldPackets {
@@ -84,12 +104,16 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize)
     {
         _sendBufferSize = sendBufferSize;
     }
 
+    /// outbound traffic of this socket, safe to call from any thread
+    NetworkTraffic GetTraffic() const;
+
 protected:
     void OnClose() override;
     void ReadHandler() override;
@@ -100,6 +124,9 @@ protected:
     ReadDataHandlerResult ReadDataHandler();
 
 private:
+    /// payloads of at least this size are sent without copying them
+    static constexpr std::size_t ZERO_COPY_PACKET_SIZE = 1024;
+
     void CheckIpCallback(PreparedQueryResult result);
 
     /// writes network.opcode log
@@ -136,6 +163,10 @@ private:
                 _bufferQueue;
     std::size_t _sendBufferSize;
 
+    std::atomic<uint64> _sentPackets;
+    std::atomic<uint64> _rawBytes;
+    std::atomic<uint64> _sentBytes;
+
     QueryCallbackProcessor _queryProcessor;
     std::string            _ipCountry;
 };
@@ -19,6 +19,7 @@
 #include "WorldSocketMgr.h"
 #include "Config.h"
 #include "NetworkThread.h"
+#include "ProcessPriority.h"
 #include "ScriptMgr.h"
 #include "WorldSocket.h"
 #include <boost/system/error_code.hpp>
@@ -55,6 +56,10 @@ bool WorldSocketMgr::StartWorldNetwork(Acore::Asio::IoContext& ioContext,
                                        int                     threadCount)
 {
     _tcpNoDelay = sConfigMgr->GetOption<bool>("Network.TcpNodelay", true);
+    _acceptorPerThread =
+        sConfigMgr->GetOption<bool>("Network.ReusePort", false);
+    _threadProcessors = ParseProcessorList(
+        sConfigMgr->GetOption<std::string>("Network.Threads.Affinity", ""));
 
     int const max_connections = ACORE_MAX_LISTEN_CONNECTIONS;
     LOG_DEBUG("network", "Max allowed socket connections {}", max_connections);
@@ -73,7 +78,7 @@ bool WorldSocketMgr::StartWorldNetwork(Acore::Asio::IoContext& ioContext,
     if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
         return false;
 
-    _acceptor->AsyncAcceptWithCallback<&WorldSocketMgr::OnSocketAccept>();
+    AsyncAcceptWithCallback<&WorldSocketMgr::OnSocketAccept>();
 
     sScriptMgr->OnNetworkStart();
     return true;
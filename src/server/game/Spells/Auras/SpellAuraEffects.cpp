@@ -1356,6 +1356,20 @@ void AuraEffect::Update(uint32 diff, Unit* caster)
             m_periodicTimer += m_amplitude;
             UpdatePeriodic(caster);
 
+            // most periodic auras have a single target, tick it without
+            // copying the application map (removed applications are only
+            // deleted after the owner update, the pointer stays valid)
+            Aura::ApplicationMap const& targetMap =
+                GetBase()->GetApplicationMap();
+            if (targetMap.size() <= 1) {
+                if (!targetMap.empty()) {
+                    AuraApplication* aurApp = targetMap.begin()->second;
+                    if (aurApp->HasEffect(GetEffIndex()))
+                        PeriodicTick(aurApp, caster);
+                }
+                continue;
+            }
+
             std::list<AuraApplication*> effectApplications;
             GetApplicationList(effectApplications);
             // tick on targets of effects
@@ -1781,8 +1795,8 @@ void AuraEffect::HandleShapeshiftBoosts(Unit* target, bool apply) const
             for (PlayerSpellMap::const_iterator itr = sp_list.begin();
                  itr != sp_list.end();
                  ++itr) {
-                if (itr->second->State == PLAYERSPELL_REMOVED ||
-                    !itr->second->IsInSpec(player->GetActiveSpec()))
+                if (itr->second.State == PLAYERSPELL_REMOVED ||
+                    !itr->second.IsInSpec(player->GetActiveSpec()))
                     continue;
 
                 if (itr->first == spellId || itr->first == spellId2)
@@ -2644,8 +2658,8 @@ void AuraEffect::HandleAuraModShapeshift(AuraApplication const* aurApp,
                 for (PlayerSpellMap::const_iterator itr = sp_list.begin();
                      itr != sp_list.end();
                      ++itr) {
-                    if (itr->second->State == PLAYERSPELL_REMOVED ||
-                        !itr->second->IsInSpec(
+                    if (itr->second.State == PLAYERSPELL_REMOVED ||
+                        !itr->second.IsInSpec(
                             target->ToPlayer()->GetActiveSpec()))
                         continue;
 
@@ -53,7 +53,7 @@ AuraApplication::AuraApplication(Unit* target,
                                  uint8 effMask)
     : _target(target), _base(aura), _removeMode(AURA_REMOVE_NONE),
       _slot(MAX_AURAS), _flags(AFLAG_NONE), _effectsToApply(effMask),
-      _needClientUpdate(false), _disableMask(0)
+      _needClientUpdate(false), _disableMask(0), _procTriggerMask(0)
 {
     ASSERT(GetTarget() && GetBase());
 
@@ -2497,8 +2497,9 @@ bool Aura::IsProcTriggeredOnEvent(AuraApplication* aurApp,
         return false;
 
     // do checks using conditions table
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(
-        CONDITION_SOURCE_TYPE_SPELL_PROC, GetId());
+    ConditionList const& conditions =
+        sConditionMgr->GetConditionsForNotGroupedEntry(
+            CONDITION_SOURCE_TYPE_SPELL_PROC, GetId());
     ConditionSourceInfo condInfo =
         ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
     if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
@@ -56,6 +56,10 @@ private:
     // xinef: stacking
     uint8 _disableMask;
 
+    // proc flags this application can trigger at, see
+    // Unit::GetAuraProcTriggerMask
+    uint32 _procTriggerMask;
+
     explicit AuraApplication(Unit* target,
                              Unit* caster,
                              Aura* base,
@@ -87,6 +91,8 @@ public:
     uint8 GetEffectsToApply() const { return _effectsToApply; }
 
     void           SetRemoveMode(AuraRemoveMode mode) { _removeMode = mode; }
+    uint32 GetProcTriggerMask() const { return _procTriggerMask; }
+    void   SetProcTriggerMask(uint32 mask) { _procTriggerMask = mask; }
     AuraRemoveMode GetRemoveMode() const { return _removeMode; }
 
     void SetNeedClientUpdate() { _needClientUpdate = true; }
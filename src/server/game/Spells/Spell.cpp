@@ -39,6 +39,7 @@
 #include "Opcodes.h"
 #include "Pet.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "SharedDefines.h"
 #include "SpellAuraEffects.h"
@@ -1374,7 +1375,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex                  effIndex,
         break;
     case TARGET_REFERENCE_TYPE_LAST: {
         // find last added target for this effect
-        for (std::list<TargetInfo>::reverse_iterator ihit =
+        for (TargetInfoList::reverse_iterator ihit =
                  m_UniqueTargetInfo.rbegin();
              ihit != m_UniqueTargetInfo.rend();
              ++ihit) {
@@ -2764,7 +2765,7 @@ void Spell::AddUnitTarget(Unit*  target,
     ObjectGuid targetGUID = target->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit) {
         if (targetGUID == ihit->targetGUID) // Found in list
@@ -2912,7 +2913,7 @@ void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
     ObjectGuid targetGUID = go->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin();
+    for (GOTargetInfoList::iterator ihit = m_UniqueGOTargetInfo.begin();
          ihit != m_UniqueGOTargetInfo.end();
          ++ihit) {
         if (targetGUID == ihit->targetGUID) // Found in list
@@ -2958,7 +2959,7 @@ void Spell::AddItemTarget(Item* item, uint32 effectMask)
         return;
 
     // Lookup target in already in list
-    for (std::list<ItemTargetInfo>::iterator ihit = m_UniqueItemInfo.begin();
+    for (ItemTargetInfoList::iterator ihit = m_UniqueItemInfo.begin();
          ihit != m_UniqueItemInfo.end();
          ++ihit) {
         if (item == ihit->item) // Found in list
@@ -3967,7 +3968,7 @@ bool Spell::UpdateChanneledTargetList()
         range += std::min(3.0f, range * 0.1f); // 10% but no more than 3yd
     }
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit) {
         if (ihit->missCondition == SPELL_MISS_NONE &&
@@ -4011,7 +4012,7 @@ bool Spell::UpdateChanneledTargetList()
 
     // Xinef: not all effects are covered, remove applications from all targets
     if (channelTargetEffectMask != 0) {
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
              ihit != m_UniqueTargetInfo.end();
              ++ihit)
             if (ihit->missCondition == SPELL_MISS_NONE &&
@@ -4035,6 +4036,8 @@ bool Spell::UpdateChanneledTargetList()
 SpellCastResult Spell::prepare(SpellCastTargets const* targets,
                                AuraEffect const*       triggeredByAura)
 {
+    AC_PROFILE_ZONE("Spell::prepare");
+
     if (m_CastItem) {
         m_castItemGUID = m_CastItem->GetGUID();
     }
@@ -4342,7 +4345,7 @@ void Spell::cancel(bool bySelf)
 
     case SPELL_STATE_CASTING:
         if (!bySelf) {
-            for (std::list<TargetInfo>::const_iterator ihit =
+            for (TargetInfoList::const_iterator ihit =
                      m_UniqueTargetInfo.begin();
                  ihit != m_UniqueTargetInfo.end();
                  ++ihit)
@@ -4401,6 +4404,8 @@ void Spell::cancel(bool bySelf)
 
 void Spell::cast(bool skipCheck)
 {
+    AC_PROFILE_ZONE("Spell::cast");
+
     Player* modOwner = m_caster->GetSpellModOwner();
     Spell*  lastMod  = nullptr;
     if (modOwner) {
@@ -4608,7 +4613,7 @@ void Spell::_cast(bool skipCheck)
 
         uint32 procEx = PROC_EX_NORMAL_HIT;
 
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
              ihit != m_UniqueTargetInfo.end();
              ++ihit) {
             if (ihit->missCondition != SPELL_MISS_NONE) {
@@ -4798,12 +4803,12 @@ void Spell::handle_immediate()
     // variables
     _handle_immediate_phase();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit)
         DoAllEffectOnTarget(&(*ihit));
 
-    for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin();
+    for (GOTargetInfoList::iterator ihit = m_UniqueGOTargetInfo.begin();
          ihit != m_UniqueGOTargetInfo.end();
          ++ihit)
         DoAllEffectOnTarget(&(*ihit));
@@ -4855,7 +4860,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
     // now recheck units targeting correctness (need before any effects apply to
     // prevent adding immunity at first effect not allow apply second spell
     // effect and similar cases)
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit) {
         if (ihit->processed == false) {
@@ -4869,7 +4874,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
     }
 
     // now recheck gameobject targeting correctness
-    for (std::list<GOTargetInfo>::iterator ighit = m_UniqueGOTargetInfo.begin();
+    for (GOTargetInfoList::iterator ighit = m_UniqueGOTargetInfo.begin();
          ighit != m_UniqueGOTargetInfo.end();
          ++ighit) {
         if (ighit->processed == false) {
@@ -4924,7 +4929,7 @@ void Spell::_handle_immediate_phase()
     }
 
     // process items
-    for (std::list<ItemTargetInfo>::iterator ihit = m_UniqueItemInfo.begin();
+    for (ItemTargetInfoList::iterator ihit = m_UniqueItemInfo.begin();
          ihit != m_UniqueItemInfo.end();
          ++ihit)
         DoAllEffectOnTarget(&(*ihit));
@@ -4955,7 +4960,7 @@ void Spell::_handle_finish_phase()
 
     if (!IsAutoRepeat() && !IsNextMeleeSwingSpell())
         if (m_caster->GetCharmerOrOwnerPlayerOrPlayerItself())
-            for (std::list<TargetInfo>::iterator ihit =
+            for (TargetInfoList::iterator ihit =
                      m_UniqueTargetInfo.begin();
                  ihit != m_UniqueTargetInfo.end();
                  ++ihit) {
@@ -4985,7 +4990,7 @@ void Spell::_handle_finish_phase()
         }
 
         uint32 procEx = PROC_EX_NORMAL_HIT;
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
              ihit != m_UniqueTargetInfo.end();
              ++ihit) {
             if (ihit->missCondition != SPELL_MISS_NONE) {
@@ -5694,7 +5699,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
 {
     // This function also fill data for channeled spells:
     // m_needAliveTargetMask req for stop channelig if one target die
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit) {
         if ((*ihit).effectMask == 0) // No effect apply - all immuned add state
@@ -5712,7 +5717,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
     uint32 hit    = 0;
     size_t hitPos = data->wpos();
     *data << (uint8)0; // placeholder
-    for (std::list<TargetInfo>::const_iterator ihit =
+    for (TargetInfoList::const_iterator ihit =
              m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end() && hit < 255;
          ++ihit) {
@@ -5725,7 +5730,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
         }
     }
 
-    for (std::list<GOTargetInfo>::const_iterator ighit =
+    for (GOTargetInfoList::const_iterator ighit =
              m_UniqueGOTargetInfo.begin();
          ighit != m_UniqueGOTargetInfo.end() && hit < 255;
          ++ighit) {
@@ -5736,7 +5741,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
     uint32 miss    = 0;
     size_t missPos = data->wpos();
     *data << (uint8)0; // placeholder
-    for (std::list<TargetInfo>::const_iterator ihit =
+    for (TargetInfoList::const_iterator ihit =
              m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end() && miss < 255;
          ++ihit) {
@@ -6037,7 +6042,7 @@ void Spell::TakePower()
         if (PowerType == POWER_RAGE || PowerType == POWER_ENERGY ||
             PowerType == POWER_RUNE || PowerType == POWER_RUNIC_POWER)
             if (ObjectGuid targetGUID = m_targets.GetUnitTargetGUID())
-                for (std::list<TargetInfo>::iterator ihit =
+                for (TargetInfoList::iterator ihit =
                          m_UniqueTargetInfo.begin();
                      ihit != m_UniqueTargetInfo.end();
                      ++ihit)
@@ -6324,7 +6329,7 @@ void Spell::HandleThreatSpells()
     // targets, so the overall caused threat is at most the defined bonus
     threat /= m_UniqueTargetInfo.size();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit) {
         float threatToAdd = threat;
@@ -6623,7 +6628,7 @@ SpellCastResult Spell::CheckCast(bool strict)
     {
         ConditionSourceInfo condInfo  = ConditionSourceInfo(m_caster);
         condInfo.mConditionTargets[1] = m_targets.GetObjectTarget();
-        ConditionList conditions =
+        ConditionList const& conditions =
             sConditionMgr->GetConditionsForNotGroupedEntry(
                 CONDITION_SOURCE_TYPE_SPELL, m_spellInfo->Id);
         if (!conditions.empty() &&
@@ -7933,7 +7938,7 @@ bool Spell::CanAutoCast(Unit* target)
         SelectSpellTargets();
         // check if among target units, our WANTED target is as well (->only
         // self cast spells return false)
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
              ihit != m_UniqueTargetInfo.end();
              ++ihit)
             if (ihit->targetGUID == targetguid)
@@ -8806,7 +8811,7 @@ void Spell::DelayedChannel()
               delaytime,
               m_timer);
 
-    for (std::list<TargetInfo>::const_iterator ihit =
+    for (TargetInfoList::const_iterator ihit =
              m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit)
@@ -9084,20 +9089,20 @@ bool Spell::IsNeedSendToClient(bool go) const
 
 bool Spell::HaveTargetsForEffect(uint8 effect) const
 {
-    for (std::list<TargetInfo>::const_iterator itr = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::const_iterator itr = m_UniqueTargetInfo.begin();
          itr != m_UniqueTargetInfo.end();
          ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<GOTargetInfo>::const_iterator itr =
+    for (GOTargetInfoList::const_iterator itr =
              m_UniqueGOTargetInfo.begin();
          itr != m_UniqueGOTargetInfo.end();
          ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<ItemTargetInfo>::const_iterator itr =
+    for (ItemTargetInfoList::const_iterator itr =
              m_UniqueItemInfo.begin();
          itr != m_UniqueItemInfo.end();
          ++itr)
@@ -9247,7 +9252,7 @@ void Spell::HandleLaunchPhase()
 
     PrepareTargetProcessing();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
          ihit != m_UniqueTargetInfo.end();
          ++ihit) {
         TargetInfo& target = *ihit;
@@ -10152,17 +10157,24 @@ WorldObjectSpellAreaTargetCheck::WorldObjectSpellAreaTargetCheck(
 
 bool WorldObjectSpellAreaTargetCheck::operator()(WorldObject* target)
 {
-    if (target->GetTypeId() == TYPEID_GAMEOBJECT) {
-        if (!target->ToGameObject()->IsInRange(_position->GetPositionX(),
-                                               _position->GetPositionY(),
-                                               _position->GetPositionZ(),
-                                               _range))
-            return false;
-    }
-    else if (!target->IsWithinDist3d(_position, _range))
-        return false;
-    else if (target->GetTypeId() == TYPEID_UNIT &&
-             target->ToCreature()->IsAvoidingAOE()) // pussywizard
+    return IsInRange(target) && IsValidAreaTarget(target);
+}
+
+bool WorldObjectSpellAreaTargetCheck::IsInRange(WorldObject* target) const
+{
+    if (target->GetTypeId() == TYPEID_GAMEOBJECT)
+        return target->ToGameObject()->IsInRange(_position->GetPositionX(),
+                                                 _position->GetPositionY(),
+                                                 _position->GetPositionZ(),
+                                                 _range);
+
+    return target->IsWithinDist3d(_position, _range);
+}
+
+bool WorldObjectSpellAreaTargetCheck::IsValidAreaTarget(WorldObject* target)
+{
+    if (target->GetTypeId() == TYPEID_UNIT &&
+        target->ToCreature()->IsAvoidingAOE()) // pussywizard
         return false;
     return WorldObjectSpellTargetCheck::operator()(target);
 }
@@ -10182,6 +10194,9 @@ WorldObjectSpellConeTargetCheck::WorldObjectSpellConeTargetCheck(
 
 bool WorldObjectSpellConeTargetCheck::operator()(WorldObject* target)
 {
+    if (!IsInRange(target))
+        return false;
+
     if (_spellInfo->HasAttribute(SPELL_ATTR0_CU_CONE_BACK)) {
         if (!_caster->isInBack(target, _coneAngle))
             return false;
@@ -10195,7 +10210,7 @@ bool WorldObjectSpellConeTargetCheck::operator()(WorldObject* target)
         if (!_caster->isInFront(target, _coneAngle))
             return false;
     }
-    return WorldObjectSpellAreaTargetCheck::operator()(target);
+    return IsValidAreaTarget(target);
 }
 
 WorldObjectSpellTrajTargetCheck::WorldObjectSpellTrajTargetCheck(
@@ -10212,10 +10227,13 @@ WorldObjectSpellTrajTargetCheck::WorldObjectSpellTrajTargetCheck(
 
 bool WorldObjectSpellTrajTargetCheck::operator()(WorldObject* target)
 {
+    if (!IsInRange(target))
+        return false;
+
     // return all targets on missile trajectory (0 - size of a missile)
     if (!_caster->HasInLine(target, target->GetObjectSize()))
         return false;
-    return WorldObjectSpellAreaTargetCheck::operator()(target);
+    return IsValidAreaTarget(target);
 }
 
 } // namespace Acore
@@ -24,6 +24,7 @@
 #include "PathGenerator.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
+#include <boost/container/small_vector.hpp>
 
 class Unit;
 class Player;
@@ -272,6 +273,9 @@ struct TargetInfo {
     int32         damage;
 };
 
+// most spells hit a handful of targets, keep those inline in the spell
+typedef boost::container::small_vector<TargetInfo, 4> TargetInfoList;
+
 static const uint32 SPELL_INTERRUPT_NONPLAYER = 32747;
 
 struct TriggeredByAuraSpellData {
@@ -692,7 +696,7 @@ public:
 
     // xinef: moved to public
     void                   LoadScripts();
-    std::list<TargetInfo>* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
+    TargetInfoList* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
 
     [[nodiscard]] uint32 GetTriggeredByAuraTickNumber() const
     {
@@ -810,8 +814,8 @@ protected:
     // *****************************************
     // Spell target subsystem
     // *****************************************
-    std::list<TargetInfo> m_UniqueTargetInfo;
-    uint8                 m_channelTargetEffectMask; // Mask req. alive targets
+    TargetInfoList m_UniqueTargetInfo;
+    uint8          m_channelTargetEffectMask; // Mask req. alive targets
 
     struct GOTargetInfo {
         ObjectGuid targetGUID;
@@ -819,13 +823,16 @@ protected:
         uint8      effectMask : 8;
         bool       processed : 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    typedef boost::container::small_vector<GOTargetInfo, 1> GOTargetInfoList;
+    GOTargetInfoList m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo {
         Item* item;
         uint8 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    typedef boost::container::small_vector<ItemTargetInfo, 1>
+                       ItemTargetInfoList;
+    ItemTargetInfoList m_UniqueItemInfo;
 
     SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
@@ -989,6 +996,12 @@ struct WorldObjectSpellAreaTargetCheck : public WorldObjectSpellTargetCheck {
                                     SpellTargetCheckTypes selectionType,
                                     ConditionList*        condList);
     bool operator()(WorldObject* target);
+
+protected:
+    // Position tests are cheap, derived checks run them before their shape
+    // test and only then the full target validation
+    [[nodiscard]] bool IsInRange(WorldObject* target) const;
+    bool               IsValidAreaTarget(WorldObject* target);
 };
 
 struct WorldObjectSpellConeTargetCheck
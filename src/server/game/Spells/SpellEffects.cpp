@@ -410,7 +410,7 @@ void Spell::EffectSchoolDMG(SpellEffIndex effIndex)
             // Meteor like spells (divided damage to targets)
             if (m_spellInfo->HasAttribute(SPELL_ATTR0_CU_SHARE_DAMAGE)) {
                 uint32 count = 0;
-                for (std::list<TargetInfo>::iterator ihit =
+                for (TargetInfoList::iterator ihit =
                          m_UniqueTargetInfo.begin();
                      ihit != m_UniqueTargetInfo.end();
                      ++ihit)
@@ -4087,7 +4087,7 @@ void Spell::EffectWeaponDmg(SpellEffIndex effIndex)
     // Meteor like spells (divided damage to targets)
     if (m_spellInfo->HasAttribute(SPELL_ATTR0_CU_SHARE_DAMAGE)) {
         uint32 count = 0;
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin();
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin();
              ihit != m_UniqueTargetInfo.end();
              ++ihit)
             if (ihit->effectMask & (1 << effIndex))
@@ -359,6 +359,13 @@ public:
     uint32                                 AttributesEx6;
     uint32                                 AttributesEx7;
     uint32                                 AttributesCu;
+    // read on every cast and immunity check, kept next to the attributes
+    uint32                                 SchoolMask;
+    uint32                                 DmgClass;
+    uint32                                 PreventionType;
+    uint32                                 SpellFamilyName;
+    flag96                                 SpellFamilyFlags;
+    SpellRangeEntry const*                 RangeEntry;
     uint32                                 Stances;
     uint32                                 StancesNot;
     uint32                                 Targets;
@@ -395,7 +402,6 @@ public:
     uint32                                 ManaPerSecondPerLevel;
     uint32                                 ManaCostPercentage;
     uint32                                 RuneCostID;
-    SpellRangeEntry const*                 RangeEntry;
     float                                  Speed;
     uint32                                 StackAmount;
     std::array<uint32, 2>                  Totem;
@@ -409,19 +415,15 @@ public:
     uint32                                 SpellIconID;
     uint32                                 ActiveIconID;
     uint32                                 SpellPriority;
-    std::array<char const*, 16>            SpellName;
-    std::array<char const*, 16>            Rank;
     uint32                                 MaxTargetLevel;
     uint32                                 MaxAffectedTargets;
-    uint32                                 SpellFamilyName;
-    flag96                                 SpellFamilyFlags;
-    uint32                                 DmgClass;
-    uint32                                 PreventionType;
     int32                                  AreaGroupId;
-    uint32                                 SchoolMask;
     std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
     uint32                                         ExplicitTargetMask;
     SpellChainNode const*                          ChainEntry;
+    // display only, kept out of the way of the effects
+    std::array<char const*, 16>                    SpellName;
+    std::array<char const*, 16>                    Rank;
 
     // Mine
     AuraStateType     _auraState;
@@ -35,6 +35,35 @@
 #include "SpellInfo.h"
 #include "World.h"
 
+namespace {
+
+// Flattens a spell id keyed map into a vector indexed by spell id; with
+// resolveFirstRank spells missing from the map use the first rank's entry
+template <class Entry, class Map>
+void BuildSpellIdLookup(std::vector<Entry const*>& lookup, Map const& map,
+                        bool resolveFirstRank)
+{
+    lookup.assign(sSpellMgr->GetSpellInfoStoreSize(), nullptr);
+
+    for (auto const& [spellId, entry] : map)
+        if (spellId < lookup.size())
+            lookup[spellId] = &entry;
+
+    if (!resolveFirstRank)
+        return;
+
+    for (uint32 spellId = 0; spellId < lookup.size(); ++spellId) {
+        if (lookup[spellId])
+            continue;
+
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+        if (spellInfo && spellInfo->ChainEntry)
+            lookup[spellId] = lookup[spellInfo->ChainEntry->first->Id];
+    }
+}
+
+} // namespace
+
 bool IsPrimaryProfessionSkill(uint32 skill)
 {
     SkillLineEntry const* pSkill = sSkillLineStore.LookupEntry(skill);
@@ -579,11 +608,11 @@ SpellMgr::GetSpellForDifficultyFromSpell(SpellInfo const* spell,
 
 SpellChainNode const* SpellMgr::GetSpellChainNode(uint32 spell_id) const
 {
-    SpellChainMap::const_iterator itr = mSpellChains.find(spell_id);
-    if (itr == mSpellChains.end())
-        return nullptr;
+    // every node of mSpellChains is linked from its spell
+    if (SpellInfo const* spellInfo = GetSpellInfo(spell_id))
+        return spellInfo->ChainEntry;
 
-    return &itr->second;
+    return nullptr;
 }
 
 uint32 SpellMgr::GetFirstSpellInChain(uint32 spell_id) const
@@ -781,6 +810,9 @@ void SpellMgr::GetSetOfSpellsInSpellGroupWithFlag(
 
 SpellProcEventEntry const* SpellMgr::GetSpellProcEvent(uint32 spellId) const
 {
+    if (spellId < mSpellProcEventLookup.size())
+        return mSpellProcEventLookup[spellId];
+
     SpellProcEventMap::const_iterator itr = mSpellProcEventMap.find(spellId);
     if (itr != mSpellProcEventMap.end())
         return &itr->second;
@@ -954,6 +986,9 @@ bool SpellMgr::IsSpellProcEventCanTriggeredBy(
 
 SpellProcEntry const* SpellMgr::GetSpellProcEntry(uint32 spellId) const
 {
+    if (spellId < mSpellProcLookup.size())
+        return mSpellProcLookup[spellId];
+
     SpellProcMap::const_iterator itr = mSpellProcMap.find(spellId);
     if (itr != mSpellProcMap.end())
         return &itr->second;
@@ -1037,6 +1072,9 @@ bool SpellMgr::CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry,
 
 SpellBonusEntry const* SpellMgr::GetSpellBonusData(uint32 spellId) const
 {
+    if (spellId < mSpellBonusLookup.size())
+        return mSpellBonusLookup[spellId];
+
     // Lookup data
     SpellBonusMap::const_iterator itr = mSpellBonusMap.find(spellId);
     if (itr != mSpellBonusMap.end())
@@ -1052,6 +1090,9 @@ SpellBonusEntry const* SpellMgr::GetSpellBonusData(uint32 spellId) const
 
 SpellThreatEntry const* SpellMgr::GetSpellThreatEntry(uint32 spellID) const
 {
+    if (spellID < mSpellThreatLookup.size())
+        return mSpellThreatLookup[spellID];
+
     SpellThreatMap::const_iterator itr = mSpellThreatMap.find(spellID);
     if (itr != mSpellThreatMap.end())
         return &itr->second;
@@ -1928,6 +1969,8 @@ void SpellMgr::LoadSpellProcEvents()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcEventMap.clear(); // need for reload case
+    mSpellProcEventLookup.clear();
+    ++mSpellProcGeneration;
 
     //                                                0      1           2 3 4
     //                                                5                 6 7 8 9
@@ -2026,6 +2069,8 @@ void SpellMgr::LoadSpellProcEvents()
         ++count;
     } while (result->NextRow());
 
+    BuildSpellIdLookup(mSpellProcEventLookup, mSpellProcEventMap, false);
+
     LOG_INFO("server.loading",
              ">> Loaded {} Extra Spell Proc Event Conditions in {} ms",
              count,
@@ -2038,6 +2083,8 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear(); // need for reload case
+    mSpellProcLookup.clear();
+    ++mSpellProcGeneration;
 
     //                                                 0        1           2 3
     //                                                 4                 5 6 7
@@ -2233,6 +2280,8 @@ void SpellMgr::LoadSpellProcs()
         ++count;
     } while (result->NextRow());
 
+    BuildSpellIdLookup(mSpellProcLookup, mSpellProcMap, false);
+
     LOG_INFO("server.loading",
              ">> Loaded {} spell proc conditions and data in {} ms",
              count,
@@ -2245,6 +2294,7 @@ void SpellMgr::LoadSpellBonuses()
     uint32 oldMSTime = getMSTime();
 
     mSpellBonusMap.clear(); // need for reload case
+    mSpellBonusLookup.clear();
 
     //                                                0      1             2 3 4
     QueryResult result =
@@ -2280,6 +2330,8 @@ void SpellMgr::LoadSpellBonuses()
         ++count;
     } while (result->NextRow());
 
+    BuildSpellIdLookup(mSpellBonusLookup, mSpellBonusMap, true);
+
     LOG_INFO("server.loading",
              ">> Loaded {} Extra Spell Bonus Data in {} ms",
              count,
@@ -2292,6 +2344,7 @@ void SpellMgr::LoadSpellThreats()
     uint32 oldMSTime = getMSTime();
 
     mSpellThreatMap.clear(); // need for reload case
+    mSpellThreatLookup.clear();
 
     //                                                0      1        2       3
     QueryResult result = WorldDatabase.Query(
@@ -2326,6 +2379,8 @@ void SpellMgr::LoadSpellThreats()
         ++count;
     } while (result->NextRow());
 
+    BuildSpellIdLookup(mSpellThreatLookup, mSpellThreatMap, true);
+
     LOG_INFO("server.loading",
              ">> Loaded {} SpellThreatEntries in {} ms",
              count,
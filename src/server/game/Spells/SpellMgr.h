@@ -788,6 +788,12 @@ public:
                                    uint32                     EventProcFlag,
                                    ProcEventInfo const&       eventInfo,
                                    bool                       active) const;
+    // Bumped on every (re)load of the proc tables, see
+    // Unit::UpdateAppliedAuraProcFlags
+    [[nodiscard]] uint32 GetSpellProcGeneration() const
+    {
+        return mSpellProcGeneration;
+    }
 
     // Spell proc table
     [[nodiscard]] SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
@@ -931,6 +937,13 @@ private:
     SpellProcMap               mSpellProcMap;
     SpellBonusMap              mSpellBonusMap;
     SpellThreatMap             mSpellThreatMap;
+    // direct lookups by spell id into the maps above, bonus and threat
+    // entries of the first rank are already resolved for higher ranks
+    std::vector<SpellProcEventEntry const*> mSpellProcEventLookup;
+    std::vector<SpellProcEntry const*>      mSpellProcLookup;
+    std::vector<SpellBonusEntry const*>     mSpellBonusLookup;
+    std::vector<SpellThreatEntry const*>    mSpellThreatLookup;
+    uint32                                  mSpellProcGeneration = 0;
     SpellMixologyMap           mSpellMixologyMap;
     SpellPetAuraMap            mSpellPetAuraMap;
     SpellLinkedMap             mSpellLinkedMap;
@@ -17,6 +17,7 @@
  */
 
 #include "SpellScript.h"
+#include "ScriptProfiler.h"
 #include "Spell.h"
 #include "SpellAuras.h"
 #include "SpellMgr.h"
@@ -455,11 +456,21 @@ void SpellScript::_InitHit()
 void SpellScript::_PrepareScriptCall(SpellScriptHookType hookType)
 {
     m_currentScriptState = hookType;
+    if (sScriptProfiler->ShouldSample())
+        m_profileStart = std::chrono::steady_clock::now();
 }
 
 void SpellScript::_FinishScriptCall()
 {
     m_currentScriptState = SPELL_SCRIPT_STATE_NONE;
+    if (m_profileStart != TimePoint() && m_scriptName) {
+        sScriptProfiler->Record(
+            SCRIPT_PROFILE_SPELL_SCRIPT,
+            *m_scriptName,
+            std::chrono::duration_cast<Microseconds>(
+                std::chrono::steady_clock::now() - m_profileStart));
+        m_profileStart = TimePoint();
+    }
 }
 
 bool SpellScript::IsInCheckCastHook() const
@@ -1348,19 +1359,32 @@ bool AuraScript::_Load(Aura* aura)
 void AuraScript::_PrepareScriptCall(AuraScriptHookType     hookType,
                                     AuraApplication const* aurApp)
 {
-    m_scriptStates.push(ScriptStateStore(
-        m_currentScriptState, m_auraApplication, m_defaultActionPrevented));
+    m_scriptStates.push(ScriptStateStore(m_currentScriptState,
+                                         m_auraApplication,
+                                         m_defaultActionPrevented,
+                                         m_profileStart));
     m_currentScriptState     = hookType;
     m_defaultActionPrevented = false;
     m_auraApplication        = aurApp;
+    m_profileStart           = sScriptProfiler->ShouldSample()
+                                   ? std::chrono::steady_clock::now()
+                                   : TimePoint();
 }
 
 void AuraScript::_FinishScriptCall()
 {
+    if (m_profileStart != TimePoint() && m_scriptName)
+        sScriptProfiler->Record(
+            SCRIPT_PROFILE_AURA_SCRIPT,
+            *m_scriptName,
+            std::chrono::duration_cast<Microseconds>(
+                std::chrono::steady_clock::now() - m_profileStart));
+
     ScriptStateStore stateStore = m_scriptStates.top();
     m_currentScriptState        = stateStore._currentScriptState;
     m_auraApplication           = stateStore._auraApplication;
     m_defaultActionPrevented    = stateStore._defaultActionPrevented;
+    m_profileStart              = stateStore._profileStart;
     m_scriptStates.pop();
 }
 
@@ -110,6 +110,8 @@ protected:
     uint8              m_currentScriptState;
     std::string const* m_scriptName;
     uint32             m_scriptSpellId;
+    // start of the current hook call when the script profiler samples it
+    TimePoint          m_profileStart;
 
 public:
     //
@@ -1068,12 +1070,15 @@ private:
         AuraApplication const* _auraApplication;
         uint8                  _currentScriptState;
         bool                   _defaultActionPrevented;
+        TimePoint              _profileStart;
         ScriptStateStore(uint8                  currentScriptState,
                          AuraApplication const* auraApplication,
-                         bool                   defaultActionPrevented)
+                         bool                   defaultActionPrevented,
+                         TimePoint              profileStart)
             : _auraApplication(auraApplication),
               _currentScriptState(currentScriptState),
-              _defaultActionPrevented(defaultActionPrevented)
+              _defaultActionPrevented(defaultActionPrevented),
+              _profileStart(profileStart)
         {
         }
     };
@@ -257,7 +257,7 @@ void CreatureTextMgr::LoadCreatureTextLocales()
         uint32 ID         = fields[2].Get<uint8>();
 
         LocaleConstant locale = GetLocaleByName(fields[3].Get<std::string>());
-        if (locale == LOCALE_enUS)
+        if (!sObjectMgr->ShouldLoadLocale(locale))
             continue;
 
         CreatureTextLocale& data =
@@ -25,6 +25,8 @@
 #include "Opcodes.h"
 #include "SharedDefines.h"
 #include "WorldSession.h"
+#include <array>
+#include <memory>
 
 enum CreatureTextRange {
     TEXT_RANGE_NORMAL = 0,
@@ -157,54 +159,49 @@ public:
     CreatureTextLocalizer(Builder const& builder, ChatMsg msgType)
         : _builder(builder), _msgType(msgType)
     {
-        _packetCache.resize(TOTAL_LOCALES, nullptr);
-    }
-
-    ~CreatureTextLocalizer()
-    {
-        for (size_t i = 0; i < _packetCache.size(); ++i) {
-            if (_packetCache[i])
-                delete _packetCache[i]->first;
-            delete _packetCache[i];
-        }
     }
 
     void operator()(Player* player)
     {
         LocaleConstant loc_idx =
             player->GetSession()->GetSessionDbLocaleIndex();
-        WorldPacket* messageTemplate;
-        size_t       whisperGUIDpos;
+        PacketTemplate& messageTemplate = _packetCache[loc_idx];
 
         // create if not cached yet
-        if (!_packetCache[loc_idx]) {
-            messageTemplate       = new WorldPacket();
-            whisperGUIDpos        = _builder(messageTemplate, loc_idx);
-            _packetCache[loc_idx] = new std::pair<WorldPacket*, size_t>(
-                messageTemplate, whisperGUIDpos);
-        }
-        else {
-            messageTemplate = _packetCache[loc_idx]->first;
-            whisperGUIDpos  = _packetCache[loc_idx]->second;
+        if (!messageTemplate.Packet) {
+            std::shared_ptr<WorldPacket> packet =
+                std::make_shared<WorldPacket>();
+            messageTemplate.WhisperGUIDPos = _builder(packet.get(), loc_idx);
+            messageTemplate.Packet         = std::move(packet);
         }
 
-        WorldPacket data(*messageTemplate);
         switch (_msgType) {
         case CHAT_MSG_MONSTER_WHISPER:
-        case CHAT_MSG_RAID_BOSS_WHISPER:
-            data.put<uint64>(whisperGUIDpos, player->GetGUID().GetRawValue());
-            break;
+        case CHAT_MSG_RAID_BOSS_WHISPER: {
+            WorldPacket data(*messageTemplate.Packet);
+            data.put<uint64>(messageTemplate.WhisperGUIDPos,
+                             player->GetGUID().GetRawValue());
+            player->SendDirectMessage(&data);
+            return;
+        }
         default:
             break;
         }
 
-        player->SendDirectMessage(&data);
+        // nothing is receiver specific, all players with this locale share
+        // the same packet instead of getting their own copy
+        player->SendDirectMessage(messageTemplate.Packet);
     }
 
 private:
-    std::vector<std::pair<WorldPacket*, size_t>*> _packetCache;
-    Builder const&                                _builder;
-    ChatMsg                                       _msgType;
+    struct PacketTemplate {
+        std::shared_ptr<WorldPacket const> Packet;
+        size_t                             WhisperGUIDPos = 0;
+    };
+
+    std::array<PacketTemplate, TOTAL_LOCALES> _packetCache;
+    Builder const&                            _builder;
+    ChatMsg                                   _msgType;
 };
 
 template <class Builder>
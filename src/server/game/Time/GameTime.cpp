@@ -22,10 +22,11 @@
 namespace GameTime {
 using namespace std::chrono;
 
-Seconds const StartTime = GetEpochTime();
+Seconds StartTime = GetEpochTime();
 
-Seconds      GameTime   = GetEpochTime();
-Milliseconds GameMSTime = 0ms;
+Seconds      GameTime    = GetEpochTime();
+Milliseconds GameMSTime  = 0ms;
+Seconds      ClockOffset = 0s;
 
 SystemTimePoint GameTimeSystemPoint = SystemTimePoint::min();
 TimePoint       GameTimeSteadyPoint = TimePoint::min();
@@ -44,9 +45,16 @@ Seconds GetUptime() { return GameTime - StartTime; }
 
 void UpdateGameTimers()
 {
-    GameTime            = GetEpochTime();
+    GameTime            = GetEpochTime() + ClockOffset;
     GameMSTime          = GetTimeMS();
-    GameTimeSystemPoint = system_clock::now();
+    GameTimeSystemPoint = system_clock::now() + ClockOffset;
     GameTimeSteadyPoint = steady_clock::now();
 }
+
+void SetStartTime(Seconds startTime)
+{
+    ClockOffset = startTime - StartTime;
+    StartTime   = startTime;
+    UpdateGameTimers();
+}
 } // namespace GameTime
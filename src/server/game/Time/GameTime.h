@@ -43,6 +43,10 @@ AC_GAME_API Seconds GetUptime();
 
 /// Update all timers
 void UpdateGameTimers();
+
+/// Shift the game clock so the server starts at the given unix time, the
+/// clock keeps running from there (used to replay packet captures)
+AC_GAME_API void SetStartTime(Seconds startTime);
 } // namespace GameTime
 
 #endif
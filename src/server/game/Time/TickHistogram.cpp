@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickHistogram.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+void TickHistogram::Add(uint32 value)
+{
+    ++_buckets[GetBucket(value)];
+    ++_count;
+    _max = std::max(_max, value);
+}
+
+void TickHistogram::Remove(uint32 value)
+{
+    uint32& bucket = _buckets[GetBucket(value)];
+    if (!bucket)
+        return;
+
+    --bucket;
+    --_count;
+}
+
+void TickHistogram::Reset()
+{
+    _buckets.fill(0);
+    _count = 0;
+    _max   = 0;
+}
+
+uint32 TickHistogram::GetPercentile(double percentile) const
+{
+    if (!_count)
+        return 0;
+
+    // rank of the wanted value, 1 based like the nearest rank method
+    uint64 const rank = std::max<uint64>(
+        1,
+        uint64(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 *
+                         double(_count))));
+
+    uint64 seen = 0;
+    for (uint32 bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        seen += _buckets[bucket];
+        if (seen >= rank)
+            return std::min(GetBucketHighestValue(bucket), _max);
+    }
+
+    return _max;
+}
+
+uint32 TickHistogram::GetBucket(uint32 value)
+{
+    if (value < EXACT_VALUES)
+        return value;
+
+    // the highest bit selects the row, the next SUB_BUCKET_BITS the column
+    uint32 const highestBit = std::bit_width(value) - 1;
+    uint32 const shift      = highestBit - SUB_BUCKET_BITS;
+    return EXACT_VALUES + (highestBit - 6) * SUB_BUCKETS +
+           ((value >> shift) - SUB_BUCKETS);
+}
+
+uint32 TickHistogram::GetBucketHighestValue(uint32 bucket)
+{
+    if (bucket < EXACT_VALUES)
+        return bucket;
+
+    uint32 const row    = (bucket - EXACT_VALUES) / SUB_BUCKETS;
+    uint32 const column = (bucket - EXACT_VALUES) % SUB_BUCKETS;
+    uint32 const shift  = row + 6 - SUB_BUCKET_BITS;
+    return ((SUB_BUCKETS + column) << shift) + ((1u << shift) - 1);
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TICKHISTOGRAM_H
+#define __TICKHISTOGRAM_H
+
+#include "Define.h"
+#include <array>
+
+/*
+ * Log-linear histogram of tick durations in the style of an HDR histogram.
+ * Values below 64 are counted exactly, every power of two above is split into
+ * 32 buckets, so a percentile is off by at most 1/32 of its value. Adding,
+ * removing and reading a percentile never sort or allocate.
+ */
+class AC_GAME_API TickHistogram {
+public:
+    static constexpr uint32 EXACT_VALUES    = 64;
+    static constexpr uint32 SUB_BUCKET_BITS = 5;
+    static constexpr uint32 SUB_BUCKETS     = 1 << SUB_BUCKET_BITS;
+    // one row of sub buckets for every power of two from 2^6 to 2^31
+    static constexpr uint32 BUCKET_COUNT =
+        EXACT_VALUES + (32 - 6) * SUB_BUCKETS;
+
+    void Add(uint32 value);
+    // value must have been added before, used for sliding windows
+    void Remove(uint32 value);
+    void Reset();
+
+    uint64 GetCount() const { return _count; }
+    // largest value added since the last reset, removals do not lower it
+    uint32 GetMax() const { return _max; }
+
+    // highest value of the bucket holding the percentile, 0 when empty
+    uint32 GetPercentile(double percentile) const;
+
+private:
+    static uint32 GetBucket(uint32 value);
+    static uint32 GetBucketHighestValue(uint32 bucket);
+
+    std::array<uint32, BUCKET_COUNT> _buckets = {};
+    uint64                           _count   = 0;
+    uint32                           _max     = 0;
+};
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickProfiler.h"
+#include "Config.h"
+#include "Log.h"
+#include "Metric.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+// full name of the innermost open phase of this thread
+thread_local std::string _currentPhase;
+
+std::string_view GetLastSegment(std::string_view phase)
+{
+    size_t separator = phase.rfind('/');
+    return separator == std::string_view::npos ? phase
+                                               : phase.substr(separator + 1);
+}
+} // namespace
+
+TickProfiler::TickProfiler()
+    : _enabled(false), _opcodes(false), _reportInterval(0), _reportTimer(0),
+      _slowTickThreshold(0), _slowTickTopCount(0)
+{
+}
+
+TickProfiler* TickProfiler::instance()
+{
+    static TickProfiler instance;
+    return &instance;
+}
+
+void TickProfiler::LoadFromConfig()
+{
+    _enabled = sConfigMgr->GetOption<bool>("TickProfiler.Enable", false);
+    _opcodes = sConfigMgr->GetOption<bool>("TickProfiler.Opcodes", false);
+    _reportInterval = Milliseconds(
+        sConfigMgr->GetOption<uint32>("TickProfiler.MetricInterval", 10000));
+    _slowTickThreshold = Milliseconds(
+        sConfigMgr->GetOption<uint32>("TickProfiler.SlowTick.Threshold", 0));
+    _slowTickTopCount =
+        sConfigMgr->GetOption<uint32>("TickProfiler.SlowTick.TopCount", 5);
+
+    if (!_enabled)
+        Reset();
+}
+
+void TickProfiler::Record(std::string_view phase, Microseconds elapsed)
+{
+    if (!_enabled)
+        return;
+
+    uint32 value = uint32(std::min<int64>(
+        elapsed.count(), std::numeric_limits<uint32>::max()));
+
+    std::vector<std::string> slowTickReport;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        auto itr = _phases.find(phase);
+        if (itr == _phases.end())
+            itr = _phases.emplace(std::string(phase), PhaseSamples()).first;
+
+        PhaseSamples& samples = itr->second;
+        samples.Histogram.Add(value);
+
+        if (_slowTickThreshold > 0s) {
+            samples.TickTotal += value;
+            ++samples.TickCount;
+
+            // the world phase closes last, the whole tick has been recorded
+            if (phase == "world")
+                slowTickReport = EndWorldTick(value);
+        }
+    }
+
+    for (std::string const& line : slowTickReport)
+        LOG_INFO("time.slowtick", line);
+}
+
+void TickProfiler::RecordOpcode(char const* name, Microseconds elapsed)
+{
+    // reused per thread, building the phase name does not allocate once warm
+    thread_local std::string phase;
+    phase.assign("opcode/");
+    phase.append(name);
+
+    Record(phase, elapsed);
+}
+
+void TickProfiler::Update(uint32 diff)
+{
+    if (!_enabled || _reportInterval == 0s || !sMetric->IsEnabled())
+        return;
+
+    _reportTimer += Milliseconds(diff);
+    if (_reportTimer < _reportInterval)
+        return;
+
+    _reportTimer = 0s;
+
+    for (PhaseStats const& stats : GetStats()) {
+        METRIC_VALUE("tick_phase_p50",
+                     uint64(stats.Median.count()),
+                     METRIC_TAG("phase", stats.Phase));
+        METRIC_VALUE("tick_phase_p99",
+                     uint64(stats.P99.count()),
+                     METRIC_TAG("phase", stats.Phase));
+        METRIC_VALUE("tick_phase_max",
+                     uint64(stats.Max.count()),
+                     METRIC_TAG("phase", stats.Phase));
+    }
+}
+
+std::vector<TickProfiler::PhaseStats>
+TickProfiler::GetStats(std::string_view prefix) const
+{
+    std::vector<PhaseStats> result;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto const& [phase, samples] : _phases) {
+        if (!samples.Histogram.GetCount() ||
+            std::string_view(phase).substr(0, prefix.size()) != prefix)
+            continue;
+
+        result.push_back(BuildStats(phase, samples));
+    }
+
+    return result;
+}
+
+void TickProfiler::Reset()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _phases.clear();
+}
+
+TickProfiler::PhaseStats
+TickProfiler::BuildStats(std::string const& phase, PhaseSamples const& samples)
+{
+    TickHistogram const& histogram = samples.Histogram;
+    return {phase,
+            uint32(std::min<uint64>(histogram.GetCount(),
+                                    std::numeric_limits<uint32>::max())),
+            Microseconds(histogram.GetPercentile(50)),
+            Microseconds(histogram.GetPercentile(99)),
+            Microseconds(histogram.GetMax())};
+}
+
+std::vector<std::string> TickProfiler::EndWorldTick(uint32 elapsed)
+{
+    std::vector<std::string> report;
+
+    if (Microseconds(elapsed) >= _slowTickThreshold) {
+        using TickPhase = std::pair<std::string_view, PhaseSamples const*>;
+        std::vector<TickPhase> phases, maps, opcodes;
+
+        for (auto const& [phase, samples] : _phases) {
+            if (!samples.TickCount)
+                continue;
+
+            std::string_view name = phase;
+            if (name.starts_with("opcode/"))
+                opcodes.emplace_back(name.substr(7), &samples);
+            else if (GetLastSegment(name).starts_with("map "))
+                maps.emplace_back(GetLastSegment(name).substr(4), &samples);
+            else if (name.starts_with("world/") &&
+                     name.find('/', 6) == std::string_view::npos)
+                phases.emplace_back(name.substr(6), &samples);
+        }
+
+        auto byTime = [](TickPhase const& left, TickPhase const& right) {
+            return left.second->TickTotal > right.second->TickTotal;
+        };
+        std::sort(phases.begin(), phases.end(), byTime);
+        std::sort(maps.begin(), maps.end(), byTime);
+        std::sort(opcodes.begin(), opcodes.end(), byTime);
+
+        auto format = [&report](char const* kind, TickPhase const& entry) {
+            report.push_back(Acore::StringFormat(
+                " - {} {}: {:.2f} ms in {} samples",
+                kind,
+                entry.first,
+                entry.second->TickTotal / 1000.0,
+                entry.second->TickCount));
+        };
+
+        report.push_back(Acore::StringFormat(
+            "Slow world tick: {:.2f} ms (threshold {} ms)",
+            elapsed / 1000.0,
+            _slowTickThreshold.count()));
+
+        for (TickPhase const& entry : phases)
+            format("phase", entry);
+
+        for (size_t i = 0; i < maps.size() && i < _slowTickTopCount; ++i)
+            format("map", maps[i]);
+
+        for (size_t i = 0; i < opcodes.size() && i < _slowTickTopCount; ++i)
+            format("opcode", opcodes[i]);
+    }
+
+    for (auto& [phase, samples] : _phases) {
+        samples.TickTotal = 0;
+        samples.TickCount = 0;
+    }
+
+    return report;
+}
+
+TickProfilerScope::TickProfilerScope(std::string_view phase)
+    : _active(sTickProfiler->IsEnabled()), _parentLength(0)
+{
+    if (!_active)
+        return;
+
+    _parentLength = _currentPhase.size();
+    if (_parentLength)
+        _currentPhase += '/';
+
+    _currentPhase += phase;
+    _start = std::chrono::steady_clock::now();
+}
+
+TickProfilerScope::~TickProfilerScope()
+{
+    if (!_active)
+        return;
+
+    sTickProfiler->Record(
+        _currentPhase,
+        std::chrono::duration_cast<Microseconds>(
+            std::chrono::steady_clock::now() - _start));
+
+    _currentPhase.resize(_parentLength);
+}
@@ -0,0 +1,114 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TICKPROFILER_H
+#define __TICKPROFILER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "TickHistogram.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Records the wall time spent in named phases of the world and map updates.
+ * Phases nest per thread, a phase opened while another one is active is
+ * stored as "parent/child". Every phase keeps a histogram of its samples
+ * since the last reset. When a world tick takes longer than the slow tick
+ * threshold, the phases, maps and opcodes of that tick are written to the
+ * "time.slowtick" log.
+ */
+class AC_GAME_API TickProfiler {
+public:
+    struct PhaseStats {
+        std::string  Phase;
+        uint32       Samples;
+        Microseconds Median;
+        Microseconds P99;
+        Microseconds Max;
+    };
+
+    static TickProfiler* instance();
+
+    void LoadFromConfig();
+    bool IsEnabled() const { return _enabled; }
+    bool IsOpcodeProfilingEnabled() const { return _enabled && _opcodes; }
+
+    void Record(std::string_view phase, Microseconds elapsed);
+    // stored as the top level phase "opcode/<name>"
+    void RecordOpcode(char const* name, Microseconds elapsed);
+
+    // sends the phase percentiles to sMetric once per report interval
+    void Update(uint32 diff);
+
+    std::vector<PhaseStats> GetStats(std::string_view prefix = {}) const;
+    void                    Reset();
+
+private:
+    struct PhaseSamples {
+        TickHistogram Histogram;
+        // time spent in the phase during the current world tick
+        uint64 TickTotal = 0;
+        uint32 TickCount = 0;
+    };
+
+    TickProfiler();
+
+    static PhaseStats BuildStats(std::string const& phase,
+                                 PhaseSamples const& samples);
+
+    // called with _lock held once the world phase of a tick was recorded
+    std::vector<std::string> EndWorldTick(uint32 elapsed);
+
+    mutable std::mutex                               _lock;
+    std::map<std::string, PhaseSamples, std::less<>> _phases;
+
+    std::atomic<bool> _enabled;
+    std::atomic<bool> _opcodes;
+    Milliseconds      _reportInterval;
+    Milliseconds      _reportTimer;
+    Milliseconds      _slowTickThreshold;
+    uint32            _slowTickTopCount;
+};
+
+#define sTickProfiler TickProfiler::instance()
+
+class AC_GAME_API TickProfilerScope {
+public:
+    explicit TickProfilerScope(std::string_view phase);
+    ~TickProfilerScope();
+
+    TickProfilerScope(TickProfilerScope const&)            = delete;
+    TickProfilerScope& operator=(TickProfilerScope const&) = delete;
+
+private:
+    bool      _active;
+    size_t    _parentLength;
+    TimePoint _start;
+};
+
+#define TICK_PROFILE_CONCAT_I(a, b) a##b
+#define TICK_PROFILE_CONCAT(a, b) TICK_PROFILE_CONCAT_I(a, b)
+#define TICK_PROFILE_SCOPE(phase)                                              \
+    TickProfilerScope TICK_PROFILE_CONCAT(__ac_tick_profile_, __LINE__)(phase)
+
+#endif
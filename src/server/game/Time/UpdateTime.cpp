@@ -21,7 +21,6 @@
 #include "Log.h"
 #include "Timer.h"
 #include <algorithm>
-#include <iterator>
 
 // create instance
 WorldUpdateTime sWorldUpdateTime;
@@ -71,35 +70,29 @@ uint32 UpdateTime::GetLastUpdateTime() const
 
 uint32 UpdateTime::GetDatasetSize() const
 {
-    return _updateTimeDataTable[_updateTimeDataTable.size() - 1] == 0
-               ? _updateTimeTableIndex
-               : _orderedUpdateTimeDataTable.size();
+    return uint32(_tableHistogram.GetCount());
 }
 
-uint32 UpdateTime::GetPercentile(uint8 p)
+uint32 UpdateTime::GetPercentile(uint8 p) const
 {
-    if (_needsReorder)
-        SortUpdateTimeDataTable();
+    // the histogram only knows the largest diff ever seen, the window keeps
+    // its own
+    if (p >= 100)
+        return GetMaxUpdateTimeOfCurrentTable();
 
-    // Calculate the index of the element corresponding to the percentile
-    double index = (double(p) / 100.0) * (GetDatasetSize() - 1);
-
-    // If the index is an integer, return the value at that index
-    if (index == floor(index))
-        return _orderedUpdateTimeDataTable[index];
-
-    // Otherwise, perform linear interpolation
-    int    lowerIndex = floor(index);
-    int    upperIndex = ceil(index);
-    double fraction   = index - lowerIndex;
-
-    return _orderedUpdateTimeDataTable[lowerIndex] * (1 - fraction) +
-           _orderedUpdateTimeDataTable[upperIndex] * fraction;
+    return std::min(_tableHistogram.GetPercentile(p),
+                    GetMaxUpdateTimeOfCurrentTable());
 }
 
 void UpdateTime::UpdateWithDiff(uint32 diff)
 {
-    _needsReorder = true;
+    // once the table is full the slot being overwritten leaves the window
+    if (_tableHistogram.GetCount() >= _updateTimeDataTable.size())
+        _tableHistogram.Remove(_updateTimeDataTable[_updateTimeTableIndex]);
+
+    _tableHistogram.Add(diff);
+    _totalHistogram.Add(diff);
+
     _totalUpdateTime =
         _totalUpdateTime - _updateTimeDataTable[_updateTimeTableIndex] + diff;
     _updateTimeDataTable[_updateTimeTableIndex] = diff;
@@ -124,30 +117,6 @@ void UpdateTime::UpdateWithDiff(uint32 diff)
 
 void UpdateTime::RecordUpdateTimeReset() { _recordedTime = GetTimeMS(); }
 
-void UpdateTime::SortUpdateTimeDataTable()
-{
-    if (!_needsReorder)
-        return;
-
-    auto endUpdateTable = _updateTimeDataTable.end();
-    if (!_updateTimeDataTable[_updateTimeDataTable.size() - 1])
-        endUpdateTable =
-            std::next(_updateTimeDataTable.begin(), _updateTimeTableIndex);
-
-    std::copy(_updateTimeDataTable.begin(),
-              endUpdateTable,
-              _orderedUpdateTimeDataTable.begin());
-
-    auto endOrderedUpdateTable = _orderedUpdateTimeDataTable.end();
-    if (!_updateTimeDataTable[_updateTimeDataTable.size() - 1])
-        endOrderedUpdateTable = std::next(_orderedUpdateTimeDataTable.begin(),
-                                          _updateTimeTableIndex);
-
-    std::sort(_orderedUpdateTimeDataTable.begin(), endOrderedUpdateTable);
-
-    _needsReorder = false;
-}
-
 void WorldUpdateTime::LoadFromConfig()
 {
     _recordUpdateTimeInverval = Milliseconds(
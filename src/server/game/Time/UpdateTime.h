@@ -21,6 +21,7 @@
 
 #include "Define.h"
 #include "Duration.h"
+#include "TickHistogram.h"
 #include <array>
 #include <string>
 
@@ -36,7 +37,10 @@ public:
     uint32 GetMaxUpdateTimeOfCurrentTable() const;
     uint32 GetLastUpdateTime() const;
     uint32 GetDatasetSize() const;
-    uint32 GetPercentile(uint8 p);
+    // percentiles of the last AVG_DIFF_COUNT diffs
+    uint32 GetPercentile(uint8 p) const;
+    // every diff since the server started
+    TickHistogram const& GetTotalHistogram() const { return _totalHistogram; }
 
     void UpdateWithDiff(uint32 diff);
 
@@ -45,8 +49,6 @@ public:
 protected:
     UpdateTime();
 
-    void SortUpdateTimeDataTable();
-
 private:
     DiffTableArray _updateTimeDataTable;
     uint32         _averageUpdateTime;
@@ -56,8 +58,8 @@ private:
     uint32         _maxUpdateTimeOfLastTable;
     uint32         _maxUpdateTimeOfCurrentTable;
 
-    DiffTableArray _orderedUpdateTimeDataTable;
-    bool           _needsReorder;
+    TickHistogram _tableHistogram;
+    TickHistogram _totalHistogram;
 
     Milliseconds _recordedTime;
 };
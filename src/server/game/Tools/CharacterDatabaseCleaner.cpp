@@ -22,6 +22,45 @@
 #include "Log.h"
 #include "SpellMgr.h"
 #include "World.h"
+#include <deque>
+
+namespace {
+// ids removed per DELETE statement and the delay between two statements,
+// keeps the cleanup from hogging the async connections after startup
+constexpr std::size_t CLEANER_DELETE_CHUNK_SIZE     = 500;
+constexpr uint32      CLEANER_DELETE_CHUNK_INTERVAL = 100; // ms
+
+struct PendingDelete {
+    char const*         Table;
+    char const*         Column;
+    std::vector<uint32> Ids;
+    std::size_t         Next = 0;
+};
+
+QueryCallbackProcessor    _queryProcessor;
+std::deque<PendingDelete> _pendingDeletes;
+uint32                    _pendingChecks   = 0;
+uint32                    _deleteTimer     = 0;
+uint32                    _persistentFlags = 0;
+bool                      _cleaning        = false;
+uint32                    _startTime       = 0;
+
+void FinishCleaning()
+{
+    _cleaning = false;
+
+    // NOTE: In order to have persistentFlags be set in worldstates for the next
+    // cleanup, you need to define them at least once in worldstates.
+    CharacterDatabase.Execute(
+        "UPDATE worldstates SET value = {} WHERE entry = {}",
+        _persistentFlags,
+        WS_CLEANING_FLAGS);
+
+    LOG_INFO("misc",
+             "Cleaned character database in {} ms",
+             GetMSTimeDiffToNow(_startTime));
+}
+} // namespace
 
 void CharacterDatabaseCleaner::CleanDatabase()
 {
@@ -29,9 +68,7 @@ void CharacterDatabaseCleaner::CleanDatabase()
     if (!sWorld->getBoolConfig(CONFIG_CLEAN_CHARACTER_DB))
         return;
 
-    LOG_INFO("misc", "Cleaning character database...");
-
-    uint32 oldMSTime = getMSTime();
+    LOG_INFO("server.loading", "Scheduling character database cleanup...");
 
     // check flags which clean ups are necessary
     QueryResult result = CharacterDatabase.Query(
@@ -41,7 +78,11 @@ void CharacterDatabaseCleaner::CleanDatabase()
 
     uint32 flags = (*result)[0].Get<uint32>();
 
-    // clean up
+    _cleaning  = true;
+    _startTime = getMSTime();
+
+    // clean up, the checks only queue async queries and the deletes are
+    // issued in chunks from Update() once the world is running
     if (flags & CLEANING_FLAG_ACHIEVEMENT_PROGRESS)
         CleanCharacterAchievementProgress();
 
@@ -57,56 +98,90 @@ void CharacterDatabaseCleaner::CleanDatabase()
     if (flags & CLEANING_FLAG_QUESTSTATUS)
         CleanCharacterQuestStatus();
 
-    // NOTE: In order to have persistentFlags be set in worldstates for the next
-    // cleanup, you need to define them at least once in worldstates.
     flags &= sWorld->getIntConfig(CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS);
-    CharacterDatabase.DirectExecute(
-        "UPDATE worldstates SET value = {} WHERE entry = {}",
-        flags,
-        WS_CLEANING_FLAGS);
+    _persistentFlags = flags;
 
     sWorld->SetCleaningFlags(flags);
 
-    LOG_INFO("server.loading",
-             ">> Cleaned character database in {} ms",
-             GetMSTimeDiffToNow(oldMSTime));
+    if (!_pendingChecks)
+        FinishCleaning();
+
     LOG_INFO("server.loading", " ");
 }
 
-void CharacterDatabaseCleaner::CheckUnique(const char* column,
-                                           const char* table,
-                                           bool (*check)(uint32))
+void CharacterDatabaseCleaner::Update(uint32 diff)
 {
-    QueryResult result =
-        CharacterDatabase.Query("SELECT DISTINCT {} FROM {}", column, table);
-    if (!result) {
-        LOG_INFO("sql.sql", "Table {} is empty.", table);
+    if (!_cleaning)
         return;
-    }
 
-    bool               found = false;
-    std::ostringstream ss;
-    do {
-        Field* fields = result->Fetch();
+    _queryProcessor.ProcessReadyCallbacks();
+
+    if (!_pendingDeletes.empty()) {
+        _deleteTimer += diff;
+        if (_deleteTimer < CLEANER_DELETE_CHUNK_INTERVAL)
+            return;
 
-        uint32 id = fields[0].Get<uint32>();
+        _deleteTimer = 0;
 
-        if (!check(id)) {
-            if (!found) {
-                ss << "DELETE FROM " << table << " WHERE " << column << " IN (";
-                found = true;
-            }
-            else
+        PendingDelete& pending = _pendingDeletes.front();
+        std::size_t    end     = std::min(
+            pending.Next + CLEANER_DELETE_CHUNK_SIZE, pending.Ids.size());
+
+        std::ostringstream ss;
+        ss << "DELETE FROM " << pending.Table << " WHERE " << pending.Column
+           << " IN (";
+        for (std::size_t i = pending.Next; i < end; ++i) {
+            if (i != pending.Next)
                 ss << ',';
 
-            ss << id;
+            ss << pending.Ids[i];
         }
-    } while (result->NextRow());
-
-    if (found) {
         ss << ')';
-        CharacterDatabase.Execute(ss.str().c_str());
+
+        CharacterDatabase.Execute(ss.str());
+
+        pending.Next = end;
+        if (pending.Next == pending.Ids.size())
+            _pendingDeletes.pop_front();
+
+        return;
     }
+
+    if (!_pendingChecks)
+        FinishCleaning();
+}
+
+void CharacterDatabaseCleaner::CheckUnique(const char* column,
+                                           const char* table,
+                                           bool (*check)(uint32))
+{
+    ++_pendingChecks;
+
+    _queryProcessor.AddCallback(
+        CharacterDatabase
+            .AsyncQuery(Acore::StringFormatFmt(
+                "SELECT DISTINCT {} FROM {}", column, table))
+            .WithCallback([column, table, check](QueryResult result) {
+                --_pendingChecks;
+
+                if (!result) {
+                    LOG_INFO("sql.sql", "Table {} is empty.", table);
+                    return;
+                }
+
+                PendingDelete pending{table, column, {}};
+                do {
+                    Field* fields = result->Fetch();
+
+                    uint32 id = fields[0].Get<uint32>();
+
+                    if (!check(id))
+                        pending.Ids.push_back(id);
+                } while (result->NextRow());
+
+                if (!pending.Ids.empty())
+                    _pendingDeletes.push_back(std::move(pending));
+            }));
 }
 
 bool CharacterDatabaseCleaner::AchievementProgressCheck(uint32 criteria)
@@ -152,7 +227,7 @@ bool CharacterDatabaseCleaner::TalentCheck(uint32 talent_id)
 
 void CharacterDatabaseCleaner::CleanCharacterTalent()
 {
-    CharacterDatabase.DirectExecute(
+    CharacterDatabase.Execute(
         "DELETE FROM character_talent WHERE specMask >= {}",
         1 << MAX_TALENT_SPECS);
     CheckUnique("spell", "character_talent", &TalentCheck);
@@ -160,6 +235,6 @@ void CharacterDatabaseCleaner::CleanCharacterTalent()
 
 void CharacterDatabaseCleaner::CleanCharacterQuestStatus()
 {
-    CharacterDatabase.DirectExecute(
+    CharacterDatabase.Execute(
         "DELETE FROM character_queststatus WHERE status = 0");
 }
@@ -30,7 +30,10 @@ enum CleaningFlags {
     CLEANING_FLAG_QUESTSTATUS          = 0x10
 };
 
+//! Reads the cleaning flags and queues the checks, the actual cleanup runs
+//! in the background through Update() once the world is running
 void CleanDatabase();
+void Update(uint32 diff);
 
 void CheckUnique(const char* column, const char* table, bool (*check)(uint32));
 
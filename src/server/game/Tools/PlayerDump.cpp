@@ -117,24 +117,6 @@ DumpTable const DumpTables[] = {
 
 uint32 const DUMP_TABLE_COUNT = std::extent<decltype(DumpTables)>::value;
 
-// helper class to dump sql queries to a printable string
-class StringTransaction {
-public:
-    StringTransaction() : _buf() {}
-
-    void Append(char const* sql)
-    {
-        std::ostringstream oss;
-        oss << sql << '\n';
-        _buf += oss.str();
-    }
-
-    char const* GetBuffer() const { return _buf.c_str(); }
-
-private:
-    std::string _buf;
-};
-
 // dynamic data, loaded at startup
 struct TableField {
     std::string FieldName;
@@ -551,48 +533,50 @@ inline bool ChangeGuid(TableStruct const&      ts,
     return ChangeColumn(ts, str, column, chritem, allowZero);
 }
 
-inline void AppendTableDump(StringTransaction& trans,
+inline void AppendTableDump(std::ostream&      out,
                             TableStruct const& tableStruct,
                             QueryResult        result)
 {
     if (!result)
         return;
 
-    do {
-        std::ostringstream ss;
-        ss << "INSERT INTO `" << tableStruct.TableName << "` (";
-        for (auto itr = tableStruct.TableFields.begin();
-             itr != tableStruct.TableFields.end();) {
-            ss << '`' << itr->FieldName << '`';
-            ++itr;
-
-            if (itr != tableStruct.TableFields.end())
-                ss << ", ";
-        }
-        ss << ") VALUES (";
+    // the column list is the same for every row of the table
+    std::ostringstream header;
+    header << "INSERT INTO `" << tableStruct.TableName << "` (";
+    for (auto itr = tableStruct.TableFields.begin();
+         itr != tableStruct.TableFields.end();) {
+        header << '`' << itr->FieldName << '`';
+        ++itr;
+
+        if (itr != tableStruct.TableFields.end())
+            header << ", ";
+    }
+    header << ") VALUES (";
+
+    std::string const insertHeader = header.str();
+    uint32 const      fieldSize    = uint32(tableStruct.TableFields.size());
 
-        uint32 const fieldSize = uint32(tableStruct.TableFields.size());
-        Field*       fields    = result->Fetch();
+    std::string value;
+    do {
+        out << insertHeader;
 
+        Field* fields = result->Fetch();
         for (uint32 i = 0; i < fieldSize;) {
-            std::string cString = fields[i].Get<std::string>();
+            value = fields[i].Get<std::string>();
             ++i;
 
             // null pointer -> we have null
-            if (cString.empty())
-                ss << "'NULL'";
+            if (value.empty())
+                out << "'NULL'";
             else {
-                std::string s(cString);
-                CharacterDatabase.EscapeString(s);
-                ss << '\'' << s << '\'';
+                CharacterDatabase.EscapeString(value);
+                out << '\'' << value << '\'';
             }
 
             if (i != fieldSize)
-                ss << ", ";
+                out << ", ";
         }
-        ss << ");";
-
-        trans.Append(ss.str().c_str());
+        out << ");\n";
     } while (result->NextRow());
 }
 
@@ -604,24 +588,34 @@ inline std::string GenerateWhereStr(std::string const&  field,
     return whereStr.str();
 }
 
+// Splits the set into as many IN lists as needed to keep every query below
+// MAX_QUERY_LEN, so huge banks and mailboxes are not cut off
 template <typename T, template <class, class...> class SetType, class... Rest>
-inline std::string GenerateWhereStr(std::string const&         field,
-                                    SetType<T, Rest...> const& guidSet)
+inline std::vector<std::string>
+GenerateWhereStrs(std::string const& field, SetType<T, Rest...> const& guidSet)
 {
-    std::ostringstream whereStr;
-    whereStr << field << " IN ('";
-    for (auto itr = guidSet.begin(); itr != guidSet.end();) {
-        whereStr << *itr;
-        ++itr;
+    std::vector<std::string> whereStrs;
 
-        if (whereStr.str().size() > MAX_QUERY_LEN - 50) // near to max query
-            break;
+    std::string whereStr;
+    for (T const& guid : guidSet) {
+        if (whereStr.empty())
+            whereStr = field + " IN ('";
+        else
+            whereStr += "','";
+
+        whereStr += std::to_string(guid);
 
-        if (itr != guidSet.end())
-            whereStr << "','";
+        // near to max query
+        if (whereStr.size() > MAX_QUERY_LEN - 50) {
+            whereStrs.push_back(whereStr + "')");
+            whereStr.clear();
+        }
     }
-    whereStr << "')";
-    return whereStr.str();
+
+    if (!whereStr.empty())
+        whereStrs.push_back(whereStr + "')");
+
+    return whereStrs;
 }
 
 // Writing - High-level functions
@@ -674,89 +668,85 @@ void PlayerDumpWriter::PopulateGuids(ObjectGuid::LowType guid)
     }
 }
 
-bool PlayerDumpWriter::AppendTable(StringTransaction&  trans,
+bool PlayerDumpWriter::AppendTable(std::ostream&       out,
                                    ObjectGuid::LowType guid,
                                    TableStruct const&  tableStruct,
                                    DumpTable const&    dumpTable)
 {
-    std::string whereStr;
+    std::vector<std::string> whereStrs;
     switch (dumpTable.Type) {
     case DTT_ITEM:
     case DTT_ITEM_GIFT:
-        if (_items.empty())
-            return true;
-
-        whereStr = GenerateWhereStr(tableStruct.WhereFieldName, _items);
+        whereStrs = GenerateWhereStrs(tableStruct.WhereFieldName, _items);
         break;
     case DTT_PET_TABLE:
-        if (_pets.empty())
-            return true;
-
-        whereStr = GenerateWhereStr(tableStruct.WhereFieldName, _pets);
+        whereStrs = GenerateWhereStrs(tableStruct.WhereFieldName, _pets);
         break;
     case DTT_MAIL_ITEM:
-        if (_mails.empty())
-            return true;
-
-        whereStr = GenerateWhereStr(tableStruct.WhereFieldName, _mails);
+        whereStrs = GenerateWhereStrs(tableStruct.WhereFieldName, _mails);
         break;
     case DTT_EQSET_TABLE:
-        if (_itemSets.empty())
-            return true;
-
-        whereStr = GenerateWhereStr(tableStruct.WhereFieldName, _itemSets);
+        whereStrs = GenerateWhereStrs(tableStruct.WhereFieldName, _itemSets);
         break;
     default:
         // not set case, get single guid string
-        whereStr = GenerateWhereStr(tableStruct.WhereFieldName, guid);
+        whereStrs.push_back(
+            GenerateWhereStr(tableStruct.WhereFieldName, guid));
         break;
     }
 
-    QueryResult result = CharacterDatabase.Query(
-        "SELECT * FROM {} WHERE {}", dumpTable.Name, whereStr);
-    switch (dumpTable.Type) {
-    case DTT_CHARACTER:
-        if (result) {
-            // characters.deleteInfos_Account - if filled error
-            int32 index =
-                GetColumnIndexByName(tableStruct, "deleteInfos_Account");
-            ASSERT(index != -1); // checked at startup
-
-            if ((*result)[index].Get<uint32>())
-                return false;
+    for (std::string const& whereStr : whereStrs) {
+        QueryResult result = CharacterDatabase.Query(
+            "SELECT * FROM {} WHERE {}", dumpTable.Name, whereStr);
+        switch (dumpTable.Type) {
+        case DTT_CHARACTER:
+            if (result) {
+                // characters.deleteInfos_Account - if filled error
+                int32 index =
+                    GetColumnIndexByName(tableStruct, "deleteInfos_Account");
+                ASSERT(index != -1); // checked at startup
+
+                if ((*result)[index].Get<uint32>())
+                    return false;
+            }
+            break;
+        default:
+            break;
         }
-        break;
-    default:
-        break;
+
+        AppendTableDump(out, tableStruct, result);
     }
 
-    AppendTableDump(trans, tableStruct, result);
     return true;
 }
 
-bool PlayerDumpWriter::GetDump(ObjectGuid::LowType guid, std::string& dump)
+bool PlayerDumpWriter::GetDump(ObjectGuid::LowType guid, std::ostream& out)
 {
-    dump = "IMPORTANT NOTE: THIS DUMPFILE IS MADE FOR USE WITH THE 'PDUMP' "
+    out << "IMPORTANT NOTE: THIS DUMPFILE IS MADE FOR USE WITH THE 'PDUMP' "
            "COMMAND ONLY - EITHER THROUGH INGAME CHAT OR ON CONSOLE!\n";
-    dump += "IMPORTANT NOTE: DO NOT apply it directly - it will irreversibly "
-            "DAMAGE and CORRUPT your database! You have been warned!\n\n";
-
-    StringTransaction trans;
+    out << "IMPORTANT NOTE: DO NOT apply it directly - it will irreversibly "
+           "DAMAGE and CORRUPT your database! You have been warned!\n\n";
 
     // collect guids
     PopulateGuids(guid);
     for (uint32 i = 0; i < DUMP_TABLE_COUNT; ++i)
-        if (!AppendTable(trans, guid, CharacterTables[i], DumpTables[i]))
+        if (!AppendTable(out, guid, CharacterTables[i], DumpTables[i]))
             return false;
 
-    dump += trans.GetBuffer();
-
     /// @todo Add instance/group..
     /// @todo Add a dump level option to skip some non-important tables
 
     return true;
 }
 
+bool PlayerDumpWriter::GetDump(ObjectGuid::LowType guid, std::string& dump)
+{
+    std::ostringstream out;
+    bool               ret = GetDump(guid, out);
+    dump                   = out.str();
+    return ret;
+}
+
 DumpReturn PlayerDumpWriter::WriteDumpToFile(std::string const&  file,
                                              ObjectGuid::LowType guid)
 {
@@ -770,16 +760,15 @@ DumpReturn PlayerDumpWriter::WriteDumpToFile(std::string const&  file,
             return DUMP_FILE_OPEN_ERROR;
     }
 
-    FileHandle fout = GetFileHandle(file.c_str(), "w");
+    // rows are written through to the file as they are fetched
+    std::ofstream fout(file, std::ios::out | std::ios::trunc);
     if (!fout)
         return DUMP_FILE_OPEN_ERROR;
 
-    DumpReturn  ret = DUMP_SUCCESS;
-    std::string dump;
-    if (!GetDump(guid, dump))
+    DumpReturn ret = DUMP_SUCCESS;
+    if (!GetDump(guid, fout))
         ret = DUMP_CHARACTER_DELETED;
 
-    fprintf(fout.get(), "%s", dump.c_str());
     return ret;
 }
 
@@ -799,10 +788,65 @@ inline void FixNULLfields(std::string& line)
     size_t                   pos = line.find(NullString);
     while (pos != std::string::npos) {
         line.replace(pos, NullString.length(), "NULL");
-        pos = line.find(NullString);
+        pos = line.find(NullString, pos + 4);
     }
 }
 
+// Merges consecutive rows of the same table into multi-row INSERTs, the
+// import then runs a statement per batch instead of one per row
+class BulkInsertBuilder {
+public:
+    explicit BulkInsertBuilder(CharacterDatabaseTransaction trans)
+        : _trans(std::move(trans))
+    {
+    }
+
+    void Append(std::string const& line)
+    {
+        // only lines of the current format ("INSERT INTO `t` (`a`, ...)
+        // VALUES (...);") are merged, anything else is passed through
+        std::string::size_type valuesPos = line.find("`) VALUES (");
+        std::string::size_type endPos    = line.find_last_not_of(" \t\r\n");
+        if (valuesPos == std::string::npos || endPos == std::string::npos ||
+            line[endPos] != ';') {
+            Flush();
+            _trans->Append(line);
+            return;
+        }
+
+        // "`) VALUES " is kept in the header, the row starts at its '('
+        std::string_view header(line.data(), valuesPos + 10);
+        std::string_view row(line.data() + valuesPos + 10,
+                             endPos - valuesPos - 10);
+
+        if (_statement.empty() || header != _header ||
+            _statement.size() + row.size() + 2 > MAX_QUERY_LEN) {
+            Flush();
+            _header.assign(header);
+            _statement.assign(header);
+        }
+        else
+            _statement += ", ";
+
+        _statement += row;
+    }
+
+    void Flush()
+    {
+        if (_statement.empty())
+            return;
+
+        _statement += ';';
+        _trans->Append(_statement);
+        _statement.clear();
+    }
+
+private:
+    CharacterDatabaseTransaction _trans;
+    std::string                  _header;
+    std::string                  _statement;
+};
+
 DumpReturn PlayerDumpReader::LoadDump(std::istream&       input,
                                       uint32              account,
                                       std::string         name,
@@ -875,6 +919,7 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream&       input,
     size_t lineNumber = 0;
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    BulkInsertBuilder            inserts(trans);
     while (std::getline(input, line)) {
         ++lineNumber;
 
@@ -1002,12 +1047,14 @@ DumpReturn PlayerDumpReader::LoadDump(std::istream&       input,
 
         FixNULLfields(line);
 
-        trans->Append(line.c_str());
+        inserts.Append(line);
     }
 
     if (input.fail() && !input.eof())
         return DUMP_FILE_BROKEN;
 
+    inserts.Flush();
+
     CharacterDatabase.CommitTransaction(trans);
 
     // in case of name conflict player has to rename at login anyway
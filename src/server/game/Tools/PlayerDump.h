@@ -68,7 +68,6 @@ enum DumpReturn {
 
 struct DumpTable;
 struct TableStruct;
-class StringTransaction;
 
 class PlayerDump {
 public:
@@ -83,12 +82,13 @@ public:
     PlayerDumpWriter() {}
 
     bool       GetDump(ObjectGuid::LowType guid, std::string& dump);
+    bool       GetDump(ObjectGuid::LowType guid, std::ostream& out);
     DumpReturn WriteDumpToFile(std::string const&  file,
                                ObjectGuid::LowType guid);
     DumpReturn WriteDumpToString(std::string& dump, ObjectGuid::LowType guid);
 
 private:
-    bool AppendTable(StringTransaction&  trans,
+    bool AppendTable(std::ostream&       out,
                      ObjectGuid::LowType guid,
                      TableStruct const&  tableStruct,
                      DumpTable const&    dumpTable);
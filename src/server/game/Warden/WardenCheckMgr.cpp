@@ -17,6 +17,8 @@
  */
 
 #include "WardenCheckMgr.h"
+#include "Cryptography/BigNumber.h"
+#include "CryptoConstants.h"
 #include "Database/DatabaseEnv.h"
 #include "Log.h"
 #include "Util.h"
@@ -114,9 +116,18 @@ void WardenCheckMgr::LoadWardenChecks()
         }
 
         if (checkType == MPQ_CHECK || checkType == MEM_CHECK) {
-            WardenCheckResult wr;
-            wr.Result.SetHexStr(checkResult.c_str());
-            CheckResultStore[id] = wr;
+            BigNumber expected;
+            expected.SetHexStr(checkResult.c_str());
+
+            // MPQ results are SHA1 digests, MEM results at least as long as
+            // the memory range the client reads back
+            int32 const resultSize =
+                checkType == MPQ_CHECK
+                    ? Acore::Crypto::Constants::SHA1_DIGEST_LENGTH_BYTES
+                    : length;
+
+            WardenCheckResult& wr = CheckResultStore[id];
+            wr.Result             = expected.ToByteVector(resultSize, false);
         }
 
         if (comment.empty())
@@ -151,8 +162,11 @@ void WardenCheckMgr::LoadWardenChecks()
         }
         default: {
             if (checkType == PAGE_CHECK_A || checkType == PAGE_CHECK_B ||
-                checkType == DRIVER_CHECK)
-                wardenCheck.Data.SetHexStr(data.c_str());
+                checkType == DRIVER_CHECK) {
+                BigNumber checkData;
+                checkData.SetHexStr(data.c_str());
+                wardenCheck.Data = checkData.ToByteVector(24, false);
+            }
 
             CheckIdPool[WARDEN_CHECK_OTHER_TYPE].push_back(id);
             break;
@@ -19,8 +19,11 @@
 #ifndef _WARDENCHECKMGR_H
 #define _WARDENCHECKMGR_H
 
-#include "Cryptography/BigNumber.h"
+#include "Define.h"
+#include <array>
 #include <map>
+#include <string>
+#include <vector>
 
 // EnumUtils: DESCRIBE THIS
 enum WardenActions : uint8 {
@@ -41,7 +44,7 @@ constexpr uint8 MAX_WARDEN_CHECK_TYPES = 3;
 
 struct WardenCheck {
     uint8               Type;
-    BigNumber           Data;
+    std::vector<uint8>  Data;    // PAGE_CHECK, DRIVER
     uint32              Address; // PROC_CHECK, MEM_CHECK, PAGE_CHECK
     uint8               Length;  // PROC_CHECK, MEM_CHECK, PAGE_CHECK
     std::string         Str;     // LUA, MPQ, DRIVER
@@ -53,8 +56,10 @@ struct WardenCheck {
 
 constexpr uint8 WARDEN_MAX_LUA_CHECK_LENGTH = 170;
 
+// Expected client answer, decoded once at load so responses can be compared
+// in place
 struct WardenCheckResult {
-    BigNumber Result; // MEM_CHECK
+    std::vector<uint8> Result; // MEM_CHECK, MPQ_CHECK
 };
 
 class WardenCheckMgr {
@@ -88,10 +88,8 @@ static uint16 GetCheckPacketSize(WardenCheck const* check)
                  1); // 1 byte string length
     }
 
-    BigNumber tempNumber = check->Data;
-    if (!tempNumber.GetNumBytes()) {
-        size += tempNumber.GetNumBytes();
-    }
+    // PAGE_CHECK and DRIVER seed/hash bytes
+    size += static_cast<uint16>(check->Data.size());
     return size;
 }
 
@@ -293,6 +291,18 @@ void WardenWin::ForceChecks()
     RequestChecks();
 }
 
+WardenCheck const* WardenWin::GetCheck(uint16 checkId)
+{
+    WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(checkId);
+
+    // Custom payload should be loaded in if equal to over offset.
+    if (!check && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin) {
+        check = _payloadMgr.GetPayloadById(checkId);
+    }
+
+    return check;
+}
+
 void WardenWin::RequestChecks()
 {
     LOG_DEBUG("warden", "Request data");
@@ -310,28 +320,18 @@ void WardenWin::RequestChecks()
     _CurrentChecks.clear();
 
     // Erase any nullptrs.
-    Acore::Containers::EraseIf(_PendingChecks, [this](uint16 id) {
-        WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(id);
-
-        // Custom payload should be loaded in if equal to over offset.
-        if (!check && id >= WardenPayloadMgr::WardenPayloadOffsetMin) {
-            if (_payloadMgr.CachedChecks.find(id) !=
-                _payloadMgr.CachedChecks.end()) {
-                check = &_payloadMgr.CachedChecks.at(id);
-            }
-        }
-
-        if (!check) {
-            return true;
-        }
-
-        return false;
-    });
+    Acore::Containers::EraseIf(_PendingChecks,
+                               [this](uint16 id) { return !GetCheck(id); });
 
     // No pending checks
     if (_PendingChecks.empty()) {
-        for (uint8 checkType = 0; checkType < MAX_WARDEN_CHECK_TYPES;
-             ++checkType) {
+        // Lua checks must be always in front
+        static constexpr uint8 checkTypeOrder[MAX_WARDEN_CHECK_TYPES] = {
+            WARDEN_CHECK_LUA_TYPE,
+            WARDEN_CHECK_MEM_TYPE,
+            WARDEN_CHECK_OTHER_TYPE};
+
+        for (uint8 const checkType : checkTypeOrder) {
             for (uint32 y = 0;
                  y < sWorld->getIntConfig(GetMaxWardenChecksForType(checkType));
                  ++y) {
@@ -352,44 +352,26 @@ void WardenWin::RequestChecks()
                         payloadId);
 
                     _payloadMgr.QueuedPayloads.pop_front();
-                    _CurrentChecks.push_front(payloadId);
+                    _CurrentChecks.push_back(payloadId);
 
                     continue;
                 }
 
                 // Get check id from the end and remove it from todo
-                uint16 const id = _ChecksTodo[checkType].back();
+                _CurrentChecks.push_back(_ChecksTodo[checkType].back());
                 _ChecksTodo[checkType].pop_back();
-
-                // Insert check to queue
-                if (checkType == WARDEN_CHECK_LUA_TYPE) {
-                    _CurrentChecks.push_front(id);
-                }
-                else {
-                    _CurrentChecks.push_back(id);
-                }
             }
         }
     }
     else {
-        bool hasLuaChecks = false;
-        for (uint16 const checkId : _PendingChecks) {
-            WardenCheck const* check =
-                sWardenCheckMgr->GetWardenDataById(checkId);
-
-            // Custom payload should be loaded in if equal to over offset.
-            if (!check && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin) {
-                check = &_payloadMgr.CachedChecks.at(checkId);
-            }
-
-            if (!hasLuaChecks && check->Type == LUA_EVAL_CHECK) {
-                hasLuaChecks = true;
-            }
-
-            _CurrentChecks.push_back(checkId);
-        }
-
-        // Always include lua checks
+        bool const hasLuaChecks =
+            std::any_of(_PendingChecks.begin(),
+                        _PendingChecks.end(),
+                        [this](uint16 id) {
+                            return GetCheck(id)->Type == LUA_EVAL_CHECK;
+                        });
+
+        // Always include lua checks, in front of the pending ones
         if (!hasLuaChecks) {
             for (uint32 i = 0;
                  i < sWorld->getIntConfig(
@@ -402,13 +384,14 @@ void WardenWin::RequestChecks()
                 }
 
                 // Get check id from the end and remove it from todo
-                uint16 const id = _ChecksTodo[WARDEN_CHECK_LUA_TYPE].back();
+                _CurrentChecks.push_back(
+                    _ChecksTodo[WARDEN_CHECK_LUA_TYPE].back());
                 _ChecksTodo[WARDEN_CHECK_LUA_TYPE].pop_back();
-
-                // Lua checks must be always in front
-                _CurrentChecks.push_front(id);
             }
         }
+
+        _CurrentChecks.insert(
+            _CurrentChecks.end(), _PendingChecks.begin(), _PendingChecks.end());
     }
 
     // Filter too high checks queue
@@ -417,12 +400,7 @@ void WardenWin::RequestChecks()
     _PendingChecks.clear();
     Acore::Containers::EraseIf(
         _CurrentChecks, [this, &expectedSize](uint16 id) {
-            WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(id);
-
-            // Custom payload should be loaded in if equal to over offset.
-            if (!check && id >= WardenPayloadMgr::WardenPayloadOffsetMin) {
-                check = &_payloadMgr.CachedChecks.at(id);
-            }
+            WardenCheck const* check = GetCheck(id);
 
             // Remove nullptr if it snuck in from earlier check.
             if (!check) {
@@ -440,16 +418,15 @@ void WardenWin::RequestChecks()
             return false;
         });
 
-    ByteBuffer buff;
+    ByteBuffer& buff = _requestBuffer;
+    buff.clear();
     buff << uint8(WARDEN_SMSG_CHEAT_CHECKS_REQUEST);
 
     for (uint16 const checkId : _CurrentChecks) {
-        WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(checkId);
+        WardenCheck const* check = GetCheck(checkId);
 
         // Custom payloads do not have prefix, midfix, postfix.
-        if (!check && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin) {
-            check = &_payloadMgr.CachedChecks.at(checkId);
-
+        if (!sWardenCheckMgr->GetWardenDataById(checkId)) {
             buff << uint8(check->Str.size());
             buff.append(check->Str.data(), check->Str.size());
 
@@ -486,12 +463,7 @@ void WardenWin::RequestChecks()
     uint8 index = 1;
 
     for (uint16 const checkId : _CurrentChecks) {
-        WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(checkId);
-
-        // Custom payload should be loaded in if equal to over offset.
-        if (!check && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin) {
-            check = &_payloadMgr.CachedChecks.at(checkId);
-        }
+        WardenCheck const* check = GetCheck(checkId);
 
         buff << uint8(check->Type ^ xorByte);
         switch (check->Type) {
@@ -503,8 +475,7 @@ void WardenWin::RequestChecks()
         }
         case PAGE_CHECK_A:
         case PAGE_CHECK_B: {
-            std::vector<uint8> data = check->Data.ToByteVector(24, false);
-            buff.append(data.data(), data.size());
+            buff.append(check->Data.data(), check->Data.size());
             buff << uint32(check->Address);
             buff << uint8(check->Length);
             break;
@@ -515,8 +486,7 @@ void WardenWin::RequestChecks()
             break;
         }
         case DRIVER_CHECK: {
-            std::vector<uint8> data = check->Data.ToByteVector(24, false);
-            buff.append(data.data(), data.size());
+            buff.append(check->Data.data(), check->Data.size());
             buff << uint8(index++);
             break;
         }
@@ -548,13 +518,15 @@ void WardenWin::RequestChecks()
 
     _dataSent = true;
 
-    std::stringstream stream;
-    stream << "Sent check id's: ";
-    for (uint16 checkId : _CurrentChecks) {
-        stream << checkId << " ";
-    }
+    if (sLog->ShouldLog("warden", LogLevel::LOG_LEVEL_DEBUG)) {
+        std::stringstream stream;
+        stream << "Sent check id's: ";
+        for (uint16 checkId : _CurrentChecks) {
+            stream << checkId << " ";
+        }
 
-    LOG_DEBUG("warden", "{}", stream.str());
+        LOG_DEBUG("warden", "{}", stream.str());
+    }
 }
 
 void WardenWin::HandleData(ByteBuffer& buff)
@@ -618,11 +590,11 @@ void WardenWin::HandleData(ByteBuffer& buff)
     uint16 checkFailed = 0;
 
     for (uint16 const checkId : _CurrentChecks) {
-        WardenCheck const* rd = sWardenCheckMgr->GetWardenDataById(checkId);
+        WardenCheck const* rd = GetCheck(checkId);
 
-        // Custom payload should be loaded in if equal to over offset.
-        if (!rd && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin) {
-            rd = &_payloadMgr.CachedChecks.at(checkId);
+        // Payload was unregistered while the client was answering
+        if (!rd) {
+            break;
         }
 
         uint8 const type = rd->Type;
@@ -643,9 +615,8 @@ void WardenWin::HandleData(ByteBuffer& buff)
             WardenCheckResult const* rs =
                 sWardenCheckMgr->GetWardenResultById(checkId);
 
-            std::vector<uint8> result = rs->Result.ToByteVector(0, false);
             if (memcmp(buff.contents() + buff.rpos(),
-                       result.data(),
+                       rs->Result.data(),
                        rd->Length) != 0) {
                 LOG_DEBUG("warden",
                           "RESULT MEM_CHECK fail CheckId {} account Id {}",
@@ -750,7 +721,7 @@ void WardenWin::HandleData(ByteBuffer& buff)
             WardenCheckResult const* rs =
                 sWardenCheckMgr->GetWardenResultById(checkId);
             if (memcmp(buff.contents() + buff.rpos(),
-                       rs->Result.ToByteArray<20>(false).data(),
+                       rs->Result.data(),
                        Acore::Crypto::Constants::SHA1_DIGEST_LENGTH_BYTES) !=
                 0) // SHA1
             {
@@ -23,7 +23,7 @@
 #include "Cryptography/ARC4.h"
 #include "Cryptography/BigNumber.h"
 #include "Warden.h"
-#include <list>
+#include <vector>
 
 #if defined(__GNUC__)
 #pragma pack(1)
@@ -85,11 +85,17 @@ public:
     void                HandleData(ByteBuffer& buff) override;
 
 private:
-    uint32            _serverTicks;
-    std::list<uint16> _ChecksTodo[MAX_WARDEN_CHECK_TYPES];
+    // Looks up database checks and custom payloads alike
+    WardenCheck const* GetCheck(uint16 checkId);
 
-    std::list<uint16> _CurrentChecks;
-    std::list<uint16> _PendingChecks;
+    uint32              _serverTicks;
+    std::vector<uint16> _ChecksTodo[MAX_WARDEN_CHECK_TYPES];
+
+    std::vector<uint16> _CurrentChecks;
+    std::vector<uint16> _PendingChecks;
+
+    // Reused for every check request so its storage is only allocated once
+    ByteBuffer _requestBuffer;
 };
 
 #endif // _WARDEN_WIN_H
@@ -185,6 +185,7 @@ enum WorldBoolConfigs {
     CONFIG_STRICT_NAMES_RESERVED,
     CONFIG_STRICT_NAMES_PROFANITY,
     CONFIG_ALLOWS_RANK_MOD_FOR_PET_HEALTH,
+    CONFIG_MAP_UPDATE_REGIONS,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -195,6 +196,7 @@ enum WorldFloatConfigs {
     CONFIG_LISTEN_RANGE_SAY,
     CONFIG_LISTEN_RANGE_TEXTEMOTE,
     CONFIG_LISTEN_RANGE_YELL,
+    CONFIG_COMBAT_LOG_RANGE,
     CONFIG_CREATURE_FAMILY_FLEE_ASSISTANCE_RADIUS,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS,
     CONFIG_CHANCE_OF_GM_SURVEY,
@@ -202,6 +204,7 @@ enum WorldFloatConfigs {
     CONFIG_ARENA_WIN_RATING_MODIFIER_2,
     CONFIG_ARENA_LOSE_RATING_MODIFIER,
     CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER,
+    CONFIG_MAP_UPDATE_FAR_OBJECTS_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -369,6 +372,7 @@ enum WorldIntConfigs {
     CONFIG_PACKET_SPOOF_POLICY,
     CONFIG_PACKET_SPOOF_BANMODE,
     CONFIG_PACKET_SPOOF_BANDURATION,
+    CONFIG_PACKET_SPOOF_HANDLER_BUDGET,
     CONFIG_WARDEN_CLIENT_RESPONSE_DELAY,
     CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF,
     CONFIG_WARDEN_CLIENT_FAIL_ACTION,
@@ -417,6 +421,20 @@ enum WorldIntConfigs {
     CONFIG_WATER_BREATH_TIMER,
     CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT,
     CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD,
+    CONFIG_COMPRESSION_LARGE_PACKET_SIZE,
+    CONFIG_COMPRESSION_LARGE_PACKET_LEVEL,
+    CONFIG_MOVEMAPS_PATH_BUDGET,
+    CONFIG_VISIBILITY_UPDATE_BUDGET,
+    CONFIG_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_STARTUP_LOAD_THREADS,
+    CONFIG_CREATURE_IDLE_UPDATE_INTERVAL,
+    CONFIG_MAP_UPDATE_FAR_OBJECTS_TICKS,
+    CONFIG_TRANSPORT_POSITION_UPDATE_INTERVAL,
+    CONFIG_MAP_UPDATE_STATS_INTERVAL,
+    CONFIG_MAP_UPDATE_ITEM_GUID_BLOCK,
+    CONFIG_GROUP_STATS_HEALTH_INTERVAL,
+    CONFIG_GROUP_STATS_POSITION_INTERVAL,
+    CONFIG_GROUP_STATS_AURAS_INTERVAL,
     INT_CONFIG_VALUE_COUNT
 };
 
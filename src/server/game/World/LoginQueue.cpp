@@ -0,0 +1,129 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginQueue.h"
+#include <algorithm>
+
+namespace {
+constexpr std::size_t MIN_QUEUE_CAPACITY = 64;
+
+inline std::size_t LowBit(std::size_t i) { return i & (~i + 1); }
+} // namespace
+
+void LoginQueue::Push(WorldSession* session)
+{
+    if (_index.count(session))
+        return;
+
+    if (_slots.size() + 1 >= _tree.size())
+        Compact();
+
+    std::size_t slot = _slots.size();
+    _slots.push_back(session);
+    _index[session] = uint32(slot);
+    TreeAdd(slot, 1);
+}
+
+bool LoginQueue::Remove(WorldSession* session)
+{
+    auto itr = _index.find(session);
+    if (itr == _index.end())
+        return false;
+
+    std::size_t slot = itr->second;
+    _index.erase(itr);
+    _slots[slot] = nullptr;
+    TreeAdd(slot, -1);
+
+    while (_head < _slots.size() && !_slots[_head])
+        ++_head;
+
+    return true;
+}
+
+WorldSession* LoginQueue::Front() const
+{
+    return empty() ? nullptr : _slots[_head];
+}
+
+void LoginQueue::PopFront()
+{
+    if (!empty())
+        Remove(_slots[_head]);
+}
+
+uint32 LoginQueue::GetPosition(WorldSession* session) const
+{
+    auto itr = _index.find(session);
+    if (itr == _index.end())
+        return 0;
+
+    return TreePrefix(itr->second);
+}
+
+void LoginQueue::clear()
+{
+    _slots.clear();
+    _tree.clear();
+    _index.clear();
+    _head = 0;
+}
+
+void LoginQueue::Compact()
+{
+    std::vector<WorldSession*> live;
+    live.reserve(_index.size());
+    for (std::size_t i = _head; i < _slots.size(); ++i)
+        if (_slots[i])
+            live.push_back(_slots[i]);
+
+    _slots = std::move(live);
+    _head  = 0;
+
+    // Leave as much free room as there are live entries, so the next
+    // compaction is at least size() pushes away.
+    std::size_t capacity = std::max(MIN_QUEUE_CAPACITY, _slots.size() * 2);
+    _tree.assign(capacity + 1, 0);
+
+    // linear Fenwick construction, every remaining slot holds a live session
+    for (std::size_t i = 0; i < _slots.size(); ++i) {
+        _index[_slots[i]] = uint32(i);
+        _tree[i + 1]      = 1;
+    }
+
+    for (std::size_t i = 1; i < _tree.size(); ++i) {
+        std::size_t parent = i + LowBit(i);
+        if (parent < _tree.size())
+            _tree[parent] += _tree[i];
+    }
+}
+
+void LoginQueue::TreeAdd(std::size_t slot, int32 delta)
+{
+    for (std::size_t i = slot + 1; i < _tree.size(); i += LowBit(i))
+        _tree[i] += delta;
+}
+
+uint32 LoginQueue::TreePrefix(std::size_t slot) const
+{
+    int32 sum = 0;
+    for (std::size_t i = slot + 1; i > 0; i -= LowBit(i))
+        sum += _tree[i];
+
+    return uint32(sum);
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LOGIN_QUEUE_H
+#define __LOGIN_QUEUE_H
+
+#include "Define.h"
+#include <unordered_map>
+#include <vector>
+
+class WorldSession;
+
+/// FIFO of sessions waiting for a free realm slot.
+/// Every session gets a ticket slot in arrival order; a Fenwick tree over the
+/// slots keeps the live count so removal from the middle and position lookup
+/// are O(log n) instead of a full list scan. Dead slots are dropped by a
+/// compaction that runs in amortized O(1) per push.
+class AC_GAME_API LoginQueue {
+public:
+    void Push(WorldSession* session);
+    bool Remove(WorldSession* session);
+
+    [[nodiscard]] WorldSession* Front() const;
+    void                        PopFront();
+
+    /// 1-based position of the session, 0 if it is not queued
+    [[nodiscard]] uint32 GetPosition(WorldSession* session) const;
+
+    [[nodiscard]] uint32 size() const { return uint32(_index.size()); }
+    [[nodiscard]] bool   empty() const { return _index.empty(); }
+    void                 clear();
+
+    /// Calls fn(session, position) for every queued session in queue order
+    template <class Fn>
+    void ForEach(Fn&& fn) const
+    {
+        uint32 position = 0;
+        for (std::size_t i = _head; i < _slots.size(); ++i)
+            if (_slots[i])
+                fn(_slots[i], ++position);
+    }
+
+private:
+    void   Compact();
+    void   TreeAdd(std::size_t slot, int32 delta);
+    uint32 TreePrefix(std::size_t slot) const;
+
+    std::vector<WorldSession*>                 _slots;
+    std::vector<int32>                         _tree; // 1-based Fenwick tree
+    std::unordered_map<WorldSession*, uint32> _index; // session -> slot
+    std::size_t                                _head = 0;
+};
+
+#endif
@@ -0,0 +1,281 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerStateJournal.h"
+#include "ByteBuffer.h"
+#include "Config.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "Timer.h"
+#include <cstdio>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 JOURNAL_MAGIC = 0x314A5350; // "PSJ1"
+
+    enum JournalRecordType : uint8 {
+        JOURNAL_RECORD_POSITION = 1,
+        JOURNAL_RECORD_RESET    = 2
+    };
+
+    // type, guid, map, zone and four coordinates
+    constexpr std::size_t POSITION_RECORD_SIZE = 1 + 4 + 2 + 2 + 4 * 4;
+
+    // garbage of cancelled records tolerated before the journal is rewritten
+    constexpr std::size_t JOURNAL_COMPACT_SLACK = 4 * 1024 * 1024;
+} // namespace
+
+PlayerStateJournal* PlayerStateJournal::instance()
+{
+    static PlayerStateJournal instance;
+    return &instance;
+}
+
+void PlayerStateJournal::Initialize()
+{
+    _path = sConfigMgr->GetOption<std::string>("PlayerSave.Journal.File", "");
+    _interval =
+        sConfigMgr->GetOption<uint32>("PlayerSave.Journal.Interval", 10000);
+    _enabled = !_path.empty() && _interval;
+
+    if (!_enabled)
+        return;
+
+    Replay();
+    Open(true);
+}
+
+void PlayerStateJournal::Replay()
+{
+    uint32 oldMSTime = getMSTime();
+
+    std::ifstream file(_path, std::ios::binary);
+    if (!file)
+        return;
+
+    std::vector<char> contents((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+    if (contents.empty())
+        return;
+
+    ByteBuffer data(contents.size());
+    data.append(reinterpret_cast<uint8 const*>(contents.data()),
+                contents.size());
+
+    std::unordered_map<uint32, PlayerPosition> positions;
+    try {
+        if (data.read<uint32>() != JOURNAL_MAGIC) {
+            LOG_ERROR("server.loading",
+                      "Player state journal {} has an unknown format, "
+                      "skipped.",
+                      _path);
+            return;
+        }
+
+        while (data.rpos() < data.size()) {
+            uint8  type    = data.read<uint8>();
+            uint32 guidLow = data.read<uint32>();
+
+            if (type == JOURNAL_RECORD_RESET) {
+                positions.erase(guidLow);
+                continue;
+            }
+
+            if (type != JOURNAL_RECORD_POSITION)
+                break;
+
+            PlayerPosition position;
+            data >> position.mapId >> position.zoneId;
+            data >> position.x >> position.y >> position.z >> position.o;
+            positions[guidLow] = position;
+        }
+    }
+    catch (ByteBufferException const&) {
+        // the last record was cut short by the crash
+    }
+
+    if (positions.empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    for (auto const& [guidLow, position] : positions)
+        Player::SavePositionInDB(
+            WorldLocation(
+                position.mapId, position.x, position.y, position.z, position.o),
+            position.zoneId,
+            ObjectGuid::Create<HighGuid::Player>(guidLow),
+            trans);
+    CharacterDatabase.DirectCommitTransaction(trans);
+
+    LOG_INFO("server.loading",
+             ">> Restored {} player positions from the state journal in {} ms",
+             positions.size(),
+             GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", " ");
+}
+
+void PlayerStateJournal::Open(bool truncate)
+{
+    _file.open(_path,
+               std::ios::binary | (truncate ? std::ios::trunc : std::ios::app));
+    if (!_file) {
+        LOG_ERROR("server.loading",
+                  "Unable to open player state journal {}, journal disabled.",
+                  _path);
+        _enabled = false;
+        return;
+    }
+
+    if (truncate) {
+        _fileSize = 0;
+
+        ByteBuffer header(4);
+        header << JOURNAL_MAGIC;
+        Write(header);
+    }
+}
+
+void PlayerStateJournal::Write(ByteBuffer const& data)
+{
+    // flushed right away, a crash of the process cannot lose what the
+    // kernel already holds
+    _file.write(reinterpret_cast<char const*>(data.contents()), data.size());
+    _file.flush();
+    _fileSize += data.size();
+}
+
+void PlayerStateJournal::AppendPosition(ByteBuffer&           data,
+                                        uint32                guidLow,
+                                        PlayerPosition const& position)
+{
+    data << uint8(JOURNAL_RECORD_POSITION) << guidLow;
+    data << position.mapId << position.zoneId;
+    data << position.x << position.y << position.z << position.o;
+}
+
+void PlayerStateJournal::Update(uint32 diff)
+{
+    if (!_enabled)
+        return;
+
+    _timer += diff;
+    if (_timer < _interval)
+        return;
+
+    _timer = 0;
+
+    std::vector<std::pair<uint32, PlayerPosition>> positions;
+    {
+        std::shared_lock<std::shared_mutex> lock(
+            *HashMapHolder<Player>::GetLock());
+
+        HashMapHolder<Player>::MapType const& players =
+            ObjectAccessor::GetPlayers();
+        positions.reserve(players.size());
+        for (auto const& [guid, player] : players) {
+            // instance ids, transport offsets and taxi paths are only kept
+            // by full saves
+            if (!player->IsInWorld() || player->IsBeingTeleported() ||
+                player->GetTransport() || player->IsInFlight() ||
+                player->GetMap()->Instanceable() ||
+                !player->IsPositionValid())
+                continue;
+
+            positions.emplace_back(guid.GetCounter(),
+                                   PlayerPosition{uint16(player->GetMapId()),
+                                                  uint16(player->GetZoneId()),
+                                                  player->GetPositionX(),
+                                                  player->GetPositionY(),
+                                                  player->GetPositionZ(),
+                                                  player->GetOrientation()});
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    ByteBuffer data(positions.size() * POSITION_RECORD_SIZE);
+    for (auto const& [guidLow, position] : positions) {
+        auto [itr, inserted] = _pending.try_emplace(guidLow, position);
+        if (!inserted) {
+            // players standing still are not journaled again
+            if (itr->second == position)
+                continue;
+
+            itr->second = position;
+        }
+
+        AppendPosition(data, guidLow, position);
+    }
+
+    if (data.empty())
+        return;
+
+    Write(data);
+
+    if (_fileSize >
+        _pending.size() * POSITION_RECORD_SIZE + JOURNAL_COMPACT_SLACK)
+        Compact();
+}
+
+void PlayerStateJournal::ResetPlayer(uint32 guidLow)
+{
+    if (!_enabled)
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // nothing journaled since the last save
+    if (!_pending.erase(guidLow))
+        return;
+
+    ByteBuffer data(1 + 4);
+    data << uint8(JOURNAL_RECORD_RESET) << guidLow;
+    Write(data);
+}
+
+void PlayerStateJournal::Compact()
+{
+    ByteBuffer data(4 + _pending.size() * POSITION_RECORD_SIZE);
+    data << JOURNAL_MAGIC;
+    for (auto const& [guidLow, position] : _pending) {
+        AppendPosition(data, guidLow, position);
+    }
+
+    // the old journal stays in place until the new one is complete
+    std::string   tmpPath = _path + ".tmp";
+    std::ofstream tmp(tmpPath, std::ios::binary | std::ios::trunc);
+    tmp.write(reinterpret_cast<char const*>(data.contents()), data.size());
+    tmp.close();
+    if (!tmp) {
+        LOG_ERROR("server", "Unable to compact player state journal {}", _path);
+        return;
+    }
+
+    _file.close();
+    bool renamed = std::rename(tmpPath.c_str(), _path.c_str()) == 0;
+    Open(false);
+
+    if (renamed)
+        _fileSize = data.size();
+    else
+        LOG_ERROR("server", "Unable to compact player state journal {}", _path);
+}
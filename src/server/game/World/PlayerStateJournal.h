@@ -0,0 +1,85 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PLAYER_STATE_JOURNAL_H
+#define __PLAYER_STATE_JOURNAL_H
+
+#include "Define.h"
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class ByteBuffer;
+
+/// Append-only file of player positions written between full saves.
+/// Online players outside of instances are journaled every
+/// PlayerSave.Journal.Interval; a full save or a logout appends a reset record
+/// that cancels the older records of that character. After a crash the
+/// records that were not cancelled are written to the characters table on
+/// the next startup, so players do not lose the way they travelled since
+/// their last save.
+class AC_GAME_API PlayerStateJournal {
+public:
+    static PlayerStateJournal* instance();
+
+    /// Replays the journal left by the previous run and starts a new one.
+    void Initialize();
+    /// Journals the positions of online players, world thread only.
+    void Update(uint32 diff);
+    /// Cancels the journaled state of a character, called from map threads.
+    void ResetPlayer(uint32 guidLow);
+
+    [[nodiscard]] bool IsEnabled() const { return _enabled; }
+
+private:
+    struct PlayerPosition {
+        uint16 mapId;
+        uint16 zoneId;
+        float  x;
+        float  y;
+        float  z;
+        float  o;
+
+        bool operator==(PlayerPosition const& right) const = default;
+    };
+
+    static void AppendPosition(ByteBuffer&           data,
+                               uint32                guidLow,
+                               PlayerPosition const& position);
+
+    void Replay();
+    void Open(bool truncate);
+    void Write(ByteBuffer const& data);
+    void Compact();
+
+    bool        _enabled{false};
+    std::string _path;
+    uint32      _interval{0};
+    uint32      _timer{0};
+
+    std::mutex    _lock;
+    std::ofstream _file;
+    std::size_t   _fileSize{0};
+    // last journaled position of every character not saved since
+    std::unordered_map<uint32, PlayerPosition> _pending;
+};
+
+#define sPlayerStateJournal PlayerStateJournal::instance()
+
+#endif
@@ -42,6 +42,7 @@
 #include "CreatureAIRegistry.h"
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
+#include "CryptoHash.h"
 #include "DBCStores.h"
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
@@ -65,20 +66,26 @@
 #include "MapMgr.h"
 #include "Metric.h"
 #include "MotdMgr.h"
+#include "NetworkStats.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerStateJournal.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "TaskScheduler.h"
+#include "TickProfiler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
 #include "TransportMgr.h"
@@ -96,10 +103,34 @@
 #include "WorldSession.h"
 #include <boost/asio/ip/address.hpp>
 #include <cmath>
+#include <cstring>
 
 namespace {
 TaskScheduler playersSaveScheduler;
+
+/// The world query snapshot is valid as long as the same core revision runs
+/// against a world database with the same applied updates
+uint64 GetWorldQuerySnapshotKey()
+{
+    Acore::Crypto::SHA1 hash;
+    hash.UpdateData(GitRevision::GetHash());
+
+    if (QueryResult result = WorldDatabase.Query(
+            "SELECT `name`, `hash` FROM `updates` ORDER BY `name`")) {
+        do {
+            Field* fields = result->Fetch();
+            hash.UpdateData(fields[0].Get<std::string>());
+            hash.UpdateData(fields[1].Get<std::string>());
+        } while (result->NextRow());
+    }
+
+    hash.Finalize();
+
+    uint64 key = 0;
+    std::memcpy(&key, hash.GetDigest().data(), sizeof(key));
+    return key;
 }
+} // namespace
 
 std::atomic_long World::_stopEvent         = false;
 uint8            World::_exitCode          = SHUTDOWN_EXIT_CODE;
@@ -338,72 +369,60 @@ bool World::HasRecentlyDisconnected(WorldSession* session)
 
 int32 World::GetQueuePos(WorldSession* sess)
 {
-    uint32 position = 1;
-
-    for (Queue::const_iterator iter = _queuedPlayer.begin();
-         iter != _queuedPlayer.end();
-         ++iter, ++position)
-        if ((*iter) == sess)
-            return position;
-
-    return 0;
+    return _queuedPlayer.GetPosition(sess);
 }
 
 void World::AddQueuedPlayer(WorldSession* sess)
 {
     sess->SetInQueue(true);
-    _queuedPlayer.push_back(sess);
+    _queuedPlayer.Push(sess);
 
     // The 1st SMSG_AUTH_RESPONSE needs to contain other info too.
-    sess->SendAuthResponse(AUTH_WAIT_QUEUE, false, GetQueuePos(sess));
+    sess->SendAuthResponse(AUTH_WAIT_QUEUE, false, _queuedPlayer.size());
 }
 
 bool World::RemoveQueuedPlayer(WorldSession* sess)
 {
     uint32 sessions = GetActiveSessionCount();
 
-    uint32          position = 1;
-    Queue::iterator iter     = _queuedPlayer.begin();
-
-    // search to remove and count skipped positions
-    bool found = false;
-
-    for (; iter != _queuedPlayer.end(); ++iter, ++position) {
-        if (*iter == sess) {
-            sess->SetInQueue(false);
-            sess->ResetTimeOutTime(false);
-            iter  = _queuedPlayer.erase(iter);
-            found = true;
-            break;
-        }
+    bool found = _queuedPlayer.Remove(sess);
+    if (found) {
+        sess->SetInQueue(false);
+        sess->ResetTimeOutTime(false);
     }
-
     // if session not queued then it was an active session
-    if (!found) {
+    else {
         ASSERT(sessions > 0);
         --sessions;
     }
 
     // accept first in queue
+    bool popped = false;
     if ((!GetPlayerAmountLimit() || sessions < GetPlayerAmountLimit()) &&
         !_queuedPlayer.empty()) {
-        WorldSession* pop_sess = _queuedPlayer.front();
+        WorldSession* pop_sess = _queuedPlayer.Front();
         pop_sess->InitializeSession();
-        _queuedPlayer.pop_front();
-
-        // update iter to point first queued socket or end() if queue is empty
-        // now
-        iter     = _queuedPlayer.begin();
-        position = 1;
+        _queuedPlayer.PopFront();
+        popped = true;
     }
 
-    // update queue position from iter to end()
-    for (; iter != _queuedPlayer.end(); ++iter, ++position)
-        (*iter)->SendAuthWaitQueue(position);
+    // positions of the sessions left behind are sent in one batch by
+    // SendQueuePositions instead of on every single removal
+    if ((found || popped) && !_queuedPlayer.empty())
+        _queuePositionsChanged = true;
 
     return found;
 }
 
+void World::SendQueuePositions()
+{
+    _queuePositionsChanged = false;
+
+    _queuedPlayer.ForEach([](WorldSession* session, uint32 position) {
+        session->SendAuthWaitQueue(position);
+    });
+}
+
 /// Initialize config values
 void World::LoadConfigSettings(bool reload)
 {
@@ -425,6 +444,9 @@ void World::LoadConfigSettings(bool reload)
 
     // load update time related configs
     sWorldUpdateTime.LoadFromConfig();
+    sTickProfiler->LoadFromConfig();
+    sScriptProfiler->LoadFromConfig();
+    sNetworkStats->LoadFromConfig();
 
     ///- Read the player limit and the Message of the day from the config file
     if (!reload) {
@@ -760,6 +782,22 @@ void World::LoadConfigSettings(bool reload)
                   _int_configs[CONFIG_COMPRESSION]);
         _int_configs[CONFIG_COMPRESSION] = 1;
     }
+
+    _int_configs[CONFIG_COMPRESSION_LARGE_PACKET_SIZE] =
+        sConfigMgr->GetOption<int32>("Compression.LargePacketSize", 0);
+    _int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] =
+        sConfigMgr->GetOption<int32>("Compression.LargePacketLevel",
+                                     _int_configs[CONFIG_COMPRESSION]);
+    if (_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] < 1 ||
+        _int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] > 9) {
+        LOG_ERROR("server.loading",
+                  "Compression.LargePacketLevel ({}) must be in range 1..9. "
+                  "Using Compression ({}).",
+                  _int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL],
+                  _int_configs[CONFIG_COMPRESSION]);
+        _int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] =
+            _int_configs[CONFIG_COMPRESSION];
+    }
     _bool_configs[CONFIG_ADDON_CHANNEL] =
         sConfigMgr->GetOption<bool>("AddonChannel", true);
     _bool_configs[CONFIG_CLEAN_CHARACTER_DB] =
@@ -1259,6 +1297,9 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_OBJECT_QUEST_MARKERS] =
         sConfigMgr->GetOption<bool>("Visibility.ObjectQuestMarkers", true);
 
+    _int_configs[CONFIG_VISIBILITY_UPDATE_BUDGET] =
+        sConfigMgr->GetOption<uint32>("Visibility.UpdateBudget", 0);
+
     _int_configs[CONFIG_MAIL_DELIVERY_DELAY] =
         sConfigMgr->GetOption<int32>("MailDeliveryDelay", HOUR);
 
@@ -1528,6 +1569,8 @@ void World::LoadConfigSettings(bool reload)
         sConfigMgr->GetOption<float>("ListenRange.TextEmote", 25.0f);
     _float_configs[CONFIG_LISTEN_RANGE_YELL] =
         sConfigMgr->GetOption<float>("ListenRange.Yell", 300.0f);
+    _float_configs[CONFIG_COMBAT_LOG_RANGE] =
+        sConfigMgr->GetOption<float>("CombatLog.Range", 0.0f);
 
     _bool_configs[CONFIG_BATTLEGROUND_DISABLE_QUEST_SHARE_IN_BG] =
         sConfigMgr->GetOption<bool>("Battleground.DisableQuestShareInBG",
@@ -1676,6 +1719,8 @@ void World::LoadConfigSettings(bool reload)
     _int_configs[CONFIG_CREATURE_STOP_FOR_PLAYER] =
         sConfigMgr->GetOption<uint32>("Creature.MovingStopTimeForPlayer",
                                       3 * MINUTE * IN_MILLISECONDS);
+    _int_configs[CONFIG_CREATURE_IDLE_UPDATE_INTERVAL] =
+        sConfigMgr->GetOption<uint32>("Creature.IdleUpdateInterval", 0);
 
     _int_configs[CONFIG_WATER_BREATH_TIMER] =
         sConfigMgr->GetOption<uint32>("WaterBreath.Timer", 180000);
@@ -1806,6 +1851,13 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_LEAVE_GROUP_ON_LOGOUT] =
         sConfigMgr->GetOption<bool>("LeaveGroupOnLogout.Enabled", true);
 
+    _int_configs[CONFIG_GROUP_STATS_HEALTH_INTERVAL] =
+        sConfigMgr->GetOption<uint32>("Group.MemberStats.HealthInterval", 0);
+    _int_configs[CONFIG_GROUP_STATS_POSITION_INTERVAL] =
+        sConfigMgr->GetOption<uint32>("Group.MemberStats.PositionInterval", 0);
+    _int_configs[CONFIG_GROUP_STATS_AURAS_INTERVAL] =
+        sConfigMgr->GetOption<uint32>("Group.MemberStats.AurasInterval", 0);
+
     _bool_configs[CONFIG_QUEST_POI_ENABLED] =
         sConfigMgr->GetOption<bool>("QuestPOI.Enabled", true);
 
@@ -1908,6 +1960,19 @@ void World::LoadConfigSettings(bool reload)
         sConfigMgr->GetOption<bool>("ShowBanInWorld", false);
     _int_configs[CONFIG_NUMTHREADS] =
         sConfigMgr->GetOption<int32>("MapUpdate.Threads", 1);
+    _bool_configs[CONFIG_MAP_UPDATE_REGIONS] =
+        sConfigMgr->GetOption<bool>("MapUpdate.Regions", false);
+    _int_configs[CONFIG_MAP_UPDATE_FAR_OBJECTS_TICKS] =
+        sConfigMgr->GetOption<uint32>("MapUpdate.FarObjects.Ticks", 1);
+    _float_configs[CONFIG_MAP_UPDATE_FAR_OBJECTS_DISTANCE] =
+        sConfigMgr->GetOption<float>("MapUpdate.FarObjects.Distance", 100.0f);
+    _int_configs[CONFIG_TRANSPORT_POSITION_UPDATE_INTERVAL] =
+        sConfigMgr->GetOption<uint32>("MapUpdate.Transports.PositionInterval",
+                                      1);
+    _int_configs[CONFIG_MAP_UPDATE_STATS_INTERVAL] =
+        sConfigMgr->GetOption<uint32>("MapUpdate.Stats.Interval", 10);
+    _int_configs[CONFIG_MAP_UPDATE_ITEM_GUID_BLOCK] =
+        sConfigMgr->GetOption<uint32>("MapUpdate.ItemGuidBlock", 0);
     _int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] =
         sConfigMgr->GetOption<int32>("Command.LookupMaxResults", 0);
 
@@ -1967,6 +2032,8 @@ void World::LoadConfigSettings(bool reload)
         sConfigMgr->GetOption<bool>("PlayerDump.DisallowOverwrite", true);
     _bool_configs[CONFIG_ENABLE_MMAPS] =
         sConfigMgr->GetOption<bool>("MoveMaps.Enable", true);
+    _int_configs[CONFIG_MOVEMAPS_PATH_BUDGET] =
+        sConfigMgr->GetOption<uint32>("MoveMaps.PathBudget", 0);
     MMAP::MMapFactory::InitializeDisabledMaps();
 
     // Wintergrasp
@@ -2020,6 +2087,10 @@ void World::LoadConfigSettings(bool reload)
     // Preload all grids of all non-instanced maps
     _bool_configs[CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS] =
         sConfigMgr->GetOption<bool>("PreloadAllNonInstancedMapGrids", false);
+    _int_configs[CONFIG_GRID_PRELOAD_LOOKAHEAD] =
+        sConfigMgr->GetOption<uint32>("GridPreloadLookahead", 0);
+    _int_configs[CONFIG_STARTUP_LOAD_THREADS] =
+        sConfigMgr->GetOption<uint32>("StartupLoadThreads", 1);
 
     // ICC buff override
     _int_configs[CONFIG_ICC_BUFF_HORDE] =
@@ -2042,6 +2113,9 @@ void World::LoadConfigSettings(bool reload)
     _int_configs[CONFIG_PACKET_SPOOF_BANDURATION] =
         sConfigMgr->GetOption<int32>("PacketSpoof.BanDuration", 86400);
 
+    _int_configs[CONFIG_PACKET_SPOOF_HANDLER_BUDGET] =
+        sConfigMgr->GetOption<int32>("PacketSpoof.HandlerBudget", 50000);
+
     // Random Battleground Rewards
     _int_configs[CONFIG_BG_REWARD_WINNER_HONOR_FIRST] =
         sConfigMgr->GetOption<int32>("Battleground.RewardWinnerHonorFirst", 30);
@@ -2150,6 +2224,13 @@ void World::SetInitialWorldSettings()
     ///initialized guids in some code.
     sObjectMgr->SetHighestGuids();
 
+    ///- Serve the startup world queries from the snapshot if configured
+    std::string const querySnapshot =
+        sConfigMgr->GetOption<std::string>("WorldDatabase.QuerySnapshot", "");
+    if (!querySnapshot.empty())
+        WorldDatabase.StartQuerySnapshot(querySnapshot,
+                                         GetWorldQuerySnapshotKey());
+
     if (!sConfigMgr->isDryRun()) {
         ///- Check the existence of the map files for all starting areas.
         if (!MapMgr::ExistMapAndVMap(0, -6240.32f, 331.033f) ||
@@ -2267,24 +2348,55 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Instances...");
     sInstanceSaveMgr->LoadInstances();
 
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    LOG_INFO("server.loading", "Loading Localization Strings...");
+    LOG_INFO("server.loading",
+             "Loading Broadcast Texts and Localization Strings...");
     uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
+
+    // must be before every *_locale loader, creature texts included
+    sObjectMgr->LoadLocaleSettings();
+
+    // every loader fills its own ObjectMgr store, only the broadcast text
+    // locales are added to the loaded broadcast texts
+    Acore::StartupLoader localeLoader;
+    auto addLocaleLoader = [&localeLoader](std::string                     name,
+                                           std::vector<std::string> const& deps,
+                                           void (ObjectMgr::*load)()) {
+        localeLoader.Add(std::move(name), deps, [load]() {
+            (sObjectMgr->*load)();
+        });
+    };
+    addLocaleLoader("broadcast_text", {}, &ObjectMgr::LoadBroadcastTexts);
+    addLocaleLoader("broadcast_text_locale",
+                    {"broadcast_text"},
+                    &ObjectMgr::LoadBroadcastTextLocales);
+    addLocaleLoader("creature_template_locale",
+                    {},
+                    &ObjectMgr::LoadCreatureLocales);
+    addLocaleLoader("gameobject_template_locale",
+                    {},
+                    &ObjectMgr::LoadGameObjectLocales);
+    addLocaleLoader("item_template_locale", {}, &ObjectMgr::LoadItemLocales);
+    addLocaleLoader(
+        "item_set_names_locale", {}, &ObjectMgr::LoadItemSetNameLocales);
+    addLocaleLoader("quest_template_locale", {}, &ObjectMgr::LoadQuestLocales);
+    addLocaleLoader("quest_offer_reward_locale",
+                    {},
+                    &ObjectMgr::LoadQuestOfferRewardLocale);
+    addLocaleLoader("quest_request_items_locale",
+                    {},
+                    &ObjectMgr::LoadQuestRequestItemsLocale);
+    addLocaleLoader("npc_text_locale", {}, &ObjectMgr::LoadNpcTextLocales);
+    addLocaleLoader("page_text_locale", {}, &ObjectMgr::LoadPageTextLocales);
+    addLocaleLoader("gossip_menu_option_locale",
+                    {},
+                    &ObjectMgr::LoadGossipMenuItemsLocales);
+    addLocaleLoader("points_of_interest_locale",
+                    {},
+                    &ObjectMgr::LoadPointOfInterestLocales);
+    addLocaleLoader("pet_name_generation_locale",
+                    {},
+                    &ObjectMgr::LoadPetNamesLocales);
+    localeLoader.Run(getIntConfig(CONFIG_STARTUP_LOAD_THREADS));
 
     sObjectMgr->SetDBCLocaleIndex(
         GetDefaultDbcLocale()); // Get once for all the locale index of DBC
@@ -2764,6 +2876,9 @@ void World::SetInitialWorldSettings()
     _timers[WUPDATE_WHO_LIST].SetInterval(
         5 * IN_MILLISECONDS); // update who list cache every 5 seconds
 
+    // batch login queue position updates
+    _timers[WUPDATE_LOGIN_QUEUE].SetInterval(2 * IN_MILLISECONDS);
+
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
     ///- Initialize MapMgr
@@ -2779,6 +2894,9 @@ void World::SetInitialWorldSettings()
     // Delete all characters which have been deleted X days before
     Player::DeleteOldCharacters();
 
+    // Restore positions journaled before a crash, must be before any login
+    sPlayerStateJournal->Initialize();
+
     // Delete all custom channels which haven't been used for
     // PreserveCustomChannelDuration days.
     Channel::CleanOldChannelsInDB();
@@ -2877,6 +2995,8 @@ void World::SetInitialWorldSettings()
         }
     }
 
+    WorldDatabase.StopQuerySnapshot();
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     LOG_INFO("server.loading", " ");
@@ -2953,6 +3073,8 @@ void World::DetectDBCLang()
 void World::Update(uint32 diff)
 {
     METRIC_TIMER("world_update_time_total");
+    TICK_PROFILE_SCOPE("world");
+    AC_PROFILE_ZONE("World::Update");
 
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
@@ -2985,10 +3107,19 @@ void World::Update(uint32 diff)
         CharacterDatabase.Execute(stmt);
     }
 
+    ///- Send changed login queue positions
+    if (_timers[WUPDATE_LOGIN_QUEUE].Passed()) {
+        _timers[WUPDATE_LOGIN_QUEUE].Reset();
+
+        if (_queuePositionsChanged)
+            SendQueuePositions();
+    }
+
     ///- Update Who List Cache
     if (_timers[WUPDATE_WHO_LIST].Passed()) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update who list"));
+        TICK_PROFILE_SCOPE("Update who list");
         _timers[WUPDATE_WHO_LIST].Reset();
         sWhoListCacheMgr->Update();
     }
@@ -2996,6 +3127,7 @@ void World::Update(uint32 diff)
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Check quest reset times"));
+        TICK_PROFILE_SCOPE("Check quest reset times");
 
         /// Handle daily quests reset time
         if (currentGameTime > _nextDailyQuestReset) {
@@ -3016,18 +3148,21 @@ void World::Update(uint32 diff)
     if (currentGameTime > _nextRandomBGReset) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Reset random BG"));
+        TICK_PROFILE_SCOPE("Reset random BG");
         ResetRandomBG();
     }
 
     if (currentGameTime > _nextCalendarOldEventsDeletionTime) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Delete old calendar events"));
+        TICK_PROFILE_SCOPE("Delete old calendar events");
         CalendarDeleteOldEvents();
     }
 
     if (currentGameTime > _nextGuildReset) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Reset guild cap"));
+        TICK_PROFILE_SCOPE("Reset guild cap");
         ResetGuildCap();
     }
 
@@ -3035,6 +3170,7 @@ void World::Update(uint32 diff)
     if (_timers[WUPDATE_AUCTIONS].Passed()) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update expired auctions"));
+        TICK_PROFILE_SCOPE("Update expired auctions");
 
         _timers[WUPDATE_AUCTIONS].Reset();
 
@@ -3044,7 +3180,10 @@ void World::Update(uint32 diff)
         sAuctionMgr->Update();
     }
 
-    AsyncAuctionListingMgr::Update(Milliseconds(diff));
+    {
+        TICK_PROFILE_SCOPE("Update auction listings");
+        AsyncAuctionListingMgr::Update(Milliseconds(diff));
+    }
 
     if (currentGameTime > _mail_expire_check_timer) {
         sObjectMgr->ReturnOrDeleteOldMails(true);
@@ -3052,7 +3191,10 @@ void World::Update(uint32 diff)
     }
 
     METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
-    UpdateSessions(diff);
+    {
+        TICK_PROFILE_SCOPE("Update sessions");
+        UpdateSessions(diff);
+    }
 
     /// <li> Handle weather updates when the timer has passed
     if (_timers[WUPDATE_WEATHERS].Passed()) {
@@ -3067,6 +3209,7 @@ void World::Update(uint32 diff)
         if (_timers[WUPDATE_CLEANDB].Passed()) {
             METRIC_TIMER("world_update_time",
                          METRIC_TAG("type", "Clean logs table"));
+            TICK_PROFILE_SCOPE("Clean logs table");
 
             _timers[WUPDATE_CLEANDB].Reset();
 
@@ -3078,8 +3221,16 @@ void World::Update(uint32 diff)
         }
     }
 
+    {
+        METRIC_TIMER("world_update_time",
+                     METRIC_TAG("type", "Update player state journal"));
+        TICK_PROFILE_SCOPE("Update player state journal");
+        sPlayerStateJournal->Update(diff);
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 0"));
+        TICK_PROFILE_SCOPE("Update LFG 0");
         sLFGMgr->Update(diff, 0); // pussywizard: remove obsolete stuff before
                                   // finding compatibility during map update
     }
@@ -3088,6 +3239,7 @@ void World::Update(uint32 diff)
         ///- Update objects when the timer has passed (maps, transport,
         ///creatures, ...)
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maps"));
+        TICK_PROFILE_SCOPE("Update maps");
         sMapMgr->Update(diff);
     }
 
@@ -3095,6 +3247,7 @@ void World::Update(uint32 diff)
         if (_timers[WUPDATE_AUTOBROADCAST].Passed()) {
             METRIC_TIMER("world_update_time",
                          METRIC_TAG("type", "Send autobroadcast"));
+            TICK_PROFILE_SCOPE("Send autobroadcast");
             _timers[WUPDATE_AUTOBROADCAST].Reset();
             sAutobroadcastMgr->SendAutobroadcasts();
         }
@@ -3103,36 +3256,43 @@ void World::Update(uint32 diff)
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update battlegrounds"));
+        TICK_PROFILE_SCOPE("Update battlegrounds");
         sBattlegroundMgr->Update(diff);
     }
 
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update outdoor pvp"));
+        TICK_PROFILE_SCOPE("Update outdoor pvp");
         sOutdoorPvPMgr->Update(diff);
     }
 
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update battlefields"));
+        TICK_PROFILE_SCOPE("Update battlefields");
         sBattlefieldMgr->Update(diff);
     }
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 2"));
+        TICK_PROFILE_SCOPE("Update LFG 2");
         sLFGMgr->Update(diff, 2); // pussywizard: handle created proposals
     }
 
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Process query callbacks"));
+        TICK_PROFILE_SCOPE("Process query callbacks");
         // execute callbacks from sql queries that were queued recently
         ProcessQueryCallbacks();
+        CharacterDatabaseCleaner::Update(diff);
     }
 
     /// <li> Update uptime table
     if (_timers[WUPDATE_UPTIME].Passed()) {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update uptime"));
+        TICK_PROFILE_SCOPE("Update uptime");
 
         _timers[WUPDATE_UPTIME].Reset();
 
@@ -3149,6 +3309,7 @@ void World::Update(uint32 diff)
     if (_timers[WUPDATE_CORPSES].Passed()) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Remove old corpses"));
+        TICK_PROFILE_SCOPE("Remove old corpses");
         _timers[WUPDATE_CORPSES].Reset();
 
         sMapMgr->DoForAllMaps([](Map* map) { map->RemoveOldCorpses(); });
@@ -3158,6 +3319,7 @@ void World::Update(uint32 diff)
     if (_timers[WUPDATE_EVENTS].Passed()) {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update game events"));
+        TICK_PROFILE_SCOPE("Update game events");
         _timers[WUPDATE_EVENTS]
             .Reset(); // to give time for Update() to be processed
         uint32 nextGameEvent = sGameEventMgr->Update();
@@ -3168,6 +3330,7 @@ void World::Update(uint32 diff)
     ///- Ping to keep MySQL connections alive
     if (_timers[WUPDATE_PINGDB].Passed()) {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Ping MySQL"));
+        TICK_PROFILE_SCOPE("Ping MySQL");
         _timers[WUPDATE_PINGDB].Reset();
         LOG_DEBUG("sql.driver", "Ping MySQL to keep connection alive");
         CharacterDatabase.KeepAlive();
@@ -3178,6 +3341,7 @@ void World::Update(uint32 diff)
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update instance reset times"));
+        TICK_PROFILE_SCOPE("Update instance reset times");
         // update the instance reset times
         sInstanceSaveMgr->Update();
     }
@@ -3185,6 +3349,7 @@ void World::Update(uint32 diff)
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Process cli commands"));
+        TICK_PROFILE_SCOPE("Process cli commands");
         // And last, but not least handle the issued cli commands
         ProcessCliCommands();
     }
@@ -3192,20 +3357,28 @@ void World::Update(uint32 diff)
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update world scripts"));
+        TICK_PROFILE_SCOPE("Update world scripts");
         sScriptMgr->OnWorldUpdate(diff);
     }
 
     {
         METRIC_TIMER("world_update_time",
                      METRIC_TAG("type", "Update playersSaveScheduler"));
+        TICK_PROFILE_SCOPE("Update playersSaveScheduler");
         playersSaveScheduler.Update(diff);
     }
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update metrics"));
+        TICK_PROFILE_SCOPE("Update metrics");
         // Stats logger update
         sMetric->Update();
+        sTickProfiler->Update(diff);
+        sScriptProfiler->Update(diff);
+        sNetworkStats->Update(diff);
         METRIC_VALUE("update_time_diff", diff);
+        METRIC_VALUE("player_save_skipped_statements",
+                     Player::GetSkippedSaveStatements());
     }
 }
 
@@ -3440,8 +3613,9 @@ void World::SendZoneText(uint32        zone,
 /// Kick (and save) all players
 void World::KickAll()
 {
-    _queuedPlayer
-        .clear(); // prevent send queue update packet and login queued sessions
+    // prevent send queue update packet and login queued sessions
+    _queuedPlayer.clear();
+    _queuePositionsChanged = false;
 
     // session not removed at kick and will removed in next update tick
     for (SessionMap::const_iterator itr = _sessions.begin();
@@ -3528,7 +3702,7 @@ void World::ShutdownServ(uint32             time,
                 }
 
                 LOG_INFO("server", "> Save players before shutdown server");
-                ObjectAccessor::SaveAllPlayers();
+                ObjectAccessor::SaveAllPlayers(true);
             });
     }
 
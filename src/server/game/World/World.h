@@ -25,6 +25,7 @@
 
 #include "IWorld.h"
 #include "LockedQueue.h"
+#include "LoginQueue.h"
 #include "ObjectGuid.h"
 #include "QueryResult.h"
 #include "SharedDefines.h"
@@ -68,6 +69,7 @@ enum WorldTimers {
     WUPDATE_PINGDB,
     WUPDATE_5_SECS,
     WUPDATE_WHO_LIST,
+    WUPDATE_LOGIN_QUEUE,
     WUPDATE_COUNT
 };
 
@@ -226,8 +228,7 @@ public:
     }
 
     // player Queue
-    typedef std::list<WorldSession*> Queue;
-    void                             AddQueuedPlayer(WorldSession*) override;
+    void  AddQueuedPlayer(WorldSession*) override;
     bool  RemoveQueuedPlayer(WorldSession* session) override;
     int32 GetQueuePos(WorldSession*) override;
     bool  HasRecentlyDisconnected(WorldSession*) override;
@@ -540,7 +541,9 @@ private:
     Seconds _nextGuildReset;
 
     // Player Queue
-    Queue _queuedPlayer;
+    LoginQueue _queuedPlayer;
+    bool       _queuePositionsChanged = false;
+    void       SendQueuePositions();
 
     // sessions that are added async
     void                       AddSession_(WorldSession* s);
@@ -145,8 +145,9 @@ public:
                     cPlayer->GetGUID(), cPlayer->GetSession()->GetAccountId());
                 sCharacterCache->UpdateCharacterGuildId(cPlayer->GetGUID(),
                                                         cPlayer->GetGuildId());
-                sCharacterCache->UpdateCharacterMailCount(
-                    cPlayer->GetGUID(), cPlayer->GetMailSize(), true);
+                if (cPlayer->IsMailLoaded())
+                    sCharacterCache->UpdateCharacterMailCount(
+                        cPlayer->GetGUID(), cPlayer->GetMailSize(), true);
                 sCharacterCache->UpdateCharacterArenaTeamId(
                     cPlayer->GetGUID(),
                     ARENA_SLOT_2v2,
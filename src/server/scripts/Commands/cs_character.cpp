@@ -677,10 +677,10 @@ public:
 
         FactionStateList const& targetFSL =
             target->GetReputationMgr().GetStateList();
-        for (FactionStateList::const_iterator itr = targetFSL.begin();
-             itr != targetFSL.end();
-             ++itr) {
-            FactionState const& faction = itr->second;
+        for (FactionState const& faction : targetFSL) {
+            if (!faction.ID)
+                continue;
+
             FactionEntry const* factionEntry =
                 sFactionStore.LookupEntry(faction.ID);
             char const* factionName =
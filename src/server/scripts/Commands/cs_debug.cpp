@@ -36,10 +36,13 @@ EndScriptData */
 #include "Log.h"
 #include "M2Stores.h"
 #include "MapMgr.h"
+#include "NetworkStats.h"
 #include "ObjectMgr.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "SpellMgr.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "Warden.h"
 #include "World.h"
@@ -120,6 +123,30 @@ public:
              HandleDebugSendSpellFailCommand,
              SEC_ADMINISTRATOR,
              Console::No}};
+        static ChatCommandTable debugNetStatsCommandTable = {
+            {"", HandleDebugNetStatsCommand, SEC_ADMINISTRATOR, Console::Yes},
+            {"reset",
+             HandleDebugNetStatsResetCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes}};
+        static ChatCommandTable debugScriptProfileCommandTable = {
+            {"",
+             HandleDebugScriptProfileCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes},
+            {"reset",
+             HandleDebugScriptProfileResetCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes}};
+        static ChatCommandTable debugTickProfileCommandTable = {
+            {"",
+             HandleDebugTickProfileCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes},
+            {"reset",
+             HandleDebugTickProfileResetCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes}};
         static ChatCommandTable debugCommandTable = {
             {"setbit",
              HandleDebugSet32BitCommand,
@@ -218,6 +245,13 @@ public:
              HandleDebugObjectCountCommand,
              SEC_ADMINISTRATOR,
              Console::Yes},
+            {"tickprofile", debugTickProfileCommandTable},
+            {"scriptprofile", debugScriptProfileCommandTable},
+            {"netstats", debugNetStatsCommandTable},
+            {"opcodestats",
+             HandleDebugOpcodeStatsCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes},
             {"dummy", HandleDebugDummyCommand, SEC_ADMINISTRATOR, Console::No}};
         static ChatCommandTable commandTable = {
             {"debug", debugCommandTable},
@@ -1602,6 +1636,143 @@ public:
         return true;
     }
 
+    static bool HandleDebugTickProfileCommand(ChatHandler*          handler,
+                                              Optional<std::string> prefix)
+    {
+        if (!sTickProfiler->IsEnabled()) {
+            handler->SendErrorMessage(
+                "Tick profiler is disabled, set TickProfiler.Enable = 1.");
+            return false;
+        }
+
+        std::vector<TickProfiler::PhaseStats> stats =
+            sTickProfiler->GetStats(prefix ? *prefix : std::string());
+        if (stats.empty()) {
+            handler->SendSysMessage("No tick profile samples recorded.");
+            return true;
+        }
+
+        handler->SendSysMessage("Phase: samples, p50 / p99 / max in us");
+        for (TickProfiler::PhaseStats const& phase : stats)
+            handler->PSendSysMessage("%s: %u, %u / %u / %u",
+                                     phase.Phase.c_str(),
+                                     phase.Samples,
+                                     uint32(phase.Median.count()),
+                                     uint32(phase.P99.count()),
+                                     uint32(phase.Max.count()));
+
+        return true;
+    }
+
+    static bool HandleDebugOpcodeStatsCommand(ChatHandler* handler)
+    {
+        if (!sTickProfiler->IsOpcodeProfilingEnabled()) {
+            handler->SendErrorMessage("Opcode profiling is disabled, set "
+                                      "TickProfiler.Enable = 1 and "
+                                      "TickProfiler.Opcodes = 1.");
+            return false;
+        }
+
+        return HandleDebugTickProfileCommand(handler, std::string("opcode/"));
+    }
+
+    static bool HandleDebugTickProfileResetCommand(ChatHandler* handler)
+    {
+        sTickProfiler->Reset();
+        handler->SendSysMessage("Tick profile samples cleared.");
+        return true;
+    }
+
+    static bool HandleDebugScriptProfileCommand(ChatHandler*     handler,
+                                                Optional<uint32> count)
+    {
+        if (!sScriptProfiler->IsEnabled()) {
+            handler->SendErrorMessage("Script profiler is disabled, set "
+                                      "ScriptProfiler.SampleRate.");
+            return false;
+        }
+
+        std::vector<ScriptProfiler::ScriptStats> stats =
+            sScriptProfiler->GetStats(count.value_or(20));
+        if (stats.empty()) {
+            handler->SendSysMessage("No script samples recorded.");
+            return true;
+        }
+
+        uint32 const rate = sScriptProfiler->GetSampleRate();
+        handler->PSendSysMessage("Sampling 1 in %u calls. Script: samples, "
+                                 "estimated total ms, avg / max us",
+                                 rate);
+        for (ScriptProfiler::ScriptStats const& script : stats)
+            handler->PSendSysMessage(
+                "%s %s: %u, %.1f, %u / %u",
+                ScriptProfiler::GetTypeName(script.Type),
+                script.Name.c_str(),
+                script.Samples,
+                script.Total.count() * rate / 1000.0,
+                uint32(script.Total.count() / script.Samples),
+                uint32(script.Max.count()));
+
+        return true;
+    }
+
+    static bool HandleDebugScriptProfileResetCommand(ChatHandler* handler)
+    {
+        sScriptProfiler->Reset();
+        handler->SendSysMessage("Script profile samples cleared.");
+        return true;
+    }
+
+    static bool HandleDebugNetStatsCommand(ChatHandler*     handler,
+                                           Optional<uint32> count)
+    {
+        uint32 const limit = count.value_or(10);
+
+        std::vector<OpcodeTraffic> opcodes = sNetworkStats->GetOpcodes();
+        if (opcodes.size() > limit)
+            opcodes.resize(limit);
+
+        handler->SendSysMessage("Opcode: packets, raw bytes, sent bytes");
+        for (OpcodeTraffic const& traffic : opcodes)
+            handler->PSendSysMessage(
+                "%s: %u, %u, %u",
+                GetOpcodeNameForLogging(Opcodes(traffic.Opcode)).c_str(),
+                traffic.Packets,
+                traffic.RawBytes,
+                traffic.SentBytes);
+
+        std::vector<std::pair<WorldSession*, NetworkTraffic>> sessions;
+        for (auto const& [accountId, session] : sWorld->GetAllSessions())
+            sessions.emplace_back(session, session->GetTraffic());
+
+        std::sort(sessions.begin(),
+                  sessions.end(),
+                  [](auto const& a, auto const& b) {
+                      return a.second.SentBytes > b.second.SentBytes;
+                  });
+        if (sessions.size() > limit)
+            sessions.resize(limit);
+
+        handler->SendSysMessage(
+            "Session (account, player): packets, raw bytes, sent bytes");
+        for (auto const& [session, traffic] : sessions)
+            handler->PSendSysMessage("%u %s: %u, %u, %u",
+                                     session->GetAccountId(),
+                                     session->GetPlayerName().c_str(),
+                                     traffic.Packets,
+                                     traffic.RawBytes,
+                                     traffic.SentBytes);
+
+        return true;
+    }
+
+    static bool HandleDebugNetStatsResetCommand(ChatHandler* handler)
+    {
+        sNetworkStats->Reset();
+        handler->SendSysMessage("Opcode traffic counters cleared.");
+        return true;
+    }
+
     class CreatureCountWorker {
     public:
         CreatureCountWorker() {}
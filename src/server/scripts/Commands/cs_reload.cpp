@@ -37,6 +37,7 @@ EndScriptData */
 #include "MapMgr.h"
 #include "MotdMgr.h"
 #include "ObjectMgr.h"
+#include "QueryResponseCache.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
@@ -752,6 +753,7 @@ public:
         LOG_INFO("server.loading", "Re-Loading Broadcast texts...");
         sObjectMgr->LoadBroadcastTexts();
         sObjectMgr->LoadBroadcastTextLocales();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_NPC_TEXT);
         handler->SendGlobalGMSysMessage("DB table `broadcast_text` reloaded.");
         return true;
     }
@@ -816,6 +818,8 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        sQueryResponseCache->Clear(QUERY_RESPONSE_CREATURE);
+
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
@@ -1351,6 +1355,7 @@ public:
     {
         LOG_INFO("server.loading", "Re-Loading Page Texts...");
         sObjectMgr->LoadPageTexts();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_PAGE_TEXT);
         handler->SendGlobalGMSysMessage("DB table `page_texts` reloaded.");
         handler->SendGlobalGMSysMessage(
             "You need to delete your client cache or change the cache number "
@@ -1497,6 +1502,7 @@ public:
     {
         LOG_INFO("server.loading", "Re-Loading Creature Template Locale...");
         sObjectMgr->LoadCreatureLocales();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_CREATURE);
         handler->SendGlobalGMSysMessage(
             "DB table `creature_template_locale` reloaded.");
         return true;
@@ -1516,6 +1522,7 @@ public:
         LOG_INFO("server.loading",
                  "Re-Loading Gameobject Template Locale ... ");
         sObjectMgr->LoadGameObjectLocales();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_GAMEOBJECT);
         handler->SendGlobalGMSysMessage(
             "DB table `gameobject_template_locale` reloaded.");
         return true;
@@ -1534,6 +1541,7 @@ public:
     {
         LOG_INFO("server.loading", "Re-Loading Item Template Locale ... ");
         sObjectMgr->LoadItemLocales();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_ITEM);
         handler->SendGlobalGMSysMessage(
             "DB table `item_template_locale` reloaded.");
         return true;
@@ -1552,6 +1560,7 @@ public:
     {
         LOG_INFO("server.loading", "Re-Loading NPC Text Locale ... ");
         sObjectMgr->LoadNpcTextLocales();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_NPC_TEXT);
         handler->SendGlobalGMSysMessage("DB table `npc_text_locale` reloaded.");
         return true;
     }
@@ -1560,6 +1569,7 @@ public:
     {
         LOG_INFO("server.loading", "Re-Loading Page Text Locale ... ");
         sObjectMgr->LoadPageTextLocales();
+        sQueryResponseCache->Clear(QUERY_RESPONSE_PAGE_TEXT);
         handler->SendGlobalGMSysMessage(
             "DB table `page_text_locale` reloaded.");
         handler->SendGlobalGMSysMessage(
@@ -27,11 +27,16 @@ EndScriptData */
 #include "CommandScript.h"
 #include "GameTime.h"
 #include "GitRevision.h"
+#include "MapMgr.h"
+#include "MMapFactory.h"
+#include "MemoryStats.h"
 #include "ModuleMgr.h"
 #include "MotdMgr.h"
 #include "MySQLThreading.h"
+#include "ObjectMgr.h"
 #include "Player.h"
 #include "Realm.h"
+#include "SpellMgr.h"
 #include "StringConvert.h"
 #include "UpdateTime.h"
 #include "VMapFactory.h"
@@ -90,6 +95,9 @@ public:
             {"closed", HandleServerSetClosedCommand, SEC_CONSOLE, Console::Yes},
         };
 
+        static ChatCommandTable serverMapsCommandTable = {
+            {"top", HandleServerMapsTopCommand, SEC_GAMEMASTER, Console::Yes}};
+
         static ChatCommandTable serverCommandTable = {
             {"corpses",
              HandleServerCorpsesCommand,
@@ -103,6 +111,11 @@ public:
             {"idlerestart", serverIdleRestartCommandTable},
             {"idleshutdown", serverIdleShutdownCommandTable},
             {"info", HandleServerInfoCommand, SEC_PLAYER, Console::Yes},
+            {"memory",
+             HandleServerMemoryCommand,
+             SEC_ADMINISTRATOR,
+             Console::Yes},
+            {"maps", serverMapsCommandTable},
             {"motd", HandleServerMotdCommand, SEC_PLAYER, Console::Yes},
             {"restart", serverRestartCommandTable},
             {"shutdown", serverShutdownCommandTable},
@@ -341,6 +354,13 @@ public:
             sWorldUpdateTime.GetPercentile(99),
             sWorldUpdateTime.GetPercentile(100));
 
+        TickHistogram const& total = sWorldUpdateTime.GetTotalHistogram();
+        handler->PSendSysMessage(
+            "- Since start (99, 99.9, max): %ums, %ums, %ums",
+            total.GetPercentile(99),
+            total.GetPercentile(99.9),
+            total.GetMax());
+
         //! Can't use sWorld->ShutdownMsg here in case of console command
         if (sWorld->IsShuttingDown())
             handler->PSendSysMessage(
@@ -351,6 +371,106 @@ public:
 
         return true;
     }
+    static bool HandleServerMemoryCommand(ChatHandler* handler)
+    {
+        auto toMegabytes = [](uint64 bytes) {
+            return double(bytes) / (1024.0 * 1024.0);
+        };
+
+        if (uint64 resident = Acore::Memory::GetProcessResidentBytes())
+            handler->PSendSysMessage("Process resident memory: %.1f MB.",
+                                     toMegabytes(resident));
+
+        Acore::Memory::AllocatorStats heap = Acore::Memory::GetAllocatorStats();
+        if (heap.Available) {
+            handler->PSendSysMessage("Heap allocated: %.1f MB, active: %.1f "
+                                     "MB.",
+                                     toMegabytes(heap.Allocated),
+                                     toMegabytes(heap.Active));
+            handler->PSendSysMessage("Heap resident: %.1f MB, mapped: %.1f "
+                                     "MB.",
+                                     toMegabytes(heap.Resident),
+                                     toMegabytes(heap.Mapped));
+        }
+        else
+            handler->PSendSysMessage(
+                "Allocator statistics are not available in this build.");
+
+        handler->PSendSysMessage(
+            "Creature spawns: %u, gameobject spawns: %u.",
+            uint32(sObjectMgr->GetAllCreatureData().size()),
+            uint32(sObjectMgr->GetAllGOData().size()));
+        handler->PSendSysMessage(
+            "Item templates: %u, spell info slots: %u.",
+            uint32(sObjectMgr->GetItemTemplateStore()->size()),
+            sSpellMgr->GetSpellInfoStoreSize());
+
+        MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
+        handler->PSendSysMessage("Navmesh: %u maps with %u tiles loaded.",
+                                 mmap->getLoadedMapsCount(),
+                                 mmap->getLoadedTilesCount());
+        return true;
+    }
+
+    // Lists the maps that used the most update time in their last stats window
+    static bool HandleServerMapsTopCommand(ChatHandler*     handler,
+                                           Optional<uint32> count)
+    {
+        if (!sWorld->getIntConfig(CONFIG_MAP_UPDATE_STATS_INTERVAL)) {
+            handler->SendSysMessage("Map stats are disabled "
+                                    "(MapUpdate.Stats.Interval = 0).");
+            return true;
+        }
+
+        std::vector<std::pair<Map*, MapStatsWindow>> maps;
+        sMapMgr->DoForAllMaps([&maps](Map* map) {
+            maps.emplace_back(map, map->GetStats().GetLastWindow());
+        });
+
+        std::sort(maps.begin(), maps.end(), [](auto const& a, auto const& b) {
+            return a.second.UpdateTime > b.second.UpdateTime;
+        });
+        maps.resize(std::min<std::size_t>(maps.size(), count.value_or(10)));
+
+        for (auto const& [map, window] : maps) {
+            if (!window.Updates)
+                continue;
+
+            auto const topPhase = std::max_element(window.PhaseTime.begin(),
+                                                   window.PhaseTime.end());
+            auto toMs = [](Microseconds time) { return time.count() / 1000.0; };
+
+            handler->PSendSysMessage(
+                "Map %u instance %u (%s): %.1f ms in %u updates over %u s, "
+                "avg %.2f ms, max %.2f ms, most in %s (%.1f ms)",
+                map->GetId(),
+                map->GetInstanceId(),
+                map->GetMapName(),
+                toMs(window.UpdateTime),
+                window.Updates,
+                uint32(window.Duration.count() / 1000),
+                toMs(window.UpdateTime) / window.Updates,
+                toMs(window.MaxUpdateTime),
+                GetMapUpdatePhaseName(MapUpdatePhase(
+                    topPhase - window.PhaseTime.begin())),
+                toMs(*topPhase));
+            handler->PSendSysMessage(
+                "  players %u, creatures %u, gameobjects %u | packets %u "
+                "(%u bytes) | paths %u (%.1f ms) | los %u | grid loads %u",
+                window.Players,
+                window.Creatures,
+                window.GameObjects,
+                window.PacketsSent,
+                window.BytesSent,
+                window.Paths,
+                toMs(window.PathTime),
+                window.LosQueries,
+                window.GridLoads);
+        }
+
+        return true;
+    }
+
     // Display the 'Message of the day' for the realm
     static bool HandleServerMotdCommand(ChatHandler* handler)
     {
@@ -683,7 +683,7 @@ public:
             if (!quest)
                 continue;
 
-            ConditionList conditions =
+            ConditionList const& conditions =
                 sConditionMgr->GetConditionsForNotGroupedEntry(
                     CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
             if (!sConditionMgr->IsObjectMeetToConditions(player, conditions))
@@ -714,7 +714,7 @@ public:
             if (!quest)
                 continue;
 
-            ConditionList conditions =
+            ConditionList const& conditions =
                 sConditionMgr->GetConditionsForNotGroupedEntry(
                     CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
             if (!sConditionMgr->IsObjectMeetToConditions(player, conditions))
@@ -306,9 +306,9 @@ public:
 
         void SetDest(SpellDestination& dest)
         {
-            std::list<TargetInfo> const* targetsInfo =
+            TargetInfoList const* targetsInfo =
                 GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::const_iterator ihit =
+            for (TargetInfoList::const_iterator ihit =
                      targetsInfo->begin();
                  ihit != targetsInfo->end();
                  ++ihit)
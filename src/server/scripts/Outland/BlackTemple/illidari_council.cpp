@@ -645,9 +645,9 @@ public:
             }
 
             float pct = (_sharedHealth / _sharedHealthMax) * 100.0f;
-            std::list<TargetInfo> const* targetsInfo =
+            TargetInfoList const* targetsInfo =
                 GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::const_iterator ihit =
+            for (TargetInfoList::const_iterator ihit =
                      targetsInfo->begin();
                  ihit != targetsInfo->end();
                  ++ihit)
@@ -502,9 +502,9 @@ class spell_pet_gen_valkyr_guardian_smite : public SpellScript {
     void RecalculateDamage()
     {
         if (GetHitUnit() != GetCaster()) {
-            std::list<TargetInfo>* targetsInfo =
+            TargetInfoList* targetsInfo =
                 GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::iterator ihit = targetsInfo->begin();
+            for (TargetInfoList::iterator ihit = targetsInfo->begin();
                  ihit != targetsInfo->end();
                  ++ihit)
                 if (ihit->targetGUID == GetCaster()->GetGUID())
@@ -481,9 +481,9 @@ class spell_dk_chains_of_ice : public SpellScript {
     void HandleAfterCast()
     {
         if (Unit* target = GetExplTargetUnit()) {
-            std::list<TargetInfo> const* targetsInfo =
+            TargetInfoList const* targetsInfo =
                 GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::const_iterator ihit =
+            for (TargetInfoList::const_iterator ihit =
                      targetsInfo->begin();
                  ihit != targetsInfo->end();
                  ++ihit)
@@ -631,8 +631,8 @@ class spell_dk_rune_of_the_fallen_crusader : public SpellScript {
 
     void RecalculateDamage()
     {
-        std::list<TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-        for (std::list<TargetInfo>::iterator ihit = targetsInfo->begin();
+        TargetInfoList* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+        for (TargetInfoList::iterator ihit = targetsInfo->begin();
              ihit != targetsInfo->end();
              ++ihit)
             if (ihit->targetGUID == GetCaster()->GetGUID())
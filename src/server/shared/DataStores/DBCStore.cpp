@@ -18,6 +18,7 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include "MappedFile.h"
 
 DBCStorageBase::DBCStorageBase(char const* fmt)
     : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
@@ -46,9 +47,9 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
     // load raw non-string data
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
-    // load strings from dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    // strings point into the file, keep it mapped
+    if (dbc.AutoProduceStrings(_fileFormat, _dataTable))
+        _files.push_back(dbc.GetFile());
 
     // error in dbc file at loading if nullptr
     return indexTable != nullptr;
@@ -67,8 +68,8 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
         return false;
 
     // load strings from another locale dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    if (dbc.AutoProduceStrings(_fileFormat, _dataTable))
+        _files.push_back(dbc.GetFile());
 
     return true;
 }
@@ -23,8 +23,13 @@
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
+namespace Acore {
+class MappedFile;
+}
+
 /// Interface class for common access
 class DBCStorageBase {
 public:
@@ -48,6 +53,9 @@ protected:
     char*              _dataTable;
     std::vector<char*> _stringPool;
     uint32             _indexTableSize;
+
+    /// Mapped .dbc files records and strings point into
+    std::vector<std::shared_ptr<Acore::MappedFile>> _files;
 };
 
 template <class T>
@@ -75,7 +75,7 @@ public:
             });
     }
 
-    bool Bind()
+    bool Bind(bool reusePort = false)
     {
         boost::system::error_code errorCode;
         _acceptor.open(_endpoint.protocol(), errorCode);
@@ -96,6 +96,23 @@ public:
         }
 #endif
 
+#ifdef SO_REUSEPORT
+        if (reusePort) {
+            _acceptor.set_option(
+                boost::asio::detail::socket_option::boolean<SOL_SOCKET,
+                                                            SO_REUSEPORT>(true),
+                errorCode);
+            if (errorCode) {
+                LOG_INFO("network",
+                         "Failed to set reuse_port option on acceptor {}",
+                         errorCode.message());
+                return false;
+            }
+        }
+#else
+        (void)reusePort;
+#endif
+
         _acceptor.bind(_endpoint, errorCode);
         if (errorCode) {
             LOG_INFO("network",
@@ -24,6 +24,9 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "ProcessPriority.h"
+#include "Profiler.h"
+#include "ThreadWatchdog.h"
 #include "Timer.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
@@ -81,6 +84,9 @@ public:
 
     [[nodiscard]] int32 GetConnectionCount() const { return _connections; }
 
+    // pins the thread to the processor once it starts, call before Start()
+    void SetProcessor(uint32 processor) { _processor = processor; }
+
     virtual void AddSocket(std::shared_ptr<SocketType> sock)
     {
         std::lock_guard<std::mutex> lock(_newSocketsLock);
@@ -92,6 +98,8 @@ public:
 
     tcp::socket* GetSocketForAccept() { return &_acceptSocket; }
 
+    Acore::Asio::IoContext& GetIoContext() { return _ioContext; }
+
 protected:
     virtual void SocketAdded(std::shared_ptr<SocketType> /*sock*/) {}
     virtual void SocketRemoved(std::shared_ptr<SocketType> /*sock*/) {}
@@ -119,6 +127,11 @@ protected:
     void Run()
     {
         LOG_DEBUG("misc", "Network Thread Starting");
+        AC_PROFILE_THREAD_NAME("Network");
+        sThreadWatchdog->RegisterThread("Network");
+
+        if (_processor >= 0)
+            SetThreadAffinity("network", "Network thread", uint32(_processor));
 
         _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
         _updateTimer.async_wait(
@@ -139,6 +152,8 @@ protected:
         _updateTimer.async_wait(
             [this](boost::system::error_code const&) { Update(); });
 
+        ThreadWatchdog::WorkScope watchdogScope;
+
         AddNewSockets();
 
         _sockets.erase(std::remove_if(_sockets.begin(),
@@ -164,6 +179,7 @@ private:
 
     std::atomic<int32> _connections{};
     std::atomic<bool>  _stopped{};
+    int64              _processor{-1};
 
     std::unique_ptr<std::thread> _thread;
 
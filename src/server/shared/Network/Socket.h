@@ -23,15 +23,22 @@
 #include "MessageBuffer.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
-#ifdef BOOST_ASIO_HAS_IOCP
+// Queued buffers sent with a single gathered write, stays below IOV_MAX
+#define WRITE_GATHER_MAX_BUFFERS 64
+// Completion based backends (IOCP, io_uring) take the data with the write
+// request, reactor backends (epoll, kqueue) wait for writability and write
+// synchronously
+#if defined(BOOST_ASIO_HAS_IOCP) ||                                            \
+    (defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL))
 #define AC_SOCKET_USE_IOCP
 #endif
 
@@ -120,7 +127,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -166,9 +173,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(),
-                                                     buffer.GetActiveSize()),
+        GatherWriteBuffers();
+        _socket.async_write_some(_writeBuffers,
                                  std::bind(&Socket<T>::WriteHandler,
                                            this->shared_from_this(),
                                            std::placeholders::_1,
@@ -199,6 +205,40 @@ protected:
     }
 
 private:
+    /// Collects the front of the write queue into one buffer sequence
+    std::size_t GatherWriteBuffers()
+    {
+        _writeBuffers.clear();
+
+        std::size_t bytesToSend = 0;
+        for (MessageBuffer& buffer : _writeQueue) {
+            if (_writeBuffers.size() >= WRITE_GATHER_MAX_BUFFERS)
+                break;
+
+            _writeBuffers.emplace_back(buffer.GetActiveData(),
+                                       buffer.GetActiveSize());
+            bytesToSend += buffer.GetActiveSize();
+        }
+
+        return bytesToSend;
+    }
+
+    /// Drops fully sent buffers and advances a partially sent one
+    void WriteCompleted(std::size_t bytesSent)
+    {
+        while (bytesSent && !_writeQueue.empty()) {
+            MessageBuffer& buffer     = _writeQueue.front();
+            std::size_t    bufferSize = buffer.GetActiveSize();
+            if (bytesSent < bufferSize) {
+                buffer.ReadCompleted(bytesSent);
+                return;
+            }
+
+            bytesSent -= bufferSize;
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error,
                              size_t                    transferredBytes)
     {
@@ -217,10 +257,7 @@ private:
     {
         if (!error) {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -245,14 +282,11 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = GatherWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t               bytesSent = _socket.write_some(
-            boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend),
-            error);
+        std::size_t               bytesSent =
+            _socket.write_some(_writeBuffers, error);
 
         if (error) {
             if (error == boost::asio::error::would_block ||
@@ -260,7 +294,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_closing && _writeQueue.empty()) {
                 CloseSocket();
@@ -269,7 +303,7 @@ private:
             return false;
         }
         else if (bytesSent == 0) {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_closing && _writeQueue.empty()) {
                 CloseSocket();
@@ -279,11 +313,11 @@ private:
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            WriteCompleted(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        WriteCompleted(bytesSent);
 
         if (_closing && _writeQueue.empty()) {
             CloseSocket();
@@ -298,8 +332,9 @@ private:
     boost::asio::ip::address _remoteAddress;
     uint16                   _remotePort;
 
-    MessageBuffer             _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    MessageBuffer                          _readBuffer;
+    std::deque<MessageBuffer>              _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBuffers;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
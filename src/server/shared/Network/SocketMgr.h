@@ -24,6 +24,7 @@
 #include "NetworkThread.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <memory>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
@@ -32,7 +33,7 @@ class SocketMgr {
 public:
     virtual ~SocketMgr()
     {
-        ASSERT(!_threads && !_acceptor && !_threadCount,
+        ASSERT(!_threads && _acceptors.empty() && !_threadCount,
                "StopNetwork must be called prior to SocketMgr destruction");
     }
 
@@ -43,48 +44,74 @@ public:
     {
         ASSERT(threadCount > 0);
 
-        std::unique_ptr<AsyncAcceptor> acceptor;
-        try {
-            acceptor = std::make_unique<AsyncAcceptor>(ioContext, bindIp, port);
-        }
-        catch (boost::system::system_error const& err) {
-            LOG_ERROR("network",
-                      "Exception caught in SocketMgr.StartNetwork ({}:{}): {}",
-                      bindIp,
-                      port,
-                      err.what());
-            return false;
-        }
-
-        if (!acceptor->Bind()) {
-            LOG_ERROR("network", "StartNetwork failed to bind socket acceptor");
-            return false;
-        }
-
-        _acceptor    = std::move(acceptor);
         _threadCount = threadCount;
         _threads =
             std::unique_ptr<NetworkThread<SocketType>[]>(CreateThreads());
 
         ASSERT(_threads);
 
-        for (int32 i = 0; i < _threadCount; ++i)
+        bool acceptorPerThread = _acceptorPerThread && _threadCount > 1;
+#ifndef SO_REUSEPORT
+        if (acceptorPerThread) {
+            LOG_WARN("network",
+                     "SO_REUSEPORT is not supported on this platform, using a "
+                     "single acceptor");
+            acceptorPerThread = false;
+        }
+#endif
+
+        // With one listening socket per network thread the kernel spreads
+        // incoming connections and each accept completes on the thread that
+        // owns the new socket
+        int32 acceptorCount = acceptorPerThread ? _threadCount : 1;
+        for (int32 i = 0; i < acceptorCount; ++i) {
+            std::unique_ptr<AsyncAcceptor> acceptor =
+                CreateAcceptor(acceptorPerThread ? _threads[i].GetIoContext()
+                                                 : ioContext,
+                               bindIp,
+                               port,
+                               acceptorPerThread);
+            if (!acceptor) {
+                _acceptors.clear();
+                _threads.reset();
+                _threadCount = 0;
+                return false;
+            }
+
+            if (acceptorPerThread)
+                acceptor->SetSocketFactory([this, i]() {
+                    return std::make_pair(_threads[i].GetSocketForAccept(),
+                                          uint32(i));
+                });
+            else
+                acceptor->SetSocketFactory(
+                    [this]() { return GetSocketForAccept(); });
+
+            _acceptors.push_back(std::move(acceptor));
+        }
+
+        for (int32 i = 0; i < _threadCount; ++i) {
+            if (!_threadProcessors.empty())
+                _threads[i].SetProcessor(
+                    _threadProcessors[i % _threadProcessors.size()]);
+
             _threads[i].Start();
+        }
 
-        _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
         return true;
     }
 
     virtual void StopNetwork()
     {
-        _acceptor->Close();
+        for (std::unique_ptr<AsyncAcceptor>& acceptor : _acceptors)
+            acceptor->Close();
 
         for (int32 i = 0; i < _threadCount; ++i)
             _threads[i].Stop();
 
         Wait();
 
-        _acceptor.reset();
+        _acceptors.clear();
         _threads.reset();
         _threadCount = 0;
     }
@@ -136,9 +163,47 @@ protected:
 
     virtual NetworkThread<SocketType>* CreateThreads() const = 0;
 
-    std::unique_ptr<AsyncAcceptor>               _acceptor;
+    template <AsyncAcceptor::AcceptCallback acceptCallback>
+    void AsyncAcceptWithCallback()
+    {
+        for (std::unique_ptr<AsyncAcceptor>& acceptor : _acceptors)
+            acceptor->AsyncAcceptWithCallback<acceptCallback>();
+    }
+
+    std::vector<std::unique_ptr<AsyncAcceptor>>  _acceptors;
     std::unique_ptr<NetworkThread<SocketType>[]> _threads;
     int32                                        _threadCount{};
+    bool                                         _acceptorPerThread{false};
+    // network thread i runs on _threadProcessors[i % size], empty for none
+    std::vector<uint32>                          _threadProcessors;
+
+private:
+    static std::unique_ptr<AsyncAcceptor>
+    CreateAcceptor(Acore::Asio::IoContext& ioContext,
+                   std::string const&      bindIp,
+                   uint16                  port,
+                   bool                    reusePort)
+    {
+        std::unique_ptr<AsyncAcceptor> acceptor;
+        try {
+            acceptor = std::make_unique<AsyncAcceptor>(ioContext, bindIp, port);
+        }
+        catch (boost::system::system_error const& err) {
+            LOG_ERROR("network",
+                      "Exception caught in SocketMgr.StartNetwork ({}:{}): {}",
+                      bindIp,
+                      port,
+                      err.what());
+            return nullptr;
+        }
+
+        if (!acceptor->Bind(reusePort)) {
+            LOG_ERROR("network", "StartNetwork failed to bind socket acceptor");
+            return nullptr;
+        }
+
+        return acceptor;
+    }
 };
 
 #endif // SocketMgr_h__
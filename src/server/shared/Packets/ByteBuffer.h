@@ -21,6 +21,7 @@
 
 #include "ByteConverter.h"
 #include "Define.h"
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <string>
@@ -123,6 +124,13 @@ public:
         _rpos = _wpos = 0;
     }
 
+    std::vector<uint8>&& Move()
+    {
+        _rpos = _wpos = 0;
+
+        return std::move(_storage);
+    }
+
     template <typename T>
     void append(T value)
     {
@@ -475,13 +483,18 @@ public:
     }
 
     // can be used in SMSG_MONSTER_MOVE opcode
-    void appendPackXYZ(float x, float y, float z)
+    static uint32 PackXYZ(float x, float y, float z)
     {
         uint32 packed = 0;
         packed |= ((int)(x / 0.25f) & 0x7FF);
         packed |= ((int)(y / 0.25f) & 0x7FF) << 11;
         packed |= ((int)(z / 0.25f) & 0x3FF) << 22;
-        *this << packed;
+        return packed;
+    }
+
+    void appendPackXYZ(float x, float y, float z)
+    {
+        *this << PackXYZ(x, y, z);
     }
 
     void appendPackGUID(uint64 guid)
@@ -509,6 +522,62 @@ public:
     void textlike() const;
     void hexlike() const;
 
+    /// Appends a run of values after growing the storage once, for builders
+    /// that know an upper bound of what they write. Stores are only checked
+    /// against that bound in debug builds. Bytes reserved but not written are
+    /// dropped when the writer goes out of scope, the buffer must not be used
+    /// directly until then.
+    class Writer {
+    public:
+        Writer(ByteBuffer& buffer, std::size_t maxSize)
+            : _buffer(buffer), _initialSize(buffer._storage.size())
+        {
+            std::size_t const end = buffer._wpos + maxSize;
+            if (_initialSize < end)
+                buffer._storage.resize(end);
+
+            _begin = buffer._storage.data() + buffer._wpos;
+            _pos   = _begin;
+            _end   = _begin + maxSize;
+        }
+
+        ~Writer()
+        {
+            _buffer._wpos += _pos - _begin;
+            _buffer._storage.resize(std::max(_initialSize, _buffer._wpos));
+        }
+
+        Writer(Writer const&)            = delete;
+        Writer& operator=(Writer const&) = delete;
+
+        template <typename T>
+        Writer& operator<<(T value)
+        {
+            static_assert(std::is_fundamental<T>::value, "append(compound)");
+            EndianConvert(value);
+            append(reinterpret_cast<uint8 const*>(&value), sizeof(value));
+            return *this;
+        }
+
+        void append(uint8 const* src, std::size_t cnt)
+        {
+#if defined(ACORE_DEBUG)
+            if (std::size_t(_end - _pos) < cnt)
+                throw ByteBufferPositionException(
+                    true, _pos - _begin, _end - _begin, cnt);
+#endif
+            std::memcpy(_pos, src, cnt);
+            _pos += cnt;
+        }
+
+    private:
+        ByteBuffer& _buffer;
+        std::size_t _initialSize;
+        uint8*      _begin;
+        uint8*      _pos;
+        uint8*      _end;
+    };
+
 protected:
     size_t             _rpos{0}, _wpos{0};
     std::vector<uint8> _storage;
@@ -25,7 +25,10 @@
 #include "Util.h"
 #include <boost/asio/ip/tcp.hpp>
 
-RealmList::RealmList() : _updateInterval(0) {}
+RealmList::RealmList()
+    : _realms(std::make_shared<RealmMap const>()), _updateInterval(0)
+{
+}
 
 RealmList* RealmList::Instance()
 {
@@ -89,7 +92,8 @@ void RealmList::LoadBuildInfo()
     }
 }
 
-void RealmList::UpdateRealm(RealmHandle const&         id,
+void RealmList::UpdateRealm(RealmMap&                  realms,
+                            RealmHandle const&         id,
                             uint32                     build,
                             std::string const&         name,
                             boost::asio::ip::address&& address,
@@ -103,7 +107,7 @@ void RealmList::UpdateRealm(RealmHandle const&         id,
                             float                      population)
 {
     // Create new if not exist or update existed
-    Realm& realm = _realms[id];
+    Realm& realm = realms[id];
 
     realm.Id                   = id;
     realm.Build                = build;
@@ -146,11 +150,13 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     PreparedQueryResult result = LoginDatabase.Query(stmt);
 
     std::map<RealmHandle, std::string> existingRealms;
-    for (auto const& [handle, realm] : _realms) {
+    for (auto const& [handle, realm] : *GetRealms()) {
         existingRealms[handle] = realm.Name;
     }
 
-    _realms.clear();
+    // network threads may still be reading the current list, build the new
+    // one aside and swap it in at the end
+    std::shared_ptr<RealmMap> realms = std::make_shared<RealmMap>();
 
     // Circle through results and add them to the realm map
     if (result) {
@@ -221,7 +227,8 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
 
                 RealmHandle id{realmId};
 
-                UpdateRealm(id,
+                UpdateRealm(*realms,
+                            id,
                             build,
                             name,
                             externalAddress->address(),
@@ -265,6 +272,11 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     for (auto itr = existingRealms.begin(); itr != existingRealms.end(); ++itr)
         LOG_INFO("server.authserver", "Removed realm \"{}\".", itr->second);
 
+    {
+        std::lock_guard<std::mutex> lock(_realmsLock);
+        _realms = std::move(realms);
+    }
+
     if (_updateInterval) {
         _updateTimer->expires_from_now(
             boost::posix_time::seconds(_updateInterval));
@@ -275,11 +287,19 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     }
 }
 
-Realm const* RealmList::GetRealm(RealmHandle const& id) const
+std::shared_ptr<RealmList::RealmMap const> RealmList::GetRealms() const
+{
+    std::lock_guard<std::mutex> lock(_realmsLock);
+    return _realms;
+}
+
+std::shared_ptr<Realm const> RealmList::GetRealm(RealmHandle const& id) const
 {
-    auto itr = _realms.find(id);
-    if (itr != _realms.end()) {
-        return &itr->second;
+    std::shared_ptr<RealmMap const> realms = GetRealms();
+    auto                            itr    = realms->find(id);
+    if (itr != realms->end()) {
+        // shares ownership of the snapshot holding the realm
+        return {realms, &itr->second};
     }
 
     return nullptr;
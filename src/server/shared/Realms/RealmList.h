@@ -23,6 +23,8 @@
 #include "Realm.h"
 #include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_set>
 #include <vector>
 
@@ -50,8 +52,11 @@ public:
     void Initialize(Acore::Asio::IoContext& ioContext, uint32 updateInterval);
     void Close();
 
-    [[nodiscard]] RealmMap const& GetRealms() const { return _realms; }
-    [[nodiscard]] Realm const*    GetRealm(RealmHandle const& id) const;
+    /// Snapshot of the realm list, UpdateRealms publishes a new one instead
+    /// of modifying it so it stays valid while callers hold it
+    [[nodiscard]] std::shared_ptr<RealmMap const> GetRealms() const;
+    [[nodiscard]] std::shared_ptr<Realm const>
+    GetRealm(RealmHandle const& id) const;
 
     [[nodiscard]] RealmBuildInfo const* GetBuildInfo(uint32 build) const;
 
@@ -61,7 +66,8 @@ private:
 
     void LoadBuildInfo();
     void UpdateRealms(boost::system::error_code const& error);
-    void UpdateRealm(RealmHandle const&         id,
+    void UpdateRealm(RealmMap&                  realms,
+                     RealmHandle const&         id,
                      uint32                     build,
                      std::string const&         name,
                      boost::asio::ip::address&& address,
@@ -75,7 +81,8 @@ private:
                      float                      population);
 
     std::vector<RealmBuildInfo>                 _builds;
-    RealmMap                                    _realms;
+    std::shared_ptr<RealmMap const>             _realms;
+    mutable std::mutex                          _realmsLock;
     uint32                                      _updateInterval{0};
     std::unique_ptr<Acore::Asio::DeadlineTimer> _updateTimer;
     std::unique_ptr<Acore::Asio::Resolver>      _resolver;
@@ -130,3 +130,17 @@ TEST_F(ConfigEnvTest, NotExistingInt)
 {
     EXPECT_EQ(sConfigMgr->GetOption<int>("NotFound.Int", 1), 1);
 }
+
+TEST_F(ConfigEnvTest, RegisteredOption)
+{
+    ConfigValue<int32> const& option =
+        sConfigMgr->RegisterOption<int32>("Registered.Int", 7);
+    EXPECT_EQ(option.Get(), 7);
+    EXPECT_EQ(&option, &sConfigMgr->RegisterOption<int32>("Registered.Int", 7));
+    EXPECT_THROW(sConfigMgr->RegisterOption<bool>("Registered.Int", false),
+                 ConfigException);
+
+    setenv("AC_REGISTERED_INT", "21", 1);
+    sConfigMgr->OverrideWithEnvVariablesIfAny();
+    EXPECT_EQ(option.Get(), 21);
+}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ARC4.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+namespace {
+std::vector<uint8> Crypt(std::string_view key, std::string_view text)
+{
+    Acore::Crypto::ARC4 arc4;
+    arc4.Init(reinterpret_cast<uint8 const*>(key.data()), key.size());
+
+    std::vector<uint8> data(text.begin(), text.end());
+    arc4.UpdateData(data);
+    return data;
+}
+} // namespace
+
+TEST(ARC4Test, KnownVectors)
+{
+    EXPECT_EQ(Crypt("Key", "Plaintext"),
+              (std::vector<uint8>{
+                  0xBB, 0xF3, 0x16, 0xE8, 0xD9, 0x40, 0xAF, 0x0A, 0xD3}));
+    EXPECT_EQ(Crypt("Wiki", "pedia"),
+              (std::vector<uint8>{0x10, 0x21, 0xBF, 0x04, 0x20}));
+    EXPECT_EQ(Crypt("Secret", "Attack at dawn"),
+              (std::vector<uint8>{0x45,
+                                  0xA0,
+                                  0x1F,
+                                  0x64,
+                                  0x5F,
+                                  0xC3,
+                                  0x5B,
+                                  0x38,
+                                  0x35,
+                                  0x52,
+                                  0x54,
+                                  0x4B,
+                                  0x9B,
+                                  0xF5}));
+}
+
+TEST(ARC4Test, SplitUpdatesMatchSingleUpdate)
+{
+    std::array<uint8, 16> key{};
+    for (uint8 i = 0; i < key.size(); ++i)
+        key[i] = uint8(i * 17 + 3);
+
+    Acore::Crypto::ARC4 whole;
+    Acore::Crypto::ARC4 split;
+    whole.Init(key);
+    split.Init(key);
+
+    std::array<uint8, 64> a{};
+    std::array<uint8, 64> b{};
+    whole.UpdateData(a);
+
+    // packet headers are encrypted a few bytes at a time
+    for (size_t offset = 0; offset < b.size(); offset += 4)
+        split.UpdateData(b.data() + offset, 4);
+
+    EXPECT_EQ(a, b);
+}
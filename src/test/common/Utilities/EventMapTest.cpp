@@ -0,0 +1,203 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+
+TEST(EventMapTest, ExecutesInTimeOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(3, 300);
+    events.ScheduleEvent(1, 100);
+    events.ScheduleEvent(2, 200);
+
+    EXPECT_EQ(events.ExecuteEvent(), 0u);
+
+    events.Update(250);
+    EXPECT_EQ(events.ExecuteEvent(), 1u);
+    EXPECT_EQ(events.ExecuteEvent(), 2u);
+    EXPECT_EQ(events.ExecuteEvent(), 0u);
+
+    events.Update(50);
+    EXPECT_EQ(events.ExecuteEvent(), 3u);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, KeepsScheduleOrderForSameTime)
+{
+    EventMap events;
+    for (uint32 eventId = 1; eventId <= 20; ++eventId)
+        events.ScheduleEvent(eventId, 100);
+
+    events.Update(100);
+    for (uint32 eventId = 1; eventId <= 20; ++eventId)
+        EXPECT_EQ(events.ExecuteEvent(), eventId);
+}
+
+TEST(EventMapTest, PhaseMaskSkipsOtherPhases)
+{
+    EventMap events;
+    events.SetPhase(1);
+    events.ScheduleEvent(1, 100, 0, 2);
+    events.ScheduleEvent(2, 100, 0, 1);
+    events.ScheduleEvent(3, 100);
+
+    events.Update(100);
+    EXPECT_EQ(events.ExecuteEvent(), 2u);
+    EXPECT_EQ(events.ExecuteEvent(), 3u);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, RepeatUsesLastEvent)
+{
+    EventMap events;
+    events.ScheduleEvent(7, 100, 2, 3);
+
+    events.Update(100);
+    EXPECT_EQ(events.ExecuteEvent(), 7u);
+
+    events.Repeat(50ms);
+    EXPECT_EQ(events.GetNextEventTime(7), 150u);
+
+    events.SetPhase(3);
+    events.CancelEventGroup(2);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, CancelAndGroups)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100, 1);
+    events.ScheduleEvent(2, 200, 2);
+    events.ScheduleEvent(1, 300);
+    events.ScheduleEvent(3, 400, 1);
+
+    events.CancelEvent(1);
+    EXPECT_EQ(events.GetNextEventTime(1), 0u);
+    EXPECT_EQ(events.GetNextEventTime(), 200u);
+
+    events.CancelEventGroup(1);
+    EXPECT_EQ(events.GetNextEventTime(3), 0u);
+    EXPECT_EQ(events.GetTimeUntilEvent(2), 200ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(3), Milliseconds::max());
+}
+
+TEST(EventMapTest, DelayGroup)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100, 1);
+    events.ScheduleEvent(2, 150);
+    events.ScheduleEvent(3, 100, 1);
+
+    events.DelayEvents(100, 1);
+    EXPECT_EQ(events.GetNextEventTime(1), 200u);
+    EXPECT_EQ(events.GetNextEventTime(3), 200u);
+
+    events.Update(200);
+    EXPECT_EQ(events.ExecuteEvent(), 2u);
+    EXPECT_EQ(events.ExecuteEvent(), 1u);
+    EXPECT_EQ(events.ExecuteEvent(), 3u);
+}
+
+TEST(EventMapTest, DelayEventsToMax)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 500);
+    events.ScheduleEvent(2, 100);
+    events.ScheduleEvent(3, 50);
+    events.ScheduleEvent(4, 300);
+
+    events.DelayEventsToMax(300, 0);
+    EXPECT_EQ(events.GetNextEventTime(), 300u);
+
+    events.Update(300);
+    EXPECT_EQ(events.ExecuteEvent(), 4u);
+    EXPECT_EQ(events.ExecuteEvent(), 3u);
+    EXPECT_EQ(events.ExecuteEvent(), 2u);
+    EXPECT_EQ(events.ExecuteEvent(), 0u);
+    EXPECT_EQ(events.GetNextEventTime(1), 500u);
+}
+
+namespace {
+// the std::multimap store EventMap used before the heap based one
+class MultimapEventStore {
+public:
+    void Update(uint32 time) { _time += time; }
+
+    void ScheduleEvent(uint32 eventId, uint32 time)
+    {
+        _events.emplace(_time + time, eventId);
+    }
+
+    uint32 ExecuteEvent()
+    {
+        auto itr = _events.begin();
+        if (itr == _events.end() || itr->first > _time)
+            return 0;
+
+        uint32 eventId = itr->second;
+        _events.erase(itr);
+        return eventId;
+    }
+
+private:
+    uint32                         _time = 0;
+    std::multimap<uint32, uint32> _events;
+};
+
+template <typename Store>
+std::chrono::nanoseconds RunEventBenchmark()
+{
+    constexpr uint32 creatures = 1000;
+    constexpr uint32 updates   = 2000;
+    constexpr uint32 eventIds  = 6;
+
+    std::vector<Store> stores(creatures);
+    for (Store& store : stores)
+        for (uint32 eventId = 1; eventId <= eventIds; ++eventId)
+            store.ScheduleEvent(eventId, eventId * 1000);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < updates; ++i) {
+        for (Store& store : stores) {
+            store.Update(100);
+            while (uint32 eventId = store.ExecuteEvent())
+                store.ScheduleEvent(eventId, eventId * 1000);
+        }
+    }
+
+    return std::chrono::steady_clock::now() - start;
+}
+} // namespace
+
+// run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST(EventMapTest, DISABLED_BenchmarkAgainstMultimap)
+{
+    auto heap = std::chrono::duration_cast<Microseconds>(
+        RunEventBenchmark<EventMap>());
+    auto multimap = std::chrono::duration_cast<Microseconds>(
+        RunEventBenchmark<MultimapEventStore>());
+
+    std::printf("EventMap: %lld us, std::multimap: %lld us\n",
+                static_cast<long long>(heap.count()),
+                static_cast<long long>(multimap.count()));
+}
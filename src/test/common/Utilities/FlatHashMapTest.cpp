@@ -0,0 +1,167 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlatHashMap.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    Acore::FlatHashMap<uint64, int> map;
+    EXPECT_EQ(map.Find(1), 0);
+    EXPECT_FALSE(map.Erase(1));
+
+    map.Insert(1, 10);
+    map.Insert(2, 20);
+    map.Insert(1, 11);
+
+    EXPECT_EQ(map.Size(), 2u);
+    EXPECT_EQ(map.Find(1), 11);
+    EXPECT_EQ(map.Find(2), 20);
+    EXPECT_EQ(map.Find(3), 0);
+
+    EXPECT_TRUE(map.Erase(1));
+    EXPECT_EQ(map.Find(1), 0);
+    EXPECT_EQ(map.Find(2), 20);
+    EXPECT_EQ(map.Size(), 1u);
+}
+
+TEST(FlatHashMapTest, MatchesUnorderedMap)
+{
+    Acore::FlatHashMap<uint64, uint64> map;
+    std::unordered_map<uint64, uint64> reference;
+
+    std::mt19937_64                       random(42);
+    std::uniform_int_distribution<uint64> keys(1, 2000);
+
+    for (int i = 0; i < 100000; ++i) {
+        uint64 const key = keys(random);
+        if (random() % 3) {
+            map.Insert(key, i);
+            reference[key] = i;
+        }
+        else
+            EXPECT_EQ(map.Erase(key), reference.erase(key) == 1);
+    }
+
+    ASSERT_EQ(map.Size(), reference.size());
+    for (uint64 key = 1; key <= 2000; ++key) {
+        auto itr = reference.find(key);
+        EXPECT_EQ(map.Find(key), itr != reference.end() ? itr->second : 0u);
+    }
+}
+
+namespace {
+constexpr std::size_t LookupThreads = 8;
+constexpr std::size_t LookupObjects = 5000;
+constexpr std::size_t LookupsPerThread = 2000000;
+
+struct LockedUnorderedMap {
+    std::shared_mutex                 Lock;
+    std::unordered_map<uint64, void*> Objects;
+
+    void Insert(uint64 key, void* value) { Objects[key] = value; }
+
+    void* Find(uint64 key)
+    {
+        std::shared_lock<std::shared_mutex> lock(Lock);
+        auto itr = Objects.find(key);
+        return itr != Objects.end() ? itr->second : nullptr;
+    }
+};
+
+struct ShardedFlatMap {
+    struct alignas(64) Shard {
+        std::shared_mutex                 Lock;
+        Acore::FlatHashMap<uint64, void*> Objects;
+    };
+
+    std::array<Shard, 16> Shards;
+
+    Shard& Get(uint64 key)
+    {
+        return Shards[Acore::FlatHashMap<uint64, void*>::Hash(key) >> 60];
+    }
+
+    void Insert(uint64 key, void* value)
+    {
+        Get(key).Objects.Insert(key, value);
+    }
+
+    void* Find(uint64 key)
+    {
+        Shard&                              shard = Get(key);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock);
+        return shard.Objects.Find(key);
+    }
+};
+
+template <typename Store>
+std::chrono::microseconds RunLookupBenchmark()
+{
+    Store store;
+    for (uint64 key = 1; key <= LookupObjects; ++key)
+        store.Insert(key, &store);
+
+    std::atomic<uint64>      found{0};
+    std::vector<std::thread> threads;
+
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < LookupThreads; ++i)
+        threads.emplace_back([&store, &found, i]() {
+            uint64 hits = 0;
+            uint64 key  = i;
+            for (std::size_t n = 0; n < LookupsPerThread; ++n) {
+                key = key * 6364136223846793005ULL + 1442695040888963407ULL;
+                if (store.Find(key % (LookupObjects * 2) + 1))
+                    ++hits;
+            }
+
+            found += hits;
+        });
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    auto const elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    EXPECT_GT(found.load(), 0u);
+    return elapsed;
+}
+} // namespace
+
+TEST(FlatHashMapTest, DISABLED_BenchmarkConcurrentLookups)
+{
+    auto locked  = RunLookupBenchmark<LockedUnorderedMap>();
+    auto sharded = RunLookupBenchmark<ShardedFlatMap>();
+
+    std::printf("unordered_map + shared_mutex: %lld us, sharded FlatHashMap: "
+                "%lld us\n",
+                static_cast<long long>(locked.count()),
+                static_cast<long long>(sharded.count()));
+}
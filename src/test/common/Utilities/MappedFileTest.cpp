@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+
+TEST(MappedFileTest, MapsFileContents)
+{
+    std::filesystem::path const path =
+        std::filesystem::temp_directory_path() / "acore_mapped_file_test.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "mapped";
+    }
+
+    Acore::MappedFile file;
+    ASSERT_TRUE(file.Open(path.string()));
+    ASSERT_EQ(file.GetSize(), 6u);
+    EXPECT_EQ(std::string(reinterpret_cast<char const*>(file.GetData()), 6),
+              "mapped");
+
+    // the mapping stays valid after the file is gone
+    std::filesystem::remove(path);
+    EXPECT_EQ(file.GetData()[0], 'm');
+
+    file.Close();
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_EQ(file.GetSize(), 0u);
+}
+
+TEST(MappedFileTest, CopyOnWriteLeavesFileUntouched)
+{
+    std::filesystem::path const path =
+        std::filesystem::temp_directory_path() / "acore_mapped_file_cow.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "mapped";
+    }
+
+    Acore::MappedFile file;
+    ASSERT_TRUE(file.Open(path.string(), true));
+    ASSERT_NE(file.GetWritableData(), nullptr);
+    file.GetWritableData()[0] = 'M';
+    EXPECT_EQ(file.GetData()[0], 'M');
+
+    Acore::MappedFile other;
+    ASSERT_TRUE(other.Open(path.string()));
+    EXPECT_EQ(other.GetWritableData(), nullptr);
+    EXPECT_EQ(other.GetData()[0], 'm');
+
+    file.Close();
+    other.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, MissingFile)
+{
+    Acore::MappedFile file;
+    EXPECT_FALSE(file.Open("acore_mapped_file_test_missing.bin"));
+    EXPECT_FALSE(file.IsOpen());
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MessageBuffer.h"
+#include "gtest/gtest.h"
+
+TEST(MessageBufferTest, SharedBufferKeepsOwnerAlive)
+{
+    auto owner = std::make_shared<std::vector<uint8>>(
+        std::initializer_list<uint8>{1, 2, 3, 4});
+    std::weak_ptr<std::vector<uint8>> const watcher = owner;
+
+    MessageBuffer buffer(owner, owner->data(), owner->size());
+    owner.reset();
+    ASSERT_FALSE(watcher.expired());
+
+    EXPECT_EQ(buffer.GetActiveSize(), 4u);
+    EXPECT_EQ(buffer.GetActiveData()[0], 1);
+
+    buffer.ReadCompleted(3);
+    EXPECT_EQ(buffer.GetActiveSize(), 1u);
+    EXPECT_EQ(buffer.GetActiveData()[0], 4);
+
+    // a moved buffer still sends the shared bytes
+    MessageBuffer moved(std::move(buffer));
+    EXPECT_EQ(moved.GetActiveSize(), 1u);
+    EXPECT_EQ(moved.GetActiveData()[0], 4);
+
+    moved = MessageBuffer(0);
+    EXPECT_TRUE(watcher.expired());
+}
+
+TEST(MessageBufferTest, OwnedBufferReadsItsStorage)
+{
+    MessageBuffer buffer(8);
+    uint8 const   data[] = {5, 6};
+    buffer.Write(data, sizeof(data));
+
+    EXPECT_EQ(buffer.GetActiveSize(), 2u);
+    EXPECT_EQ(buffer.GetActiveData(), buffer.GetReadPointer());
+    EXPECT_EQ(buffer.GetActiveData()[1], 6);
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <mutex>
+
+TEST(StartupLoaderTest, RunsDependenciesFirst)
+{
+    for (uint32 threads : {1u, 4u}) {
+        Acore::StartupLoader     loader;
+        std::mutex               lock;
+        std::vector<std::string> order;
+        auto                     record = [&](std::string name) {
+            return [&, name]() {
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(name);
+            };
+        };
+
+        loader.Add("quests", {"items", "creatures"}, record("quests"));
+        loader.Add("items", {}, record("items"));
+        loader.Add("creatures", {"models"}, record("creatures"));
+        loader.Add("models", {}, record("models"));
+        loader.Add("locales", {}, record("locales"));
+        loader.Run(threads);
+
+        auto position = [&](std::string const& name) {
+            return std::find(order.begin(), order.end(), name) - order.begin();
+        };
+
+        ASSERT_EQ(order.size(), 5u);
+        EXPECT_LT(position("items"), position("quests"));
+        EXPECT_LT(position("creatures"), position("quests"));
+        EXPECT_LT(position("models"), position("creatures"));
+
+        // the first added loader which is ready runs next
+        if (threads == 1)
+            EXPECT_EQ(order,
+                      (std::vector<std::string>{"items",
+                                                "models",
+                                                "creatures",
+                                                "quests",
+                                                "locales"}));
+    }
+}
+
+TEST(StartupLoaderTest, Validate)
+{
+    Acore::StartupLoader missing;
+    missing.Add("quests", {"items"}, []() {});
+    EXPECT_EQ(missing.Validate(),
+              "startup loader 'quests' depends on unknown loader 'items'");
+
+    Acore::StartupLoader cycle;
+    cycle.Add("a", {"b"}, []() {});
+    cycle.Add("b", {"c"}, []() {});
+    cycle.Add("c", {"a"}, []() {});
+    EXPECT_NE(cycle.Validate().find("dependency cycle"), std::string::npos);
+
+    Acore::StartupLoader duplicate;
+    duplicate.Add("a", {}, []() {});
+    duplicate.Add("a", {}, []() {});
+    EXPECT_EQ(duplicate.Validate(),
+              "startup loader 'a' is added more than once");
+
+    Acore::StartupLoader valid;
+    valid.Add("b", {"a"}, []() {});
+    valid.Add("a", {}, []() {});
+    EXPECT_EQ(valid.Validate(), "");
+}
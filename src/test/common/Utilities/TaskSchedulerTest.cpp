@@ -0,0 +1,104 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(TaskSchedulerTest, ExecutesInTimeOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    scheduler.Schedule(300ms, [&](TaskContext) { order.push_back(3); });
+    scheduler.Schedule(100ms, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(200ms, [&](TaskContext) { order.push_back(2); });
+
+    scheduler.Update(250ms);
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+
+    scheduler.Update(50ms);
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(TaskSchedulerTest, SameTimeKeepsInsertionOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    for (int i = 0; i < 8; ++i)
+        scheduler.Schedule(100ms, [&, i](TaskContext) { order.push_back(i); });
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST(TaskSchedulerTest, RepeatAndCancelGroup)
+{
+    TaskScheduler scheduler;
+    int repeats = 0;
+    int grouped = 0;
+
+    scheduler.Schedule(100ms, [&](TaskContext context) {
+        ++repeats;
+        context.Repeat();
+    });
+    scheduler.Schedule(150ms, 1, [&](TaskContext) { ++grouped; });
+
+    scheduler.Update(100ms);
+    scheduler.CancelGroup(1);
+    scheduler.Update(200ms);
+
+    EXPECT_EQ(repeats, 3);
+    EXPECT_EQ(grouped, 0);
+}
+
+TEST(TaskSchedulerTest, DelayGroupKeepsOtherTasks)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    scheduler.Schedule(100ms, 1, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(200ms, [&](TaskContext) { order.push_back(2); });
+    scheduler.DelayGroup(1, 150ms);
+
+    scheduler.Update(200ms);
+    EXPECT_EQ(order, (std::vector<int>{2}));
+
+    scheduler.Update(50ms);
+    EXPECT_EQ(order, (std::vector<int>{2, 1}));
+}
+
+TEST(TaskSchedulerTest, LargeCapturesFallBackToHeap)
+{
+    TaskScheduler scheduler;
+    std::string   payload(256, 'x');
+    std::string   result;
+
+    scheduler.Schedule(
+        10ms, [&result, payload, padding = std::array<char, 128>()](
+                  TaskContext) { result = payload; });
+
+    scheduler.Update(10ms);
+    EXPECT_EQ(result, payload);
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateMask.h"
+#include "gtest/gtest.h"
+
+TEST(UpdateMaskTest, SetAndUnsetBits)
+{
+    UpdateMask mask;
+    mask.SetCount(70);
+
+    EXPECT_EQ(mask.GetCount(), 70u);
+    EXPECT_EQ(mask.GetBlockCount(), 3u);
+
+    mask.SetBit(0);
+    mask.SetBit(33);
+    mask.SetBit(69);
+    EXPECT_TRUE(mask.GetBit(0));
+    EXPECT_FALSE(mask.GetBit(1));
+    EXPECT_TRUE(mask.GetBit(33));
+    EXPECT_TRUE(mask.GetBit(69));
+    EXPECT_EQ(mask.GetBlock(1), 1u << 1);
+
+    mask.UnsetBit(33);
+    EXPECT_FALSE(mask.GetBit(33));
+    EXPECT_EQ(mask.GetBlock(1), 0u);
+
+    mask.Clear();
+    EXPECT_FALSE(mask.GetBit(0));
+    EXPECT_FALSE(mask.GetBit(69));
+}
+
+TEST(UpdateMaskTest, AppendToPacketWritesClientBlocks)
+{
+    UpdateMask mask;
+    mask.SetCount(40);
+    mask.SetBit(0);
+    mask.SetBit(31);
+    mask.SetBit(32);
+    mask.SetBit(39);
+
+    ByteBuffer data;
+    mask.AppendToPacket(&data);
+
+    ASSERT_EQ(data.size(), 2 * sizeof(uint32));
+    EXPECT_EQ(data.read<uint32>(), 0x80000001u);
+    EXPECT_EQ(data.read<uint32>(), 0x00000081u);
+}
+
+TEST(UpdateMaskTest, CopyAndCombine)
+{
+    UpdateMask left;
+    left.SetCount(64);
+    left.SetBit(3);
+    left.SetBit(40);
+
+    UpdateMask right(left);
+    EXPECT_TRUE(right.GetBit(3));
+    EXPECT_TRUE(right.GetBit(40));
+
+    right.UnsetBit(3);
+    right.SetBit(50);
+
+    UpdateMask combined = left | right;
+    EXPECT_TRUE(combined.GetBit(3));
+    EXPECT_TRUE(combined.GetBit(40));
+    EXPECT_TRUE(combined.GetBit(50));
+
+    combined &= right;
+    EXPECT_FALSE(combined.GetBit(3));
+    EXPECT_TRUE(combined.GetBit(40));
+    EXPECT_TRUE(combined.GetBit(50));
+}
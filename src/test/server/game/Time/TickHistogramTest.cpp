@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickHistogram.h"
+#include "gtest/gtest.h"
+
+TEST(TickHistogramTest, EmptyHistogramReportsZero)
+{
+    TickHistogram histogram;
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(50), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0u);
+}
+
+TEST(TickHistogramTest, SmallValuesAreExact)
+{
+    TickHistogram histogram;
+    for (uint32 i = 1; i <= 50; ++i)
+        histogram.Add(i);
+
+    EXPECT_EQ(histogram.GetCount(), 50u);
+    EXPECT_EQ(histogram.GetPercentile(0), 1u);
+    EXPECT_EQ(histogram.GetPercentile(50), 25u);
+    EXPECT_EQ(histogram.GetPercentile(90), 45u);
+    EXPECT_EQ(histogram.GetPercentile(100), 50u);
+}
+
+TEST(TickHistogramTest, LargeValuesStayWithinBucketPrecision)
+{
+    for (uint32 value : {64u, 100u, 1000u, 54321u, 4000000000u}) {
+        TickHistogram histogram;
+        histogram.Add(value);
+        histogram.Add(value / 2);
+
+        uint32 const reported = histogram.GetPercentile(100);
+        EXPECT_EQ(reported, value);
+
+        // the bucket of the lower value is reported by its highest value
+        uint32 const lower = histogram.GetPercentile(50);
+        EXPECT_GE(lower, value / 2);
+        EXPECT_LE(lower - value / 2, value / 2 / TickHistogram::SUB_BUCKETS);
+    }
+}
+
+TEST(TickHistogramTest, RemoveSlidesTheWindow)
+{
+    TickHistogram histogram;
+    histogram.Add(10);
+    histogram.Add(500);
+    histogram.Add(20);
+
+    EXPECT_EQ(histogram.GetPercentile(100), 500u);
+
+    histogram.Remove(500);
+    EXPECT_EQ(histogram.GetCount(), 2u);
+    EXPECT_EQ(histogram.GetPercentile(100), 20u);
+    // the maximum is kept until the next reset
+    EXPECT_EQ(histogram.GetMax(), 500u);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0u);
+}
@@ -0,0 +1,717 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BotSession.h"
+#include "BigNumber.h"
+#include "BotStats.h"
+#include "CryptoHash.h"
+#include "CryptoRandom.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include "PacketCapture.h"
+#include "SRP6.h"
+#include "SharedDefines.h"
+#include "Util.h"
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <cmath>
+#include <thread>
+
+namespace {
+// authserver commands, see AuthSession.cpp of the authserver
+enum AuthCommand : uint8 {
+    AUTH_LOGON_CHALLENGE = 0x00,
+    AUTH_LOGON_PROOF     = 0x01,
+};
+
+uint16 constexpr CLIENT_BUILD          = 12340; // 3.3.5a
+uint32 constexpr MOVEMENT_FLAG_FORWARD = 0x00000001;
+float constexpr RUN_SPEED              = 7.0f;
+uint32 constexpr HEARTBEAT_INTERVAL    = 500;
+uint32 constexpr PING_INTERVAL         = 30000; // the server kicks below 27s
+uint32 constexpr UPDATE_INTERVAL       = 50;
+
+// character enum entry after guid, name and race, see Player::BuildEnumData
+std::size_t constexpr CHAR_ENUM_ENTRY_TAIL_SIZE = 7 + 4 + 4 + 12 + 4 + 4 + 4 +
+                                                  1 + 12 + 23 * (4 + 1 + 4);
+
+std::chrono::seconds constexpr RESPONSE_TIMEOUT(30);
+std::chrono::seconds constexpr SILENCE_TIMEOUT(60);
+
+// character names may only contain letters
+std::string GetCharacterName(uint32 index)
+{
+    std::string name = "Bot";
+    do {
+        name += char('a' + index % 26);
+        index /= 26;
+    } while (index);
+
+    return name;
+}
+
+boost::asio::ip::tcp::endpoint GetEndpoint(std::string const& address,
+                                           uint16             port)
+{
+    return {boost::asio::ip::make_address(address), port};
+}
+} // namespace
+
+BotSession::BotSession(uint32                index,
+                       std::string           account,
+                       BotConfig const&      config,
+                       BotStats&             stats,
+                       CapturedStream const* stream)
+    : _index(index), _account(std::move(account)), _config(config),
+      _stats(stats), _stream(stream), _socket(_ioContext)
+{
+    Utf8ToUpperOnlyLatin(_account);
+}
+
+void BotSession::Run(std::atomic<bool> const& stop)
+{
+    _startTime = Clock::now();
+
+    try {
+        if (!Authenticate() || !ConnectWorld() || !EnterWorld()) {
+            _stats.LoginFailed();
+            return;
+        }
+    }
+    catch (std::exception const& e) {
+        LOG_ERROR("loadbot", "Bot {}: login failed: {}", _account, e.what());
+        _stats.LoginFailed();
+        return;
+    }
+
+    _stats.BotEntered();
+    Play(stop);
+    _stats.BotLeft();
+
+    boost::system::error_code error;
+    _socket.close(error);
+}
+
+bool BotSession::Authenticate()
+{
+    using Acore::Crypto::SHA1;
+    using Acore::Crypto::SRP6;
+
+    std::string password = _config.Password;
+    Utf8ToUpperOnlyLatin(password);
+
+    boost::asio::ip::tcp::socket socket(_ioContext);
+    socket.connect(
+        GetEndpoint(_config.AuthServerAddress, _config.AuthServerPort));
+
+    // the four character codes are sent in reversed byte order
+    ByteBuffer challenge;
+    challenge << uint8(AUTH_LOGON_CHALLENGE) << uint8(6);
+    challenge << uint16(30 + _account.size());
+    challenge.append("WoW", 4);
+    challenge << uint8(3) << uint8(3) << uint8(5) << uint16(CLIENT_BUILD);
+    challenge.append("68x", 4);
+    challenge.append("niW", 4);
+    challenge.append("SUne", 4);
+    challenge << uint32(0);          // timezone bias
+    challenge << uint32(0x0100007F); // ip
+    challenge << uint8(_account.size());
+    challenge.append(_account.data(), _account.size());
+    boost::asio::write(socket,
+                       boost::asio::buffer(challenge.contents(),
+                                           challenge.size()));
+
+    std::array<uint8, 3> challengeResult;
+    boost::asio::read(socket, boost::asio::buffer(challengeResult));
+    if (challengeResult[2] != 0) {
+        LOG_ERROR("loadbot",
+                  "Bot {}: logon challenge failed with error {}",
+                  _account,
+                  challengeResult[2]);
+        return false;
+    }
+
+    // B, g length, g, N length, N, salt, version challenge, security flags
+    std::array<uint8, 32 + 1 + 1 + 1 + 32 + 32 + 16 + 1> challengeData;
+    boost::asio::read(socket, boost::asio::buffer(challengeData));
+
+    SRP6::EphemeralKey B;
+    SRP6::Salt         salt;
+    std::copy_n(challengeData.begin(), B.size(), B.begin());
+    std::copy_n(challengeData.begin() + 67, salt.size(), salt.begin());
+    if (challengeData.back() != 0) {
+        LOG_ERROR("loadbot",
+                  "Bot {}: accounts with a pin or token are not supported",
+                  _account);
+        return false;
+    }
+
+    // client half of SRP6, the server half lives in SRP6::
+    // VerifyChallengeResponse
+    BigNumber const N(SRP6::N);
+    BigNumber const g(SRP6::g);
+    BigNumber       a;
+    a.SetRand(19 * 8);
+
+    SRP6::EphemeralKey const A = g.ModExp(a, N).ToByteArray<32>();
+    BigNumber const          x(SHA1::GetDigestOf(
+        salt, SHA1::GetDigestOf(_account, ":", password)));
+    BigNumber const          u(SHA1::GetDigestOf(A, B));
+
+    BigNumber base = BigNumber(B) - g.ModExp(x, N) * 3 % N;
+    if (base.IsNegative())
+        base += N;
+
+    SRP6::EphemeralKey const S = base.ModExp(a + u * x, N).ToByteArray<32>();
+    _sessionKey                = SRP6::SHA1Interleave(S);
+
+    SHA1::Digest const NHash = SHA1::GetDigestOf(SRP6::N);
+    SHA1::Digest const gHash = SHA1::GetDigestOf(SRP6::g);
+    SHA1::Digest       NgHash;
+    for (std::size_t i = 0; i < NgHash.size(); ++i)
+        NgHash[i] = NHash[i] ^ gHash[i];
+
+    SHA1::Digest const M1 = SHA1::GetDigestOf(
+        NgHash, SHA1::GetDigestOf(_account), salt, A, B, _sessionKey);
+
+    ByteBuffer proof;
+    proof << uint8(AUTH_LOGON_PROOF);
+    proof.append(A);
+    proof.append(M1);
+    proof.append(SHA1::Digest{}); // version hash, only checked when strict
+    proof << uint8(0);            // number of keys
+    proof << uint8(0);            // security flags
+    boost::asio::write(socket,
+                       boost::asio::buffer(proof.contents(), proof.size()));
+
+    std::array<uint8, 2> proofResult;
+    boost::asio::read(socket, boost::asio::buffer(proofResult));
+    if (proofResult[1] != 0) {
+        LOG_ERROR("loadbot",
+                  "Bot {}: logon proof failed with error {}",
+                  _account,
+                  proofResult[1]);
+        return false;
+    }
+
+    // M2, account flags, survey id, login flags
+    std::array<uint8, 20 + 4 + 4 + 2> proofData;
+    boost::asio::read(socket, boost::asio::buffer(proofData));
+
+    SHA1::Digest M2;
+    std::copy_n(proofData.begin(), M2.size(), M2.begin());
+    if (M2 != SRP6::GetSessionVerifier(A, M1, _sessionKey)) {
+        LOG_ERROR("loadbot", "Bot {}: server proof mismatch", _account);
+        return false;
+    }
+
+    return true;
+}
+
+bool BotSession::ConnectWorld()
+{
+    _socket.connect(
+        GetEndpoint(_config.WorldServerAddress, _config.WorldServerPort));
+    _lastReceive = Clock::now();
+
+    ByteBuffer payload;
+    if (!WaitForPacket(SMSG_AUTH_CHALLENGE, payload))
+        return false;
+
+    std::array<uint8, 4> serverSeed;
+    payload.read_skip<uint32>();
+    payload.read(serverSeed);
+
+    std::array<uint8, 4> clientSeed;
+    Acore::Crypto::GetRandomBytes(clientSeed);
+
+    uint8 const         t[4] = {0x00, 0x00, 0x00, 0x00};
+    Acore::Crypto::SHA1 sha;
+    sha.UpdateData(_account);
+    sha.UpdateData(t, sizeof(t));
+    sha.UpdateData(clientSeed);
+    sha.UpdateData(serverSeed);
+    sha.UpdateData(_sessionKey);
+    sha.Finalize();
+
+    ByteBuffer session;
+    session << uint32(CLIENT_BUILD);
+    session << uint32(0); // login server id
+    session << _account;
+    session << uint32(0); // login server type
+    session.append(clientSeed);
+    session << uint32(0); // region id
+    session << uint32(0); // battlegroup id
+    session << uint32(_config.RealmID);
+    session << uint64(0); // dos response
+    session.append(sha.GetDigest());
+    session << uint32(0); // no addon info
+    SendPacket(CMSG_AUTH_SESSION, session);
+
+    // everything after the auth session is encrypted
+    _crypt.Init(_sessionKey);
+
+    for (;;) {
+        if (!WaitForPacket(SMSG_AUTH_RESPONSE, payload))
+            return false;
+
+        uint8 result;
+        payload >> result;
+        if (result == AUTH_OK)
+            return true;
+
+        if (result != AUTH_WAIT_QUEUE) {
+            LOG_ERROR("loadbot",
+                      "Bot {}: world authentication failed with result {}",
+                      _account,
+                      result);
+            return false;
+        }
+    }
+}
+
+bool BotSession::EnterWorld()
+{
+    ByteBuffer payload;
+    SendPacket(CMSG_CHAR_ENUM, ByteBuffer());
+    if (!WaitForPacket(SMSG_CHAR_ENUM, payload))
+        return false;
+
+    uint8 count;
+    payload >> count;
+    if (!count && !_stream) {
+        ByteBuffer create;
+        create << GetCharacterName(_index);
+        create << uint8(_config.CharacterRace) << uint8(_config.CharacterClass);
+        create << uint8(0); // gender
+        create << uint8(0) << uint8(0) << uint8(0) << uint8(0) << uint8(0);
+        create << uint8(0); // outfit
+        SendPacket(CMSG_CHAR_CREATE, create);
+        if (!WaitForPacket(SMSG_CHAR_CREATE, payload))
+            return false;
+
+        uint8 result;
+        payload >> result;
+        if (result != CHAR_CREATE_SUCCESS) {
+            LOG_ERROR("loadbot",
+                      "Bot {}: character creation failed with result {}",
+                      _account,
+                      result);
+            return false;
+        }
+
+        SendPacket(CMSG_CHAR_ENUM, ByteBuffer());
+        if (!WaitForPacket(SMSG_CHAR_ENUM, payload))
+            return false;
+
+        payload >> count;
+        if (!count)
+            return false;
+    }
+
+    // the first character is used unless a captured one is replayed, its
+    // guid and race are all we need
+    uint8       race;
+    std::string name;
+    for (uint8 i = 0; i < count; ++i) {
+        payload >> _guid >> name >> race;
+        if (!_stream || _guid == _stream->CharacterGuid)
+            break;
+
+        payload.read_skip(CHAR_ENUM_ENTRY_TAIL_SIZE);
+        _guid = 0;
+    }
+
+    if (!_guid) {
+        LOG_ERROR("loadbot",
+                  "Bot {}: captured character {} is not on the account",
+                  _account,
+                  _stream ? _stream->CharacterGuid : 0);
+        return false;
+    }
+
+    _language = (RACEMASK_ALLIANCE & (1 << (race - 1))) ? LANG_COMMON
+                                                        : LANG_ORCISH;
+
+    ByteBuffer login;
+    login << _guid;
+    SendPacket(CMSG_PLAYER_LOGIN, login);
+    if (!WaitForPacket(SMSG_LOGIN_VERIFY_WORLD, payload))
+        return false;
+
+    payload.read_skip<uint32>(); // map
+    payload >> _positionX >> _positionY >> _positionZ >> _orientation;
+
+    // the route is a circle through the login position
+    _routeCenterX = _positionX - _config.RouteRadius;
+    _routeCenterY = _positionY;
+    _routeAngle   = 0.0f;
+
+    LOG_DEBUG("loadbot", "Bot {}: {} entered the world", _account, name);
+    return true;
+}
+
+void BotSession::Play(std::atomic<bool> const& stop)
+{
+    // a replayed session only sends what was captured
+    bool const moving = !_stream && _config.RouteRadius > 0.0f;
+    if (moving)
+        SendMovement(MSG_MOVE_START_FORWARD, MOVEMENT_FLAG_FORWARD);
+
+    if (!_stream && _config.BattlegroundTypeId) {
+        ByteBuffer join;
+        join << uint64(0); // battlemaster
+        join << uint32(_config.BattlegroundTypeId);
+        join << uint32(0); // first available instance
+        join << uint8(0);  // not as group
+        SendPacket(CMSG_BATTLEMASTER_JOIN, join);
+    }
+
+    uint32 heartbeatTimer  = 0;
+    uint32 chatTimer       = 0;
+    uint32 spellTimer      = 0;
+    uint32 latencyTimer    = 0;
+    uint32 pingTimer       = 0;
+    uint32 serverInfoTimer = 0;
+
+    Clock::time_point const enteredWorld = Clock::now();
+    Clock::time_point       lastUpdate   = enteredWorld;
+    ByteBuffer              payload;
+    uint16            opcode;
+
+    while (!stop) {
+        if (!Receive() || Clock::now() - _lastReceive > SILENCE_TIMEOUT) {
+            LOG_ERROR("loadbot", "Bot {}: disconnected", _account);
+            return;
+        }
+
+        while (ParsePacket(opcode, payload))
+            HandlePacket(opcode, payload);
+
+        Clock::time_point const now = Clock::now();
+        uint32 const            diff =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now -
+                                                                  lastUpdate)
+                .count();
+        lastUpdate = now;
+
+        if (_stream && !ReplayPackets(now - enteredWorld)) {
+            LOG_INFO("loadbot", "Bot {}: replay finished", _account);
+            break;
+        }
+
+        if (moving) {
+            AdvanceRoute(diff);
+            if ((heartbeatTimer += diff) >= HEARTBEAT_INTERVAL) {
+                heartbeatTimer = 0;
+                SendMovement(MSG_MOVE_HEARTBEAT, MOVEMENT_FLAG_FORWARD);
+            }
+        }
+
+        if (!_stream && _config.ChatInterval &&
+            (chatTimer += diff) >= _config.ChatInterval) {
+            chatTimer = 0;
+            SendChat("Load test message");
+        }
+
+        if (!_stream && _config.SpellId &&
+            (spellTimer += diff) >= _config.SpellInterval) {
+            spellTimer = 0;
+
+            ByteBuffer cast;
+            cast << uint8(0);  // cast count
+            cast << uint32(_config.SpellId);
+            cast << uint8(0);  // cast flags
+            cast << uint32(0); // self cast, no target
+            SendPacket(CMSG_CAST_SPELL, cast);
+        }
+
+        // answered from the world session update, so the round trip includes
+        // the time the request waits for the next world tick
+        if ((latencyTimer += diff) >= _config.LatencyInterval) {
+            latencyTimer = 0;
+            _pendingTimeQueries.push_back(now);
+            SendPacket(CMSG_QUERY_TIME, ByteBuffer());
+        }
+
+        // answered by the network thread, the plain network round trip
+        if ((pingTimer += diff) >= PING_INTERVAL) {
+            pingTimer = 0;
+            _pingSent = now;
+
+            ByteBuffer ping;
+            ping << uint32(++_pingSerial) << uint32(_lastPing);
+            SendPacket(CMSG_PING, ping);
+        }
+
+        if (_config.ServerInfoInterval && !_index &&
+            (serverInfoTimer += diff) >= _config.ServerInfoInterval) {
+            serverInfoTimer = 0;
+            SendChat(".server info");
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(UPDATE_INTERVAL));
+    }
+
+    if (moving)
+        SendMovement(MSG_MOVE_STOP, 0);
+}
+
+bool BotSession::ReplayPackets(Clock::duration elapsedTime)
+{
+    uint32 const elapsed = uint32(
+        std::chrono::duration_cast<std::chrono::milliseconds>(elapsedTime)
+            .count());
+
+    std::vector<CapturedStream::Packet> const& packets = _stream->Packets;
+    for (; _nextReplayPacket < packets.size() &&
+           packets[_nextReplayPacket].Offset <= elapsed;
+         ++_nextReplayPacket) {
+        CapturedStream::Packet const& packet = packets[_nextReplayPacket];
+
+        ByteBuffer payload;
+        if (!packet.Payload.empty())
+            payload.append(packet.Payload.data(), packet.Payload.size());
+
+        SendPacket(packet.Opcode, payload);
+    }
+
+    return _nextReplayPacket < packets.size();
+}
+
+void BotSession::SendPacket(uint32 opcode, ByteBuffer const& payload)
+{
+    // client header: big endian size (including the opcode), 4 byte opcode
+    std::vector<uint8> data(6 + payload.size());
+    uint16 const       size = uint16(payload.size() + 4);
+    data[0]                 = uint8(size >> 8);
+    data[1]                 = uint8(size);
+    data[2]                 = uint8(opcode);
+    data[3]                 = uint8(opcode >> 8);
+    data[4]                 = uint8(opcode >> 16);
+    data[5]                 = uint8(opcode >> 24);
+
+    // ARC4 is symmetric: the server decrypts what we send with the stream
+    // AuthCrypt::DecryptRecv generates, and the other way round
+    if (_crypt.IsInitialized())
+        _crypt.DecryptRecv(data.data(), 6);
+
+    if (payload.size())
+        std::memcpy(data.data() + 6, payload.contents(), payload.size());
+
+    boost::system::error_code error;
+    boost::asio::write(_socket, boost::asio::buffer(data), error);
+}
+
+bool BotSession::Receive()
+{
+    boost::system::error_code error;
+    std::size_t const         available = _socket.available(error);
+    if (error)
+        return false;
+
+    if (!available)
+        return true;
+
+    std::size_t const offset = _recvBuffer.size();
+    _recvBuffer.resize(offset + available);
+
+    std::size_t const read = _socket.read_some(
+        boost::asio::buffer(_recvBuffer.data() + offset, available), error);
+    _recvBuffer.resize(offset + read);
+    if (error)
+        return false;
+
+    _lastReceive = Clock::now();
+    return true;
+}
+
+bool BotSession::ParsePacket(uint16& opcode, ByteBuffer& payload)
+{
+    // headers are decrypted in place exactly once, even when they arrive in
+    // several reads
+    auto decryptHeader = [this](std::size_t length) {
+        if (_headerDecrypted >= length)
+            return;
+
+        if (_crypt.IsInitialized())
+            _crypt.EncryptSend(_recvBuffer.data() + _headerDecrypted,
+                               length - _headerDecrypted);
+
+        _headerDecrypted = length;
+    };
+
+    if (_recvBuffer.empty())
+        return false;
+
+    decryptHeader(1);
+    std::size_t const headerSize = (_recvBuffer[0] & 0x80) ? 5 : 4;
+    if (_recvBuffer.size() < headerSize)
+        return false;
+
+    decryptHeader(headerSize);
+
+    uint8 const* header = _recvBuffer.data();
+    uint32       size;
+    if (headerSize == 5) {
+        size   = (uint32(header[0] & 0x7F) << 16) | (header[1] << 8) |
+                 header[2];
+        opcode = header[3] | (header[4] << 8);
+    }
+    else {
+        size   = (header[0] << 8) | header[1];
+        opcode = header[2] | (header[3] << 8);
+    }
+
+    // the size includes the opcode
+    size -= 2;
+    if (_recvBuffer.size() < headerSize + size)
+        return false;
+
+    payload.clear();
+    if (size)
+        payload.append(_recvBuffer.data() + headerSize, size);
+
+    _recvBuffer.erase(_recvBuffer.begin(),
+                      _recvBuffer.begin() + headerSize + size);
+    _headerDecrypted = 0;
+    return true;
+}
+
+bool BotSession::WaitForPacket(uint16 opcode, ByteBuffer& payload)
+{
+    Clock::time_point const deadline = Clock::now() + RESPONSE_TIMEOUT;
+
+    uint16 received;
+    while (Clock::now() < deadline) {
+        while (ParsePacket(received, payload)) {
+            if (received == opcode)
+                return true;
+
+            HandlePacket(received, payload);
+        }
+
+        if (!Receive())
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    LOG_ERROR("loadbot",
+              "Bot {}: timed out waiting for opcode {}",
+              _account,
+              opcode);
+    return false;
+}
+
+void BotSession::HandlePacket(uint16 opcode, ByteBuffer& payload)
+{
+    try {
+        switch (opcode) {
+        case SMSG_TIME_SYNC_REQ: {
+            uint32 counter;
+            payload >> counter;
+
+            ByteBuffer response;
+            response << counter << GetClientTime();
+            SendPacket(CMSG_TIME_SYNC_RESP, response);
+            break;
+        }
+        case SMSG_QUERY_TIME_RESPONSE:
+            if (!_pendingTimeQueries.empty()) {
+                _stats.AddWorldLatency(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        Clock::now() - _pendingTimeQueries.front())
+                        .count());
+                _pendingTimeQueries.pop_front();
+            }
+            break;
+        case SMSG_PONG:
+            _lastPing = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            Clock::now() - _pingSent)
+                            .count();
+            _stats.AddPingLatency(_lastPing);
+            break;
+        case SMSG_MESSAGECHAT: {
+            if (!_config.ServerInfoInterval || _index)
+                break;
+
+            uint8 type;
+            payload >> type;
+            if (type != CHAT_MSG_SYSTEM)
+                break;
+
+            // language, sender, flags, receiver, length
+            payload.read_skip(4 + 8 + 4 + 8 + 4);
+
+            std::string text;
+            payload >> text;
+            if (text.starts_with("Update time diff") || text.starts_with("- "))
+                _stats.AddServerInfo(std::move(text));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    catch (ByteBufferException const&) {
+        LOG_ERROR("loadbot",
+                  "Bot {}: malformed packet with opcode {}",
+                  _account,
+                  opcode);
+    }
+}
+
+void BotSession::SendMovement(uint32 opcode, uint32 moveFlags)
+{
+    ByteBuffer data;
+    data.appendPackGUID(_guid);
+    data << uint32(moveFlags);
+    data << uint16(0); // extra flags
+    data << GetClientTime();
+    data << _positionX << _positionY << _positionZ << _orientation;
+    data << uint32(0); // fall time
+    SendPacket(opcode, data);
+}
+
+void BotSession::AdvanceRoute(uint32 diff)
+{
+    float const radius = _config.RouteRadius;
+
+    // the height is kept, the route should be picked on flat ground
+    _routeAngle = std::fmod(
+        _routeAngle + RUN_SPEED * diff / 1000.0f / radius,
+        2 * float(M_PI));
+    _positionX   = _routeCenterX + radius * std::cos(_routeAngle);
+    _positionY   = _routeCenterY + radius * std::sin(_routeAngle);
+    _orientation = std::fmod(_routeAngle + float(M_PI) / 2, 2 * float(M_PI));
+}
+
+void BotSession::SendChat(std::string const& text)
+{
+    ByteBuffer data;
+    data << uint32(CHAT_MSG_SAY) << uint32(_language) << text;
+    SendPacket(CMSG_MESSAGECHAT, data);
+}
+
+uint32 BotSession::GetClientTime() const
+{
+    return uint32(std::chrono::duration_cast<std::chrono::milliseconds>(
+                      Clock::now() - _startTime)
+                      .count());
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADBOT_BOTSESSION_H
+#define LOADBOT_BOTSESSION_H
+
+#include "AuthCrypt.h"
+#include "AuthDefines.h"
+#include "ByteBuffer.h"
+#include "Define.h"
+#include <atomic>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
+
+class BotStats;
+struct CapturedStream;
+
+struct BotConfig {
+    std::string AuthServerAddress;
+    uint16      AuthServerPort;
+    std::string WorldServerAddress;
+    uint16      WorldServerPort;
+    uint32      RealmID;
+    std::string Password;
+    uint8       CharacterRace;
+    uint8       CharacterClass;
+    float       RouteRadius;
+    uint32      ChatInterval;
+    uint32      SpellId;
+    uint32      SpellInterval;
+    uint32      BattlegroundTypeId;
+    uint32      LatencyInterval;
+    uint32      ServerInfoInterval;
+};
+
+/// One headless client: logs in through the authserver, enters the world with
+/// the first character of its account and then plays until stopped. With a
+/// captured stream it logs in the captured character instead and sends the
+/// recorded packets with their original timing.
+class BotSession {
+public:
+    BotSession(uint32                index,
+               std::string           account,
+               BotConfig const&      config,
+               BotStats&             stats,
+               CapturedStream const* stream = nullptr);
+
+    void Run(std::atomic<bool> const& stop);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    bool Authenticate();
+    bool ConnectWorld();
+    bool EnterWorld();
+    void Play(std::atomic<bool> const& stop);
+    bool ReplayPackets(Clock::duration elapsedTime);
+
+    void SendPacket(uint32 opcode, ByteBuffer const& payload);
+    bool Receive();
+    bool ParsePacket(uint16& opcode, ByteBuffer& payload);
+    bool WaitForPacket(uint16 opcode, ByteBuffer& payload);
+    void HandlePacket(uint16 opcode, ByteBuffer& payload);
+
+    void SendMovement(uint32 opcode, uint32 moveFlags);
+    void AdvanceRoute(uint32 diff);
+    void SendChat(std::string const& text);
+
+    uint32 GetClientTime() const;
+
+    uint32                _index;
+    std::string           _account;
+    BotConfig const&      _config;
+    BotStats&             _stats;
+    CapturedStream const* _stream;
+    std::size_t           _nextReplayPacket{0};
+
+    boost::asio::io_context      _ioContext;
+    boost::asio::ip::tcp::socket _socket;
+    SessionKey                   _sessionKey{};
+    AuthCrypt                    _crypt;
+    std::vector<uint8>           _recvBuffer;
+    std::size_t                  _headerDecrypted{0};
+    Clock::time_point            _startTime;
+    Clock::time_point            _lastReceive;
+
+    uint64 _guid{0};
+    uint32 _language{0};
+    float  _routeCenterX{0.0f};
+    float  _routeCenterY{0.0f};
+    float  _routeAngle{0.0f};
+    float  _positionX{0.0f};
+    float  _positionY{0.0f};
+    float  _positionZ{0.0f};
+    float  _orientation{0.0f};
+    uint32 _pingSerial{0};
+    uint32 _lastPing{0};
+
+    std::deque<Clock::time_point> _pendingTimeQueries;
+    Clock::time_point             _pingSent;
+};
+
+#endif
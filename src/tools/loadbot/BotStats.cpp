@@ -0,0 +1,84 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BotStats.h"
+#include "Log.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+uint32 Percentile(std::vector<uint32> const& sorted, uint32 percent)
+{
+    if (sorted.empty())
+        return 0;
+
+    return sorted[(sorted.size() - 1) * percent / 100];
+}
+} // namespace
+
+void BotStats::AddWorldLatency(uint32 milliseconds)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _worldLatency.push_back(milliseconds);
+}
+
+void BotStats::AddPingLatency(uint32 milliseconds)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _pingLatency.push_back(milliseconds);
+}
+
+void BotStats::AddServerInfo(std::string line)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _serverInfo.push_back(std::move(line));
+}
+
+void BotStats::Report(uint32 botCount)
+{
+    std::vector<uint32>      worldLatency;
+    std::vector<uint32>      pingLatency;
+    std::vector<std::string> serverInfo;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        worldLatency.swap(_worldLatency);
+        pingLatency.swap(_pingLatency);
+        serverInfo.swap(_serverInfo);
+    }
+
+    std::sort(worldLatency.begin(), worldLatency.end());
+
+    uint64 const pingTotal =
+        std::accumulate(pingLatency.begin(), pingLatency.end(), uint64(0));
+
+    LOG_INFO("loadbot",
+             "Bots in world: {}/{} (failed logins: {}) | world latency p50 "
+             "{}ms, p95 {}ms, max {}ms ({} samples) | ping avg {}ms",
+             GetInWorldCount(),
+             botCount,
+             uint32(_failedLogins),
+             Percentile(worldLatency, 50),
+             Percentile(worldLatency, 95),
+             worldLatency.empty() ? 0 : worldLatency.back(),
+             worldLatency.size(),
+             pingLatency.empty() ? 0 : pingTotal / pingLatency.size());
+
+    for (std::string const& line : serverInfo)
+        LOG_INFO("loadbot", "Server: {}", line);
+}
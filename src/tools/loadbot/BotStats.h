@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADBOT_BOTSTATS_H
+#define LOADBOT_BOTSTATS_H
+
+#include "Define.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Measurements shared by all bots, logged and reset by Report()
+class BotStats {
+public:
+    void AddWorldLatency(uint32 milliseconds);
+    void AddPingLatency(uint32 milliseconds);
+    void AddServerInfo(std::string line);
+
+    void BotEntered() { ++_inWorld; }
+    void BotLeft() { --_inWorld; }
+    void LoginFailed() { ++_failedLogins; }
+
+    uint32 GetInWorldCount() const { return _inWorld; }
+
+    void Report(uint32 botCount);
+
+private:
+    std::mutex               _lock;
+    std::vector<uint32>      _worldLatency;
+    std::vector<uint32>      _pingLatency;
+    std::vector<std::string> _serverInfo;
+    std::atomic<uint32>      _inWorld{0};
+    std::atomic<uint32>      _failedLogins{0};
+};
+
+#endif
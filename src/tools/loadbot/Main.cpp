@@ -0,0 +1,237 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Banner.h"
+#include "BotSession.h"
+#include "BotStats.h"
+#include "Config.h"
+#include "Log.h"
+#include "OpenSSLCrypto.h"
+#include "PacketCapture.h"
+#include "Util.h"
+#include <boost/program_options.hpp>
+#include <csignal>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#ifndef _ACORE_LOAD_BOT_CONFIG
+#define _ACORE_LOAD_BOT_CONFIG "loadbot.conf"
+#endif
+
+using namespace boost::program_options;
+namespace fs = std::filesystem;
+
+namespace {
+std::atomic<bool> StopRequested{false};
+
+void SignalHandler(int /*signal*/) { StopRequested = true; }
+} // namespace
+
+BotConfig     LoadBotConfig();
+variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile);
+
+/// Launch the load generation client
+int main(int argc, char** argv)
+{
+    signal(SIGABRT, &Acore::AbortHandler);
+
+    // Command line parsing
+    auto configFile = fs::path(sConfigMgr->GetConfigPath() +
+                               std::string(_ACORE_LOAD_BOT_CONFIG));
+    auto vm         = GetConsoleArguments(argc, argv, configFile);
+
+    // exit if help is enabled
+    if (vm.count("help"))
+        return 0;
+
+    // Add file and args in config
+    sConfigMgr->Configure(configFile.generic_string(),
+                          std::vector<std::string>(argv, argv + argc));
+
+    if (!sConfigMgr->LoadAppConfigs())
+        return 1;
+
+    // Init logging
+    sLog->Initialize();
+
+    Acore::Banner::Show(
+        "loadbot",
+        [](std::string_view text) { LOG_INFO("loadbot", text); },
+        []() {
+            LOG_INFO("loadbot",
+                     "> Using configuration file:       {}",
+                     sConfigMgr->GetFilename());
+        });
+
+    OpenSSLCrypto::threadsSetup();
+
+    std::shared_ptr<void> opensslHandle(
+        nullptr, [](void*) { OpenSSLCrypto::threadsCleanup(); });
+
+    signal(SIGINT, &SignalHandler);
+    signal(SIGTERM, &SignalHandler);
+
+    BotConfig const config = LoadBotConfig();
+    BotStats        stats;
+
+    // a capture replaces the scripted bots, one bot per captured session
+    PacketCapture     capture;
+    std::string const replayFile =
+        sConfigMgr->GetOption<std::string>("LoadBot.Replay.File", "");
+    if (!replayFile.empty()) {
+        if (!capture.Load(replayFile))
+            return 1;
+
+        LOG_INFO("loadbot",
+                 "Set Replay.StartTime = {} in the worldserver config to "
+                 "replay with the captured game time",
+                 capture.GetStartTime());
+    }
+
+    uint32 const botCount =
+        replayFile.empty()
+            ? sConfigMgr->GetOption<uint32>("LoadBot.BotCount", 10)
+            : uint32(capture.GetStreams().size());
+    uint32 const firstAccount =
+        sConfigMgr->GetOption<uint32>("LoadBot.FirstAccount", 1);
+    std::string const accountPrefix =
+        sConfigMgr->GetOption<std::string>("LoadBot.AccountPrefix", "BOT");
+    uint32 const loginInterval =
+        sConfigMgr->GetOption<uint32>("LoadBot.LoginInterval", 200);
+    uint32 const reportInterval = std::max<uint32>(
+        1, sConfigMgr->GetOption<uint32>("LoadBot.ReportInterval", 10));
+    uint32 const duration =
+        sConfigMgr->GetOption<uint32>("LoadBot.Duration", 0);
+
+    LOG_INFO("loadbot",
+             "Starting {} bots, accounts {}{} to {}{}",
+             botCount,
+             accountPrefix,
+             firstAccount,
+             accountPrefix,
+             firstAccount + botCount - 1);
+
+    // one thread per bot, each one only blocks on its own socket
+    std::vector<std::unique_ptr<BotSession>> bots;
+    std::vector<std::thread>                 threads;
+    std::atomic<uint32>                      running{0};
+    bots.reserve(botCount);
+    threads.reserve(botCount);
+
+    for (uint32 i = 0; i < botCount && !StopRequested; ++i) {
+        bots.push_back(std::make_unique<BotSession>(
+            i,
+            accountPrefix + std::to_string(firstAccount + i),
+            config,
+            stats,
+            replayFile.empty() ? nullptr : &capture.GetStreams()[i]));
+
+        ++running;
+        threads.emplace_back([bot = bots.back().get(), &running]() {
+            bot->Run(StopRequested);
+            --running;
+        });
+
+        // spread the logins, the authserver and the character enum are the
+        // expensive part of connecting
+        std::this_thread::sleep_for(std::chrono::milliseconds(loginInterval));
+    }
+
+    uint32 elapsed = 0;
+    while (!StopRequested && running && (!duration || elapsed < duration)) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        if (!(++elapsed % reportInterval))
+            stats.Report(botCount);
+    }
+
+    StopRequested = true;
+    for (std::thread& thread : threads)
+        thread.join();
+
+    stats.Report(botCount);
+    LOG_INFO("loadbot", "Halting process...");
+
+    return 0;
+}
+
+BotConfig LoadBotConfig()
+{
+    BotConfig config;
+    config.AuthServerAddress = sConfigMgr->GetOption<std::string>(
+        "LoadBot.AuthServerAddress", "127.0.0.1");
+    config.AuthServerPort =
+        sConfigMgr->GetOption<uint16>("LoadBot.AuthServerPort", 3724);
+    config.WorldServerAddress = sConfigMgr->GetOption<std::string>(
+        "LoadBot.WorldServerAddress", "127.0.0.1");
+    config.WorldServerPort =
+        sConfigMgr->GetOption<uint16>("LoadBot.WorldServerPort", 8085);
+    config.RealmID = sConfigMgr->GetOption<uint32>("LoadBot.RealmID", 1);
+    config.Password =
+        sConfigMgr->GetOption<std::string>("LoadBot.Password", "bot");
+    config.CharacterRace =
+        sConfigMgr->GetOption<uint8>("LoadBot.Character.Race", 1);
+    config.CharacterClass =
+        sConfigMgr->GetOption<uint8>("LoadBot.Character.Class", 1);
+    config.RouteRadius =
+        sConfigMgr->GetOption<float>("LoadBot.Route.Radius", 10.0f);
+    config.ChatInterval =
+        sConfigMgr->GetOption<uint32>("LoadBot.Chat.Interval", 0);
+    config.SpellId = sConfigMgr->GetOption<uint32>("LoadBot.Spell.Id", 0);
+    config.SpellInterval =
+        sConfigMgr->GetOption<uint32>("LoadBot.Spell.Interval", 10000);
+    config.BattlegroundTypeId =
+        sConfigMgr->GetOption<uint32>("LoadBot.Battleground.TypeId", 0);
+    config.LatencyInterval = std::max<uint32>(
+        100, sConfigMgr->GetOption<uint32>("LoadBot.Latency.Interval", 1000));
+    config.ServerInfoInterval =
+        sConfigMgr->GetOption<uint32>("LoadBot.ServerInfo.Interval", 10000);
+    return config;
+}
+
+variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile)
+{
+    options_description all("Allowed options");
+    all.add_options()("help,h", "print usage message")(
+        "config,c",
+        value<fs::path>(&configFile)
+            ->default_value(fs::path(sConfigMgr->GetConfigPath() +
+                                     std::string(_ACORE_LOAD_BOT_CONFIG))),
+        "use <arg> as configuration file");
+
+    variables_map variablesMap;
+
+    try {
+        store(command_line_parser(argc, argv)
+                  .options(all)
+                  .allow_unregistered()
+                  .run(),
+              variablesMap);
+        notify(variablesMap);
+    }
+    catch (std::exception const& e) {
+        std::cerr << e.what() << "\n";
+    }
+
+    if (variablesMap.count("help")) {
+        std::cout << all << "\n";
+    }
+
+    return variablesMap;
+}
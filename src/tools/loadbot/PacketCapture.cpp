@@ -0,0 +1,151 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketCapture.h"
+#include "ByteBuffer.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include <fstream>
+#include <iterator>
+#include <map>
+
+namespace {
+// see LogHeader and PacketHeader in PacketLog.cpp of the worldserver
+uint32 constexpr CAPTURE_CLIENT_TO_SERVER      = 0x47534d43; // "CMSG"
+std::size_t constexpr CAPTURE_SESSION_KEY_SIZE = 40;
+std::size_t constexpr CAPTURE_SOCKET_IP_SIZE   = 16;
+
+// answered or sent by the bot itself, replaying them would only confuse the
+// server about the connection state
+bool IsConnectionOpcode(uint32 opcode)
+{
+    switch (opcode) {
+    case CMSG_AUTH_SESSION:
+    case CMSG_PLAYER_LOGIN:
+    case CMSG_PING:
+    case CMSG_KEEP_ALIVE:
+    case CMSG_TIME_SYNC_RESP:
+        return true;
+    default:
+        return false;
+    }
+}
+} // namespace
+
+bool PacketCapture::Load(std::string const& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file) {
+        LOG_ERROR("loadbot", "Cannot open packet capture {}", fileName);
+        return false;
+    }
+
+    std::vector<uint8> const content{std::istreambuf_iterator<char>(file),
+                                     std::istreambuf_iterator<char>()};
+
+    ByteBuffer capture;
+    capture.append(content.data(), content.size());
+
+    // connections are told apart by the remote address and port
+    struct Connection {
+        std::size_t Stream;
+        uint32      LoginTicks;
+    };
+    std::map<std::pair<std::string, uint32>, Connection> connections;
+
+    try {
+        std::string signature(3, '\0');
+        capture.read(reinterpret_cast<uint8*>(signature.data()), 3);
+
+        uint16 formatVersion;
+        capture >> formatVersion;
+        if (signature != "PKT" || formatVersion != 0x0301) {
+            LOG_ERROR("loadbot", "{} is not a PKT 3.1 capture", fileName);
+            return false;
+        }
+
+        uint32 optionalDataSize;
+        capture.read_skip<uint8>();  // sniffer id
+        capture.read_skip<uint32>(); // build
+        capture.read_skip(4);        // locale
+        capture.read_skip(CAPTURE_SESSION_KEY_SIZE);
+        capture >> _startTime;
+        capture.read_skip<uint32>(); // start ticks
+        capture >> optionalDataSize;
+        capture.read_skip(optionalDataSize);
+
+        while (capture.rpos() < capture.size()) {
+            uint32 direction, ticks, length, opcode;
+            capture >> direction;
+            capture.read_skip<uint32>(); // connection id, always 0
+            capture >> ticks >> optionalDataSize >> length;
+
+            std::string ip(CAPTURE_SOCKET_IP_SIZE, '\0');
+            uint32      port = 0;
+            if (optionalDataSize >= CAPTURE_SOCKET_IP_SIZE + 4) {
+                capture.read(reinterpret_cast<uint8*>(ip.data()), ip.size());
+                capture >> port;
+                optionalDataSize -= CAPTURE_SOCKET_IP_SIZE + 4;
+            }
+
+            capture.read_skip(optionalDataSize);
+            capture >> opcode;
+
+            // the length includes the opcode
+            std::vector<uint8> payload(length - 4);
+            if (!payload.empty())
+                capture.read(payload.data(), payload.size());
+
+            if (direction != CAPTURE_CLIENT_TO_SERVER)
+                continue;
+
+            auto itr = connections.find({ip, port});
+            if (itr == connections.end()) {
+                // everything before the character login is the handshake the
+                // bot does on its own
+                if (opcode != CMSG_PLAYER_LOGIN || payload.size() < 8)
+                    continue;
+
+                CapturedStream& stream = _streams.emplace_back();
+                std::memcpy(&stream.CharacterGuid, payload.data(), 8);
+                connections.emplace(std::make_pair(ip, port),
+                                    Connection{_streams.size() - 1, ticks});
+                continue;
+            }
+
+            if (IsConnectionOpcode(opcode))
+                continue;
+
+            _streams[itr->second.Stream].Packets.push_back(
+                {ticks - itr->second.LoginTicks,
+                 uint16(opcode),
+                 std::move(payload)});
+        }
+    }
+    catch (ByteBufferException const&) {
+        LOG_ERROR("loadbot", "Packet capture {} is truncated", fileName);
+        return false;
+    }
+
+    LOG_INFO("loadbot",
+             "Loaded {} sessions from packet capture {}, started at {}",
+             _streams.size(),
+             fileName,
+             _startTime);
+    return true;
+}
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright
+ * information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADBOT_PACKETCAPTURE_H
+#define LOADBOT_PACKETCAPTURE_H
+
+#include "Define.h"
+#include <string>
+#include <vector>
+
+/// Client packets one connection of a capture sent after its character login
+struct CapturedStream {
+    struct Packet {
+        uint32             Offset; // milliseconds after the character login
+        uint16             Opcode;
+        std::vector<uint8> Payload;
+    };
+
+    uint64              CharacterGuid{0};
+    std::vector<Packet> Packets;
+};
+
+/// Reads a capture written by the PacketLogFile option of the worldserver
+/// (PKT 3.1, see PacketLog.cpp) and splits it into one stream per connection
+class PacketCapture {
+public:
+    bool Load(std::string const& fileName);
+
+    std::vector<CapturedStream> const& GetStreams() const { return _streams; }
+
+    // unix time the capture was started at, for Replay.StartTime
+    uint32 GetStartTime() const { return _startTime; }
+
+private:
+    uint32                      _startTime{0};
+    std::vector<CapturedStream> _streams;
+};
+
+#endif
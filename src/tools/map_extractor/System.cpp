@@ -18,11 +18,14 @@
 
 #define _CRT_SECURE_NO_DEPRECATE
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <deque>
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <unordered_map>
 
 #ifdef _WIN32
@@ -56,7 +59,7 @@
 #else
 #define OPEN_FLAGS (O_RDONLY | O_BINARY)
 #endif
-extern ArchiveSet gOpenArchives;
+extern thread_local ArchiveSet gOpenArchives;
 
 // cppcheck-suppress ctuOneDefinitionRuleViolation
 typedef struct {
@@ -94,6 +97,9 @@ float CONF_flat_height_delta_limit =
 float CONF_flat_liquid_delta_limit =
     0.001f; // If max - min less this value - liquid surface is flat
 
+// Number of threads converting map grids, 0 = one per hardware thread
+uint32 CONF_threads = 0;
+
 // List MPQ for extract from
 const char* CONF_mpq_list[] = {
     "common.MPQ",
@@ -165,6 +171,7 @@ void Usage(char* prg)
            "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"
            "-f height stored as int (less map size but lost some accuracy) 1 "
            "by default\n"
+           "-t number of threads converting maps - standard: all cores(0)\n"
            "Example: %s -f 0 -i \"c:\\games\\game\"",
            prg,
            prg);
@@ -178,6 +185,7 @@ void HandleArgs(int argc, char* arg[])
         // o - output path
         // e - extract only MAP(1)/DBC(2) - standard both(3)
         // f - use float to int conversion
+        // t - number of map conversion threads
         // h - limit minimum height
         if (arg[c][0] != '-') {
             Usage(arg[0]);
@@ -211,6 +219,15 @@ void HandleArgs(int argc, char* arg[])
                 Usage(arg[0]);
             }
             break;
+        case 't':
+            if (c + 1 < argc) // all ok
+            {
+                CONF_threads = std::max(0, atoi(arg[(c++) + 1]));
+            }
+            else {
+                Usage(arg[0]);
+            }
+            break;
         case 'e':
             if (c + 1 < argc) // all ok
             {
@@ -370,24 +387,24 @@ struct map_liquidHeader {
 float selectUInt8StepStore(float maxDiff) { return 255 / maxDiff; }
 
 float selectUInt16StepStore(float maxDiff) { return 65535 / maxDiff; }
-// Temporary grid data store
-uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+// Temporary grid data store, one per extraction thread
+thread_local uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
 
-float  V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float  V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local float  V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float  V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
 
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8  liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool   liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float  liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8  liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool   liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float  liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
 
-int16 flight_box_max[3][3];
-int16 flight_box_min[3][3];
+thread_local int16 flight_box_max[3][3];
+thread_local int16 flight_box_min[3][3];
 
 bool ConvertADT(std::string const& inputPath,
                 std::string const& outputPath,
@@ -930,10 +947,18 @@ bool ConvertADT(std::string const& inputPath,
     return true;
 }
 
-void ExtractMapsFromMpq(uint32 build)
+void        LoadLocaleMPQFiles(int const locale);
+void        LoadCommonMPQFiles();
+inline void CloseMPQFiles();
+
+struct ADTJob {
+    uint32 mapIndex;
+    uint32 x;
+    uint32 y;
+};
+
+void ExtractMapsFromMpq(uint32 build, int locale)
 {
-    std::string mpqFileName;
-    std::string outputFileName;
     std::string mpqMapName;
 
     printf("Extracting maps...\n");
@@ -946,12 +971,9 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
-    printf("Convert map files\n");
+    printf("Collect map grids\n");
+    std::vector<ADTJob> jobs;
     for (uint32 z = 0; z < map_count; ++z) {
-        printf("Extract %s (%d/%u)                  \n",
-               map_ids[z].name,
-               z + 1,
-               map_count);
         // Loadup map grid data
         mpqMapName = Acore::StringFormat(
             R"(World\Maps\%s\%s.wdt)", map_ids[z].name, map_ids[z].name);
@@ -962,28 +984,73 @@ void ExtractMapsFromMpq(uint32 build)
             continue;
         }
 
-        for (uint32 y = 0; y < WDT_MAP_SIZE; ++y) {
-            for (uint32 x = 0; x < WDT_MAP_SIZE; ++x) {
-                if (!wdt.main->adt_list[y][x].exist)
-                    continue;
-                mpqFileName =
-                    Acore::StringFormat(R"(World\Maps\%s\%s_%u_%u.adt)",
-                                        map_ids[z].name,
-                                        map_ids[z].name,
-                                        x,
-                                        y);
-                outputFileName = Acore::StringFormat("%s/maps/%03u%02u%02u.map",
-                                                     output_path,
-                                                     map_ids[z].id,
-                                                     y,
-                                                     x);
-                ConvertADT(mpqFileName, outputFileName, y, x, build);
-            }
+        for (uint32 y = 0; y < WDT_MAP_SIZE; ++y)
+            for (uint32 x = 0; x < WDT_MAP_SIZE; ++x)
+                if (wdt.main->adt_list[y][x].exist)
+                    jobs.push_back({z, x, y});
+    }
+
+    uint32 threads = CONF_threads;
+    if (!threads)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<uint32>(threads, std::max<size_t>(jobs.size(), 1));
+
+    printf("Convert %u map files using %u threads\n",
+           uint32(jobs.size()),
+           threads);
+
+    std::atomic<size_t> nextJob{0};
+    std::atomic<size_t> jobsDone{0};
+    std::mutex          printLock;
+
+    // libmpq archive handles keep a file position and are not safe to share,
+    // so every worker opens its own set of MPQs
+    auto worker = [&](bool ownArchives) {
+        if (ownArchives) {
+            LoadLocaleMPQFiles(locale);
+            LoadCommonMPQFiles();
+        }
+
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+            ADTJob const& job = jobs[i];
+            std::string   mpqFileName =
+                Acore::StringFormat(R"(World\Maps\%s\%s_%u_%u.adt)",
+                                    map_ids[job.mapIndex].name,
+                                    map_ids[job.mapIndex].name,
+                                    job.x,
+                                    job.y);
+            std::string outputFileName =
+                Acore::StringFormat("%s/maps/%03u%02u%02u.map",
+                                    output_path,
+                                    map_ids[job.mapIndex].id,
+                                    job.y,
+                                    job.x);
+            ConvertADT(mpqFileName, outputFileName, job.y, job.x, build);
+
             // draw progress bar
-            printf("Processing........................%d%%\r",
-                   (100 * (y + 1)) / WDT_MAP_SIZE);
+            size_t done = ++jobsDone;
+            if (done % 64 == 0 || done == jobs.size()) {
+                std::lock_guard<std::mutex> lock(printLock);
+                printf("Processing........................%u%%\r",
+                       uint32(100 * done / jobs.size()));
+                fflush(stdout);
+            }
         }
-    }
+
+        if (ownArchives)
+            CloseMPQFiles();
+    };
+
+    // the calling thread already has the archives open and works as well
+    std::vector<std::thread> workers;
+    for (uint32 i = 1; i < threads; ++i)
+        workers.emplace_back(worker, true);
+
+    worker(false);
+
+    for (std::thread& thread : workers)
+        thread.join();
+
     printf("\n");
 }
 
@@ -1211,7 +1278,7 @@ int main(int argc, char* arg[])
         LoadCommonMPQFiles();
 
         // Extract maps
-        ExtractMapsFromMpq(build);
+        ExtractMapsFromMpq(build, FirstLocale);
 
         // Close MPQs
         CloseMPQFiles();
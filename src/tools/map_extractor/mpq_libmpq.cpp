@@ -20,7 +20,8 @@
 #include <cstdio>
 #include <deque>
 
-ArchiveSet gOpenArchives;
+// each thread reading from the MPQs keeps its own archive handles
+thread_local ArchiveSet gOpenArchives;
 
 MPQArchive::MPQArchive(const char* filename)
 {
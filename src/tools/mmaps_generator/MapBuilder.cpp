@@ -28,6 +28,7 @@
 #include <DetourCommon.h>
 #include <DetourNavMesh.h>
 #include <DetourNavMeshBuilder.h>
+#include <cstdio>
 
 namespace MMAP {
 TileBuilder::TileBuilder(MapBuilder* mapBuilder,
@@ -65,11 +66,14 @@ MapBuilder::MapBuilder(float        maxWalkableAngle,
                        bool         bigBaseUnit,
                        int          mapid,
                        const char*  offMeshFilePath,
-                       unsigned int threads)
+                       unsigned int threads,
+                       unsigned int shardIndex,
+                       unsigned int shardCount)
     :
 
       m_debugOutput(debugOutput), m_offMeshFilePath(offMeshFilePath),
-      m_threads(threads), m_skipContinents(skipContinents),
+      m_threads(threads), m_shardIndex(shardIndex), m_shardCount(shardCount),
+      m_skipContinents(skipContinents),
       m_skipJunkMaps(skipJunkMaps), m_skipBattlegrounds(skipBattlegrounds),
       m_skipLiquid(skipLiquid), m_maxWalkableAngle(maxWalkableAngle),
       m_bigBaseUnit(bigBaseUnit), m_mapid(mapid), m_totalTiles(0u),
@@ -384,7 +388,11 @@ void MapBuilder::buildSingleTile(uint32 mapID, uint32 tileX, uint32 tileY)
         return;
     }
 
-    /// @todo: delete the old tile as the user clearly wants to rebuild it
+    // the user clearly wants to rebuild it, so don't let the existing tile
+    // short-circuit the build
+    char fileName[255];
+    sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
+    std::remove(fileName);
 
     TileBuilder tileBuilder =
         TileBuilder(this, m_skipLiquid, m_bigBaseUnit, m_debugOutput);
@@ -443,6 +451,11 @@ void MapBuilder::buildMap(uint32 mapID)
                mapID,
                (unsigned int)tiles->size());
         for (unsigned int tile : *tiles) {
+            if (!isTileInShard(mapID, tile)) {
+                ++m_totalTilesProcessed;
+                continue;
+            }
+
             uint32 tileX, tileY;
 
             // unpack tile coords
@@ -938,16 +951,20 @@ void TileBuilder::buildMoveMapTile(uint32     mapID,
             break;
         }
 
-        // file output
+        // file output - written to a temporary name and renamed once complete,
+        // so an interrupted build never leaves a partial tile behind that
+        // shouldSkipTile would accept on the next run
         char fileName[255];
+        char tempFileName[260];
         sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
-        FILE* file = fopen(fileName, "wb");
+        sprintf(tempFileName, "%s.tmp", fileName);
+        FILE* file = fopen(tempFileName, "wb");
         if (!file) {
             char message[1024];
             sprintf(message,
                     "[Map %03i] Failed to open %s for writing!\n",
                     mapID,
-                    fileName);
+                    tempFileName);
             perror(message);
             navMesh->removeTile(tileRef, nullptr, nullptr);
             break;
@@ -962,8 +979,13 @@ void TileBuilder::buildMoveMapTile(uint32     mapID,
         fwrite(&header, sizeof(MmapTileHeader), 1, file);
 
         // write data
-        fwrite(navData, sizeof(unsigned char), navDataSize, file);
-        fclose(file);
+        size_t written =
+            fwrite(navData, sizeof(unsigned char), navDataSize, file);
+        if (fclose(file) != 0 || written != size_t(navDataSize) ||
+            std::rename(tempFileName, fileName) != 0) {
+            printf("%s Failed writing %s!\n", tileString, fileName);
+            std::remove(tempFileName);
+        }
 
         // now that tile is written to disk, we can unload it
         navMesh->removeTile(tileRef, nullptr, nullptr);
@@ -1103,6 +1125,20 @@ bool MapBuilder::isContinentMap(uint32 mapID) const
     }
 }
 
+/**************************************************************************/
+bool MapBuilder::isTileInShard(uint32 mapID, uint32 tileID) const
+{
+    if (m_shardCount <= 1)
+        return true;
+
+    uint32 tileX, tileY;
+    StaticMapTree::unpackTileID(tileID, tileX, tileY);
+
+    // interleave tiles instead of handing out whole maps, so that every
+    // shard gets a similar share of the big continents
+    return ((mapID * 64 + tileX) * 64 + tileY) % m_shardCount == m_shardIndex;
+}
+
 /**************************************************************************/
 bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
 {
@@ -1114,10 +1150,16 @@ bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
 
     MmapTileHeader header;
     int            count = fread(&header, sizeof(MmapTileHeader), 1, file);
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
     fclose(file);
     if (count != 1)
         return false;
 
+    // a truncated tile has to be rebuilt
+    if (fileSize != long(sizeof(MmapTileHeader) + header.size))
+        return false;
+
     if (header.mmapMagic != MMAP_MAGIC ||
         header.dtVersion != uint32(DT_NAVMESH_VERSION))
         return false;
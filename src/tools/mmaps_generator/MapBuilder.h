@@ -153,7 +153,9 @@ public:
                bool         bigBaseUnit,
                int          mapid,
                char const*  offMeshFilePath,
-               unsigned int threads);
+               unsigned int threads,
+               unsigned int shardIndex,
+               unsigned int shardCount);
 
     ~MapBuilder();
 
@@ -188,6 +190,8 @@ private:
                        uint32& maxY) const;
 
     bool shouldSkipMap(uint32 mapID) const;
+    // true if the tile belongs to the shard this process was asked to build
+    bool isTileInShard(uint32 mapID, uint32 tileID) const;
     bool isTransportMap(uint32 mapID) const;
     bool isContinentMap(uint32 mapID) const;
 
@@ -206,6 +210,8 @@ private:
 
     const char*  m_offMeshFilePath;
     unsigned int m_threads;
+    unsigned int m_shardIndex;
+    unsigned int m_shardCount;
     bool         m_skipContinents;
     bool         m_skipJunkMaps;
     bool         m_skipBattlegrounds;
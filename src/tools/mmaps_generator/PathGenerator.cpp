@@ -75,7 +75,9 @@ bool handleArgs(int           argc,
                 bool&         bigBaseUnit,
                 char*&        offMeshInputPath,
                 char*&        file,
-                unsigned int& threads)
+                unsigned int& threads,
+                unsigned int& shardIndex,
+                unsigned int& shardCount)
 {
     char* param = nullptr;
     for (int i = 1; i < argc; ++i) {
@@ -96,6 +98,28 @@ bool handleArgs(int           argc,
                 return false;
             threads = static_cast<unsigned int>(std::max(0, atoi(param)));
         }
+        else if (strcmp(argv[i], "--shard") == 0) {
+            param = argv[++i];
+            if (!param)
+                return false;
+
+            // <index>/<count>, e.g. 0/4 .. 3/4 to split a build over four
+            // machines sharing the same mmaps directory
+            char* sindex = strtok(param, "/");
+            char* scount = strtok(nullptr, "/");
+            if (!sindex || !scount)
+                return false;
+
+            int index = atoi(sindex);
+            int count = atoi(scount);
+            if (count < 1 || index < 0 || index >= count) {
+                printf("invalid option for '--shard'\n");
+                return false;
+            }
+
+            shardIndex = uint32(index);
+            shardCount = uint32(count);
+        }
         else if (strcmp(argv[i], "--file") == 0) {
             param = argv[++i];
             if (!param)
@@ -233,7 +257,8 @@ int finish(const char* message, int returnValue)
 
 int main(int argc, char** argv)
 {
-    unsigned int threads = std::thread::hardware_concurrency();
+    unsigned int threads    = std::thread::hardware_concurrency();
+    unsigned int shardIndex = 0, shardCount = 1;
     int          mapnum  = -1;
     int          tileX = -1, tileY = -1;
     float        maxAngle = 60.0f;
@@ -258,7 +283,9 @@ int main(int argc, char** argv)
                                  bigBaseUnit,
                                  offMeshInputPath,
                                  file,
-                                 threads);
+                                 threads,
+                                 shardIndex,
+                                 shardCount);
 
     if (!validParam)
         return silent ? -1
@@ -288,7 +315,9 @@ int main(int argc, char** argv)
                        bigBaseUnit,
                        mapnum,
                        offMeshInputPath,
-                       threads);
+                       threads,
+                       shardIndex,
+                       shardCount);
 
     uint32 start = getMSTime();
     if (file)